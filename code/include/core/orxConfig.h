@@ -145,6 +145,13 @@ extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_ReloadHistory();
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_Save(const orxSTRING _zFileName, orxBOOL _bUseEncryption, const orxCONFIG_SAVE_FUNCTION _pfnSaveCallback);
 
+/** Writes a binary snapshot of the whole config to given file: it can be loaded with orxConfig_Load/orxConfig_LoadFromMemory,
+ * without any parsing, and will be replaced by its text sources if any of them is found to be more recent.
+ * @param[in] _zFileName        File name, if null or empty the default file name will be used
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_SaveBinary(const orxSTRING _zFileName);
+
 /** Copies a file with optional encryption
  * @param[in] _zDstFileName     Name of the destination file
  * @param[in] _zSrcFileName     Name of the source file
@@ -65,6 +65,14 @@ do                                                                  \
   orxEvent_Send(&stEvent);                                          \
 } while(orxFALSE)
 
+#define orxEVENT_POST(TYPE, ID, SENDER, RECIPIENT, PAYLOAD, SIZE)   \
+do                                                                  \
+{                                                                   \
+  orxEVENT stEvent;                                                 \
+  orxEVENT_INIT(stEvent, TYPE, ID, SENDER, RECIPIENT, PAYLOAD);     \
+  orxEvent_Post(&stEvent, SIZE);                                    \
+} while(orxFALSE)
+
 
 /** Event type enum
  */
@@ -177,6 +185,19 @@ extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_Send(orxEVENT *_pstEvent);
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_SendShort(orxEVENT_TYPE _eEventType, orxENUM _eEventID);
 
+/** Posts an event: it will be sent during the next call to orxEvent_Flush, grouped with all the other posted events of the same type, in posting order
+ * This function can be called from any thread. The payload gets copied, however sender & recipient handles need to remain valid till the event is sent
+ * @param[in] _pstEvent             Event to post
+ * @param[in] _u32PayloadSize       Size of the payload to copy, 0 to keep the payload pointer as is
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_Post(const orxEVENT *_pstEvent, orxU32 _u32PayloadSize);
+
+/** Sends all the posted events, grouped by type, events posted during the flush will be sent by the next one (called once per frame by the main loop, main thread only)
+ * @return Number of sent events
+ */
+extern orxDLLAPI orxU32 orxFASTCALL     orxEvent_Flush();
+
 /** Is currently sending an event?
  * @return orxTRUE / orxFALSE
  */
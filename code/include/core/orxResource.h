@@ -81,6 +81,42 @@ typedef struct __orxRESOURCE_TYPE_INFO_t
 
 } orxRESOURCE_TYPE_INFO;
 
+
+/** Pack archive format, used by the built-in "pack" resource type (cf. tools/orxPack), all values are stored little-endian
+ * Layout: header | entry list, sorted by name CRC | name block (NULL-terminated names) | data (each entry aligned on orxRESOURCE_KU32_PACK_DATA_ALIGNMENT)
+ */
+#define orxRESOURCE_KU32_PACK_MAGIC                       0x4B41504F  /**< 'OPAK' */
+#define orxRESOURCE_KU32_PACK_VERSION                     1
+#define orxRESOURCE_KU32_PACK_DATA_ALIGNMENT              16
+
+#define orxRESOURCE_KU32_PACK_ENTRY_FLAG_NONE             0x00000000  /**< Stored as-is */
+#define orxRESOURCE_KU32_PACK_ENTRY_FLAG_COMPRESSED       0x00000001  /**< Stored as a single LZ4 block */
+
+/** Pack header
+ */
+typedef struct __orxRESOURCE_PACK_HEADER_t
+{
+  orxU32                        u32Magic;                 /**< Magic number : 4 */
+  orxU32                        u32Version;               /**< Format version : 8 */
+  orxU32                        u32EntryCount;            /**< Number of entries : 12 */
+  orxU32                        u32NameSize;              /**< Size of the name block : 16 */
+
+} orxRESOURCE_PACK_HEADER;
+
+/** Pack entry
+ */
+typedef struct __orxRESOURCE_PACK_ENTRY_t
+{
+  orxU64                        u64Offset;                /**< Data offset, from the start of the archive : 8 */
+  orxU32                        u32NameCRC;               /**< CRC of the name, as computed by orxString_ToCRC : 12 */
+  orxU32                        u32NameOffset;            /**< Name offset, from the start of the name block : 16 */
+  orxU32                        u32Size;                  /**< Size of the resource : 20 */
+  orxU32                        u32StoredSize;            /**< Size of the stored data : 24 */
+  orxU32                        u32Flags;                 /**< Entry flags : 28 */
+  orxU32                        u32Reserved;              /**< Reserved, should be 0 : 32 */
+
+} orxRESOURCE_PACK_ENTRY;
+
 /** Event enum
  */
 typedef enum __orxRESOURCE_EVENT_t
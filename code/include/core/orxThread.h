@@ -67,6 +67,9 @@ typedef struct __orxTHREAD_SEMAPHORE_t                orxTHREAD_SEMAPHORE;
 /** Thread run function type */
 typedef orxSTATUS (orxFASTCALL *orxTHREAD_FUNCTION)(void *_pContext);
 
+/** Thread parallel function type, called on chunks of a range: [_u32Start, _u32End[ */
+typedef orxSTATUS (orxFASTCALL *orxTHREAD_PARALLEL_FUNCTION)(orxU32 _u32Start, orxU32 _u32End, void *_pContext);
+
 
 /** Thread module setup
  */
@@ -150,7 +153,7 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_SignalSemaphore(
 
 
 /** Runs an asynchronous task and optional follow-ups
- * @param[in]   _pfnRun                               Asynchronous task to run, executed on a different thread dedicated to tasks, if orxNULL defaults to an empty task that always succeed
+ * @param[in]   _pfnRun                               Asynchronous task to run, executed on a worker thread, only after all the previously submitted ordered tasks have completed, if orxNULL defaults to an empty task that always succeed
  * @param[in]   _pfnThen                              Executed (on the main thread) if Run does *not* return orxSTATUS_FAILURE, can be orxNULL
  * @param[in]   _pfnElse                              Executed (on the main thread) if Run returns orxSTATUS_FAILURE, can be orxNULL
  * @param[in]   _pContext                             Context that will be transmitted to all the task functions
@@ -158,11 +161,32 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_SignalSemaphore(
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_RunTask(const orxTHREAD_FUNCTION _pfnRun, const orxTHREAD_FUNCTION _pfnThen, const orxTHREAD_FUNCTION _pfnElse, void *_pContext);
 
+/** Runs an asynchronous task that can be executed concurrently with any other task, and optional follow-ups
+ * Follow-ups of all tasks (ordered or not) are still executed on the main thread, in submission order
+ * @param[in]   _pfnRun                               Asynchronous task to run, executed on any available worker thread, if orxNULL defaults to an empty task that always succeed
+ * @param[in]   _pfnThen                              Executed (on the main thread) if Run does *not* return orxSTATUS_FAILURE, can be orxNULL
+ * @param[in]   _pfnElse                              Executed (on the main thread) if Run returns orxSTATUS_FAILURE, can be orxNULL
+ * @param[in]   _pContext                             Context that will be transmitted to all the task functions
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_RunParallelTask(const orxTHREAD_FUNCTION _pfnRun, const orxTHREAD_FUNCTION _pfnThen, const orxTHREAD_FUNCTION _pfnElse, void *_pContext);
+
 /** Gets number of pending asynchronous tasks awaiting full completion (might pump task notifications if called from main thread)
  * @return      Number of pending asynchronous tasks
  */
 extern orxDLLAPI orxU32 orxFASTCALL                   orxThread_GetTaskCounter();
 
+/** Runs a function over a range, split in chunks that are processed in parallel by the worker threads and the calling thread, and waits for their completion
+ * Chunks can be processed in any order and concurrently: the function must only access data related to its own chunk or protect any shared access
+ * @param[in]   _u32Start                             Start of the range (inclusive)
+ * @param[in]   _u32End                               End of the range (exclusive)
+ * @param[in]   _u32Grain                             Number of items per chunk, 0 for automatic
+ * @param[in]   _pfnRun                               Function to run on each chunk
+ * @param[in]   _pContext                             Context that will be transmitted to the function when called
+ * @return      orxSTATUS_SUCCESS if all the chunks succeeded, orxSTATUS_FAILURE otherwise
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_ParallelFor(orxU32 _u32Start, orxU32 _u32End, orxU32 _u32Grain, const orxTHREAD_PARALLEL_FUNCTION _pfnRun, void *_pContext);
+
 
 #endif /* _orxTHREAD_H_ */
 
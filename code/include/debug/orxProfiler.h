@@ -150,6 +150,23 @@ extern orxDLLAPI void orxFASTCALL                 orxProfiler_Pause(orxBOOL _bPa
 extern orxDLLAPI orxBOOL orxFASTCALL              orxProfiler_IsPaused();
 
 
+/** Enables/disables marker event tracing, used to export timelines with orxProfiler_SaveTrace
+ * @param[in] _bEnable          Enable
+ */
+extern orxDLLAPI void orxFASTCALL                 orxProfiler_EnableTrace(orxBOOL _bEnable);
+
+/** Is marker event tracing enabled?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL              orxProfiler_IsTraceEnabled();
+
+/** Saves all the marker events traced since the last call to orxProfiler_EnableTrace, using the Chrome Trace Event format (JSON), which can be opened with chrome://tracing or Perfetto
+ * @param[in] _zFileName        Name of the file to save
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxProfiler_SaveTrace(const orxSTRING _zFileName);
+
+
 /** Resets all markers (usually called at the end of the frame)
  */
 extern orxDLLAPI void orxFASTCALL                 orxProfiler_ResetAllMarkers();
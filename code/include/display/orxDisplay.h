@@ -123,6 +123,8 @@ typedef struct __orxCHARACTER_GLYPH_t
 
 /** Character map structure
  */
+#define orxCHARACTER_MAP_KU32_DIRECT_TABLE_SIZE 256 /**< Code points below this value (ASCII/Latin-1) are directly indexed */
+
 typedef struct __orxCHARACTER_MAP_t
 {
   orxFLOAT      fCharacterHeight;
@@ -130,8 +132,21 @@ typedef struct __orxCHARACTER_MAP_t
   orxBANK      *pstCharacterBank;
   orxHASHTABLE *pstCharacterTable;
 
+  orxU32        u32Revision;                                /**< Incremented every time the glyphs get updated */
+  const orxCHARACTER_GLYPH *apstDirectTable[orxCHARACTER_MAP_KU32_DIRECT_TABLE_SIZE];
+
 } orxCHARACTER_MAP;
 
+/** Character quad structure: a glyph laid out in text space, as cached by orxText
+ */
+typedef struct __orxCHARACTER_QUAD_t
+{
+  orxFLOAT fX, fY;                                          /**< Top left corner, in text space */
+  orxFLOAT fU, fV;                                          /**< Top left corner, in the font's texture (pixels) */
+  orxFLOAT fWidth;                                          /**< Width */
+
+} orxCHARACTER_QUAD;
+
 /** Bitmap smoothing enum
  */
 typedef enum __orxDISPLAY_SMOOTHING_t
@@ -191,6 +206,7 @@ typedef struct __orxCOLOR_t
 #define orxDISPLAY_KZ_CONFIG_SMOOTH         "Smoothing"
 #define orxDISPLAY_KZ_CONFIG_VSYNC          "VSync"
 #define orxDISPLAY_KZ_CONFIG_DEPTHBUFFER    "DepthBuffer"
+#define orxDISPLAY_KZ_CONFIG_BATCH_SIZE     "BatchSize"
 #define orxDISPLAY_KZ_CONFIG_SHADER_VERSION "ShaderVersion"
 #define orxDISPLAY_KZ_CONFIG_SHADER_EXTENSION_LIST "ShaderExtensionList"
 
@@ -215,6 +231,7 @@ typedef enum __orxDISPLAY_EVENT_t
 {
   orxDISPLAY_EVENT_SET_VIDEO_MODE = 0,
   orxDISPLAY_EVENT_LOAD_BITMAP,
+  orxDISPLAY_EVENT_READ_BITMAP,
 
   orxDISPLAY_EVENT_NUMBER,
 
@@ -249,6 +266,17 @@ typedef struct __orxDISPLAY_EVENT_PAYLOAD_t
       orxU32          u32ID;                                /**< Bitmap (hardware texture) ID : 48 */
 
     } stBitmap;
+
+    struct
+    {
+      const orxU8    *au8Data;                              /**< Bitmap data (4 channels, RGBA), only valid during the event : 52 */
+      orxU32          u32Width;                             /**< Bitmap width : 56 */
+      orxU32          u32Height;                            /**< Bitmap height : 60 */
+      orxU32          u32ID;                                /**< Bitmap (hardware texture) ID, 0 for the screen : 64 */
+      orxU32          u32FilenameID;                        /**< File name ID, when saving, 0 otherwise : 68 */
+      void           *pContext;                             /**< User context : 72 */
+
+    } stBitmapData;
   };
 
 } orxDISPLAY_EVENT_PAYLOAD;
@@ -816,6 +844,27 @@ static orxCOLOR *orxFASTCALL      orxColor_FromHSVToRGB(orxCOLOR *_pstDst, const
   return pstResult;
 }
 
+/** Gets a character's glyph from a character map
+ * @param[in]   _pstMap                 Concerned character map
+ * @param[in]   _u32CharacterCodePoint  Character code point
+ * @return      orxCHARACTER_GLYPH / orxNULL
+ */
+static orxINLINE const orxCHARACTER_GLYPH *orxCharacterMap_GetGlyph(const orxCHARACTER_MAP *_pstMap, orxU32 _u32CharacterCodePoint)
+{
+  const orxCHARACTER_GLYPH *pstResult;
+
+  /* Checks */
+  orxASSERT(_pstMap != orxNULL);
+
+  /* Updates result */
+  pstResult = (_u32CharacterCodePoint < orxCHARACTER_MAP_KU32_DIRECT_TABLE_SIZE)
+              ? _pstMap->apstDirectTable[_u32CharacterCodePoint]
+              : (const orxCHARACTER_GLYPH *)orxHashTable_Get(_pstMap->pstCharacterTable, _u32CharacterCodePoint);
+
+  /* Done! */
+  return pstResult;
+}
+
 /** Gets blend mode from a string
  * @param[in]    _zBlendMode                          String to evaluate
  * @return orxDISPLAY_BLEND_MODE
@@ -875,7 +924,7 @@ extern orxDLLAPI void orxFASTCALL                     orxDisplay_DeleteBitmap(or
  */
 extern orxDLLAPI orxBITMAP *orxFASTCALL               orxDisplay_LoadBitmap(const orxSTRING _zFileName);
 
-/** Saves a bitmap to file
+/** Saves a bitmap to file (the file is written asynchronously)
  * @param[in]   _pstBitmap                            Concerned bitmap
  * @param[in]   _zFileName                            Name of the file where to store the bitmap
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
@@ -949,6 +998,13 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SetBitmapData(o
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber);
 
+/** Requests a bitmap data (RGBA memory format) without stalling: an event of ID orxDISPLAY_EVENT_READ_BITMAP will be sent once the data is available, usually a few frames later (the current content is captured when calling this function)
+ * @param[in]   _pstBitmap                            Concerned bitmap
+ * @param[in]   _pContext                             User context, sent along with the event
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_RequestBitmapData(const orxBITMAP *_pstBitmap, void *_pContext);
+
 /** Sets a bitmap color (lighting/hue)
  * @param[in]   _pstBitmap                            Concerned bitmap
  * @param[in]   _stColor                              Color to apply on the bitmap
@@ -997,6 +1053,18 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_TransformBitmap
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_TransformText(const orxSTRING _zString, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode);
 
+/** Transforms a list of laid out character quads (onto a bitmap), usually cached by orxText_GetQuadList
+ * @param[in]   _astQuadList                          List of quads to display
+ * @param[in]   _u32QuadCounter                       Number of quads
+ * @param[in]   _pstFont                              Font bitmap
+ * @param[in]   _pstMap                               Character map
+ * @param[in]   _pstTransform                         Transformation info (position, scale, rotation, ...)
+ * @param[in]   _eSmoothing                           Bitmap smoothing type
+ * @param[in]   _eBlendMode                           Blend mode
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_TransformCharacterQuads(const orxCHARACTER_QUAD *_astQuadList, orxU32 _u32QuadCounter, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode);
+
 
 /** Draws a line
  * @param[in]   _pvStart                              Start point
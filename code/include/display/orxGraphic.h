@@ -100,6 +100,10 @@
  */
 typedef struct __orxGRAPHIC_t                 orxGRAPHIC;
 
+/** Graphic update callback, called whenever the size or pivot of a graphic changes
+ */
+typedef void (orxFASTCALL *orxGRAPHIC_UPDATE_FUNCTION)(const orxGRAPHIC *_pstGraphic);
+
 
 /** Graphic module setup
  */
@@ -137,6 +141,18 @@ extern orxDLLAPI orxSTATUS orxFASTCALL        orxGraphic_Delete(orxGRAPHIC *_pst
  */
 extern orxDLLAPI const orxSTRING orxFASTCALL  orxGraphic_GetName(const orxGRAPHIC *_pstGraphic);
 
+/** Adds a graphic update callback: it will be called every time a graphic's size or pivot changes
+ * @param[in]   _pfnCallback    Callback to add
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxGraphic_AddUpdateCallback(const orxGRAPHIC_UPDATE_FUNCTION _pfnCallback);
+
+/** Removes a graphic update callback
+ * @param[in]   _pfnCallback    Callback to remove
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxGraphic_RemoveUpdateCallback(const orxGRAPHIC_UPDATE_FUNCTION _pfnCallback);
+
 
 /** Sets graphic data
  * @param[in]   _pstGraphic     Concerned graphic
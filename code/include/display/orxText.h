@@ -111,6 +111,13 @@ extern orxDLLAPI const orxSTRING orxFASTCALL orxText_GetString(const orxTEXT *_p
  */
 extern orxDLLAPI orxFONT *orxFASTCALL     orxText_GetFont(const orxTEXT *_pstText);
 
+/** Gets text quad list: all its glyphs, laid out in text space, rebuilt only when its string, its font or the font's map change
+ * @param[in]   _pstText      Concerned text
+ * @param[out]  _pu32Counter  Number of quads in the list
+ * @return      Quad list / orxNULL
+ */
+extern orxDLLAPI const orxCHARACTER_QUAD *orxFASTCALL orxText_GetQuadList(orxTEXT *_pstText, orxU32 *_pu32Counter);
+
 
 /** Sets text string
  * @param[in]   _pstText      Concerned text
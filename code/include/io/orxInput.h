@@ -106,6 +106,11 @@ typedef enum __orxINPUT_EVENT_t
 
 } orxINPUT_EVENT;
 
+/** Input handle (opaque), resolved once for an input of a given set
+ */
+typedef struct __orxINPUT_HANDLE_t              orxINPUT_HANDLE;
+
+
 /** Input event payload
  */
 typedef struct __orxINPUT_EVENT_PAYLOAD_t
@@ -191,6 +196,30 @@ extern orxDLLAPI orxBOOL orxFASTCALL              orxInput_HasNewStatus(const or
  */
 extern orxDLLAPI orxFLOAT orxFASTCALL             orxInput_GetValue(const orxSTRING _zInputName);
 
+/** Gets a handle for fast repeated queries of an input of the current set (stays valid across reloads, until the module exits)
+ * @param[in] _zInputName       Concerned input name (in the current working set)
+ * @return orxINPUT_HANDLE / orxNULL
+ */
+extern orxDLLAPI orxINPUT_HANDLE *orxFASTCALL     orxInput_GetHandle(const orxSTRING _zInputName);
+
+/** Is input active (using a handle)?
+ * @param[in] _pstHandle        Concerned input handle
+ * @return orxTRUE if active, orxFALSE otherwise
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL              orxInput_IsActiveFromHandle(orxINPUT_HANDLE *_pstHandle);
+
+/** Has a new active status since this frame (using a handle)?
+ * @param[in] _pstHandle        Concerned input handle
+ * @return orxTRUE if active status is new, orxFALSE otherwise
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL              orxInput_HasNewStatusFromHandle(orxINPUT_HANDLE *_pstHandle);
+
+/** Gets input value (using a handle)
+ * @param[in] _pstHandle        Concerned input handle
+ * @return orxFLOAT
+ */
+extern orxDLLAPI orxFLOAT orxFASTCALL             orxInput_GetValueFromHandle(orxINPUT_HANDLE *_pstHandle);
+
 /** Sets input value (will prevail on peripheral inputs only once)
  * @param[in] _zInputName       Concerned input name
  * @param[in] _fValue           Value to set, orxFLOAT_0 to deactivate
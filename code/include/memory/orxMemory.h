@@ -52,6 +52,10 @@
 #include <string.h>
 
 
+/* *** Uncomment the line below to track memory allocations per call site (file & line) *** */
+//#define __orxMEMORY_TRACKING__
+
+
 #ifdef __orxWINDOWS__
   #ifdef NO_WIN32_LEAN_AND_MEAN
     #undef WIN32_LEAN_AND_MEAN
@@ -149,6 +153,33 @@ extern orxDLLAPI void *orxFASTCALL                        orxMemory_Reallocate(v
 extern orxDLLAPI void orxFASTCALL                         orxMemory_Free(void *_pMem);
 
 
+#ifdef __orxMEMORY_TRACKING__
+
+/** Allocates a portion of memory in the system and returns a pointer on it, recording the allocation site
+ * @param[in]  _u32Size  Size of the memory to allocate
+ * @param[in]  _eMemType Memory zone where data will be allocated
+ * @param[in]  _zFile    Name of the source file of the allocation site, has to remain valid (ie. __FILE__)
+ * @param[in]  _u32Line  Line of the allocation site
+ * @return  returns a pointer on the memory allocated, or orxNULL if an error has occurred
+ */
+extern orxDLLAPI void *orxFASTCALL                        orxMemory_AllocateAt(orxU32 _u32Size, orxMEMORY_TYPE _eMemType, const orxSTRING _zFile, orxU32 _u32Line);
+
+/** Reallocates a previously allocated memory block, with the given new size and returns a pointer on it, recording the allocation site
+ * @param[in]  _pMem      Memory block to reallocate
+ * @param[in]  _u32Size   Size of the memory to allocate
+ * @param[in]  _zFile     Name of the source file of the allocation site, has to remain valid (ie. __FILE__)
+ * @param[in]  _u32Line   Line of the allocation site
+ * @return  returns a pointer to the reallocated memory block or orxNULL if an error has occurred
+ */
+extern orxDLLAPI void *orxFASTCALL                        orxMemory_ReallocateAt(void *_pMem, orxU32 _u32Size, const orxSTRING _zFile, orxU32 _u32Line);
+
+/** Allocation site tracking macros */
+#define orxMemory_Allocate(SIZE, TYPE)                    orxMemory_AllocateAt(SIZE, TYPE, __FILE__, __LINE__)
+#define orxMemory_Reallocate(MEM, SIZE)                   orxMemory_ReallocateAt(MEM, SIZE, __FILE__, __LINE__)
+
+#endif /* __orxMEMORY_TRACKING__ */
+
+
 /** Copies a portion of memory into another one
  * @param[out] _pDest    Destination pointer
  * @param[in]  _pSrc     Pointer of memory from where data are read
@@ -265,6 +296,42 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                    orxMemory_Track(orxMEM
 
 #endif /* __orxPROFILER__  */
 
+#ifdef __orxMEMORY_TRACKING__
+
+/** Gets the number of tracked allocation sites
+ * @return Number of allocation sites, including the unknown one (index 0), used for untracked or overflowing sites
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                       orxMemory_GetSiteCounter();
+
+/** Gets memory usage for a given allocation site
+ * @param[in] _u32SiteIndex           Concerned allocation site index, < orxMemory_GetSiteCounter()
+ * @param[out] _pzFile                Source file of the allocation site
+ * @param[out] _pu32Line              Line of the allocation site
+ * @param[out] _peMemType             Memory type of the allocation site
+ * @param[out] _pu32Counter           Current memory allocation counter
+ * @param[out] _pu32PeakCounter       Peak memory allocation counter
+ * @param[out] _pu32Size              Current memory allocation size
+ * @param[out] _pu32PeakSize          Peak memory allocation size
+ * @param[out] _pu32OperationCounter  Total number of memory operations (malloc/free)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                    orxMemory_GetSiteUsage(orxU32 _u32SiteIndex, const orxSTRING *_pzFile, orxU32 *_pu32Line, orxMEMORY_TYPE *_peMemType, orxU32 *_pu32Counter, orxU32 *_pu32PeakCounter, orxU32 *_pu32Size, orxU32 *_pu32PeakSize, orxU32 *_pu32OperationCounter);
+
+/** Logs the allocation sites currently holding the most memory
+ * @param[in] _u32Number              Number of sites to log, 0 for all of them
+ */
+extern orxDLLAPI void orxFASTCALL                         orxMemory_LogSites(orxU32 _u32Number);
+
+/** Saves a binary snapshot of all the allocation sites
+ * Format (native endianness): orxU32 magic ('OMSS'), orxU32 version, orxU32 site number, then for each site:
+ * orxU32 line, memory type, counter, peak counter, size, peak size, operation counter & file name length, followed by the file name (no terminating null character)
+ * @param[in] _zFileName              Name of the file to save
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                    orxMemory_SaveSiteSnapshot(const orxSTRING _zFileName);
+
+#endif /* __orxMEMORY_TRACKING__ */
+
 #endif /* _orxMEMORY_H_ */
 
 /** @} */
@@ -91,6 +91,10 @@ typedef enum __orxFRAME_SPACE_t
  */
 typedef struct __orxFRAME_t                   orxFRAME;
 
+/** Frame update callback, called whenever the global data of a frame changes
+ */
+typedef void (orxFASTCALL *orxFRAME_UPDATE_FUNCTION)(const orxFRAME *_pstFrame);
+
 
 /** Setups the frame module
  */
@@ -119,6 +123,19 @@ extern orxDLLAPI orxFRAME *orxFASTCALL        orxFrame_Create(orxU32 _u32Flags);
 extern orxDLLAPI orxSTATUS orxFASTCALL        orxFrame_Delete(orxFRAME *_pstFrame);
 
 
+/** Adds a frame update callback: it will be called every time a frame's global data gets invalidated, including when propagated from a parent
+ * @param[in]   _pfnCallback    Callback to add
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxFrame_AddUpdateCallback(const orxFRAME_UPDATE_FUNCTION _pfnCallback);
+
+/** Removes a frame update callback
+ * @param[in]   _pfnCallback    Callback to remove
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxFrame_RemoveUpdateCallback(const orxFRAME_UPDATE_FUNCTION _pfnCallback);
+
+
 /** Sets frame parent
  * @param[in]   _pstFrame       Concerned frame
  * @param[in]   _pstParent      Parent frame to set
@@ -246,6 +246,9 @@ static orxINLINE void orx_Execute(orxU32 _u32NbParams, orxSTRING _azParams[], co
         /* Updates clock system */
         eClockStatus = orxClock_Update();
 
+        /* Sends posted events */
+        orxEvent_Flush();
+
         /* Sends frame stop event */
         orxEVENT_SEND(orxEVENT_TYPE_SYSTEM, orxSYSTEM_EVENT_GAME_LOOP_STOP, orxNULL, orxNULL, &stPayload);
 
@@ -317,6 +320,9 @@ static orxINLINE void orx_Execute(orxU32 _u32NbParams, orxSTRING _azParams[], co
         /* Updates clock system */
         eClockStatus = orxClock_Update();
 
+        /* Sends posted events */
+        orxEvent_Flush();
+
         /* Sends frame stop event */
         orxEVENT_SEND(orxEVENT_TYPE_SYSTEM, orxSYSTEM_EVENT_GAME_LOOP_STOP, orxNULL, orxNULL, &stPayload);
 
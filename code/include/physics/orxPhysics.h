@@ -299,6 +299,25 @@ typedef struct __orxPHYSICS_EVENT_PAYLOAD_t
 
 } orxPHYSICS_EVENT_PAYLOAD;
 
+/** Ray (raycast list input)
+ */
+typedef struct __orxPHYSICS_RAY_t
+{
+  orxVECTOR       vStart;                             /**< Start : 12 */
+  orxVECTOR       vEnd;                               /**< End : 24 */
+
+} orxPHYSICS_RAY;
+
+/** Ray hit (raycast list output)
+ */
+typedef struct __orxPHYSICS_RAY_HIT_t
+{
+  orxVECTOR       vContact;                           /**< Contact position : 12 */
+  orxVECTOR       vNormal;                            /**< Contact normal : 24 */
+  orxHANDLE       hUserData;                          /**< Colliding body's user data / orxHANDLE_UNDEFINED : 28 */
+
+} orxPHYSICS_RAY_HIT;
+
 /** Internal physics body structure
  */
 typedef struct __orxPHYSICS_BODY_t                    orxPHYSICS_BODY;
@@ -657,6 +676,49 @@ extern orxDLLAPI orxFLOAT orxFASTCALL                 orxPhysics_GetJointReactio
  */
 extern orxDLLAPI orxHANDLE orxFASTCALL                orxPhysics_Raycast(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxBOOL _bEarlyExit, orxVECTOR *_pvContact, orxVECTOR *_pvNormal);
 
+/** Issues a list of raycasts, processed in parallel on worker threads, the world must not be modified until it returns
+ * @param[in]   _astRayList                           List of rays to cast
+ * @param[in]   _u32Number                            Number of rays in the list
+ * @param[in]   _u16SelfFlags                         Selfs flags used for filtering (0xFFFF for no filtering)
+ * @param[in]   _u16CheckMask                         Check mask used for filtering (0xFFFF for no filtering)
+ * @param[in]   _bEarlyExit                           Should each ray stop as soon as an object has been hit (which might not be the closest)
+ * @param[out]  _astHitList                           List of hits, one per ray, in the same order, with orxHANDLE_UNDEFINED as user data when nothing has been hit
+ * @return Number of rays that hit a body
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxPhysics_RaycastList(const orxPHYSICS_RAY *_astRayList, orxU32 _u32Number, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxBOOL _bEarlyExit, orxPHYSICS_RAY_HIT *_astHitList);
+
+/** Gets all the physics bodies with a part whose bounding box intersects an axis-aligned box
+ * @param[in]   _pstBox                               Box to test, in world coordinates (Z is ignored)
+ * @param[in]   _u16SelfFlags                         Selfs flags used for filtering (0xFFFF for no filtering)
+ * @param[in]   _u16CheckMask                         Check mask used for filtering (0xFFFF for no filtering)
+ * @param[out]  _ahUserDataList                       List that will receive the found bodies' user data, each body being stored only once
+ * @param[in]   _u32Number                            Size of the list, the query stops once it's full
+ * @return Number of bodies stored in the list
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxPhysics_QueryBox(const orxAABOX *_pstBox, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxHANDLE *_ahUserDataList, orxU32 _u32Number);
+
+/** Gets all the physics bodies with a part that overlaps a sphere (circle)
+ * @param[in]   _pvCenter                             Center of the sphere, in world coordinates (Z is ignored)
+ * @param[in]   _fRadius                              Radius of the sphere
+ * @param[in]   _u16SelfFlags                         Selfs flags used for filtering (0xFFFF for no filtering)
+ * @param[in]   _u16CheckMask                         Check mask used for filtering (0xFFFF for no filtering)
+ * @param[out]  _ahUserDataList                       List that will receive the found bodies' user data, each body being stored only once
+ * @param[in]   _u32Number                            Size of the list, the query stops once it's full
+ * @return Number of bodies stored in the list
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxPhysics_QuerySphere(const orxVECTOR *_pvCenter, orxFLOAT _fRadius, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxHANDLE *_ahUserDataList, orxU32 _u32Number);
+
+/** Gets all the physics bodies with a part that overlaps a convex mesh (polygon)
+ * @param[in]   _avVertexList                         Vertices of the mesh, in world coordinates (Z is ignored)
+ * @param[in]   _u32VertexNumber                      Number of vertices, between 3 and orxBODY_PART_DEF_KU32_MESH_VERTEX_NUMBER
+ * @param[in]   _u16SelfFlags                         Selfs flags used for filtering (0xFFFF for no filtering)
+ * @param[in]   _u16CheckMask                         Check mask used for filtering (0xFFFF for no filtering)
+ * @param[out]  _ahUserDataList                       List that will receive the found bodies' user data, each body being stored only once
+ * @param[in]   _u32Number                            Size of the list, the query stops once it's full
+ * @return Number of bodies stored in the list
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxPhysics_QueryMesh(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxHANDLE *_ahUserDataList, orxU32 _u32Number);
+
 
 /** Enables/disables physics simulation
  * @param[in]   _bEnable                              Enable / disable
@@ -65,12 +65,14 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_t
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SET_BITMAP_COLOR_KEY,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SET_BITMAP_DATA,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_GET_BITMAP_DATA,
+  orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_REQUEST_BITMAP_DATA,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SET_BITMAP_COLOR,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_GET_BITMAP_COLOR,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_GET_BITMAP_SIZE,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_GET_BITMAP_ID,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_TRANSFORM_BITMAP,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_TRANSFORM_TEXT,
+  orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_TRANSFORM_CHARACTER_QUADS,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_DRAW_LINE,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_DRAW_POLYLINE,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_DRAW_POLYGON,
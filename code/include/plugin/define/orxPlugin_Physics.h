@@ -104,6 +104,11 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_t
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_GET_JOINT_REACTION_TORQUE,
 
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_RAYCAST,
+  orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_RAYCAST_LIST,
+
+  orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_QUERY_BOX,
+  orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_QUERY_SPHERE,
+  orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_QUERY_MESH,
 
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_ENABLE_SIMULATION,
 
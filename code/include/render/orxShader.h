@@ -66,6 +66,20 @@ typedef enum __orxSHADER_PARAM_TYPE_t
 
 } orxSHADER_PARAM_TYPE;
 
+/** Shader parameter update mode
+ */
+typedef enum __orxSHADER_PARAM_UPDATE_t
+{
+  orxSHADER_PARAM_UPDATE_CONSTANT = 0,          /**< Uses the parameter's default value, no event is sent */
+  orxSHADER_PARAM_UPDATE_TIME,                  /**< Uses the owner's time, no event is sent (time parameters only) */
+  orxSHADER_PARAM_UPDATE_OWNER,                 /**< Re-evaluated for each owner through an orxSHADER_EVENT_SET_PARAM event */
+
+  orxSHADER_PARAM_UPDATE_NUMBER,
+
+  orxSHADER_PARAM_UPDATE_NONE = orxENUM_NONE
+
+} orxSHADER_PARAM_UPDATE;
+
 
 /** Shader parameter structure
  */
@@ -75,6 +89,7 @@ typedef struct __orxSHADER_PARAM_t
   orxSHADER_PARAM_TYPE  eType;                  /**< Parameter type : 16 */
   const orxSTRING       zName;                  /**< Parameter literal name : 20 */
   orxU32                u32ArraySize;           /**< Parameter array size : 24 */
+  orxSHADER_PARAM_UPDATE eUpdate;               /**< Parameter update mode : 28 */
 
 } orxSHADER_PARAM;
 
@@ -227,6 +242,21 @@ extern orxDLLAPI orxSTATUS orxFASTCALL          orxShader_SetTextureParam(orxSHA
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL          orxShader_SetVectorParam(orxSHADER *_pstShader, const orxSTRING _zName, orxU32 _u32ArraySize, const orxVECTOR *_avValueList);
 
+/** Sets how a parameter gets evaluated when the shader is started (parameters need to be added beforehand and this needs to be set before compiling the shader code)
+ * @param[in] _pstShader              Concerned Shader
+ * @param[in] _zName                  Parameter's literal name
+ * @param[in] _eUpdate                Update mode: orxSHADER_PARAM_UPDATE_TIME is only valid for time parameters, orxSHADER_PARAM_UPDATE_CONSTANT for all the others
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL          orxShader_SetParamUpdate(orxSHADER *_pstShader, const orxSTRING _zName, orxSHADER_PARAM_UPDATE _eUpdate);
+
+/** Gets how a parameter gets evaluated when the shader is started
+ * @param[in] _pstShader              Concerned Shader
+ * @param[in] _zName                  Parameter's literal name
+ * @return orxSHADER_PARAM_UPDATE / orxSHADER_PARAM_UPDATE_NONE if the parameter can't be found
+ */
+extern orxDLLAPI orxSHADER_PARAM_UPDATE orxFASTCALL orxShader_GetParamUpdate(const orxSHADER *_pstShader, const orxSTRING _zName);
+
 /** Sets shader code & compiles it (parameters need to be set before compiling the shader code)
  * @param[in] _pstShader              Concerned Shader
  * @param[in] _azCodeList             List of shader codes to compile (parameters need to be set beforehand), will be processed in order
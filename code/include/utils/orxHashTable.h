@@ -52,6 +52,7 @@ typedef struct __orxHASHTABLE_t orxHASHTABLE;
 /* Define flags */
 #define orxHASHTABLE_KU32_FLAG_NONE             0x00000000  /**< No flags (default behaviour) */
 #define orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE   0x00000001  /**< The Hash table will not be expandable */
+#define orxHASHTABLE_KU32_FLAG_CHAINED          0x00000002  /**< The Hash table will use bank-allocated cells chained in a fixed number of buckets instead of open addressing */
 
 
 /** @name HashTable creation/destruction.
@@ -61,6 +62,7 @@ typedef struct __orxHASHTABLE_t orxHASHTABLE;
  * @param[in] _u32Flags    Flags used by the hash table
  * @param[in] _eMemType    Memory type to use
  * @return Returns the hashtable pointer or orxNULL if failed.
+ * @note Chained hash tables (orxHASHTABLE_KU32_FLAG_CHAINED) use _u32NbKey (rounded up to a power of two) as their bucket number and never rehash
  */
 extern orxDLLAPI orxHASHTABLE *orxFASTCALL      orxHashTable_Create(orxU32 _u32NbKey, orxU32 _u32Flags, orxMEMORY_TYPE _eMemType);
 
@@ -96,6 +98,7 @@ extern orxDLLAPI void *orxFASTCALL              orxHashTable_Get(const orxHASHTA
  * @param[in] _pstHashTable   Concerned hashtable
  * @param[in] _u64Key         Key to find
  * @return The bucket associated to the given key if success, orxNULL otherwise
+ * @note The bucket remains valid until a new key gets added to the hashtable
  */
 extern orxDLLAPI void **orxFASTCALL             orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u64Key);
 
@@ -134,6 +137,7 @@ extern orxDLLAPI orxSTATUS orxFASTCALL          orxHashTable_Remove(orxHASHTABLE
  * @param[out]  _pu64Key        Current element key
  * @param[out]  _ppData         Current element data
  * @return Iterator for next element if an element has been found, orxHANDLE_UNDEFINED otherwise
+ * @note Removing items while iterating is safe, adding new keys might reorder the hashtable
  */
 extern orxDLLAPI orxHANDLE orxFASTCALL          orxHashTable_GetNext(const orxHASHTABLE *_pstHashTable, orxHANDLE _hIterator, orxU64 *_pu64Key, void **_ppData);
 /** @} */
@@ -81,12 +81,7 @@
 
 /** Defines
  */
-#define orxSTRING_KU32_CRC_POLYNOMIAL   0xEDB88320U       /**< Using 0x04C11DB7's reverse polynomial for CRC32B */
-
-
-/** CRC Tables (slice-by-8)
- */
-extern orxDLLAPI orxU32 saau32CRCTable[8][256];
+#define orxSTRING_KU32_CRC_POLYNOMIAL   0x82F63B78U       /**< Using 0x1EDC6F41's reverse polynomial for CRC32C (Castagnoli), matching SSE4.2/ARMv8 CRC instructions */
 
 
 /* *** String inlined functions *** */
@@ -1327,91 +1322,13 @@ static orxINLINE orxSTRING                                orxString_UpperCase(or
   return _zString;
 }
 
-/** Continues a CRC with a string one
+/** Continues a CRC with a string one (CRC-32C, hardware accelerated when supported by the CPU)
  * @param[in] _zString        String used to continue the given CRC
  * @param[in] _u32CRC         Base CRC.
  * @param[in] _u32CharNumber  Number of character to process, should be <= orxString_GetLength(_zString)
  * @return The resulting CRC.
  */
-static orxINLINE orxU32                                   orxString_NContinueCRC(const orxSTRING _zString, orxU32 _u32CRC, orxU32 _u32CharNumber)
-{
-  orxU32        u32CRC, u32Length;
-  const orxU8  *pu8;
-
-#ifdef __orxLITTLE_ENDIAN__
-
-#define orxCRC_GET_FIRST(VALUE) VALUE
-#define orxCRC_INDEX_0          0
-#define orxCRC_INDEX_1          1
-#define orxCRC_INDEX_2          2
-#define orxCRC_INDEX_3          3
-#define orxCRC_INDEX_4          4
-#define orxCRC_INDEX_5          5
-#define orxCRC_INDEX_6          6
-#define orxCRC_INDEX_7          7
-
-#else /* __orxLITTLE_ENDIAN__ */
-
-#define orxCRC_GET_FIRST(VALUE) ((VALUE >> 24) | ((VALUE >> 8) & 0x0000FF00) | ((VALUE << 8) & 0x00FF0000) | (VALUE << 24))
-#define orxCRC_INDEX_0          3
-#define orxCRC_INDEX_1          2
-#define orxCRC_INDEX_2          1
-#define orxCRC_INDEX_3          0
-#define orxCRC_INDEX_4          7
-#define orxCRC_INDEX_5          6
-#define orxCRC_INDEX_6          5
-#define orxCRC_INDEX_7          4
-
-#endif /* __orxLITTLE_ENDIAN__ */
-
-  /* Checks */
-  orxASSERT(_zString != orxNULL);
-  orxASSERT(_u32CharNumber <= orxString_GetLength(_zString));
-
-  /* Inits CRC */
-  u32CRC = ~_u32CRC;
-
-  /* For all slices */
-  for(u32Length = _u32CharNumber, pu8 = (const orxU8 *)_zString; u32Length >= 8; u32Length -= 8, pu8 += 8)
-  {
-    orxU32 u32First, u32Second;
-
-    /* Gets the slice's data */
-    orxMemory_Copy(&u32First, pu8, sizeof(orxU32));
-    orxMemory_Copy(&u32Second, pu8 + 4, sizeof(orxU32));
-    u32First ^= orxCRC_GET_FIRST(u32CRC);
-
-    /* Updates the CRC */
-    u32CRC  = saau32CRCTable[orxCRC_INDEX_7][u32First & 0xFF]
-            ^ saau32CRCTable[orxCRC_INDEX_6][(u32First >> 8) & 0xFF]
-            ^ saau32CRCTable[orxCRC_INDEX_5][(u32First >> 16) & 0xFF]
-            ^ saau32CRCTable[orxCRC_INDEX_4][u32First >> 24]
-            ^ saau32CRCTable[orxCRC_INDEX_3][u32Second & 0xFF]
-            ^ saau32CRCTable[orxCRC_INDEX_2][(u32Second >> 8) & 0xFF]
-            ^ saau32CRCTable[orxCRC_INDEX_1][(u32Second >> 16) & 0xFF]
-            ^ saau32CRCTable[orxCRC_INDEX_0][u32Second >> 24];
-  }
-
-  /* For all remaining characters */
-  for(; u32Length != 0; u32Length--, pu8++)
-  {
-    /* Updates the CRC */
-    u32CRC = saau32CRCTable[0][((orxU8)(u32CRC & 0xFF)) ^ *pu8] ^ (u32CRC >> 8);
-  }
-
-#undef orxCRC_GET_FIRST
-#undef orxCRC_INDEX_0
-#undef orxCRC_INDEX_1
-#undef orxCRC_INDEX_2
-#undef orxCRC_INDEX_3
-#undef orxCRC_INDEX_4
-#undef orxCRC_INDEX_5
-#undef orxCRC_INDEX_6
-#undef orxCRC_INDEX_7
-
-  /* Done! */
-  return ~u32CRC;
-}
+extern orxDLLAPI orxU32 orxFASTCALL                       orxString_NContinueCRC(const orxSTRING _zString, orxU32 _u32CRC, orxU32 _u32CharNumber);
 
 /** Continues a CRC with a string one
  * @param[in] _zString        String used to continue the given CRC
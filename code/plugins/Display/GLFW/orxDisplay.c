@@ -84,6 +84,21 @@
 #undef STB_IMAGE_WRITE_IMPLEMENTATION
 
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+
+  #include <xmmintrin.h>
+
+  #define __orxDISPLAY_SSE__
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+  #include <arm_neon.h>
+
+  #define __orxDISPLAY_NEON__
+
+#endif /* __SSE__ || _M_X64 || _M_IX86_FP >= 1 */
+
+
 #ifndef __orxEMBEDDED__
   #ifdef __orxMSVC__
     #pragma message("!!WARNING!! This plugin will only work in non-embedded mode when linked against a *DYNAMIC* version of GLFW!")
@@ -110,6 +125,9 @@
 #define orxDISPLAY_KU32_STATIC_FLAG_NO_RESIZE   0x00000400  /**< No resize flag */
 #define orxDISPLAY_KU32_STATIC_FLAG_IGNORE_RESIZE 0x00000800  /**< Ignore resize event flag */
 #define orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN  0x00001000  /**< Full screen flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_MAP_BUFFER  0x00002000  /**< Map buffer range support flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_PERSISTENT  0x00004000  /**< Persistent buffer mapping support flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_READBACK    0x00008000  /**< Asynchronous readback support flag */
 
 #define orxDISPLAY_KU32_STATIC_MASK_ALL         0xFFFFFFFF  /**< All mask */
 
@@ -117,14 +135,23 @@
 
 #define orxDISPLAY_KU32_BITMAP_FLAG_LOADING     0x00000001  /**< Loading flag */
 #define orxDISPLAY_KU32_BITMAP_FLAG_DELETE      0x00000002  /**< Delete flag */
+#define orxDISPLAY_KU32_BITMAP_FLAG_MODIFIED    0x00000004  /**< Modified flag (content doesn't match its resource anymore) */
+#define orxDISPLAY_KU32_BITMAP_FLAG_RELOAD      0x00000008  /**< Reload flag (content is being restored from its resource) */
+#define orxDISPLAY_KU32_BITMAP_FLAG_QUEUED      0x00000010  /**< Queued flag (reload waiting for an in-flight slot) */
 
 #define orxDISPLAY_KU32_BITMAP_MASK_ALL         0xFFFFFFFF  /**< All mask */
 
 #define orxDISPLAY_KU32_BITMAP_BANK_SIZE        256
 #define orxDISPLAY_KU32_SHADER_BANK_SIZE        64
 
-#define orxDISPLAY_KU32_VERTEX_BUFFER_SIZE      (4 * 2048)  /**< 2048 items batch capacity */
-#define orxDISPLAY_KU32_INDEX_BUFFER_SIZE       (6 * 2048)  /**< 2048 items batch capacity */
+#define orxDISPLAY_KU32_DEFAULT_BATCH_SIZE      8192        /**< Default batch capacity, in items */
+#define orxDISPLAY_KU32_MIN_BATCH_SIZE          2048        /**< Minimum batch capacity, in items (8192 vertices, the former fixed capacity) */
+#define orxDISPLAY_KU32_MAX_BATCH_SIZE          262144      /**< Maximum batch capacity, in items */
+#define orxDISPLAY_KU32_BUFFER_SEGMENT_NUMBER   3           /**< Number of batches in the vertex buffer ring */
+#define orxDISPLAY_KU64_BUFFER_FENCE_TIMEOUT    1000000000  /**< Vertex buffer fence wait timeout, in nanoseconds */
+#define orxDISPLAY_KU32_READBACK_NUMBER         4           /**< Number of in-flight asynchronous readbacks */
+#define orxDISPLAY_KU32_READBACK_LINE_GRAIN     64          /**< Number of lines per chunk when converting readback data in parallel */
+#define orxDISPLAY_KU32_RELOAD_NUMBER           4           /**< Number of in-flight asynchronous bitmap reloads after a video mode change */
 #define orxDISPLAY_KU32_SHADER_BUFFER_SIZE      131072
 
 #define orxDISPLAY_KF_BORDER_FIX                0.1f
@@ -225,6 +252,42 @@ typedef struct __orxDISPLAY_SAVE_INFO_t
 
 } orxDISPLAY_SAVE_INFO;
 
+/** Internal bitmap readback structure
+ */
+typedef struct __orxDISPLAY_READBACK_t
+{
+  GLuint  uiBuffer;
+#ifndef __orxMAC__
+  GLsync  hFence;
+#endif /* __orxMAC__ */
+  orxU8  *pu8Buffer;
+  void   *pContext;
+  orxU32  u32ID;
+  orxU32  u32FilenameID;
+  orxU32  u32Width;
+  orxU32  u32Height;
+  orxU32  u32RealWidth;
+  orxU32  u32RealHeight;
+  orxBOOL bScreen;
+  orxBOOL bSave;
+  orxBOOL bPending;
+
+} orxDISPLAY_READBACK;
+
+/** Internal readback copy structure
+ */
+typedef struct __orxDISPLAY_READBACK_COPY_t
+{
+  const orxU8  *pu8Source;
+  orxU8        *pu8Destination;
+  orxU32        u32SrcOffset;
+  orxU32        u32LineSize;
+  orxU32        u32RealLineSize;
+  orxU32        u32Height;
+  orxBOOL       bScreen;
+
+} orxDISPLAY_READBACK_COPY;
+
 /** Internal bitmap load info structure
  */
 typedef struct __orxDISPLAY_LOAD_INFO_t
@@ -257,6 +320,16 @@ typedef struct __orxDISPLAY_PARAM_INFO_t
 
 } orxDISPLAY_PARAM_INFO;
 
+/** Internal uniform info structure
+ */
+typedef struct __orxDISPLAY_UNIFORM_INFO_t
+{
+  GLint                     iLocation;
+  orxBOOL                   bValid;
+  GLfloat                   afValue[3];
+
+} orxDISPLAY_UNIFORM_INFO;
+
 /** Internal shader structure
  */
 typedef struct __orxDISPLAY_SHADER_t
@@ -266,11 +339,13 @@ typedef struct __orxDISPLAY_SHADER_t
   GLint                     iTextureLocation;
   GLint                     iTextureCounter;
   orxS32                    s32ParamCounter;
+  orxS32                    s32UniformCounter;
+  orxS32                    s32UniformNumber;
   orxBOOL                   bPending;
-  orxBOOL                   bUseCustomParam;
   orxSTRING                 zCode;
   orxDISPLAY_TEXTURE_INFO  *astTextureInfoList;
   orxDISPLAY_PARAM_INFO    *astParamInfoList;
+  orxDISPLAY_UNIFORM_INFO  *astUniformInfoList;
 
 } orxDISPLAY_SHADER;
 
@@ -300,7 +375,19 @@ typedef struct __orxDISPLAY_STATIC_t
   GLuint                    uiLastFrameBuffer;
   GLuint                    uiVertexBuffer;
   GLuint                    uiIndexBuffer;
+  GLenum                    eIndexType;
+  orxU32                    u32IndexSize;
   orxS32                    s32BufferIndex;
+  orxS32                    s32BufferSize;
+  orxU32                    u32BufferOffset;
+  orxU32                    u32BufferSegment;
+  orxU32                    u32ReadbackIndex;
+  orxU32                    u32ReloadCounter;
+  orxU32                    u32QueuedReloadCounter;
+  orxDISPLAY_GLFW_VERTEX   *astVertexList;
+  orxDISPLAY_GLFW_VERTEX   *astStagingVertexList;
+  orxDISPLAY_GLFW_VERTEX   *astMappedVertexList;
+  GLvoid                   *pIndexList;
   orxU32                    u32Flags;
   orxU32                    u32Depth;
   orxU32                    u32RefreshRate;
@@ -314,8 +401,10 @@ typedef struct __orxDISPLAY_STATIC_t
   orxBITMAP                *apstDestinationBitmapList[orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER];
   const orxBITMAP          *apstBoundBitmapList[orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER];
   orxDOUBLE                 adMRUBitmapList[orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER];
-  orxDISPLAY_GLFW_VERTEX    astVertexList[orxDISPLAY_KU32_VERTEX_BUFFER_SIZE];
-  GLushort                  au16IndexList[orxDISPLAY_KU32_INDEX_BUFFER_SIZE];
+#ifndef __orxMAC__
+  GLsync                    ahBufferFenceList[orxDISPLAY_KU32_BUFFER_SEGMENT_NUMBER];
+#endif /* __orxMAC__ */
+  orxDISPLAY_READBACK       astReadbackList[orxDISPLAY_KU32_READBACK_NUMBER];
   orxCHAR                   acShaderCodeBuffer[orxDISPLAY_KU32_SHADER_BUFFER_SIZE];
 
 } orxDISPLAY_STATIC;
@@ -354,6 +443,12 @@ PFNGLDELETEBUFFERSARBPROC           glDeleteBuffersARB          = NULL;
 PFNGLBINDBUFFERARBPROC              glBindBufferARB             = NULL;
 PFNGLBUFFERDATAARBPROC              glBufferDataARB             = NULL;
 PFNGLBUFFERSUBDATAARBPROC           glBufferSubDataARB          = NULL;
+PFNGLUNMAPBUFFERARBPROC             glUnmapBufferARB            = NULL;
+PFNGLMAPBUFFERRANGEPROC             glMapBufferRange            = NULL;
+PFNGLBUFFERSTORAGEPROC              glBufferStorage             = NULL;
+PFNGLFENCESYNCPROC                  glFenceSync                 = NULL;
+PFNGLCLIENTWAITSYNCPROC             glClientWaitSync            = NULL;
+PFNGLDELETESYNCPROC                 glDeleteSync                = NULL;
 
 PFNGLGENFRAMEBUFFERSEXTPROC         glGenFramebuffersEXT        = NULL;
 PFNGLDELETEFRAMEBUFFERSEXTPROC      glDeleteFramebuffersEXT     = NULL;
@@ -701,11 +796,52 @@ static orxINLINE void orxDisplay_GLFW_InitExtensions()
 
       /* Updates status flags */
       orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+
+#ifndef __orxMAC__
+
+      /* Can map buffer ranges? */
+      if(glfwExtensionSupported("GL_ARB_map_buffer_range") != GL_FALSE)
+      {
+        /* Loads map buffer extension functions */
+        orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLUNMAPBUFFERARBPROC, glUnmapBufferARB);
+        orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);
+
+        /* Updates status flags */
+        orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_MAP_BUFFER, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+
+        /* Has sync objects? */
+        if(glfwExtensionSupported("GL_ARB_sync") != GL_FALSE)
+        {
+          /* Loads sync extension functions */
+          orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLFENCESYNCPROC, glFenceSync);
+          orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);
+          orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLDELETESYNCPROC, glDeleteSync);
+
+          /* Can persistently map buffers? */
+          if(glfwExtensionSupported("GL_ARB_buffer_storage") != GL_FALSE)
+          {
+            /* Loads buffer storage extension function */
+            orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLBUFFERSTORAGEPROC, glBufferStorage);
+
+            /* Updates status flags */
+            orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_PERSISTENT, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+          }
+
+          /* Can pack pixels into buffers? */
+          if(glfwExtensionSupported("GL_ARB_pixel_buffer_object") != GL_FALSE)
+          {
+            /* Updates status flags */
+            orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_READBACK, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+          }
+        }
+      }
+
+#endif /* __orxMAC__ */
     }
     else
     {
       /* Updates status flags */
-      orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_VBO);
+      orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_VBO | orxDISPLAY_KU32_STATIC_FLAG_MAP_BUFFER | orxDISPLAY_KU32_STATIC_FLAG_PERSISTENT | orxDISPLAY_KU32_STATIC_FLAG_READBACK);
     }
 
     /* Can support shader? */
@@ -890,13 +1026,17 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmapCallback(void *_pCo
       }
     }
 
-    /* Inits payload */
-    stPayload.stBitmap.zLocation      = pstInfo->pstBitmap->zLocation;
-    stPayload.stBitmap.u32FilenameID  = pstInfo->pstBitmap->u32FilenameID;
-    stPayload.stBitmap.u32ID          = (pstInfo->pu8ImageBuffer != orxNULL) ? (orxU32)pstInfo->pstBitmap->uiTexture : orxU32_UNDEFINED;
+    /* Not restoring content after a context loss? */
+    if(!orxFLAG_TEST(pstInfo->pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_RELOAD))
+    {
+      /* Inits payload */
+      stPayload.stBitmap.zLocation      = pstInfo->pstBitmap->zLocation;
+      stPayload.stBitmap.u32FilenameID  = pstInfo->pstBitmap->u32FilenameID;
+      stPayload.stBitmap.u32ID          = (pstInfo->pu8ImageBuffer != orxNULL) ? (orxU32)pstInfo->pstBitmap->uiTexture : orxU32_UNDEFINED;
 
-    /* Sends event */
-    orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_LOAD_BITMAP, pstInfo->pstBitmap, orxNULL, &stPayload);
+      /* Sends event */
+      orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_LOAD_BITMAP, pstInfo->pstBitmap, orxNULL, &stPayload);
+    }
 
     /* Frees image buffer */
     if(pstInfo->pu8ImageBuffer != pstInfo->pu8ImageSource)
@@ -912,8 +1052,15 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmapCallback(void *_pCo
       pstInfo->pu8ImageSource = orxNULL;
     }
 
-    /* Clears loading flag */
-    orxFLAG_SET(pstInfo->pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_NONE, orxDISPLAY_KU32_BITMAP_FLAG_LOADING);
+    /* Was an asynchronous reload? */
+    if(orxFLAG_TEST_ALL(pstInfo->pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING | orxDISPLAY_KU32_BITMAP_FLAG_RELOAD))
+    {
+      /* Frees its in-flight slot */
+      sstDisplay.u32ReloadCounter--;
+    }
+
+    /* Clears loading & reload flags */
+    orxFLAG_SET(pstInfo->pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_NONE, orxDISPLAY_KU32_BITMAP_FLAG_LOADING | orxDISPLAY_KU32_BITMAP_FLAG_RELOAD);
     orxMEMORY_BARRIER();
 
     /* Asked for deletion? */
@@ -1079,8 +1226,15 @@ static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResourc
   if(orxFLAG_TEST(pstInfo->pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
   {
     /* Runs asynchronous task */
-    if(orxThread_RunTask(&orxDisplay_GLFW_DecompressBitmap, orxDisplay_GLFW_DecompressBitmapCallback, orxNULL, (void *)pstInfo) == orxSTATUS_FAILURE)
+    if(orxThread_RunParallelTask(&orxDisplay_GLFW_DecompressBitmap, orxDisplay_GLFW_DecompressBitmapCallback, orxNULL, (void *)pstInfo) == orxSTATUS_FAILURE)
     {
+      /* Was a reload? */
+      if(orxFLAG_TEST(pstInfo->pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_RELOAD))
+      {
+        /* Frees its in-flight slot */
+        sstDisplay.u32ReloadCounter--;
+      }
+
       /* Frees load info */
       orxMemory_Free(pstInfo);
     }
@@ -1150,6 +1304,26 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_SaveBitmapData(void *_pContext)
 }
 
 
+static void orxFASTCALL orxDisplay_GLFW_UseTempBitmap(orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT(sstDisplay.pstTempBitmap != orxNULL);
+
+  /* Uses temp texture & info, keeping its own size */
+  _pstBitmap->uiTexture       = sstDisplay.pstTempBitmap->uiTexture;
+  _pstBitmap->u32RealWidth    = sstDisplay.pstTempBitmap->u32RealWidth;
+  _pstBitmap->u32RealHeight   = sstDisplay.pstTempBitmap->u32RealHeight;
+  _pstBitmap->u32Depth        = sstDisplay.pstTempBitmap->u32Depth;
+  _pstBitmap->fRecRealWidth   = sstDisplay.pstTempBitmap->fRecRealWidth;
+  _pstBitmap->fRecRealHeight  = sstDisplay.pstTempBitmap->fRecRealHeight;
+  _pstBitmap->u32DataSize     = sstDisplay.pstTempBitmap->u32DataSize;
+  orxVector_Copy(&(_pstBitmap->stClip.vTL), &(sstDisplay.pstTempBitmap->stClip.vTL));
+  orxVector_Copy(&(_pstBitmap->stClip.vBR), &(sstDisplay.pstTempBitmap->stClip.vBR));
+
+  /* Done! */
+  return;
+}
+
 static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitmap)
 {
   orxHANDLE hResource;
@@ -1197,23 +1371,18 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitma
           if(s64Size < 0)
           {
             /* Inits bitmap info using temp */
-            _pstBitmap->uiTexture       = sstDisplay.pstTempBitmap->uiTexture;
             _pstBitmap->fWidth          = orxS2F(iWidth);
             _pstBitmap->fHeight         = orxS2F(iHeight);
-            _pstBitmap->u32RealWidth    = sstDisplay.pstTempBitmap->u32RealWidth;
-            _pstBitmap->u32RealHeight   = sstDisplay.pstTempBitmap->u32RealHeight;
-            _pstBitmap->u32Depth        = sstDisplay.pstTempBitmap->u32Depth;
-            _pstBitmap->fRecRealWidth   = sstDisplay.pstTempBitmap->fRecRealWidth;
-            _pstBitmap->fRecRealHeight  = sstDisplay.pstTempBitmap->fRecRealHeight;
-            _pstBitmap->u32DataSize     = sstDisplay.pstTempBitmap->u32DataSize;
-            orxVector_Copy(&(_pstBitmap->stClip.vTL), &(sstDisplay.pstTempBitmap->stClip.vTL));
-            orxVector_Copy(&(_pstBitmap->stClip.vBR), &(sstDisplay.pstTempBitmap->stClip.vBR));
+            orxDisplay_GLFW_UseTempBitmap(_pstBitmap);
 
             /* Updates result */
             eResult = orxSTATUS_SUCCESS;
           }
           else
           {
+            /* Clears asynchronous loading flag */
+            orxFLAG_SET(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_NONE, orxDISPLAY_KU32_BITMAP_FLAG_LOADING);
+
             /* Frees buffer */
             orxMemory_Free(pu8Buffer);
 
@@ -1265,6 +1434,93 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitma
   return eResult;
 }
 
+static void orxFASTCALL orxDisplay_GLFW_ReloadBitmap(orxBITMAP *_pstBitmap)
+{
+  /* Reloads its data from resource (asynchronously if there's a temp bitmap) */
+  if(orxDisplay_GLFW_LoadBitmapData(_pstBitmap) == orxSTATUS_FAILURE)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't reload bitmap <%s> from its resource: an empty texture will be used instead.", _pstBitmap->zLocation);
+
+    /* Clears loading & reload flags */
+    orxFLAG_SET(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_NONE, orxDISPLAY_KU32_BITMAP_FLAG_LOADING | orxDISPLAY_KU32_BITMAP_FLAG_RELOAD);
+
+    /* Tracks video memory */
+    orxMEMORY_TRACK(VIDEO, _pstBitmap->u32DataSize, orxTRUE);
+
+    /* Creates new empty texture */
+    glGenTextures(1, &_pstBitmap->uiTexture);
+    glASSERT();
+    glBindTexture(GL_TEXTURE_2D, _pstBitmap->uiTexture);
+    glASSERT();
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, (GLsizei)_pstBitmap->u32RealWidth, (GLsizei)_pstBitmap->u32RealHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glASSERT();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glASSERT();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glASSERT();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, (_pstBitmap->bSmoothing != orxFALSE) ? GL_LINEAR : GL_NEAREST);
+    glASSERT();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (_pstBitmap->bSmoothing != orxFALSE) ? GL_LINEAR : GL_NEAREST);
+    glASSERT();
+
+    /* Restores previous texture */
+    glBindTexture(GL_TEXTURE_2D, (sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit] != orxNULL) ? sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit]->uiTexture : 0);
+    glASSERT();
+  }
+  /* Asynchronous? */
+  else if(orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
+  {
+    /* Updates in-flight reload counter */
+    sstDisplay.u32ReloadCounter++;
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_UpdateReloads()
+{
+  orxBITMAP *pstBitmap, *pstNextBitmap;
+
+  /* For all bitmaps, while reloads are queued and in-flight slots are available */
+  for(pstBitmap = (orxBITMAP *)orxBank_GetNext(sstDisplay.pstBitmapBank, orxNULL);
+      (pstBitmap != orxNULL) && (sstDisplay.u32QueuedReloadCounter != 0) && (sstDisplay.u32ReloadCounter < orxDISPLAY_KU32_RELOAD_NUMBER);
+      pstBitmap = pstNextBitmap)
+  {
+    /* Gets next bitmap */
+    pstNextBitmap = (orxBITMAP *)orxBank_GetNext(sstDisplay.pstBitmapBank, pstBitmap);
+
+    /* Queued? */
+    if(orxFLAG_TEST(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_QUEUED))
+    {
+      /* Dequeues it */
+      orxFLAG_SET(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_NONE, orxDISPLAY_KU32_BITMAP_FLAG_LOADING | orxDISPLAY_KU32_BITMAP_FLAG_QUEUED);
+      sstDisplay.u32QueuedReloadCounter--;
+
+      /* Asked for deletion? */
+      if(orxFLAG_TEST(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_DELETE))
+      {
+        /* Doesn't own any texture (uses the temp one) */
+        pstBitmap->uiTexture    = 0;
+        pstBitmap->u32DataSize  = 0;
+
+        /* Deletes it */
+        orxFLAG_SET(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_NONE, orxDISPLAY_KU32_BITMAP_FLAG_RELOAD);
+        orxDisplay_DeleteBitmap(pstBitmap);
+      }
+      else
+      {
+        /* Reloads it */
+        orxDisplay_GLFW_ReloadBitmap(pstBitmap);
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 static void orxFASTCALL orxDisplay_GLFW_DeleteBitmapData(orxBITMAP *_pstBitmap)
 {
   orxS32 i;
@@ -1304,6 +1560,7 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_CompileShader(orxDISPLAY_SHADER *_p
 
   GLhandleARB hProgram, hVertexShader, hFragmentShader;
   GLint       iSuccess;
+  orxS32      i;
   orxSTATUS   eResult = orxSTATUS_FAILURE;
 
   /* Creates program */
@@ -1371,6 +1628,13 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_CompileShader(orxDISPLAY_SHADER *_p
         _pstShader->hProgram        = hProgram;
         _pstShader->iTextureCounter = 0;
 
+        /* For all uniforms */
+        for(i = 0; i < _pstShader->s32UniformCounter; i++)
+        {
+          /* Invalidates its shadow value as the new program starts with default values */
+          _pstShader->astUniformInfoList[i].bValid = orxFALSE;
+        }
+
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
       }
@@ -1463,157 +1727,1007 @@ static void orxFASTCALL orxDisplay_GLFW_InitShader(orxDISPLAY_SHADER *_pstShader
   return;
 }
 
-static void orxFASTCALL orxDisplay_GLFW_DrawArrays()
+static void orxFASTCALL orxDisplay_GLFW_DeleteBuffers()
 {
-  /* Has data? */
-  if(sstDisplay.s32BufferIndex > 0)
+  /* Has VBO support? */
+  if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
   {
-    GLvoid *pIndexContext;
-
-    /* Profiles */
-    orxPROFILER_PUSH_MARKER("orxDisplay_DrawArrays");
-
-    /* Has VBO support? */
-    if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
-    {
-      /* No offset in the index list */
-      pIndexContext = (GLvoid *)0;
+#ifndef __orxMAC__
 
-      /* Copies vertex buffer */
-      glBufferSubDataARB(GL_ARRAY_BUFFER_ARB, 0, sstDisplay.s32BufferIndex * sizeof(orxDISPLAY_GLFW_VERTEX), sstDisplay.astVertexList);
-      glASSERT();
-    }
-    else
-    {
-      /* Uses client-side index list */
-      pIndexContext = (GLvoid *)&(sstDisplay.au16IndexList);
-    }
+    orxU32 i;
 
-    /* Has active shaders? */
-    if(orxLinkList_GetCounter(&(sstDisplay.stActiveShaderList)) > 0)
+    /* For all buffer segments */
+    for(i = 0; i < orxDISPLAY_KU32_BUFFER_SEGMENT_NUMBER; i++)
     {
-      orxDISPLAY_SHADER *pstShader, *pstNextShader;
-
-      /* For all active shaders */
-      for(pstShader = (orxDISPLAY_SHADER *)orxLinkList_GetFirst(&(sstDisplay.stActiveShaderList));
-          pstShader != orxNULL;
-          pstShader = pstNextShader)
+      /* Has pending fence? */
+      if(sstDisplay.ahBufferFenceList[i] != NULL)
       {
-        /* Inits shader */
-        orxDisplay_GLFW_InitShader(pstShader);
-
-        /* Draws elements */
-        glDrawElements(GL_TRIANGLE_STRIP, (GLsizei)(sstDisplay.s32BufferIndex + (sstDisplay.s32BufferIndex >> 1)), GL_UNSIGNED_SHORT, pIndexContext);
+        /* Deletes it */
+        glDeleteSync(sstDisplay.ahBufferFenceList[i]);
         glASSERT();
+        sstDisplay.ahBufferFenceList[i] = NULL;
+      }
+    }
 
-        /* Gets next shader */
-        pstNextShader = (orxDISPLAY_SHADER *)orxLinkList_GetNext(&(pstShader->stNode));
-
-        /* Was pending removal? */
-        if(pstShader->bPending != orxFALSE)
-        {
-          /* Clears its texture counter */
-          pstShader->iTextureCounter = 0;
-
-          /* Clears its texture info list */
-          orxMemory_Zero(pstShader->astTextureInfoList, sstDisplay.iTextureUnitNumber * sizeof(orxDISPLAY_TEXTURE_INFO));
-
-          /* Removes its pending status */
-          pstShader->bPending = orxFALSE;
-
-          /* Removes it from active list */
-          orxLinkList_Remove(&(pstShader->stNode));
+    /* Was mapped? */
+    if(sstDisplay.astMappedVertexList != orxNULL)
+    {
+      /* Unmaps it */
+      glUnmapBufferARB(GL_ARRAY_BUFFER_ARB);
+      glASSERT();
+      sstDisplay.astMappedVertexList = orxNULL;
+    }
 
-          /* Updates counter */
-          sstDisplay.s32PendingShaderCounter--;
-        }
-      }
+#endif /* __orxMAC__ */
 
-      /* Has shader support? */
-      if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_SHADER))
-      {
-        /* Uses default shader */
-        orxDisplay_GLFW_StopShader(orxNULL);
-      }
+    /* Had vertex buffer? */
+    if(sstDisplay.uiVertexBuffer != 0)
+    {
+      /* Deletes it */
+      glDeleteBuffersARB(1, &(sstDisplay.uiVertexBuffer));
+      glASSERT();
+      sstDisplay.uiVertexBuffer = 0;
     }
-    else
+
+    /* Had index buffer? */
+    if(sstDisplay.uiIndexBuffer != 0)
     {
-      /* Draws arrays */
-      glDrawElements(GL_TRIANGLE_STRIP, (GLsizei)(sstDisplay.s32BufferIndex + (sstDisplay.s32BufferIndex >> 1)), GL_UNSIGNED_SHORT, pIndexContext);
+      /* Deletes it */
+      glDeleteBuffersARB(1, &(sstDisplay.uiIndexBuffer));
       glASSERT();
+      sstDisplay.uiIndexBuffer = 0;
     }
+  }
 
-    /* Clears buffer index */
-    sstDisplay.s32BufferIndex = 0;
+  /* Had staging vertex list? */
+  if(sstDisplay.astStagingVertexList != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(sstDisplay.astStagingVertexList);
+    sstDisplay.astStagingVertexList = orxNULL;
+  }
 
-    /* Profiles */
-    orxPROFILER_POP_MARKER();
+  /* Had client-side index list? */
+  if(sstDisplay.pIndexList != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(sstDisplay.pIndexList);
+    sstDisplay.pIndexList = orxNULL;
   }
 
+  /* Clears batch */
+  sstDisplay.astVertexList    = orxNULL;
+  sstDisplay.s32BufferIndex   = 0;
+  sstDisplay.u32BufferOffset  = 0;
+  sstDisplay.u32BufferSegment = 0;
+
   /* Done! */
   return;
 }
 
-static void orxFASTCALL orxDisplay_GLFW_PrepareBitmap(const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+static orxSTATUS orxFASTCALL orxDisplay_GLFW_CreateBuffers()
 {
-  orxBOOL bSmoothing;
+  orxU32    u32VertexNumber, u32IndexNumber, i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
-  orxASSERT((_pstBitmap != orxNULL) && (_pstBitmap != sstDisplay.pstScreen));
+  orxASSERT(sstDisplay.s32BufferSize > 0);
+  orxASSERT(sstDisplay.astVertexList == orxNULL);
 
-  /* Has pending shaders? */
-  if(sstDisplay.s32PendingShaderCounter != 0)
-  {
-    /* Draws remaining items */
-    orxDisplay_GLFW_DrawArrays();
+  /* Gets vertex number: the whole ring when using VBO, a single batch otherwise */
+  u32VertexNumber = orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO) ? orxDISPLAY_KU32_BUFFER_SEGMENT_NUMBER * (orxU32)sstDisplay.s32BufferSize : (orxU32)sstDisplay.s32BufferSize;
+  u32IndexNumber  = (u32VertexNumber >> 2) * 6;
 
-    /* Checks */
-    orxASSERT(sstDisplay.s32PendingShaderCounter == 0);
+  /* Can use 16-bit indices? */
+  if(u32VertexNumber <= 0x10000)
+  {
+    /* Updates index type */
+    sstDisplay.eIndexType   = GL_UNSIGNED_SHORT;
+    sstDisplay.u32IndexSize = sizeof(GLushort);
   }
-
-  /* New bitmap? */
-  if(_pstBitmap != sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit])
+  else
   {
-    /* Draws remaining items */
-    orxDisplay_GLFW_DrawArrays();
+    /* Updates index type */
+    sstDisplay.eIndexType   = GL_UNSIGNED_INT;
+    sstDisplay.u32IndexSize = sizeof(GLuint);
+  }
 
-    /* Binds source bitmap */
-    orxDisplay_GLFW_BindBitmap(_pstBitmap);
+  /* Allocates index list */
+  sstDisplay.pIndexList = orxMemory_Allocate(u32IndexNumber * sstDisplay.u32IndexSize, orxMEMORY_TYPE_VIDEO);
 
-    /* Has shader support? */
-    if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_SHADER))
+  /* Success? */
+  if(sstDisplay.pIndexList != orxNULL)
+  {
+    /* 16-bit? */
+    if(sstDisplay.eIndexType == GL_UNSIGNED_SHORT)
     {
-      /* No other shader active? */
-      if(orxLinkList_GetCounter(&(sstDisplay.stActiveShaderList)) == 0)
+      GLushort *au16IndexList, u16Index;
+
+      /* For all indices */
+      for(i = 0, u16Index = 0, au16IndexList = (GLushort *)sstDisplay.pIndexList; i < u32IndexNumber; i += 6, u16Index += 4)
       {
-        /* Updates shader uniform */
-        glUNIFORM(1iARB, sstDisplay.pstDefaultShader->iTextureLocation, sstDisplay.s32ActiveTextureUnit);
+        /* Computes them */
+        au16IndexList[i]      = u16Index;
+        au16IndexList[i + 1]  = u16Index;
+        au16IndexList[i + 2]  = u16Index + 1;
+        au16IndexList[i + 3]  = u16Index + 2;
+        au16IndexList[i + 4]  = u16Index + 3;
+        au16IndexList[i + 5]  = u16Index + 3;
       }
     }
-  }
-
-  /* Depending on smoothing type */
-  switch(_eSmoothing)
-  {
-    case orxDISPLAY_SMOOTHING_ON:
+    else
     {
-      /* Applies smoothing */
-      bSmoothing = orxTRUE;
+      GLuint *au32IndexList, u32Index;
 
-      break;
+      /* For all indices */
+      for(i = 0, u32Index = 0, au32IndexList = (GLuint *)sstDisplay.pIndexList; i < u32IndexNumber; i += 6, u32Index += 4)
+      {
+        /* Computes them */
+        au32IndexList[i]      = u32Index;
+        au32IndexList[i + 1]  = u32Index;
+        au32IndexList[i + 2]  = u32Index + 1;
+        au32IndexList[i + 3]  = u32Index + 2;
+        au32IndexList[i + 4]  = u32Index + 3;
+        au32IndexList[i + 5]  = u32Index + 3;
+      }
     }
 
-    case orxDISPLAY_SMOOTHING_OFF:
+    /* Has VBO support? */
+    if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
     {
-      /* Applies no smoothing */
-      bSmoothing = orxFALSE;
-
-      break;
-    }
+      /* Generates index buffer objects (VBO/IBO) */
+      glGenBuffersARB(1, &(sstDisplay.uiVertexBuffer));
+      glASSERT();
+      glGenBuffersARB(1, &(sstDisplay.uiIndexBuffer));
+      glASSERT();
 
-    default:
-    case orxDISPLAY_SMOOTHING_DEFAULT:
-    {
+      /* Binds them */
+      glBindBufferARB(GL_ARRAY_BUFFER_ARB, sstDisplay.uiVertexBuffer);
+      glASSERT();
+      glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, sstDisplay.uiIndexBuffer);
+      glASSERT();
+
+      /* Fills IBO */
+      glBufferDataARB(GL_ELEMENT_ARRAY_BUFFER_ARB, u32IndexNumber * sstDisplay.u32IndexSize, sstDisplay.pIndexList, GL_STATIC_DRAW_ARB);
+      glASSERT();
+
+      /* Frees index list, only needed for client-side rendering */
+      orxMemory_Free(sstDisplay.pIndexList);
+      sstDisplay.pIndexList = orxNULL;
+
+#ifndef __orxMAC__
+
+      /* Can persistently map buffers? */
+      if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_PERSISTENT))
+      {
+        /* Inits immutable VBO storage */
+        glBufferStorage(GL_ARRAY_BUFFER_ARB, u32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX), NULL, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+        glASSERT();
+
+        /* Maps it for good */
+        sstDisplay.astMappedVertexList = (orxDISPLAY_GLFW_VERTEX *)glMapBufferRange(GL_ARRAY_BUFFER_ARB, 0, u32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX), GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+        glASSERT();
+
+        /* Failure? */
+        if(sstDisplay.astMappedVertexList == orxNULL)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't persistently map vertex buffer, falling back to buffer uploads.");
+
+          /* Updates status flags */
+          orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_PERSISTENT);
+
+          /* Re-creates VBO as storage is immutable */
+          glDeleteBuffersARB(1, &(sstDisplay.uiVertexBuffer));
+          glASSERT();
+          glGenBuffersARB(1, &(sstDisplay.uiVertexBuffer));
+          glASSERT();
+          glBindBufferARB(GL_ARRAY_BUFFER_ARB, sstDisplay.uiVertexBuffer);
+          glASSERT();
+        }
+      }
+
+      /* Persistently mapped? */
+      if(sstDisplay.astMappedVertexList != orxNULL)
+      {
+        /* Writes directly in the first batch of the ring */
+        sstDisplay.astVertexList = sstDisplay.astMappedVertexList;
+      }
+      else
+
+#endif /* __orxMAC__ */
+
+      {
+        /* Inits VBO */
+        glBufferDataARB(GL_ARRAY_BUFFER_ARB, u32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX), NULL, GL_STREAM_DRAW_ARB);
+        glASSERT();
+      }
+    }
+
+    /* Not persistently mapped? */
+    if(sstDisplay.astVertexList == orxNULL)
+    {
+      /* Allocates staging vertex list */
+      sstDisplay.astStagingVertexList = (orxDISPLAY_GLFW_VERTEX *)orxMemory_Allocate(sstDisplay.s32BufferSize * sizeof(orxDISPLAY_GLFW_VERTEX), orxMEMORY_TYPE_VIDEO);
+
+      /* Writes in it */
+      sstDisplay.astVertexList = sstDisplay.astStagingVertexList;
+    }
+
+    /* Clears batch */
+    sstDisplay.s32BufferIndex   = 0;
+    sstDisplay.u32BufferOffset  = 0;
+    sstDisplay.u32BufferSegment = 0;
+  }
+
+  /* Failure? */
+  if(sstDisplay.astVertexList == orxNULL)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't allocate vertex/index buffers for a batch size of %d.", sstDisplay.s32BufferSize >> 2);
+
+    /* Deletes partial buffers */
+    orxDisplay_GLFW_DeleteBuffers();
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static orxINLINE void orxDisplay_GLFW_UploadVertices(orxU32 _u32VertexNumber)
+{
+  /* Not persistently mapped? */
+  if(sstDisplay.astVertexList == sstDisplay.astStagingVertexList)
+  {
+#ifndef __orxMAC__
+
+    /* Can map buffer ranges? */
+    if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_MAP_BUFFER))
+    {
+      GLvoid *pBuffer;
+
+      /* Maps the free range of the ring: no need to synchronize as it's not used by any pending draw */
+      pBuffer = glMapBufferRange(GL_ARRAY_BUFFER_ARB, sstDisplay.u32BufferOffset * sizeof(orxDISPLAY_GLFW_VERTEX), _u32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+      glASSERT();
+
+      /* Success? */
+      if(pBuffer != NULL)
+      {
+        /* Copies vertices */
+        orxMemory_Copy(pBuffer, sstDisplay.astStagingVertexList, _u32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX));
+
+        /* Unmaps range */
+        glUnmapBufferARB(GL_ARRAY_BUFFER_ARB);
+        glASSERT();
+      }
+    }
+    else
+
+#endif /* __orxMAC__ */
+
+    {
+      /* Copies vertex buffer */
+      glBufferSubDataARB(GL_ARRAY_BUFFER_ARB, sstDisplay.u32BufferOffset * sizeof(orxDISPLAY_GLFW_VERTEX), _u32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX), sstDisplay.astStagingVertexList);
+      glASSERT();
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_AdvanceBuffer(orxU32 _u32VertexNumber)
+{
+  orxU32  u32Offset, u32SegmentSize;
+  orxBOOL bWrap;
+
+  /* Gets segment size */
+  u32SegmentSize = (orxU32)sstDisplay.s32BufferSize;
+
+  /* Gets next offset, aligned on a quad */
+  u32Offset = (orxU32)orxALIGN(sstDisplay.u32BufferOffset + _u32VertexNumber, 4);
+
+  /* Not enough room left in the ring for a full batch? */
+  if(u32Offset + u32SegmentSize > orxDISPLAY_KU32_BUFFER_SEGMENT_NUMBER * u32SegmentSize)
+  {
+    /* Wraps around */
+    u32Offset = 0;
+    bWrap     = orxTRUE;
+  }
+  else
+  {
+    /* Updates status */
+    bWrap     = orxFALSE;
+  }
+
+  /* Persistently mapped? */
+  if(sstDisplay.astVertexList != sstDisplay.astStagingVertexList)
+  {
+#ifndef __orxMAC__
+
+    orxU32 i, u32Segment, u32LastSegment;
+
+    /* For all the segments left behind */
+    for(u32Segment = (bWrap != orxFALSE) ? orxDISPLAY_KU32_BUFFER_SEGMENT_NUMBER : u32Offset / u32SegmentSize; sstDisplay.u32BufferSegment < u32Segment; sstDisplay.u32BufferSegment++)
+    {
+      /* Checks */
+      orxASSERT(sstDisplay.ahBufferFenceList[sstDisplay.u32BufferSegment] == NULL);
+
+      /* Fences it: it can't be overwritten before all the draws submitted so far are complete */
+      sstDisplay.ahBufferFenceList[sstDisplay.u32BufferSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      glASSERT();
+    }
+
+    /* Updates current segment */
+    sstDisplay.u32BufferSegment = u32Offset / u32SegmentSize;
+
+    /* For all the segments covered by the next batch */
+    for(i = sstDisplay.u32BufferSegment, u32LastSegment = (u32Offset + u32SegmentSize - 1) / u32SegmentSize; i <= u32LastSegment; i++)
+    {
+      /* Has pending fence? */
+      if(sstDisplay.ahBufferFenceList[i] != NULL)
+      {
+        /* Profiles */
+        orxPROFILER_PUSH_MARKER("orxDisplay_WaitBuffer");
+
+        /* Waits for the GPU to be done with it */
+        while(glClientWaitSync(sstDisplay.ahBufferFenceList[i], GL_SYNC_FLUSH_COMMANDS_BIT, orxDISPLAY_KU64_BUFFER_FENCE_TIMEOUT) == GL_TIMEOUT_EXPIRED);
+        glASSERT();
+
+        /* Deletes fence */
+        glDeleteSync(sstDisplay.ahBufferFenceList[i]);
+        glASSERT();
+        sstDisplay.ahBufferFenceList[i] = NULL;
+
+        /* Profiles */
+        orxPROFILER_POP_MARKER();
+      }
+    }
+
+    /* Writes directly in the next batch */
+    sstDisplay.astVertexList = sstDisplay.astMappedVertexList + u32Offset;
+
+#endif /* __orxMAC__ */
+  }
+  /* Wrapped around? */
+  else if(bWrap != orxFALSE)
+  {
+    /* Orphans VBO storage: pending draws keep using the previous one */
+    glBufferDataARB(GL_ARRAY_BUFFER_ARB, orxDISPLAY_KU32_BUFFER_SEGMENT_NUMBER * u32SegmentSize * sizeof(orxDISPLAY_GLFW_VERTEX), NULL, GL_STREAM_DRAW_ARB);
+    glASSERT();
+  }
+
+  /* Stores offset */
+  sstDisplay.u32BufferOffset = u32Offset;
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_DrawArrays()
+{
+  /* Has data? */
+  if(sstDisplay.s32BufferIndex > 0)
+  {
+    GLvoid *pIndexContext;
+
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxDisplay_DrawArrays");
+
+    /* Has VBO support? */
+    if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
+    {
+      /* Gets current batch offset in the index list */
+      pIndexContext = (GLvoid *)(size_t)((sstDisplay.u32BufferOffset >> 2) * 6 * sstDisplay.u32IndexSize);
+
+      /* Uploads vertices */
+      orxDisplay_GLFW_UploadVertices((orxU32)sstDisplay.s32BufferIndex);
+    }
+    else
+    {
+      /* Uses client-side index list */
+      pIndexContext = sstDisplay.pIndexList;
+    }
+
+    /* Has active shaders? */
+    if(orxLinkList_GetCounter(&(sstDisplay.stActiveShaderList)) > 0)
+    {
+      orxDISPLAY_SHADER *pstShader, *pstNextShader;
+
+      /* For all active shaders */
+      for(pstShader = (orxDISPLAY_SHADER *)orxLinkList_GetFirst(&(sstDisplay.stActiveShaderList));
+          pstShader != orxNULL;
+          pstShader = pstNextShader)
+      {
+        /* Inits shader */
+        orxDisplay_GLFW_InitShader(pstShader);
+
+        /* Draws elements */
+        glDrawElements(GL_TRIANGLE_STRIP, (GLsizei)(sstDisplay.s32BufferIndex + (sstDisplay.s32BufferIndex >> 1)), sstDisplay.eIndexType, pIndexContext);
+        glASSERT();
+
+        /* Gets next shader */
+        pstNextShader = (orxDISPLAY_SHADER *)orxLinkList_GetNext(&(pstShader->stNode));
+
+        /* Was pending removal? */
+        if(pstShader->bPending != orxFALSE)
+        {
+          /* Clears its texture counter */
+          pstShader->iTextureCounter = 0;
+
+          /* Clears its texture info list */
+          orxMemory_Zero(pstShader->astTextureInfoList, sstDisplay.iTextureUnitNumber * sizeof(orxDISPLAY_TEXTURE_INFO));
+
+          /* Removes its pending status */
+          pstShader->bPending = orxFALSE;
+
+          /* Removes it from active list */
+          orxLinkList_Remove(&(pstShader->stNode));
+
+          /* Updates counter */
+          sstDisplay.s32PendingShaderCounter--;
+        }
+      }
+
+      /* Has shader support? */
+      if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_SHADER))
+      {
+        /* Uses default shader */
+        orxDisplay_GLFW_StopShader(orxNULL);
+      }
+    }
+    else
+    {
+      /* Draws arrays */
+      glDrawElements(GL_TRIANGLE_STRIP, (GLsizei)(sstDisplay.s32BufferIndex + (sstDisplay.s32BufferIndex >> 1)), sstDisplay.eIndexType, pIndexContext);
+      glASSERT();
+    }
+
+    /* Has VBO support? */
+    if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
+    {
+      /* Moves to the next batch */
+      orxDisplay_GLFW_AdvanceBuffer((orxU32)sstDisplay.s32BufferIndex);
+    }
+
+    /* Clears buffer index */
+    sstDisplay.s32BufferIndex = 0;
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_GLFW_SaveBitmapAsync(orxU8 *_pu8ImageData, orxU32 _u32Width, orxU32 _u32Height, orxU32 _u32FilenameID)
+{
+  orxDISPLAY_SAVE_INFO *pstInfo;
+  orxSTATUS             eResult = orxSTATUS_FAILURE;
+
+  /* Allocates save info */
+  pstInfo = (orxDISPLAY_SAVE_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_SAVE_INFO), orxMEMORY_TYPE_TEMP);
+
+  /* Valid? */
+  if(pstInfo != orxNULL)
+  {
+    /* Inits it */
+    pstInfo->pu8ImageData   = _pu8ImageData;
+    pstInfo->u32FilenameID  = _u32FilenameID;
+    pstInfo->u32Width       = _u32Width;
+    pstInfo->u32Height      = _u32Height;
+
+    /* Runs asynchronous task (encoding & writing) */
+    eResult = orxThread_RunParallelTask(&orxDisplay_GLFW_SaveBitmapData, orxNULL, orxNULL, (void *)pstInfo);
+
+    /* Failure? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Frees save info */
+      orxMemory_Free(pstInfo);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_ReadBitmap(const orxBITMAP *_pstBitmap, orxDISPLAY_READBACK *_pstReadback)
+{
+  orxU8 *pu8Target;
+
+  /* Checks */
+  orxASSERT(_pstReadback->bPending == orxFALSE);
+
+  /* Draws remaining items */
+  orxDisplay_GLFW_DrawArrays();
+
+  /* Stores bitmap info */
+  _pstReadback->u32ID         = (orxU32)_pstBitmap->uiTexture;
+  _pstReadback->u32Width      = orxF2U(_pstBitmap->fWidth);
+  _pstReadback->u32Height     = orxF2U(_pstBitmap->fHeight);
+  _pstReadback->u32RealWidth  = _pstBitmap->u32RealWidth;
+  _pstReadback->u32RealHeight = _pstBitmap->u32RealHeight;
+  _pstReadback->bScreen       = (_pstBitmap == sstDisplay.pstScreen) ? orxTRUE : orxFALSE;
+
+  /* Reads into its memory buffer by default */
+  pu8Target = _pstReadback->pu8Buffer;
+
+#ifndef __orxMAC__
+
+  /* Uses a pixel pack buffer? */
+  if(_pstReadback->uiBuffer != 0)
+  {
+    /* Binds it */
+    glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, _pstReadback->uiBuffer);
+    glASSERT();
+
+    /* Orphans its storage */
+    glBufferDataARB(GL_PIXEL_PACK_BUFFER_ARB, (GLsizeiptrARB)(_pstReadback->u32RealWidth * _pstReadback->u32RealHeight * 4 * sizeof(orxU8)), NULL, GL_STREAM_READ_ARB);
+    glASSERT();
+
+    /* Reads at its beginning */
+    pu8Target = orxNULL;
+  }
+
+#endif /* __orxMAC__ */
+
+  /* Binds bitmap's associated texture */
+  glBindTexture(GL_TEXTURE_2D, _pstBitmap->uiTexture);
+  glASSERT();
+
+  /* Screen capture? */
+  if(_pstBitmap == sstDisplay.pstScreen)
+  {
+    /* Tracks video memory */
+    orxMEMORY_TRACK(VIDEO, sstDisplay.pstScreen->u32DataSize, orxTRUE);
+
+    /* Creates texture for screen backup */
+    glGenTextures(1, &(sstDisplay.pstScreen->uiTexture));
+    glASSERT();
+    glBindTexture(GL_TEXTURE_2D, sstDisplay.pstScreen->uiTexture);
+    glASSERT();
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, (GLsizei)sstDisplay.pstScreen->u32RealWidth, (GLsizei)sstDisplay.pstScreen->u32RealHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glASSERT();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glASSERT();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glASSERT();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, (sstDisplay.pstScreen->bSmoothing != orxFALSE) ? GL_LINEAR : GL_NEAREST);
+    glASSERT();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (sstDisplay.pstScreen->bSmoothing != orxFALSE) ? GL_LINEAR : GL_NEAREST);
+    glASSERT();
+
+    /* Copies screen content */
+    glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, (GLint)(orxF2U(_pstBitmap->fHeight) - _pstBitmap->u32RealHeight), (GLsizei)orxF2U(_pstBitmap->fWidth), (GLsizei)_pstBitmap->u32RealHeight);
+    glASSERT();
+
+    /* Copies bitmap data */
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pu8Target);
+    glASSERT();
+
+    /* Tracks video memory */
+    orxMEMORY_TRACK(VIDEO, sstDisplay.pstScreen->u32DataSize, orxFALSE);
+
+    /* Deletes screen backup texture (its content stays alive until the pending copy is done) */
+    glDeleteTextures(1, &(sstDisplay.pstScreen->uiTexture));
+    glASSERT();
+    sstDisplay.pstScreen->uiTexture = 0;
+  }
+  else
+  {
+    /* Copies bitmap data */
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pu8Target);
+    glASSERT();
+  }
+
+  /* Restores previous texture */
+  glBindTexture(GL_TEXTURE_2D, (sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit] != orxNULL) ? sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit]->uiTexture : 0);
+  glASSERT();
+
+#ifndef __orxMAC__
+
+  /* Uses a pixel pack buffer? */
+  if(_pstReadback->uiBuffer != 0)
+  {
+    /* Unbinds it */
+    glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, 0);
+    glASSERT();
+
+    /* Inserts a fence after the copy */
+    _pstReadback->hFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glASSERT();
+  }
+
+#endif /* __orxMAC__ */
+
+  /* Updates status */
+  _pstReadback->bPending = orxTRUE;
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_GLFW_CopyReadbackLines(orxU32 _u32Start, orxU32 _u32End, void *_pContext)
+{
+  const orxDISPLAY_READBACK_COPY *pstCopy;
+  orxU32                          i;
+
+  /* Gets copy info */
+  pstCopy = (const orxDISPLAY_READBACK_COPY *)_pContext;
+
+  /* Screen? */
+  if(pstCopy->bScreen != orxFALSE)
+  {
+    orxRGBA stOpaque;
+
+    /* Sets opaque pixel */
+    stOpaque = orx2RGBA(0x00, 0x00, 0x00, 0xFF);
+
+    /* For all lines (flipped vertically) */
+    for(i = _u32Start; i < _u32End; i++)
+    {
+      const orxRGBA  *astSrc;
+      orxRGBA        *astDst;
+      orxU32          j, u32Width;
+
+      /* Gets source & destination lines */
+      astSrc    = (const orxRGBA *)(pstCopy->pu8Source + pstCopy->u32SrcOffset + i * pstCopy->u32RealLineSize);
+      astDst    = (orxRGBA *)(pstCopy->pu8Destination + (pstCopy->u32Height - 1 - i) * pstCopy->u32LineSize);
+      u32Width  = pstCopy->u32LineSize / sizeof(orxRGBA);
+
+      /* For all columns */
+      for(j = 0; j < u32Width; j++)
+      {
+        /* Stores opaque pixel */
+        astDst[j].u32RGBA = astSrc[j].u32RGBA | stOpaque.u32RGBA;
+      }
+    }
+  }
+  else
+  {
+    /* For all lines */
+    for(i = _u32Start; i < _u32End; i++)
+    {
+      /* Copies data */
+      orxMemory_Copy(pstCopy->pu8Destination + i * pstCopy->u32LineSize, pstCopy->pu8Source + pstCopy->u32SrcOffset + i * pstCopy->u32RealLineSize, pstCopy->u32LineSize);
+    }
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_ResolveReadback(orxDISPLAY_READBACK *_pstReadback, orxU8 *_au8Data)
+{
+  const orxU8 *pu8Source;
+
+  /* Checks */
+  orxASSERT(_pstReadback->bPending != orxFALSE);
+
+  /* Reads from its memory buffer by default */
+  pu8Source = _pstReadback->pu8Buffer;
+
+#ifndef __orxMAC__
+
+  /* Uses a pixel pack buffer? */
+  if(_pstReadback->uiBuffer != 0)
+  {
+    /* Waits for the copy to be done (no-op if it's already signaled) */
+    glClientWaitSync(_pstReadback->hFence, GL_SYNC_FLUSH_COMMANDS_BIT, orxDISPLAY_KU64_BUFFER_FENCE_TIMEOUT);
+    glASSERT();
+
+    /* Deletes fence */
+    glDeleteSync(_pstReadback->hFence);
+    glASSERT();
+    _pstReadback->hFence = orxNULL;
+
+    /* Has output? */
+    if(_au8Data != orxNULL)
+    {
+      /* Binds buffer */
+      glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, _pstReadback->uiBuffer);
+      glASSERT();
+
+      /* Maps it */
+      pu8Source = (const orxU8 *)glMapBufferRange(GL_PIXEL_PACK_BUFFER_ARB, 0, (GLsizeiptr)(_pstReadback->u32RealWidth * _pstReadback->u32RealHeight * 4 * sizeof(orxU8)), GL_MAP_READ_BIT);
+      glASSERT();
+    }
+  }
+
+#endif /* __orxMAC__ */
+
+  /* Valid and not read in place? */
+  if((_au8Data != orxNULL) && (pu8Source != orxNULL) && ((_pstReadback->bScreen != orxFALSE) || (pu8Source != _au8Data)))
+  {
+    orxDISPLAY_READBACK_COPY stCopy;
+
+    /* Inits copy info */
+    stCopy.pu8Source        = pu8Source;
+    stCopy.pu8Destination   = _au8Data;
+    stCopy.u32LineSize      = _pstReadback->u32Width * 4 * sizeof(orxU8);
+    stCopy.u32RealLineSize  = _pstReadback->u32RealWidth * 4 * sizeof(orxU8);
+    stCopy.u32Height        = _pstReadback->u32Height;
+    stCopy.bScreen          = _pstReadback->bScreen;
+
+    /* Screen's origin is at the bottom of its buffer */
+    stCopy.u32SrcOffset     = (_pstReadback->bScreen != orxFALSE) ? stCopy.u32RealLineSize * (_pstReadback->u32RealHeight - _pstReadback->u32Height) : 0;
+
+    /* Converts all lines, in parallel */
+    orxThread_ParallelFor(0, _pstReadback->u32Height, orxDISPLAY_KU32_READBACK_LINE_GRAIN, orxDisplay_GLFW_CopyReadbackLines, &stCopy);
+  }
+
+#ifndef __orxMAC__
+
+  /* Was mapped? */
+  if((_pstReadback->uiBuffer != 0) && (_au8Data != orxNULL))
+  {
+    /* Unmaps buffer */
+    glUnmapBufferARB(GL_PIXEL_PACK_BUFFER_ARB);
+    glASSERT();
+
+    /* Unbinds it */
+    glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, 0);
+    glASSERT();
+  }
+
+#endif /* __orxMAC__ */
+
+  /* Updates status */
+  _pstReadback->bPending = orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_CompleteReadback(orxDISPLAY_READBACK *_pstReadback)
+{
+  orxU8 *pu8ImageData;
+
+  /* Allocates output buffer */
+  pu8ImageData = (orxU8 *)orxMemory_Allocate(_pstReadback->u32Width * _pstReadback->u32Height * 4 * sizeof(orxU8), orxMEMORY_TYPE_MAIN);
+
+  /* Gets its data (or simply releases it upon allocation failure) */
+  orxDisplay_GLFW_ResolveReadback(_pstReadback, pu8ImageData);
+
+  /* Valid? */
+  if(pu8ImageData != orxNULL)
+  {
+    orxDISPLAY_EVENT_PAYLOAD stPayload;
+
+    /* Inits event payload */
+    orxMemory_Zero(&stPayload, sizeof(orxDISPLAY_EVENT_PAYLOAD));
+    stPayload.stBitmapData.au8Data        = pu8ImageData;
+    stPayload.stBitmapData.u32Width       = _pstReadback->u32Width;
+    stPayload.stBitmapData.u32Height      = _pstReadback->u32Height;
+    stPayload.stBitmapData.u32ID          = (_pstReadback->bScreen != orxFALSE) ? 0 : _pstReadback->u32ID;
+    stPayload.stBitmapData.u32FilenameID  = (_pstReadback->bSave != orxFALSE) ? _pstReadback->u32FilenameID : 0;
+    stPayload.stBitmapData.pContext       = _pstReadback->pContext;
+
+    /* Sends event */
+    orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_READ_BITMAP, orxNULL, orxNULL, &stPayload);
+
+    /* Should save it? */
+    if((_pstReadback->bSave == orxFALSE)
+    || (orxDisplay_GLFW_SaveBitmapAsync(pu8ImageData, _pstReadback->u32Width, _pstReadback->u32Height, _pstReadback->u32FilenameID) == orxSTATUS_FAILURE))
+    {
+      /* Frees buffer */
+      orxMemory_Free(pu8ImageData);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't allocate %u bytes to read back bitmap data.", _pstReadback->u32Width * _pstReadback->u32Height * 4 * sizeof(orxU8));
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_UpdateReadbacks(orxBOOL _bWait)
+{
+  orxU32 i;
+
+  /* For all readbacks, from the oldest one */
+  for(i = 0; i < orxDISPLAY_KU32_READBACK_NUMBER; i++)
+  {
+    orxDISPLAY_READBACK *pstReadback;
+
+    /* Gets it */
+    pstReadback = &(sstDisplay.astReadbackList[(sstDisplay.u32ReadbackIndex + i) % orxDISPLAY_KU32_READBACK_NUMBER]);
+
+    /* Pending? */
+    if(pstReadback->bPending != orxFALSE)
+    {
+#ifndef __orxMAC__
+
+      /* Not waiting and GPU not done yet? */
+      if((_bWait == orxFALSE)
+      && (pstReadback->uiBuffer != 0)
+      && (glClientWaitSync(pstReadback->hFence, 0, 0) == GL_TIMEOUT_EXPIRED))
+      {
+        /* Keeps completion order */
+        break;
+      }
+
+#endif /* __orxMAC__ */
+
+      /* Completes it */
+      orxDisplay_GLFW_CompleteReadback(pstReadback);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_DeleteReadbacks()
+{
+  orxU32 i;
+
+  /* Completes all pending readbacks */
+  orxDisplay_GLFW_UpdateReadbacks(orxTRUE);
+
+#ifndef __orxMAC__
+
+  /* For all readbacks */
+  for(i = 0; i < orxDISPLAY_KU32_READBACK_NUMBER; i++)
+  {
+    /* Has buffer? */
+    if(sstDisplay.astReadbackList[i].uiBuffer != 0)
+    {
+      /* Deletes it */
+      glDeleteBuffersARB(1, &(sstDisplay.astReadbackList[i].uiBuffer));
+      glASSERT();
+      sstDisplay.astReadbackList[i].uiBuffer = 0;
+    }
+  }
+
+#endif /* __orxMAC__ */
+
+  /* Resets readback index */
+  sstDisplay.u32ReadbackIndex = 0;
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_GLFW_RequestReadback(const orxBITMAP *_pstBitmap, orxBOOL _bSave, orxU32 _u32FilenameID, void *_pContext)
+{
+  orxDISPLAY_READBACK  *pstReadback;
+  orxSTATUS             eResult = orxSTATUS_SUCCESS;
+
+  /* Gets the oldest readback */
+  pstReadback = &(sstDisplay.astReadbackList[sstDisplay.u32ReadbackIndex]);
+
+  /* Still pending? */
+  if(pstReadback->bPending != orxFALSE)
+  {
+    /* Completes it now (all the readbacks are in use) */
+    orxDisplay_GLFW_CompleteReadback(pstReadback);
+  }
+
+  /* Stores request info */
+  pstReadback->bSave          = _bSave;
+  pstReadback->u32FilenameID  = _u32FilenameID;
+  pstReadback->pContext       = _pContext;
+
+#ifndef __orxMAC__
+
+  /* Has asynchronous readback support? */
+  if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_READBACK))
+  {
+    /* No buffer yet? */
+    if(pstReadback->uiBuffer == 0)
+    {
+      /* Creates it */
+      glGenBuffersARB(1, &(pstReadback->uiBuffer));
+      glASSERT();
+    }
+
+    /* Issues the copy */
+    orxDisplay_GLFW_ReadBitmap(_pstBitmap, pstReadback);
+
+    /* Updates readback index */
+    sstDisplay.u32ReadbackIndex = (sstDisplay.u32ReadbackIndex + 1) % orxDISPLAY_KU32_READBACK_NUMBER;
+  }
+  else
+
+#endif /* __orxMAC__ */
+
+  {
+    /* Allocates memory buffer */
+    pstReadback->pu8Buffer = (orxU8 *)orxMemory_Allocate(_pstBitmap->u32RealWidth * _pstBitmap->u32RealHeight * 4 * sizeof(orxU8), orxMEMORY_TYPE_MAIN);
+
+    /* Valid? */
+    if(pstReadback->pu8Buffer != orxNULL)
+    {
+      /* Reads bitmap */
+      orxDisplay_GLFW_ReadBitmap(_pstBitmap, pstReadback);
+
+      /* Completes it right away */
+      orxDisplay_GLFW_CompleteReadback(pstReadback);
+
+      /* Deletes memory buffer */
+      orxMemory_Free(pstReadback->pu8Buffer);
+      pstReadback->pu8Buffer = orxNULL;
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_PrepareBitmap(const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxBOOL bSmoothing;
+
+  /* Checks */
+  orxASSERT((_pstBitmap != orxNULL) && (_pstBitmap != sstDisplay.pstScreen));
+
+  /* Has pending shaders? */
+  if(sstDisplay.s32PendingShaderCounter != 0)
+  {
+    /* Draws remaining items */
+    orxDisplay_GLFW_DrawArrays();
+
+    /* Checks */
+    orxASSERT(sstDisplay.s32PendingShaderCounter == 0);
+  }
+
+  /* New bitmap? */
+  if(_pstBitmap != sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit])
+  {
+    /* Draws remaining items */
+    orxDisplay_GLFW_DrawArrays();
+
+    /* Binds source bitmap */
+    orxDisplay_GLFW_BindBitmap(_pstBitmap);
+
+    /* Has shader support? */
+    if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_SHADER))
+    {
+      /* No other shader active? */
+      if(orxLinkList_GetCounter(&(sstDisplay.stActiveShaderList)) == 0)
+      {
+        /* Updates shader uniform */
+        glUNIFORM(1iARB, sstDisplay.pstDefaultShader->iTextureLocation, sstDisplay.s32ActiveTextureUnit);
+      }
+    }
+  }
+
+  /* Depending on smoothing type */
+  switch(_eSmoothing)
+  {
+    case orxDISPLAY_SMOOTHING_ON:
+    {
+      /* Applies smoothing */
+      bSmoothing = orxTRUE;
+
+      break;
+    }
+
+    case orxDISPLAY_SMOOTHING_OFF:
+    {
+      /* Applies no smoothing */
+      bSmoothing = orxFALSE;
+
+      break;
+    }
+
+    default:
+    case orxDISPLAY_SMOOTHING_DEFAULT:
+    {
       /* Applies default smoothing */
       bSmoothing = sstDisplay.bDefaultSmoothing;
 
@@ -1671,7 +2785,7 @@ static orxINLINE void orxDisplay_GLFW_DrawBitmap(const orxBITMAP *_pstBitmap, co
   fHeight = (GLfloat)(_pstBitmap->stClip.vBR.fY - _pstBitmap->stClip.vTL.fY);
 
   /* End of buffer? */
-  if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
+  if(sstDisplay.s32BufferIndex > sstDisplay.s32BufferSize - 5)
   {
     /* Draws arrays */
     orxDisplay_GLFW_DrawArrays();
@@ -1712,6 +2826,9 @@ static orxINLINE void orxDisplay_GLFW_DrawBitmap(const orxBITMAP *_pstBitmap, co
 
 static void orxFASTCALL orxDisplay_GLFW_DrawPrimitive(orxU32 _u32VertexNumber, orxRGBA _stColor, orxBOOL _bFill, orxBOOL _bOpen)
 {
+  /* Checks */
+  orxASSERT(_u32VertexNumber <= (orxU32)sstDisplay.s32BufferSize);
+
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxDisplay_DrawPrimitive");
 
@@ -1756,16 +2873,15 @@ static void orxFASTCALL orxDisplay_GLFW_DrawPrimitive(orxU32 _u32VertexNumber, o
   /* Has VBO support? */
   if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
   {
-    /* Copies vertex buffer */
-    glBufferSubDataARB(GL_ARRAY_BUFFER_ARB, 0, _u32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX), sstDisplay.astVertexList);
-    glASSERT();
+    /* Uploads vertices */
+    orxDisplay_GLFW_UploadVertices(_u32VertexNumber);
   }
 
   /* Only 2 vertices? */
   if(_u32VertexNumber == 2)
   {
     /* Draws it */
-    glDrawArrays(GL_LINES, 0, 2);
+    glDrawArrays(GL_LINES, (GLint)sstDisplay.u32BufferOffset, 2);
     glASSERT();
   }
   else
@@ -1774,7 +2890,7 @@ static void orxFASTCALL orxDisplay_GLFW_DrawPrimitive(orxU32 _u32VertexNumber, o
     if(_bFill != orxFALSE)
     {
       /* Draws it */
-      glDrawArrays(GL_TRIANGLE_FAN, 0, _u32VertexNumber);
+      glDrawArrays(GL_TRIANGLE_FAN, (GLint)sstDisplay.u32BufferOffset, _u32VertexNumber);
       glASSERT();
     }
     else
@@ -1783,29 +2899,30 @@ static void orxFASTCALL orxDisplay_GLFW_DrawPrimitive(orxU32 _u32VertexNumber, o
       if(_bOpen != orxFALSE)
       {
         /* Draws it */
-        glDrawArrays(GL_LINE_STRIP, 0, _u32VertexNumber);
+        glDrawArrays(GL_LINE_STRIP, (GLint)sstDisplay.u32BufferOffset, _u32VertexNumber);
         glASSERT();
       }
       else
       {
         /* Draws it */
-        glDrawArrays(GL_LINE_LOOP, 0, _u32VertexNumber);
+        glDrawArrays(GL_LINE_LOOP, (GLint)sstDisplay.u32BufferOffset, _u32VertexNumber);
         glASSERT();
       }
     }
   }
 
+  /* Has VBO support? */
+  if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
+  {
+    /* Moves to the next batch */
+    orxDisplay_GLFW_AdvanceBuffer(_u32VertexNumber);
+  }
+
   /* Has shader support? */
   if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_SHADER))
   {
-    /* Bypasses the full screen rendering when stopping shader */
-    sstDisplay.s32BufferIndex = -1;
-
-    /* Stops current shader */
+    /* Stops current shader (buffer is empty, so it gets removed right away) */
     orxDisplay_GLFW_StopShader((orxHANDLE)sstDisplay.pstNoTextureShader);
-
-    /* Resets buffer index */
-    sstDisplay.s32BufferIndex = 0;
   }
   else
   {
@@ -1910,8 +3027,8 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformText(const orxSTRING _zString, co
         const orxCHARACTER_GLYPH *pstGlyph;
         orxFLOAT                  fWidth;
 
-        /* Gets glyph from UTF-8 table */
-        pstGlyph = (orxCHARACTER_GLYPH *)orxHashTable_Get(_pstMap->pstCharacterTable, u32CharacterCodePoint);
+        /* Gets glyph from map */
+        pstGlyph = orxCharacterMap_GetGlyph(_pstMap, u32CharacterCodePoint);
 
         /* Valid? */
         if(pstGlyph != orxNULL)
@@ -1920,7 +3037,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformText(const orxSTRING _zString, co
           fWidth = pstGlyph->fWidth;
 
           /* End of buffer? */
-          if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
+          if(sstDisplay.s32BufferIndex > sstDisplay.s32BufferSize - 5)
           {
             /* Draws arrays */
             orxDisplay_GLFW_DrawArrays();
@@ -1972,6 +3089,199 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformText(const orxSTRING _zString, co
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformCharacterQuads(const orxCHARACTER_QUAD *_astQuadList, orxU32 _u32QuadCounter, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxDISPLAY_MATRIX         mTransform;
+  const orxCHARACTER_QUAD  *pstQuad, *pstEnd;
+  GLfloat                   fHeight, fRecWidth, fRecHeight;
+  orxRGBA                   stRGBA;
+  orxSTATUS                 eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astQuadList != orxNULL) || (_u32QuadCounter == 0));
+  orxASSERT(_pstFont != orxNULL);
+  orxASSERT(_pstMap != orxNULL);
+  orxASSERT(_pstTransform != orxNULL);
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxDisplay_TransformCharacterQuads");
+
+  /* Inits matrix */
+  orxDisplay_GLFW_InitMatrix(&mTransform, _pstTransform->fDstX, _pstTransform->fDstY, _pstTransform->fScaleX, _pstTransform->fScaleY, _pstTransform->fRotation, _pstTransform->fSrcX, _pstTransform->fSrcY);
+
+  /* Gets character's height, texture scales & color */
+  fHeight     = _pstMap->fCharacterHeight;
+  fRecWidth   = (GLfloat)_pstFont->fRecRealWidth;
+  fRecHeight  = (GLfloat)_pstFont->fRecRealHeight;
+  stRGBA      = _pstFont->stColor;
+
+  /* Prepares font for drawing */
+  orxDisplay_GLFW_PrepareBitmap(_pstFont, _eSmoothing, _eBlendMode);
+
+  /* For all quads */
+  for(pstQuad = _astQuadList, pstEnd = _astQuadList + _u32QuadCounter; pstQuad < pstEnd;)
+  {
+    const orxCHARACTER_QUAD  *pstBatchEnd;
+    orxDISPLAY_GLFW_VERTEX   *pstVertex;
+
+    /* End of buffer? */
+    if(sstDisplay.s32BufferIndex > sstDisplay.s32BufferSize - 5)
+    {
+      /* Draws arrays */
+      orxDisplay_GLFW_DrawArrays();
+    }
+
+    /* Gets the quads that fit in the buffer */
+    pstBatchEnd = pstQuad + orxMIN((orxU32)(pstEnd - pstQuad), (orxU32)(sstDisplay.s32BufferSize - sstDisplay.s32BufferIndex) >> 2);
+    pstVertex   = &(sstDisplay.astVertexList[sstDisplay.s32BufferIndex]);
+
+    /* Updates buffer index */
+    sstDisplay.s32BufferIndex += (orxS32)(pstBatchEnd - pstQuad) << 2;
+
+#if defined(__orxDISPLAY_SSE__)
+    {
+      __m128 vAxis, vOrigin, vScale, vOffset, vDown, vRight, vRightOffset;
+
+      /* Inits constant terms: lanes are (X, Y, U, V) */
+      vAxis         = _mm_setr_ps(mTransform.vX.fX, mTransform.vY.fX, 0.0f, 0.0f);
+      vOrigin       = _mm_setr_ps(mTransform.vX.fY, mTransform.vY.fY, 0.0f, 0.0f);
+      vScale        = _mm_setr_ps(0.0f, 0.0f, fRecWidth, fRecHeight);
+      vOffset       = _mm_setr_ps(mTransform.vX.fZ, mTransform.vY.fZ, fRecWidth * orxDISPLAY_KF_BORDER_FIX, fRecHeight * orxDISPLAY_KF_BORDER_FIX);
+      vDown         = _mm_setr_ps(mTransform.vX.fY * fHeight, mTransform.vY.fY * fHeight, 0.0f, fRecHeight * (fHeight - 2.0f * orxDISPLAY_KF_BORDER_FIX));
+      vRight        = _mm_setr_ps(mTransform.vX.fX, mTransform.vY.fX, fRecWidth, 0.0f);
+      vRightOffset  = _mm_setr_ps(0.0f, 0.0f, -2.0f * fRecWidth * orxDISPLAY_KF_BORDER_FIX, 0.0f);
+
+      /* For all quads in batch */
+      for(; pstQuad < pstBatchEnd; pstQuad++, pstVertex += 4)
+      {
+        __m128 vQuad, vTopLeft, vTopRight;
+
+        /* Loads position & texture origin */
+        vQuad     = _mm_loadu_ps(&(pstQuad->fX));
+
+        /* Computes top left & top right vertices */
+        vTopLeft  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(vQuad, vQuad, _MM_SHUFFLE(0, 0, 0, 0)), vAxis), _mm_mul_ps(_mm_shuffle_ps(vQuad, vQuad, _MM_SHUFFLE(1, 1, 1, 1)), vOrigin)), _mm_add_ps(_mm_mul_ps(vQuad, vScale), vOffset));
+        vTopRight = _mm_add_ps(vTopLeft, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(pstQuad->fWidth), vRight), vRightOffset));
+
+        /* Outputs vertices and texture coordinates */
+        _mm_storeu_ps(&(pstVertex[0].fX), _mm_add_ps(vTopLeft, vDown));
+        _mm_storeu_ps(&(pstVertex[1].fX), vTopLeft);
+        _mm_storeu_ps(&(pstVertex[2].fX), _mm_add_ps(vTopRight, vDown));
+        _mm_storeu_ps(&(pstVertex[3].fX), vTopRight);
+
+        /* Fills the color list */
+        pstVertex[0].stRGBA =
+        pstVertex[1].stRGBA =
+        pstVertex[2].stRGBA =
+        pstVertex[3].stRGBA = stRGBA;
+      }
+    }
+#elif defined(__orxDISPLAY_NEON__)
+    {
+      float32x4_t vAxis, vOrigin, vScale, vOffset, vDown, vRight, vRightOffset;
+      const float32_t afAxis[4]         = {mTransform.vX.fX, mTransform.vY.fX, 0.0f, 0.0f};
+      const float32_t afOrigin[4]       = {mTransform.vX.fY, mTransform.vY.fY, 0.0f, 0.0f};
+      const float32_t afScale[4]        = {0.0f, 0.0f, fRecWidth, fRecHeight};
+      const float32_t afOffset[4]       = {mTransform.vX.fZ, mTransform.vY.fZ, fRecWidth * orxDISPLAY_KF_BORDER_FIX, fRecHeight * orxDISPLAY_KF_BORDER_FIX};
+      const float32_t afDown[4]         = {mTransform.vX.fY * fHeight, mTransform.vY.fY * fHeight, 0.0f, fRecHeight * (fHeight - 2.0f * orxDISPLAY_KF_BORDER_FIX)};
+      const float32_t afRight[4]        = {mTransform.vX.fX, mTransform.vY.fX, fRecWidth, 0.0f};
+      const float32_t afRightOffset[4]  = {0.0f, 0.0f, -2.0f * fRecWidth * orxDISPLAY_KF_BORDER_FIX, 0.0f};
+
+      /* Inits constant terms: lanes are (X, Y, U, V) */
+      vAxis         = vld1q_f32(afAxis);
+      vOrigin       = vld1q_f32(afOrigin);
+      vScale        = vld1q_f32(afScale);
+      vOffset       = vld1q_f32(afOffset);
+      vDown         = vld1q_f32(afDown);
+      vRight        = vld1q_f32(afRight);
+      vRightOffset  = vld1q_f32(afRightOffset);
+
+      /* For all quads in batch */
+      for(; pstQuad < pstBatchEnd; pstQuad++, pstVertex += 4)
+      {
+        float32x4_t vTopLeft, vTopRight;
+
+        /* Computes top left & top right vertices */
+        vTopLeft  = vmlaq_n_f32(vmlaq_n_f32(vmlaq_f32(vOffset, vld1q_f32(&(pstQuad->fX)), vScale), vAxis, pstQuad->fX), vOrigin, pstQuad->fY);
+        vTopRight = vmlaq_n_f32(vaddq_f32(vTopLeft, vRightOffset), vRight, pstQuad->fWidth);
+
+        /* Outputs vertices and texture coordinates */
+        vst1q_f32(&(pstVertex[0].fX), vaddq_f32(vTopLeft, vDown));
+        vst1q_f32(&(pstVertex[1].fX), vTopLeft);
+        vst1q_f32(&(pstVertex[2].fX), vaddq_f32(vTopRight, vDown));
+        vst1q_f32(&(pstVertex[3].fX), vTopRight);
+
+        /* Fills the color list */
+        pstVertex[0].stRGBA =
+        pstVertex[1].stRGBA =
+        pstVertex[2].stRGBA =
+        pstVertex[3].stRGBA = stRGBA;
+      }
+    }
+#else /* __orxDISPLAY_SSE__ */
+    {
+      GLfloat fDownX, fDownY, fDownV, fBorderU, fBorderV, fRightU;
+
+      /* Inits constant terms */
+      fDownX    = mTransform.vX.fY * fHeight;
+      fDownY    = mTransform.vY.fY * fHeight;
+      fDownV    = fRecHeight * (fHeight - 2.0f * orxDISPLAY_KF_BORDER_FIX);
+      fBorderU  = fRecWidth * orxDISPLAY_KF_BORDER_FIX;
+      fBorderV  = fRecHeight * orxDISPLAY_KF_BORDER_FIX;
+      fRightU   = -2.0f * fBorderU;
+
+      /* For all quads in batch */
+      for(; pstQuad < pstBatchEnd; pstQuad++, pstVertex += 4)
+      {
+        GLfloat fX, fY, fRightX, fRightY, fU0, fU1, fV0, fV1;
+
+        /* Computes top left vertex & right offset */
+        fX      = (mTransform.vX.fX * pstQuad->fX) + (mTransform.vX.fY * pstQuad->fY) + mTransform.vX.fZ;
+        fY      = (mTransform.vY.fX * pstQuad->fX) + (mTransform.vY.fY * pstQuad->fY) + mTransform.vY.fZ;
+        fRightX = mTransform.vX.fX * pstQuad->fWidth;
+        fRightY = mTransform.vY.fX * pstQuad->fWidth;
+        fU0     = (fRecWidth * pstQuad->fU) + fBorderU;
+        fU1     = fU0 + (fRecWidth * pstQuad->fWidth) + fRightU;
+        fV0     = (fRecHeight * pstQuad->fV) + fBorderV;
+        fV1     = fV0 + fDownV;
+
+        /* Outputs vertices and texture coordinates */
+        pstVertex[0].fX = fX + fDownX;
+        pstVertex[0].fY = fY + fDownY;
+        pstVertex[1].fX = fX;
+        pstVertex[1].fY = fY;
+        pstVertex[2].fX = fX + fRightX + fDownX;
+        pstVertex[2].fY = fY + fRightY + fDownY;
+        pstVertex[3].fX = fX + fRightX;
+        pstVertex[3].fY = fY + fRightY;
+
+        pstVertex[0].fU =
+        pstVertex[1].fU = fU0;
+        pstVertex[2].fU =
+        pstVertex[3].fU = fU1;
+        pstVertex[1].fV =
+        pstVertex[3].fV = fV0;
+        pstVertex[0].fV =
+        pstVertex[2].fV = fV1;
+
+        /* Fills the color list */
+        pstVertex[0].stRGBA =
+        pstVertex[1].stRGBA =
+        pstVertex[2].stRGBA =
+        pstVertex[3].stRGBA = stRGBA;
+      }
+    }
+#endif /* __orxDISPLAY_SSE__ */
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawLine(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxRGBA _stColor)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
@@ -2003,7 +3313,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawLine(const orxVECTOR *_pvStart, const
 
 orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawPolyline(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxRGBA _stColor)
 {
-  orxU32    i;
+  orxU32    i, u32Number;
   orxSTATUS eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
@@ -2014,19 +3324,26 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawPolyline(const orxVECTOR *_avVertexLis
   /* Draws remaining items */
   orxDisplay_GLFW_DrawArrays();
 
-  /* For all vertices */
-  for(i = 0; i < _u32VertexNumber; i++)
+  /* For all batch-sized strips (consecutive strips share their boundary vertex) */
+  for(; _u32VertexNumber > 1; _avVertexList += u32Number - 1, _u32VertexNumber -= u32Number - 1)
   {
-    /* Copies its coords */
-    sstDisplay.astVertexList[i].fX = (GLfloat)(_avVertexList[i].fX);
-    sstDisplay.astVertexList[i].fY = (GLfloat)(_avVertexList[i].fY);
+    /* Gets strip's vertex number */
+    u32Number = orxMIN(_u32VertexNumber, (orxU32)sstDisplay.s32BufferSize);
 
-    /* Copies color */
-    sstDisplay.astVertexList[i].stRGBA = _stColor;
-  }
+    /* For all its vertices */
+    for(i = 0; i < u32Number; i++)
+    {
+      /* Copies its coords */
+      sstDisplay.astVertexList[i].fX = (GLfloat)(_avVertexList[i].fX);
+      sstDisplay.astVertexList[i].fY = (GLfloat)(_avVertexList[i].fY);
 
-  /* Draws it */
-  orxDisplay_GLFW_DrawPrimitive(_u32VertexNumber, _stColor, orxFALSE, orxTRUE);
+      /* Copies color */
+      sstDisplay.astVertexList[i].stRGBA = _stColor;
+    }
+
+    /* Draws it */
+    orxDisplay_GLFW_DrawPrimitive(u32Number, _stColor, orxFALSE, orxTRUE);
+  }
 
   /* Done! */
   return eResult;
@@ -2042,22 +3359,34 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawPolygon(const orxVECTOR *_avVertexList
   orxASSERT(_avVertexList != orxNULL);
   orxASSERT(_u32VertexNumber > 0);
 
-  /* Draws remaining items */
-  orxDisplay_GLFW_DrawArrays();
-
-  /* For all vertices */
-  for(i = 0; i < _u32VertexNumber; i++)
+  /* Too many vertices for a single batch? */
+  if(_u32VertexNumber > (orxU32)sstDisplay.s32BufferSize)
   {
-    /* Copies its coords */
-    sstDisplay.astVertexList[i].fX = (GLfloat)(_avVertexList[i].fX);
-    sstDisplay.astVertexList[i].fY = (GLfloat)(_avVertexList[i].fY);
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't draw polygon with %u vertices: batch capacity is %d vertices.", _u32VertexNumber, sstDisplay.s32BufferSize);
 
-    /* Copies color */
-    sstDisplay.astVertexList[i].stRGBA = _stColor;
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
   }
+  else
+  {
+    /* Draws remaining items */
+    orxDisplay_GLFW_DrawArrays();
 
-  /* Draws it */
-  orxDisplay_GLFW_DrawPrimitive(_u32VertexNumber, _stColor, _bFill, orxFALSE);
+    /* For all vertices */
+    for(i = 0; i < _u32VertexNumber; i++)
+    {
+      /* Copies its coords */
+      sstDisplay.astVertexList[i].fX = (GLfloat)(_avVertexList[i].fX);
+      sstDisplay.astVertexList[i].fY = (GLfloat)(_avVertexList[i].fY);
+
+      /* Copies color */
+      sstDisplay.astVertexList[i].stRGBA = _stColor;
+    }
+
+    /* Draws it */
+    orxDisplay_GLFW_DrawPrimitive(_u32VertexNumber, _stColor, _bFill, orxFALSE);
+  }
 
   /* Done! */
   return eResult;
@@ -2164,16 +3493,16 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawMesh(const orxBITMAP *_pstBitmap, orxD
   fYCoef = pstBitmap->fRecRealHeight * fHeight;
 
   /* End of buffer? */
-  if(sstDisplay.s32BufferIndex + (2 * _u32VertexNumber) > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 3)
+  if(sstDisplay.s32BufferIndex + (2 * _u32VertexNumber) > sstDisplay.s32BufferSize - 3)
   {
     /* Draws arrays */
     orxDisplay_GLFW_DrawArrays();
 
     /* Too many vertices? */
-    if(_u32VertexNumber > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE / 2)
+    if(_u32VertexNumber > (orxU32)sstDisplay.s32BufferSize / 2)
     {
       /* Updates vertex number */
-      u32VertexNumber = orxDISPLAY_KU32_VERTEX_BUFFER_SIZE / 2;
+      u32VertexNumber = (orxU32)sstDisplay.s32BufferSize / 2;
 
       /* Logs message */
       orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't draw full mesh: only drawing %d vertices out of %d.", u32VertexNumber, _u32VertexNumber);
@@ -2407,6 +3736,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_ClearBitmap(orxBITMAP *_pstBitmap, orxRGBA
       glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, (GLsizei)_pstBitmap->u32RealWidth, (GLsizei)_pstBitmap->u32RealHeight, GL_RGBA, GL_UNSIGNED_BYTE, astBuffer);
       glASSERT();
 
+      /* Updates status */
+      orxFLAG_SET(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_MODIFIED, orxDISPLAY_KU32_BITMAP_FLAG_NONE);
+
       /* Restores previous texture */
       glBindTexture(GL_TEXTURE_2D, (sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit] != orxNULL) ? sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit]->uiTexture : 0);
       glASSERT();
@@ -2503,6 +3835,16 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_Swap()
   /* Swap buffers */
   glfwSwapBuffers();
 
+  /* Completes readbacks whose data is available */
+  orxDisplay_GLFW_UpdateReadbacks(orxFALSE);
+
+  /* Has queued reloads? */
+  if(sstDisplay.u32QueuedReloadCounter != 0)
+  {
+    /* Starts them as in-flight ones complete */
+    orxDisplay_GLFW_UpdateReloads();
+  }
+
   /* Is fullscreen & VSync? */
   if(orxFLAG_TEST_ALL(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN | orxDISPLAY_KU32_STATIC_FLAG_VSYNC))
   {
@@ -2575,6 +3917,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetBitmapData(orxBITMAP *_pstBitmap, const
     glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, (GLsizei)_pstBitmap->u32RealWidth, (GLsizei)_pstBitmap->u32RealHeight, GL_RGBA, GL_UNSIGNED_BYTE, pu8ImageBuffer);
     glASSERT();
 
+    /* Updates status */
+    orxFLAG_SET(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_MODIFIED, orxDISPLAY_KU32_BITMAP_FLAG_NONE);
+
     /* Restores previous texture */
     glBindTexture(GL_TEXTURE_2D, (sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit] != orxNULL) ? sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit]->uiTexture : 0);
     glASSERT();
@@ -2612,138 +3957,43 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetBitmapData(orxBITMAP *_pstBitmap, const
 }
 
 orxSTATUS orxFASTCALL orxDisplay_GLFW_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
-{
-  orxU32    u32BufferSize;
-  orxSTATUS eResult;
-
-  /* Checks */
-  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
-  orxASSERT(_pstBitmap != orxNULL);
-  orxASSERT(_au8Data != orxNULL);
-
-  /* Gets buffer size */
-  u32BufferSize = orxF2U(_pstBitmap->fWidth * _pstBitmap->fHeight) * 4 * sizeof(orxU8);
-
-  /* Is size matching? */
-  if(_u32ByteNumber == u32BufferSize)
-  {
-    orxU32  u32LineSize, u32RealLineSize, u32SrcOffset, u32DstOffset, i;
-    orxU8  *pu8ImageBuffer;
-
-    /* Draws remaining items */
-    orxDisplay_GLFW_DrawArrays();
-
-    /* Allocates buffer */
-    pu8ImageBuffer = ((_pstBitmap != sstDisplay.pstScreen) && (orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NPOT))) ? _au8Data : (orxU8 *)orxMemory_Allocate(_pstBitmap->u32RealWidth * _pstBitmap->u32RealHeight * 4 * sizeof(orxU8), orxMEMORY_TYPE_MAIN);
-
-    /* Checks */
-    orxASSERT(pu8ImageBuffer != orxNULL);
-
-    /* Binds bitmap's associated texture */
-    glBindTexture(GL_TEXTURE_2D, _pstBitmap->uiTexture);
-    glASSERT();
-
-    /* Screen capture? */
-    if(_pstBitmap == sstDisplay.pstScreen)
-    {
-      /* Tracks video memory */
-      orxMEMORY_TRACK(VIDEO, sstDisplay.pstScreen->u32DataSize, orxTRUE);
-
-      /* Creates texture for screen backup */
-      glGenTextures(1, &(sstDisplay.pstScreen->uiTexture));
-      glASSERT();
-      glBindTexture(GL_TEXTURE_2D, sstDisplay.pstScreen->uiTexture);
-      glASSERT();
-      glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, (GLsizei)sstDisplay.pstScreen->u32RealWidth, (GLsizei)sstDisplay.pstScreen->u32RealHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-      glASSERT();
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-      glASSERT();
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-      glASSERT();
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, (sstDisplay.pstScreen->bSmoothing != orxFALSE) ? GL_LINEAR : GL_NEAREST);
-      glASSERT();
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (sstDisplay.pstScreen->bSmoothing != orxFALSE) ? GL_LINEAR : GL_NEAREST);
-      glASSERT();
-
-      /* Copies screen content */
-      glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, (GLint)(orxF2U(_pstBitmap->fHeight) - _pstBitmap->u32RealHeight), (GLsizei)orxF2U(_pstBitmap->fWidth), (GLsizei)_pstBitmap->u32RealHeight);
-      glASSERT();
-
-      /* Copies bitmap data */
-      glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pu8ImageBuffer);
-      glASSERT();
-
-      /* Tracks video memory */
-      orxMEMORY_TRACK(VIDEO, sstDisplay.pstScreen->u32DataSize, orxFALSE);
-
-      /* Deletes screen backup texture */
-      glDeleteTextures(1, &(sstDisplay.pstScreen->uiTexture));
-      glASSERT();
-      sstDisplay.pstScreen->uiTexture = 0;
-    }
-    else
-    {
-      /* Copies bitmap data */
-      glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pu8ImageBuffer);
-      glASSERT();
-    }
+{
+  orxU32    u32BufferSize;
+  orxSTATUS eResult;
 
-    /* Restores previous texture */
-    glBindTexture(GL_TEXTURE_2D, (sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit] != orxNULL) ? sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit]->uiTexture : 0);
-    glASSERT();
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
 
-    /* Gets line sizes */
-    u32LineSize     = orxF2U(_pstBitmap->fWidth) * 4 * sizeof(orxU8);
-    u32RealLineSize = _pstBitmap->u32RealWidth * 4 * sizeof(orxU8);
+  /* Gets buffer size */
+  u32BufferSize = orxF2U(_pstBitmap->fWidth * _pstBitmap->fHeight) * 4 * sizeof(orxU8);
 
-    /* Screen? */
-    if(_pstBitmap == sstDisplay.pstScreen)
-    {
-      orxRGBA stOpaque;
+  /* Is size matching? */
+  if(_u32ByteNumber == u32BufferSize)
+  {
+    orxDISPLAY_READBACK stReadback;
 
-      /* Sets opaque pixel */
-      stOpaque = orx2RGBA(0x00, 0x00, 0x00, 0xFF);
+    /* Inits readback (synchronous, no pixel pack buffer) */
+    orxMemory_Zero(&stReadback, sizeof(orxDISPLAY_READBACK));
 
-      /* For all lines */
-      for(i = 0, u32SrcOffset = u32RealLineSize * (_pstBitmap->u32RealHeight - orxF2U(_pstBitmap->fHeight)), u32DstOffset = u32LineSize * (orxF2U(_pstBitmap->fHeight) - 1);
-          i < orxF2U(_pstBitmap->fHeight);
-          i++, u32SrcOffset += u32RealLineSize, u32DstOffset -= u32LineSize)
-      {
-        orxU32 j;
+    /* Allocates buffer */
+    stReadback.pu8Buffer = ((_pstBitmap != sstDisplay.pstScreen) && (orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NPOT))) ? _au8Data : (orxU8 *)orxMemory_Allocate(_pstBitmap->u32RealWidth * _pstBitmap->u32RealHeight * 4 * sizeof(orxU8), orxMEMORY_TYPE_MAIN);
 
-        /* For all columns */
-        for(j = 0; j < orxF2U(_pstBitmap->fWidth); j++)
-        {
-          orxRGBA stPixel;
+    /* Checks */
+    orxASSERT(stReadback.pu8Buffer != orxNULL);
 
-          /* Gets opaque pixel */
-          stPixel.u32RGBA = ((orxRGBA *)(pu8ImageBuffer + u32SrcOffset))[j].u32RGBA | stOpaque.u32RGBA;
+    /* Reads bitmap */
+    orxDisplay_GLFW_ReadBitmap(_pstBitmap, &stReadback);
 
-          /* Stores it */
-          ((orxRGBA *)(_au8Data + u32DstOffset))[j] = stPixel;
-        }
-      }
+    /* Gets its data */
+    orxDisplay_GLFW_ResolveReadback(&stReadback, _au8Data);
 
-      /* Deletes buffer */
-      orxMemory_Free(pu8ImageBuffer);
-    }
-    else
+    /* Was allocated? */
+    if(stReadback.pu8Buffer != _au8Data)
     {
-      /* Doesn't have NPOT texture support? */
-      if(!orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NPOT))
-      {
-        /* For all lines */
-        for(i = 0, u32SrcOffset = 0, u32DstOffset = 0;
-            i < orxF2U(_pstBitmap->fHeight);
-            i++, u32SrcOffset += u32RealLineSize, u32DstOffset += u32LineSize)
-        {
-          /* Copies data */
-          orxMemory_Copy(_au8Data + u32DstOffset, pu8ImageBuffer + u32SrcOffset, u32LineSize);
-        }
-
-        /* Deletes buffer */
-        orxMemory_Free(pu8ImageBuffer);
-      }
+      /* Deletes buffer */
+      orxMemory_Free(stReadback.pu8Buffer);
     }
 
     /* Updates result */
@@ -2762,6 +4012,21 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_GetBitmapData(const orxBITMAP *_pstBitmap,
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_GLFW_RequestBitmapData(const orxBITMAP *_pstBitmap, void *_pContext)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Requests readback */
+  eResult = orxDisplay_GLFW_RequestReadback(_pstBitmap, orxFALSE, 0, _pContext);
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_GLFW_SetBitmapColorKey(orxBITMAP *_pstBitmap, orxRGBA _stColor, orxBOOL _bEnable)
 {
   orxSTATUS eResult = orxSTATUS_FAILURE;
@@ -2982,6 +4247,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetDestinationBitmaps(orxBITMAP **_apstBit
             /* Links texture to it */
             glFramebufferTexture2DEXT(GL_FRAMEBUFFER_EXT, GL_COLOR_ATTACHMENT0_EXT + i, GL_TEXTURE_2D, pstBitmap->uiTexture, 0);
             glASSERT();
+
+            /* Updates its status */
+            orxFLAG_SET(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_MODIFIED, orxDISPLAY_KU32_BITMAP_FLAG_NONE);
           }
           else
           {
@@ -3267,7 +4535,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformBitmap(const orxBITMAP *_pstSrc,
           }
 
           /* End of buffer? */
-          if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
+          if(sstDisplay.s32BufferIndex > sstDisplay.s32BufferSize - 5)
           {
             /* Draws arrays */
             orxDisplay_GLFW_DrawArrays();
@@ -3311,59 +4579,15 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformBitmap(const orxBITMAP *_pstSrc,
 
 orxSTATUS orxFASTCALL orxDisplay_GLFW_SaveBitmap(const orxBITMAP *_pstBitmap, const orxSTRING _zFilename)
 {
-  orxU32    u32BufferSize;
-  orxU8    *pu8ImageData;
-  orxSTATUS eResult = orxSTATUS_FAILURE;
+  orxSTATUS eResult;
 
   /* Checks */
   orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBitmap != orxNULL);
   orxASSERT(_zFilename != orxNULL);
 
-  /* Gets buffer size */
-  u32BufferSize = orxF2U(_pstBitmap->fWidth * _pstBitmap->fHeight) * 4 * sizeof(orxU8);
-
-  /* Allocates buffer */
-  pu8ImageData = (orxU8 *)orxMemory_Allocate(u32BufferSize, orxMEMORY_TYPE_MAIN);
-
-  /* Valid? */
-  if(pu8ImageData != orxNULL)
-  {
-    orxDISPLAY_SAVE_INFO *pstInfo = orxNULL;
-
-    /* Gets bitmap data */
-    if(orxDisplay_GLFW_GetBitmapData(_pstBitmap, pu8ImageData, u32BufferSize) != orxSTATUS_FAILURE)
-    {
-      /* Allocates save info */
-      pstInfo = (orxDISPLAY_SAVE_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_SAVE_INFO), orxMEMORY_TYPE_TEMP);
-
-      /* Valid? */
-      if(pstInfo != orxNULL)
-      {
-        /* Inits it */
-        pstInfo->pu8ImageData   = pu8ImageData;
-        pstInfo->u32FilenameID  = orxString_GetID(_zFilename);
-        pstInfo->u32Width       = orxF2U(_pstBitmap->fWidth);
-        pstInfo->u32Height      = orxF2U(_pstBitmap->fHeight);
-
-        /* Runs asynchronous task */
-        eResult = orxThread_RunTask(&orxDisplay_GLFW_SaveBitmapData, orxNULL, orxNULL, (void *)pstInfo);
-      }
-    }
-
-    /* Failure? */
-    if(eResult == orxSTATUS_FAILURE)
-    {
-      /* Frees save info */
-      if(pstInfo != orxNULL)
-      {
-        orxMemory_Free(pstInfo);
-      }
-
-      /* Frees buffer */
-      orxMemory_Free(pu8ImageData);
-    }
-  }
+  /* Requests readback (encoding & writing will happen on a worker thread once its data is available) */
+  eResult = orxDisplay_GLFW_RequestReadback(_pstBitmap, orxTRUE, orxString_GetID(_zFilename), orxNULL);
 
   /* Done! */
   return eResult;
@@ -3825,22 +5049,34 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetVideoMode(const orxDISPLAY_VIDEO_MODE *
               pstBitmap != orxNULL;
               pstBitmap = (orxBITMAP *)orxBank_GetNext(sstDisplay.pstBitmapBank, pstBitmap))
           {
-            /* Not screen? */
-            if(pstBitmap != sstDisplay.pstScreen)
+            /* Not screen nor loading (its texture is the temp one)? */
+            if((pstBitmap != sstDisplay.pstScreen)
+            && (!orxFLAG_TEST(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING)))
             {
-              /* Allocates its buffer */
-              aau8BufferArray[u32Index] = (orxU8 *)orxMemory_Allocate(pstBitmap->u32RealWidth * pstBitmap->u32RealHeight * 4 * sizeof(orxU8), orxMEMORY_TYPE_MAIN);
+              /* Unmodified content from a resource? */
+              if((pstBitmap->u32FilenameID != 0)
+              && (pstBitmap != sstDisplay.pstTempBitmap)
+              && (!orxFLAG_TEST(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_MODIFIED)))
+              {
+                /* Will reload it from its resource instead of backing it up */
+                orxFLAG_SET(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_RELOAD, orxDISPLAY_KU32_BITMAP_FLAG_NONE);
+              }
+              else
+              {
+                /* Allocates its buffer */
+                aau8BufferArray[u32Index] = (orxU8 *)orxMemory_Allocate(pstBitmap->u32RealWidth * pstBitmap->u32RealHeight * 4 * sizeof(orxU8), orxMEMORY_TYPE_MAIN);
 
-              /* Checks */
-              orxASSERT(aau8BufferArray[u32Index] != orxNULL);
+                /* Checks */
+                orxASSERT(aau8BufferArray[u32Index] != orxNULL);
 
-              /* Binds bitmap */
-              glBindTexture(GL_TEXTURE_2D, pstBitmap->uiTexture);
-              glASSERT();
+                /* Binds bitmap */
+                glBindTexture(GL_TEXTURE_2D, pstBitmap->uiTexture);
+                glASSERT();
 
-              /* Copies bitmap data */
-              glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, aau8BufferArray[u32Index++]);
-              glASSERT();
+                /* Copies bitmap data */
+                glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, aau8BufferArray[u32Index++]);
+                glASSERT();
+              }
 
               /* Tracks video memory */
               orxMEMORY_TRACK(VIDEO, pstBitmap->u32DataSize, orxFALSE);
@@ -3881,14 +5117,11 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetVideoMode(const orxDISPLAY_VIDEO_MODE *
           sstDisplay.uiFrameBuffer = 0;
         }
 
-        /* Had index buffer? */
-        if(sstDisplay.uiIndexBuffer != 0)
-        {
-          /* Deletes it */
-          glDeleteBuffersARB(1, &(sstDisplay.uiIndexBuffer));
-          glASSERT();
-          sstDisplay.uiIndexBuffer = 0;
-        }
+        /* Completes pending readbacks & deletes their buffers */
+        orxDisplay_GLFW_DeleteReadbacks();
+
+        /* Deletes vertex & index buffers */
+        orxDisplay_GLFW_DeleteBuffers();
 
         /* Closes window */
         glfwCloseWindow();
@@ -3930,6 +5163,20 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetVideoMode(const orxDISPLAY_VIDEO_MODE *
         }
       }
 
+      /* Success? */
+      if(eResult != orxSTATUS_FAILURE)
+      {
+        /* Inits extensions */
+        orxDisplay_GLFW_InitExtensions();
+
+        /* Creates vertex & index buffers */
+        if((eResult = orxDisplay_GLFW_CreateBuffers()) == orxSTATUS_FAILURE)
+        {
+          /* Closes window (can't render without batch buffers) */
+          glfwCloseWindow();
+        }
+      }
+
       /* Success? */
       if(eResult != orxSTATUS_FAILURE)
       {
@@ -3965,9 +5212,6 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetVideoMode(const orxDISPLAY_VIDEO_MODE *
         stPayload.stVideoMode.u32PreviousRefreshRate  = sstDisplay.u32RefreshRate;
         stPayload.stVideoMode.bFullScreen             = _pstVideoMode->bFullScreen;
 
-        /* Inits extensions */
-        orxDisplay_GLFW_InitExtensions();
-
         /* Inits OpenGL */
         glEnable(GL_TEXTURE_2D);
         glASSERT();
@@ -4065,30 +5309,6 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetVideoMode(const orxDISPLAY_VIDEO_MODE *
           sstDisplay.uiLastFrameBuffer = 0;
         }
 
-        /* Has VBO support? */
-        if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
-        {
-          /* Generates index buffer objects (VBO/IBO) */
-          glGenBuffersARB(1, &(sstDisplay.uiVertexBuffer));
-          glASSERT();
-          glGenBuffersARB(1, &(sstDisplay.uiIndexBuffer));
-          glASSERT();
-
-          /* Binds them */
-          glBindBufferARB(GL_ARRAY_BUFFER_ARB, sstDisplay.uiVertexBuffer);
-          glASSERT();
-          glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, sstDisplay.uiIndexBuffer);
-          glASSERT();
-
-          /* Inits VBO */
-          glBufferDataARB(GL_ARRAY_BUFFER_ARB, orxDISPLAY_KU32_VERTEX_BUFFER_SIZE * sizeof(orxDISPLAY_GLFW_VERTEX), NULL, GL_STREAM_DRAW_ARB);
-          glASSERT();
-
-          /* Fills IBO */
-          glBufferDataARB(GL_ELEMENT_ARRAY_BUFFER_ARB, orxDISPLAY_KU32_INDEX_BUFFER_SIZE * sizeof(GLushort), &(sstDisplay.au16IndexList), GL_STATIC_DRAW_ARB);
-          glASSERT();
-        }
-
         /* Updates screen info */
         if(_pstVideoMode != orxNULL)
         {
@@ -4140,8 +5360,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetVideoMode(const orxDISPLAY_VIDEO_MODE *
               pstBitmap != orxNULL;
               pstBitmap = (orxBITMAP *)orxBank_GetNext(sstDisplay.pstBitmapBank, pstBitmap))
           {
-            /* Not screen? */
-            if(pstBitmap != sstDisplay.pstScreen)
+            /* Not screen, loading nor to be reloaded? */
+            if((pstBitmap != sstDisplay.pstScreen)
+            && (!orxFLAG_TEST(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING | orxDISPLAY_KU32_BITMAP_FLAG_RELOAD)))
             {
               /* Tracks video memory */
               orxMEMORY_TRACK(VIDEO, pstBitmap->u32DataSize, orxTRUE);
@@ -4169,6 +5390,43 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetVideoMode(const orxDISPLAY_VIDEO_MODE *
 
           /* Deletes buffer array */
           orxMemory_Free(aau8BufferArray);
+
+          /* For all bitmaps (now that the temp one is available) */
+          for(pstBitmap = (orxBITMAP *)orxBank_GetNext(sstDisplay.pstBitmapBank, orxNULL);
+              pstBitmap != orxNULL;
+              pstBitmap = (orxBITMAP *)orxBank_GetNext(sstDisplay.pstBitmapBank, pstBitmap))
+          {
+            /* Still loading (possibly reloading after a previous video mode change)? */
+            if(orxFLAG_TEST(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
+            {
+              /* Has temp bitmap? */
+              if(sstDisplay.pstTempBitmap != orxNULL)
+              {
+                /* Uses new temp texture till its data is ready */
+                pstBitmap->uiTexture = sstDisplay.pstTempBitmap->uiTexture;
+              }
+            }
+            /* Should reload? */
+            else if(orxFLAG_TEST(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_RELOAD))
+            {
+              /* Has temp bitmap? */
+              if(sstDisplay.pstTempBitmap != orxNULL)
+              {
+                /* Queues its reload: it uses the temp texture till its turn comes */
+                orxFLAG_SET(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING | orxDISPLAY_KU32_BITMAP_FLAG_QUEUED, orxDISPLAY_KU32_BITMAP_FLAG_NONE);
+                orxDisplay_GLFW_UseTempBitmap(pstBitmap);
+                sstDisplay.u32QueuedReloadCounter++;
+              }
+              else
+              {
+                /* Reloads it synchronously, one at a time, there's no placeholder to show in the meantime */
+                orxDisplay_GLFW_ReloadBitmap(pstBitmap);
+              }
+            }
+          }
+
+          /* Starts first queued reloads */
+          orxDisplay_GLFW_UpdateReloads();
         }
 
         /* Had shaders? */
@@ -4402,9 +5660,6 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_Init()
   /* Was not already initialized? */
   if(!(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY))
   {
-    orxU32 i;
-    GLushort u16Index;
-
     /* Cleans static controller */
     orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
 
@@ -4417,18 +5672,6 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_Init()
     sstDisplay.stSTBICallbacks.skip = orxDisplay_GLFW_SkipSTBICallback;
     sstDisplay.stSTBICallbacks.eof  = orxDisplay_GLFW_EOFSTBICallback;
 
-    /* For all indices */
-    for(i = 0, u16Index = 0; i < orxDISPLAY_KU32_INDEX_BUFFER_SIZE; i += 6, u16Index += 4)
-    {
-      /* Computes them */
-      sstDisplay.au16IndexList[i]     = u16Index;
-      sstDisplay.au16IndexList[i + 1] = u16Index;
-      sstDisplay.au16IndexList[i + 2] = u16Index + 1;
-      sstDisplay.au16IndexList[i + 3] = u16Index + 2;
-      sstDisplay.au16IndexList[i + 4] = u16Index + 3;
-      sstDisplay.au16IndexList[i + 5] = u16Index + 3;
-    }
-
     /* Inits GLFW */
     eResult = (glfwInit() != GL_FALSE) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
 
@@ -4528,6 +5771,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_Init()
             orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NO_RESIZE, orxDISPLAY_KU32_STATIC_FLAG_NONE);
           }
 
+          /* Gets batch size, in vertices */
+          sstDisplay.s32BufferSize = 4 * (orxS32)((orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_BATCH_SIZE) != orxFALSE) ? orxCLAMP(orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_BATCH_SIZE), orxDISPLAY_KU32_MIN_BATCH_SIZE, orxDISPLAY_KU32_MAX_BATCH_SIZE) : orxDISPLAY_KU32_DEFAULT_BATCH_SIZE);
+
           /* Allocates screen bitmap */
           sstDisplay.pstScreen = (orxBITMAP *)orxBank_Allocate(sstDisplay.pstBitmapBank);
           orxMemory_Zero(sstDisplay.pstScreen, sizeof(orxBITMAP));
@@ -4594,6 +5840,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_Init()
             }
             else
             {
+              /* Deletes vertex & index buffers */
+              orxDisplay_GLFW_DeleteBuffers();
+
               /* Terminates GLFW */
               glfwTerminate();
 
@@ -4691,6 +5940,12 @@ void orxFASTCALL orxDisplay_GLFW_Exit()
       orxDisplay_DeleteShader(sstDisplay.pstNoTextureShader);
     }
 
+    /* Completes pending readbacks & deletes their buffers */
+    orxDisplay_GLFW_DeleteReadbacks();
+
+    /* Deletes vertex & index buffers */
+    orxDisplay_GLFW_DeleteBuffers();
+
     /* Exits from GLFW */
     glfwTerminate();
 
@@ -4742,7 +5997,7 @@ orxHANDLE orxFASTCALL orxDisplay_GLFW_CreateShader(const orxSTRING *_azCodeList,
       if(pstShader != orxNULL)
       {
         orxCHAR  *pc;
-        orxS32    s32Offset, s32Free;
+        orxS32    s32Offset, s32Free, s32UniformNumber = 0;
         orxU32    i;
 
         /* Inits shader code buffer */
@@ -4857,6 +6112,9 @@ orxHANDLE orxFASTCALL orxDisplay_GLFW_CreateShader(const orxSTRING *_azCodeList,
                 pc       += s32Offset;
                 s32Free  -= s32Offset;
 
+                /* Updates uniform number */
+                s32UniformNumber += (orxS32)orxMAX(pstParam->u32ArraySize, 1);
+
                 break;
               }
 
@@ -4877,6 +6135,9 @@ orxHANDLE orxFASTCALL orxDisplay_GLFW_CreateShader(const orxSTRING *_azCodeList,
                 pc       += s32Offset;
                 s32Free  -= s32Offset;
 
+                /* Updates uniform number */
+                s32UniformNumber += (orxS32)orxMAX(pstParam->u32ArraySize, 1);
+
                 break;
               }
 
@@ -4906,11 +6167,13 @@ orxHANDLE orxFASTCALL orxDisplay_GLFW_CreateShader(const orxSTRING *_azCodeList,
         pstShader->hProgram               = (GLhandleARB)orxU32_UNDEFINED;
         pstShader->iTextureCounter        = 0;
         pstShader->s32ParamCounter        = 0;
+        pstShader->s32UniformCounter      = 0;
+        pstShader->s32UniformNumber       = s32UniformNumber;
         pstShader->bPending               = orxFALSE;
-        pstShader->bUseCustomParam        = _bUseCustomParam;
         pstShader->zCode                  = orxString_Duplicate(sstDisplay.acShaderCodeBuffer);
         pstShader->astTextureInfoList     = (orxDISPLAY_TEXTURE_INFO *)orxMemory_Allocate(sstDisplay.iTextureUnitNumber * sizeof(orxDISPLAY_TEXTURE_INFO), orxMEMORY_TYPE_MAIN);
         pstShader->astParamInfoList       = (orxDISPLAY_PARAM_INFO *)orxMemory_Allocate(sstDisplay.iTextureUnitNumber * sizeof(orxDISPLAY_PARAM_INFO), orxMEMORY_TYPE_MAIN);
+        pstShader->astUniformInfoList     = (s32UniformNumber > 0) ? (orxDISPLAY_UNIFORM_INFO *)orxMemory_Allocate(s32UniformNumber * sizeof(orxDISPLAY_UNIFORM_INFO), orxMEMORY_TYPE_MAIN) : orxNULL;
         orxMemory_Zero(pstShader->astTextureInfoList, sstDisplay.iTextureUnitNumber * sizeof(orxDISPLAY_TEXTURE_INFO));
         orxMemory_Zero(pstShader->astParamInfoList, sstDisplay.iTextureUnitNumber * sizeof(orxDISPLAY_PARAM_INFO));
 
@@ -4931,6 +6194,9 @@ orxHANDLE orxFASTCALL orxDisplay_GLFW_CreateShader(const orxSTRING *_azCodeList,
           /* Deletes param info list */
           orxMemory_Free(pstShader->astParamInfoList);
 
+          /* Deletes uniform info list */
+          orxMemory_Free(pstShader->astUniformInfoList);
+
           /* Frees shader */
           orxBank_Free(sstDisplay.pstShaderBank, pstShader);
         }
@@ -4966,6 +6232,9 @@ void orxFASTCALL orxDisplay_GLFW_DeleteShader(orxHANDLE _hShader)
   /* Deletes its param info list */
   orxMemory_Free(pstShader->astParamInfoList);
 
+  /* Deletes its uniform info list */
+  orxMemory_Free(pstShader->astUniformInfoList);
+
   /* Frees it */
   orxBank_Free(sstDisplay.pstShaderBank, pstShader);
 
@@ -4984,8 +6253,8 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_StartShader(orxHANDLE _hShader)
   /* Gets shader */
   pstShader = (orxDISPLAY_SHADER *)_hShader;
 
-  /* Not pending or use custom param? */
-  if((pstShader->bPending == orxFALSE) || (pstShader->bUseCustomParam != orxFALSE))
+  /* Not pending? */
+  if(pstShader->bPending == orxFALSE)
   {
     /* Draw remaining items */
     orxDisplay_GLFW_DrawArrays();
@@ -5072,31 +6341,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_StopShader(orxHANDLE _hShader)
         /* Removes it from active list */
         orxLinkList_Remove(&(pstShader->stNode));
       }
-      /* Using custom param? */
-      else if(pstShader->bUseCustomParam != orxFALSE)
-      {
-        /* Has something to display? */
-        if(sstDisplay.s32BufferIndex > 0)
-        {
-          /* Draws arrays */
-          orxDisplay_GLFW_DrawArrays();
-
-          /* Don't reset shader */
-          bResetShader = orxFALSE;
-        }
-
-        /* Clears texture counter */
-        pstShader->iTextureCounter = 0;
-
-        /* Clears texture info list */
-        orxMemory_Zero(pstShader->astTextureInfoList, sstDisplay.iTextureUnitNumber * sizeof(orxDISPLAY_TEXTURE_INFO));
-
-        /* Removes it from active list */
-        orxLinkList_Remove(&(pstShader->stNode));
-      }
       else
       {
-        /* Marks it as pending */
+        /* Marks it as pending (parameter changes on next use will flush it, see orxDisplay_GLFW_FlushShader()) */
         pstShader->bPending = orxTRUE;
 
         /* Updates counter */
@@ -5218,6 +6465,8 @@ orxS32 orxFASTCALL orxDisplay_GLFW_GetParameterID(const orxHANDLE _hShader, cons
   }
   else
   {
+    GLint iLocation;
+
     /* Array? */
     if(_s32Index >= 0)
     {
@@ -5228,21 +6477,85 @@ orxS32 orxFASTCALL orxDisplay_GLFW_GetParameterID(const orxHANDLE _hShader, cons
       acBuffer[sizeof(acBuffer) - 1] = orxCHAR_NULL;
 
       /* Gets parameter location */
-      s32Result = (orxS32)glGetUniformLocationARB(pstShader->hProgram, acBuffer);
+      iLocation = glGetUniformLocationARB(pstShader->hProgram, acBuffer);
       glASSERT();
     }
     else
     {
       /* Gets parameter location */
-      s32Result = (orxS32)glGetUniformLocationARB(pstShader->hProgram, (const GLcharARB *)_zParam);
+      iLocation = glGetUniformLocationARB(pstShader->hProgram, (const GLcharARB *)_zParam);
       glASSERT();
     }
+
+    /* Updates result */
+    s32Result = -1;
+
+    /* Valid? */
+    if(iLocation >= 0)
+    {
+      orxS32 i;
+
+      /* For all known uniforms */
+      for(i = 0; i < pstShader->s32UniformCounter; i++)
+      {
+        /* Same location? */
+        if(pstShader->astUniformInfoList[i].iLocation == iLocation)
+        {
+          /* Updates result */
+          s32Result = i;
+
+          break;
+        }
+      }
+
+      /* Not found? */
+      if(s32Result < 0)
+      {
+        /* Has free slot left? */
+        if(pstShader->s32UniformCounter < pstShader->s32UniformNumber)
+        {
+          orxDISPLAY_UNIFORM_INFO *pstInfo;
+
+          /* Gets corresponding uniform info */
+          pstInfo = &pstShader->astUniformInfoList[pstShader->s32UniformCounter];
+
+          /* Inits it */
+          pstInfo->iLocation  = iLocation;
+          pstInfo->bValid     = orxFALSE;
+
+          /* Updates result */
+          s32Result = pstShader->s32UniformCounter++;
+        }
+        else
+        {
+          /* Outputs log */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't get ID of parameter <%s> for fragment shader: all the <%d> uniform slots are used.", _zParam, pstShader->s32UniformNumber);
+        }
+      }
+    }
   }
 
   /* Done! */
   return s32Result;
 }
 
+static orxINLINE void orxDisplay_GLFW_FlushShader(const orxDISPLAY_SHADER *_pstShader)
+{
+  /* Has pending geometry? */
+  if(sstDisplay.s32BufferIndex > 0)
+  {
+    /* Draws remaining items, using the current parameter values */
+    orxDisplay_GLFW_DrawArrays();
+
+    /* Restores its program, reset when drawing */
+    glUseProgramObjectARB(_pstShader->hProgram);
+    glASSERT();
+  }
+
+  /* Done! */
+  return;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderBitmap(orxHANDLE _hShader, orxS32 _s32ID, const orxBITMAP *_pstValue)
 {
   orxDISPLAY_SHADER  *pstShader;
@@ -5257,43 +6570,43 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderBitmap(orxHANDLE _hShader, orxS32
   /* Gets shader */
   pstShader = (orxDISPLAY_SHADER *)_hShader;
 
-  /* For all already used texture units */
-  for(i = 0; i < pstShader->iTextureCounter; i++)
+  /* Valid? */
+  if((_s32ID >= 0) && (_s32ID < pstShader->s32ParamCounter))
   {
-    /* Same location? */
-    if(pstShader->astTextureInfoList[i].iLocation == pstShader->astParamInfoList[_s32ID].iLocation)
+    /* For all already used texture units */
+    for(i = 0; i < pstShader->iTextureCounter; i++)
     {
-      /* Different texture? */
-      if(pstShader->astTextureInfoList[i].pstBitmap != _pstValue)
+      /* Same location? */
+      if(pstShader->astTextureInfoList[i].iLocation == pstShader->astParamInfoList[_s32ID].iLocation)
       {
-        /* Draws remaining items */
-        orxDisplay_GLFW_DrawArrays();
+        /* Different texture? */
+        if(pstShader->astTextureInfoList[i].pstBitmap != _pstValue)
+        {
+          /* Flushes shader */
+          orxDisplay_GLFW_FlushShader(pstShader);
 
-        /* Updates texture info */
-        pstShader->astTextureInfoList[i].pstBitmap = _pstValue;
+          /* Updates texture info */
+          pstShader->astTextureInfoList[i].pstBitmap = _pstValue;
 
-        /* Updates corner values */
-        glUNIFORM(1fARB, pstShader->astParamInfoList[_s32ID].iLocationTop, (GLfloat)(_pstValue->fRecRealHeight * _pstValue->stClip.vTL.fY));
-        glUNIFORM(1fARB, pstShader->astParamInfoList[_s32ID].iLocationLeft, (GLfloat)(_pstValue->fRecRealWidth * _pstValue->stClip.vTL.fX));
-        glUNIFORM(1fARB, pstShader->astParamInfoList[_s32ID].iLocationBottom, (GLfloat)(_pstValue->fRecRealHeight * _pstValue->stClip.vBR.fY));
-        glUNIFORM(1fARB, pstShader->astParamInfoList[_s32ID].iLocationRight, (GLfloat)(_pstValue->fRecRealWidth * _pstValue->stClip.vBR.fX));
-      }
+          /* Updates corner values */
+          glUNIFORM(1fARB, pstShader->astParamInfoList[_s32ID].iLocationTop, (GLfloat)(_pstValue->fRecRealHeight * _pstValue->stClip.vTL.fY));
+          glUNIFORM(1fARB, pstShader->astParamInfoList[_s32ID].iLocationLeft, (GLfloat)(_pstValue->fRecRealWidth * _pstValue->stClip.vTL.fX));
+          glUNIFORM(1fARB, pstShader->astParamInfoList[_s32ID].iLocationBottom, (GLfloat)(_pstValue->fRecRealHeight * _pstValue->stClip.vBR.fY));
+          glUNIFORM(1fARB, pstShader->astParamInfoList[_s32ID].iLocationRight, (GLfloat)(_pstValue->fRecRealWidth * _pstValue->stClip.vBR.fX));
+        }
 
-      /* Updates result */
-      eResult = orxSTATUS_SUCCESS;
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
 
-      break;
+        break;
+      }
     }
-  }
 
-  /* Not already done? */
-  if(eResult == orxSTATUS_FAILURE)
-  {
-    /* Has free texture unit left? */
-    if(pstShader->iTextureCounter < sstDisplay.iTextureUnitNumber)
+    /* Not already done? */
+    if(eResult == orxSTATUS_FAILURE)
     {
-      /* Valid? */
-      if(_s32ID >= 0)
+      /* Has free texture unit left? */
+      if(pstShader->iTextureCounter < sstDisplay.iTextureUnitNumber)
       {
         /* No bitmap? */
         if(_pstValue == orxNULL)
@@ -5321,14 +6634,14 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderBitmap(orxHANDLE _hShader, orxS32
       else
       {
         /* Outputs log */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't bind texture parameter (ID <%d>) for fragment shader: invalid ID.", _s32ID);
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't bind texture parameter (ID <%d>) for fragment shader: all the texture units are used.", _s32ID);
       }
     }
-    else
-    {
-      /* Outputs log */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't bind texture parameter (ID <%d>) for fragment shader: all the texture units are used.", _s32ID);
-    }
+  }
+  else
+  {
+    /* Outputs log */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't bind texture parameter (ID <%d>) for fragment shader: invalid ID.", _s32ID);
   }
 
   /* Done! */
@@ -5337,17 +6650,37 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderBitmap(orxHANDLE _hShader, orxS32
 
 orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderFloat(orxHANDLE _hShader, orxS32 _s32ID, orxFLOAT _fValue)
 {
-  orxSTATUS eResult;
+  orxDISPLAY_SHADER  *pstShader;
+  orxSTATUS           eResult;
 
   /* Checks */
   orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
   orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
 
+  /* Gets shader */
+  pstShader = (orxDISPLAY_SHADER *)_hShader;
+
   /* Valid? */
-  if(_s32ID >= 0)
+  if((_s32ID >= 0) && (_s32ID < pstShader->s32UniformCounter))
   {
-    /* Updates its value (no glASSERT() as this can be set more than once per use and would trigger it) */
-    glUNIFORM_NO_ASSERT(1fARB, (GLint)_s32ID, (GLfloat)_fValue);
+    orxDISPLAY_UNIFORM_INFO *pstInfo;
+
+    /* Gets uniform info */
+    pstInfo = &(pstShader->astUniformInfoList[_s32ID]);
+
+    /* New value? */
+    if((pstInfo->bValid == orxFALSE) || (pstInfo->afValue[0] != (GLfloat)_fValue))
+    {
+      /* Flushes shader */
+      orxDisplay_GLFW_FlushShader(pstShader);
+
+      /* Updates its value (no glASSERT() as this can be set more than once per use and would trigger it) */
+      glUNIFORM_NO_ASSERT(1fARB, pstInfo->iLocation, (GLfloat)_fValue);
+
+      /* Stores it */
+      pstInfo->afValue[0] = (GLfloat)_fValue;
+      pstInfo->bValid     = orxTRUE;
+    }
 
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
@@ -5364,18 +6697,43 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderFloat(orxHANDLE _hShader, orxS32
 
 orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderVector(orxHANDLE _hShader, orxS32 _s32ID, const orxVECTOR *_pvValue)
 {
-  orxSTATUS eResult;
+  orxDISPLAY_SHADER  *pstShader;
+  orxSTATUS           eResult;
 
   /* Checks */
   orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
   orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
   orxASSERT(_pvValue != orxNULL);
 
+  /* Gets shader */
+  pstShader = (orxDISPLAY_SHADER *)_hShader;
+
   /* Valid? */
-  if(_s32ID >= 0)
+  if((_s32ID >= 0) && (_s32ID < pstShader->s32UniformCounter))
   {
-    /* Updates its value (no glASSERT() as this can be set more than once per use and would trigger it) */
-    glUNIFORM_NO_ASSERT(3fARB, (GLint)_s32ID, (GLfloat)_pvValue->fX, (GLfloat)_pvValue->fY, (GLfloat)_pvValue->fZ);
+    orxDISPLAY_UNIFORM_INFO *pstInfo;
+
+    /* Gets uniform info */
+    pstInfo = &(pstShader->astUniformInfoList[_s32ID]);
+
+    /* New value? */
+    if((pstInfo->bValid == orxFALSE)
+    || (pstInfo->afValue[0] != (GLfloat)_pvValue->fX)
+    || (pstInfo->afValue[1] != (GLfloat)_pvValue->fY)
+    || (pstInfo->afValue[2] != (GLfloat)_pvValue->fZ))
+    {
+      /* Flushes shader */
+      orxDisplay_GLFW_FlushShader(pstShader);
+
+      /* Updates its value (no glASSERT() as this can be set more than once per use and would trigger it) */
+      glUNIFORM_NO_ASSERT(3fARB, pstInfo->iLocation, (GLfloat)_pvValue->fX, (GLfloat)_pvValue->fY, (GLfloat)_pvValue->fZ);
+
+      /* Stores it */
+      pstInfo->afValue[0] = (GLfloat)_pvValue->fX;
+      pstInfo->afValue[1] = (GLfloat)_pvValue->fY;
+      pstInfo->afValue[2] = (GLfloat)_pvValue->fZ;
+      pstInfo->bValid     = orxTRUE;
+    }
 
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
@@ -5414,12 +6772,14 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetBitmapClipping, DISPLAY, SET
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetBitmapColorKey, DISPLAY, SET_BITMAP_COLOR_KEY);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetBitmapData, DISPLAY, SET_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_RequestBitmapData, DISPLAY, REQUEST_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetBitmapColor, DISPLAY, SET_BITMAP_COLOR);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetBitmapColor, DISPLAY, GET_BITMAP_COLOR);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetBitmapID, DISPLAY, GET_BITMAP_ID);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_TransformBitmap, DISPLAY, TRANSFORM_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_TransformText, DISPLAY, TRANSFORM_TEXT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_TransformCharacterQuads, DISPLAY, TRANSFORM_CHARACTER_QUADS);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_DrawLine, DISPLAY, DRAW_LINE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_DrawPolyline, DISPLAY, DRAW_POLYLINE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_DrawPolygon, DISPLAY, DRAW_POLYGON);
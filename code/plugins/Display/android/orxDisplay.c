@@ -1143,7 +1143,7 @@ static void orxFASTCALL orxDisplay_Android_ReadResourceCallback(orxHANDLE _hReso
   if(orxFLAG_TEST(pstInfo->pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
   {
     /* Runs asynchronous task */
-    if(orxThread_RunTask(&orxDisplay_Android_DecompressBitmap, orxDisplay_Android_DecompressBitmapCallback, orxNULL, (void *)pstInfo) == orxSTATUS_FAILURE)
+    if(orxThread_RunParallelTask(&orxDisplay_Android_DecompressBitmap, orxDisplay_Android_DecompressBitmapCallback, orxNULL, (void *)pstInfo) == orxSTATUS_FAILURE)
     {
       /* Frees load info */
       orxMemory_Free(pstInfo);
@@ -2075,7 +2075,7 @@ orxSTATUS orxFASTCALL orxDisplay_Android_TransformText(const orxSTRING _zString,
         const orxCHARACTER_GLYPH *pstGlyph;
 
         /* Gets glyph from table */
-        pstGlyph = (orxCHARACTER_GLYPH *) orxHashTable_Get(_pstMap->pstCharacterTable, u32CharacterCodePoint);
+        pstGlyph = orxCharacterMap_GetGlyph(_pstMap, u32CharacterCodePoint);
         orxFLOAT                  fWidth;
 
         /* Valid? */
@@ -2137,6 +2137,117 @@ orxSTATUS orxFASTCALL orxDisplay_Android_TransformText(const orxSTRING _zString,
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_Android_TransformCharacterQuads(const orxCHARACTER_QUAD *_astQuadList, orxU32 _u32QuadCounter, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxDISPLAY_MATRIX         mTransform;
+  const orxCHARACTER_QUAD  *pstQuad, *pstEnd;
+  GLfloat                   fHeight, fRecWidth, fRecHeight;
+  orxRGBA                   stRGBA;
+  orxSTATUS                 eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astQuadList != orxNULL) || (_u32QuadCounter == 0));
+  orxASSERT(_pstFont != orxNULL);
+  orxASSERT(_pstMap != orxNULL);
+  orxASSERT(_pstTransform != orxNULL);
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxDisplay_TransformCharacterQuads");
+
+  /* Inits matrix */
+  orxDisplay_Android_InitMatrix(&mTransform, _pstTransform->fDstX, _pstTransform->fDstY, _pstTransform->fScaleX, _pstTransform->fScaleY, _pstTransform->fRotation, _pstTransform->fSrcX, _pstTransform->fSrcY);
+
+  /* Gets character's height, texture scales & color */
+  fHeight     = _pstMap->fCharacterHeight;
+  fRecWidth   = (GLfloat)_pstFont->fRecRealWidth;
+  fRecHeight  = (GLfloat)_pstFont->fRecRealHeight;
+  stRGBA      = _pstFont->stColor;
+
+  /* Prepares font for drawing */
+  orxDisplay_Android_PrepareBitmap(_pstFont, _eSmoothing, _eBlendMode);
+
+  /* For all quads */
+  for(pstQuad = _astQuadList, pstEnd = _astQuadList + _u32QuadCounter; pstQuad < pstEnd;)
+  {
+    const orxCHARACTER_QUAD    *pstBatchEnd;
+    orxDISPLAY_ANDROID_VERTEX  *pstVertex;
+
+    /* End of buffer? */
+    if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
+    {
+      /* Draws arrays */
+      orxDisplay_Android_DrawArrays();
+    }
+
+    /* Gets the quads that fit in the buffer */
+    pstBatchEnd = pstQuad + orxMIN((orxU32)(pstEnd - pstQuad), (orxU32)(orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - sstDisplay.s32BufferIndex) >> 2);
+    pstVertex   = &(sstDisplay.astVertexList[sstDisplay.s32BufferIndex]);
+
+    /* Updates buffer index */
+    sstDisplay.s32BufferIndex += (orxS32)(pstBatchEnd - pstQuad) << 2;
+
+    {
+      GLfloat fDownX, fDownY, fDownV, fBorderU, fBorderV, fRightU;
+
+      /* Inits constant terms */
+      fDownX    = mTransform.vX.fY * fHeight;
+      fDownY    = mTransform.vY.fY * fHeight;
+      fDownV    = fRecHeight * (fHeight - 2.0f * orxDISPLAY_KF_BORDER_FIX);
+      fBorderU  = fRecWidth * orxDISPLAY_KF_BORDER_FIX;
+      fBorderV  = fRecHeight * orxDISPLAY_KF_BORDER_FIX;
+      fRightU   = -2.0f * fBorderU;
+
+      /* For all quads in batch */
+      for(; pstQuad < pstBatchEnd; pstQuad++, pstVertex += 4)
+      {
+        GLfloat fX, fY, fRightX, fRightY, fU0, fU1, fV0, fV1;
+
+        /* Computes top left vertex & right offset */
+        fX      = (mTransform.vX.fX * pstQuad->fX) + (mTransform.vX.fY * pstQuad->fY) + mTransform.vX.fZ;
+        fY      = (mTransform.vY.fX * pstQuad->fX) + (mTransform.vY.fY * pstQuad->fY) + mTransform.vY.fZ;
+        fRightX = mTransform.vX.fX * pstQuad->fWidth;
+        fRightY = mTransform.vY.fX * pstQuad->fWidth;
+        fU0     = (fRecWidth * pstQuad->fU) + fBorderU;
+        fU1     = fU0 + (fRecWidth * pstQuad->fWidth) + fRightU;
+        fV0     = (fRecHeight * pstQuad->fV) + fBorderV;
+        fV1     = fV0 + fDownV;
+
+        /* Outputs vertices and texture coordinates */
+        pstVertex[0].fX = fX + fDownX;
+        pstVertex[0].fY = fY + fDownY;
+        pstVertex[1].fX = fX;
+        pstVertex[1].fY = fY;
+        pstVertex[2].fX = fX + fRightX + fDownX;
+        pstVertex[2].fY = fY + fRightY + fDownY;
+        pstVertex[3].fX = fX + fRightX;
+        pstVertex[3].fY = fY + fRightY;
+
+        pstVertex[0].fU =
+        pstVertex[1].fU = fU0;
+        pstVertex[2].fU =
+        pstVertex[3].fU = fU1;
+        pstVertex[1].fV =
+        pstVertex[3].fV = fV0;
+        pstVertex[0].fV =
+        pstVertex[2].fV = fV1;
+
+        /* Fills the color list */
+        pstVertex[0].stRGBA =
+        pstVertex[1].stRGBA =
+        pstVertex[2].stRGBA =
+        pstVertex[3].stRGBA = stRGBA;
+      }
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_Android_DrawLine(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxRGBA _stColor)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
@@ -2819,6 +2930,53 @@ orxSTATUS orxFASTCALL orxDisplay_Android_GetBitmapData(const orxBITMAP *_pstBitm
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_Android_RequestBitmapData(const orxBITMAP *_pstBitmap, void *_pContext)
+{
+  orxU32    u32BufferSize;
+  orxU8    *pu8ImageData;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Gets buffer size */
+  u32BufferSize = orxF2U(_pstBitmap->fWidth * _pstBitmap->fHeight) * 4 * sizeof(orxU8);
+
+  /* Allocates buffer */
+  pu8ImageData = (orxU8 *)orxMemory_Allocate(u32BufferSize, orxMEMORY_TYPE_MAIN);
+
+  /* Valid? */
+  if(pu8ImageData != orxNULL)
+  {
+    /* Gets bitmap data (no asynchronous readback on this platform) */
+    eResult = orxDisplay_Android_GetBitmapData(_pstBitmap, pu8ImageData, u32BufferSize);
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      orxDISPLAY_EVENT_PAYLOAD stPayload;
+
+      /* Inits event payload */
+      orxMemory_Zero(&stPayload, sizeof(orxDISPLAY_EVENT_PAYLOAD));
+      stPayload.stBitmapData.au8Data    = pu8ImageData;
+      stPayload.stBitmapData.u32Width   = orxF2U(_pstBitmap->fWidth);
+      stPayload.stBitmapData.u32Height  = orxF2U(_pstBitmap->fHeight);
+      stPayload.stBitmapData.u32ID      = (_pstBitmap != sstDisplay.pstScreen) ? (orxU32)_pstBitmap->uiTexture : 0;
+      stPayload.stBitmapData.pContext   = _pContext;
+
+      /* Sends event right away */
+      orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_READ_BITMAP, orxNULL, orxNULL, &stPayload);
+    }
+
+    /* Frees buffer */
+    orxMemory_Free(pu8ImageData);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_Android_SetBitmapColorKey(orxBITMAP *_pstBitmap, orxRGBA _stColor, orxBOOL _bEnable)
 {
   orxSTATUS eResult = orxSTATUS_FAILURE;
@@ -3375,7 +3533,7 @@ orxSTATUS orxFASTCALL orxDisplay_Android_SaveBitmap(const orxBITMAP *_pstBitmap,
         pstInfo->u32Height      = orxF2U(_pstBitmap->fHeight);
 
         /* Runs asynchronous task */
-        eResult = orxThread_RunTask(&orxDisplay_Android_SaveBitmapData, orxNULL, orxNULL, (void *)pstInfo);
+        eResult = orxThread_RunParallelTask(&orxDisplay_Android_SaveBitmapData, orxNULL, orxNULL, (void *)pstInfo);
       }
     }
 
@@ -4857,6 +5015,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetTempBitmap, DISPLAY, GET_
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetDestinationBitmaps, DISPLAY, SET_DESTINATION_BITMAPS);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_TransformBitmap, DISPLAY, TRANSFORM_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_TransformText, DISPLAY, TRANSFORM_TEXT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_TransformCharacterQuads, DISPLAY, TRANSFORM_CHARACTER_QUADS);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_LoadBitmap, DISPLAY, LOAD_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetScreenSize, DISPLAY, GET_SCREEN_SIZE);
@@ -4867,6 +5026,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetBitmapClipping, DISPLAY,
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetBitmapID, DISPLAY, GET_BITMAP_ID);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetBitmapData, DISPLAY, SET_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_RequestBitmapData, DISPLAY, REQUEST_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetBitmapColorKey, DISPLAY, SET_BITMAP_COLOR_KEY);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetBitmapColor, DISPLAY, SET_BITMAP_COLOR);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetBitmapColor, DISPLAY, GET_BITMAP_COLOR);
@@ -1764,7 +1764,7 @@ static void orxFASTCALL orxDisplay_iOS_ReadResourceCallback(orxHANDLE _hResource
   if(orxFLAG_TEST(pstInfo->pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
   {
     /* Runs asynchronous task */
-    if(orxThread_RunTask(&orxDisplay_iOS_DecompressBitmap, orxDisplay_iOS_DecompressBitmapCallback, orxNULL, (void *)pstInfo) == orxSTATUS_FAILURE)
+    if(orxThread_RunParallelTask(&orxDisplay_iOS_DecompressBitmap, orxDisplay_iOS_DecompressBitmapCallback, orxNULL, (void *)pstInfo) == orxSTATUS_FAILURE)
     {
       /* Frees load info */
       orxMemory_Free(pstInfo);
@@ -2555,7 +2555,7 @@ orxSTATUS orxFASTCALL orxDisplay_iOS_TransformText(const orxSTRING _zString, con
         orxFLOAT                  fWidth;
 
         /* Gets glyph from table */
-        pstGlyph = (orxCHARACTER_GLYPH *)orxHashTable_Get(_pstMap->pstCharacterTable, u32CharacterCodePoint);
+        pstGlyph = orxCharacterMap_GetGlyph(_pstMap, u32CharacterCodePoint);
 
         /* Valid? */
         if(pstGlyph != orxNULL)
@@ -2616,6 +2616,117 @@ orxSTATUS orxFASTCALL orxDisplay_iOS_TransformText(const orxSTRING _zString, con
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_iOS_TransformCharacterQuads(const orxCHARACTER_QUAD *_astQuadList, orxU32 _u32QuadCounter, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxDISPLAY_MATRIX         mTransform;
+  const orxCHARACTER_QUAD  *pstQuad, *pstEnd;
+  GLfloat                   fHeight, fRecWidth, fRecHeight;
+  orxRGBA                   stRGBA;
+  orxSTATUS                 eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astQuadList != orxNULL) || (_u32QuadCounter == 0));
+  orxASSERT(_pstFont != orxNULL);
+  orxASSERT(_pstMap != orxNULL);
+  orxASSERT(_pstTransform != orxNULL);
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxDisplay_TransformCharacterQuads");
+
+  /* Inits matrix */
+  orxDisplay_iOS_InitMatrix(&mTransform, _pstTransform->fDstX, _pstTransform->fDstY, _pstTransform->fScaleX, _pstTransform->fScaleY, _pstTransform->fRotation, _pstTransform->fSrcX, _pstTransform->fSrcY);
+
+  /* Gets character's height, texture scales & color */
+  fHeight     = _pstMap->fCharacterHeight;
+  fRecWidth   = (GLfloat)_pstFont->fRecRealWidth;
+  fRecHeight  = (GLfloat)_pstFont->fRecRealHeight;
+  stRGBA      = _pstFont->stColor;
+
+  /* Prepares font for drawing */
+  orxDisplay_iOS_PrepareBitmap(_pstFont, _eSmoothing, _eBlendMode);
+
+  /* For all quads */
+  for(pstQuad = _astQuadList, pstEnd = _astQuadList + _u32QuadCounter; pstQuad < pstEnd;)
+  {
+    const orxCHARACTER_QUAD  *pstBatchEnd;
+    orxDISPLAY_IOS_VERTEX    *pstVertex;
+
+    /* End of buffer? */
+    if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
+    {
+      /* Draws arrays */
+      orxDisplay_iOS_DrawArrays();
+    }
+
+    /* Gets the quads that fit in the buffer */
+    pstBatchEnd = pstQuad + orxMIN((orxU32)(pstEnd - pstQuad), (orxU32)(orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - sstDisplay.s32BufferIndex) >> 2);
+    pstVertex   = &(sstDisplay.astVertexList[sstDisplay.s32BufferIndex]);
+
+    /* Updates buffer index */
+    sstDisplay.s32BufferIndex += (orxS32)(pstBatchEnd - pstQuad) << 2;
+
+    {
+      GLfloat fDownX, fDownY, fDownV, fBorderU, fBorderV, fRightU;
+
+      /* Inits constant terms */
+      fDownX    = mTransform.vX.fY * fHeight;
+      fDownY    = mTransform.vY.fY * fHeight;
+      fDownV    = fRecHeight * (fHeight - 2.0f * orxDISPLAY_KF_BORDER_FIX);
+      fBorderU  = fRecWidth * orxDISPLAY_KF_BORDER_FIX;
+      fBorderV  = fRecHeight * orxDISPLAY_KF_BORDER_FIX;
+      fRightU   = -2.0f * fBorderU;
+
+      /* For all quads in batch */
+      for(; pstQuad < pstBatchEnd; pstQuad++, pstVertex += 4)
+      {
+        GLfloat fX, fY, fRightX, fRightY, fU0, fU1, fV0, fV1;
+
+        /* Computes top left vertex & right offset */
+        fX      = (mTransform.vX.fX * pstQuad->fX) + (mTransform.vX.fY * pstQuad->fY) + mTransform.vX.fZ;
+        fY      = (mTransform.vY.fX * pstQuad->fX) + (mTransform.vY.fY * pstQuad->fY) + mTransform.vY.fZ;
+        fRightX = mTransform.vX.fX * pstQuad->fWidth;
+        fRightY = mTransform.vY.fX * pstQuad->fWidth;
+        fU0     = (fRecWidth * pstQuad->fU) + fBorderU;
+        fU1     = fU0 + (fRecWidth * pstQuad->fWidth) + fRightU;
+        fV0     = (fRecHeight * pstQuad->fV) + fBorderV;
+        fV1     = fV0 + fDownV;
+
+        /* Outputs vertices and texture coordinates */
+        pstVertex[0].fX = fX + fDownX;
+        pstVertex[0].fY = fY + fDownY;
+        pstVertex[1].fX = fX;
+        pstVertex[1].fY = fY;
+        pstVertex[2].fX = fX + fRightX + fDownX;
+        pstVertex[2].fY = fY + fRightY + fDownY;
+        pstVertex[3].fX = fX + fRightX;
+        pstVertex[3].fY = fY + fRightY;
+
+        pstVertex[0].fU =
+        pstVertex[1].fU = fU0;
+        pstVertex[2].fU =
+        pstVertex[3].fU = fU1;
+        pstVertex[1].fV =
+        pstVertex[3].fV = fV0;
+        pstVertex[0].fV =
+        pstVertex[2].fV = fV1;
+
+        /* Fills the color list */
+        pstVertex[0].stRGBA =
+        pstVertex[1].stRGBA =
+        pstVertex[2].stRGBA =
+        pstVertex[3].stRGBA = stRGBA;
+      }
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_iOS_DrawLine(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxRGBA _stColor)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
@@ -3304,6 +3415,53 @@ orxSTATUS orxFASTCALL orxDisplay_iOS_GetBitmapData(const orxBITMAP *_pstBitmap,
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_iOS_RequestBitmapData(const orxBITMAP *_pstBitmap, void *_pContext)
+{
+  orxU32    u32BufferSize;
+  orxU8    *pu8ImageData;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Gets buffer size */
+  u32BufferSize = orxF2U(_pstBitmap->fWidth * _pstBitmap->fHeight) * 4 * sizeof(orxU8);
+
+  /* Allocates buffer */
+  pu8ImageData = (orxU8 *)orxMemory_Allocate(u32BufferSize, orxMEMORY_TYPE_MAIN);
+
+  /* Valid? */
+  if(pu8ImageData != orxNULL)
+  {
+    /* Gets bitmap data (no asynchronous readback on this platform) */
+    eResult = orxDisplay_iOS_GetBitmapData(_pstBitmap, pu8ImageData, u32BufferSize);
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      orxDISPLAY_EVENT_PAYLOAD stPayload;
+
+      /* Inits event payload */
+      orxMemory_Zero(&stPayload, sizeof(orxDISPLAY_EVENT_PAYLOAD));
+      stPayload.stBitmapData.au8Data    = pu8ImageData;
+      stPayload.stBitmapData.u32Width   = orxF2U(_pstBitmap->fWidth);
+      stPayload.stBitmapData.u32Height  = orxF2U(_pstBitmap->fHeight);
+      stPayload.stBitmapData.u32ID      = (_pstBitmap != sstDisplay.pstScreen) ? (orxU32)_pstBitmap->uiTexture : 0;
+      stPayload.stBitmapData.pContext   = _pContext;
+
+      /* Sends event right away */
+      orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_READ_BITMAP, orxNULL, orxNULL, &stPayload);
+    }
+
+    /* Frees buffer */
+    orxMemory_Free(pu8ImageData);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_iOS_SetBitmapColorKey(orxBITMAP *_pstBitmap, orxRGBA _stColor, orxBOOL _bEnable)
 {
   orxSTATUS eResult = orxSTATUS_FAILURE;
@@ -3662,7 +3820,7 @@ orxSTATUS orxFASTCALL orxDisplay_iOS_SaveBitmap(const orxBITMAP *_pstBitmap, con
         pstInfo->u32Height      = orxF2U(_pstBitmap->fHeight);
 
         /* Runs asynchronous task */
-        eResult = orxThread_RunTask(&orxDisplay_iOS_SaveBitmapData, orxNULL, orxNULL, (void *)pstInfo);
+        eResult = orxThread_RunParallelTask(&orxDisplay_iOS_SaveBitmapData, orxNULL, orxNULL, (void *)pstInfo);
       }
     }
 
@@ -4909,12 +5067,14 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_SetBitmapClipping, DISPLAY, SET_
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_SetBitmapColorKey, DISPLAY, SET_BITMAP_COLOR_KEY);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_SetBitmapData, DISPLAY, SET_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_RequestBitmapData, DISPLAY, REQUEST_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_SetBitmapColor, DISPLAY, SET_BITMAP_COLOR);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_GetBitmapColor, DISPLAY, GET_BITMAP_COLOR);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_GetBitmapID, DISPLAY, GET_BITMAP_ID);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_TransformBitmap, DISPLAY, TRANSFORM_BITMAP);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_TransformText, DISPLAY, TRANSFORM_TEXT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_TransformCharacterQuads, DISPLAY, TRANSFORM_CHARACTER_QUADS);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_DrawLine, DISPLAY, DRAW_LINE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_DrawPolyline, DISPLAY, DRAW_POLYLINE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_DrawPolygon, DISPLAY, DRAW_POLYGON);
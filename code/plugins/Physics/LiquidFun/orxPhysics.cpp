@@ -79,6 +79,15 @@
 
 #define orxPHYSICS_KU32_STATIC_MASK_ALL         0xFFFFFFFF /**< All mask */
 
+
+/** Body flags
+ */
+#define orxPHYSICS_KU32_BODY_FLAG_NONE          0x00000000 /**< No flags */
+
+#define orxPHYSICS_KU32_BODY_FLAG_SYNCED        0x00000001 /**< Synced flag: Box2D state matches the last pushed orx state */
+
+#define orxPHYSICS_KU32_BODY_MASK_ALL           0xFFFFFFFF /**< All mask */
+
 namespace orxPhysics
 {
   static const orxU32   su32DefaultIterations   = 10;
@@ -86,6 +95,7 @@ namespace orxPhysics
   static const orxU32   su32MessageBankSize     = 512;
   static const orxU32   su32BodyBankSize        = 512;
   static const orxFLOAT sfDefaultFrequency      = orx2F(60.0f);
+  static const orxU32   su32RaycastListGrain    = 32;
 }
 
 /***************************************************************************
@@ -97,9 +107,13 @@ struct __orxPHYSICS_BODY_t
   orxLINKLIST_NODE                  stNode;            /**< Link list node */
   orxVECTOR                         vPreviousPosition; /**< Previous position */
   orxVECTOR                         vSmoothedPosition; /**< Smoothed position */
+  orxVECTOR                         vPushedSpeed;      /**< Last pushed speed */
+  orxVECTOR                         vPushedGravity;    /**< Last pushed gravity */
   b2Body                           *poBody;            /**< Box2D body */
   orxFLOAT                          fPreviousRotation; /**< Previous rotation */
   orxFLOAT                          fSmoothedRotation; /**< Smoothed rotation */
+  orxFLOAT                          fPushedAngularVelocity; /**< Last pushed angular velocity */
+  orxU32                            u32Flags;          /**< Flags */
 };
 
 /** Event storage
@@ -114,6 +128,18 @@ typedef struct __orxPHYSICS_EVENT_STORAGE_t
 
 } orxPHYSICS_EVENT_STORAGE;
 
+/** Raycast list
+ */
+typedef struct __orxPHYSICS_RAYCAST_LIST_t
+{
+  const orxPHYSICS_RAY             *astRayList;       /**< Ray list */
+  orxPHYSICS_RAY_HIT               *astHitList;       /**< Hit list */
+  orxBOOL                           bEarlyExit;       /**< Early exit */
+  orxU16                            u16SelfFlags;     /**< Self flags */
+  orxU16                            u16CheckMask;     /**< Check mask */
+
+} orxPHYSICS_RAYCAST_LIST;
+
 /** Contact listener
  */
 class orxPhysicsContactListener : public b2ContactListener
@@ -205,6 +231,12 @@ public:
   {
   }
 
+  bool ShouldQueryParticleSystem(const b2ParticleSystem *_poParticleSystem)
+  {
+    /* Only checks bodies */
+    return false;
+  }
+
   float32 ReportFixture(b2Fixture *_poFixture, const b2Vec2 &_rvContact, const b2Vec2 &_rvNormal, float32 _fFraction)
   {
     float32 fResult;
@@ -262,6 +294,154 @@ public:
   orxU16      u16CheckMask;
 };
 
+class QueryCallback : public b2QueryCallback
+{
+public:
+
+  QueryCallback() : poShape(NULL), ahUserDataList(orxNULL), u32Number(0), u32Counter(0), u16SelfFlags(0), u16CheckMask(0)
+  {
+    /* Inits query transform */
+    stTransform.SetIdentity();
+  }
+
+  bool ShouldQueryParticleSystem(const b2ParticleSystem *_poParticleSystem)
+  {
+    /* Only checks bodies */
+    return false;
+  }
+
+  bool ReportFixture(b2Fixture *_poFixture)
+  {
+    /* Gets fixture's filter info */
+    const b2Filter &rstFilter = _poFixture->GetFilterData();
+
+    /* Match? */
+    if(((rstFilter.maskBits & u16SelfFlags) != 0)
+    && ((rstFilter.categoryBits & u16CheckMask) != 0))
+    {
+      const b2Shape  *poFixtureShape;
+      b2Body         *poBody;
+      int32           i, iChildCount;
+      orxBOOL         bOverlap = orxFALSE;
+
+      /* Gets its body & shape */
+      poBody          = _poFixture->GetBody();
+      poFixtureShape  = _poFixture->GetShape();
+      iChildCount     = poFixtureShape->GetChildCount();
+
+      /* For all shape children */
+      for(i = 0; (i < iChildCount) && (bOverlap == orxFALSE); i++)
+      {
+        /* Has query shape? */
+        if(poShape != NULL)
+        {
+          /* Tests it */
+          bOverlap = b2TestOverlap(poShape, 0, poFixtureShape, i, stTransform, poBody->GetTransform()) ? orxTRUE : orxFALSE;
+        }
+        else
+        {
+          b2AABB stChildAABB;
+
+          /* Gets child's tight bounding box */
+          poFixtureShape->ComputeAABB(&stChildAABB, poBody->GetTransform(), i);
+
+          /* Tests it */
+          bOverlap = b2TestOverlap(stAABB, stChildAABB) ? orxTRUE : orxFALSE;
+        }
+      }
+
+      /* Overlap? */
+      if(bOverlap != orxFALSE)
+      {
+        orxHANDLE hUserData;
+        orxU32    u32Index = u32Counter;
+
+        /* Gets body's user data */
+        hUserData = (orxHANDLE)poBody->GetUserData();
+
+        /* Could body have already been stored? */
+        if((poBody->GetFixtureList()->GetNext() != NULL) || (iChildCount > 1))
+        {
+          /* For all stored bodies */
+          for(u32Index = 0; (u32Index < u32Counter) && (ahUserDataList[u32Index] != hUserData); u32Index++);
+        }
+
+        /* New body? */
+        if(u32Index == u32Counter)
+        {
+          /* Stores it */
+          ahUserDataList[u32Counter++] = hUserData;
+        }
+      }
+    }
+
+    /* Done! */
+    return (u32Counter < u32Number) ? true : false;
+  }
+
+  b2AABB          stAABB;
+  b2Transform     stTransform;
+  const b2Shape  *poShape;
+  orxHANDLE      *ahUserDataList;
+  orxU32          u32Number;
+  orxU32          u32Counter;
+  orxU16          u16SelfFlags;
+  orxU16          u16CheckMask;
+};
+
+static orxSTATUS orxFASTCALL orxPhysics_LiquidFun_ProcessRaycastList(orxU32 _u32Start, orxU32 _u32End, void *_pContext)
+{
+  const orxPHYSICS_RAYCAST_LIST  *pstRaycastList;
+  orxU32                          i;
+
+  /* Gets raycast list */
+  pstRaycastList = (const orxPHYSICS_RAYCAST_LIST *)_pContext;
+
+  /* For all rays in range */
+  for(i = _u32Start; i < _u32End; i++)
+  {
+    const orxPHYSICS_RAY *pstRay;
+    orxPHYSICS_RAY_HIT   *pstHit;
+    b2Vec2                vStart, vEnd;
+    RayCastCallback       oRaycastCallback;
+
+    /* Gets ray & hit */
+    pstRay = &(pstRaycastList->astRayList[i]);
+    pstHit = &(pstRaycastList->astHitList[i]);
+
+    /* Gets extremities */
+    vStart.Set(sstPhysics.fDimensionRatio * pstRay->vStart.fX, sstPhysics.fDimensionRatio * pstRay->vStart.fY);
+    vEnd.Set(sstPhysics.fDimensionRatio * pstRay->vEnd.fX, sstPhysics.fDimensionRatio * pstRay->vEnd.fY);
+
+    /* Inits filter data & early exit status */
+    oRaycastCallback.u16SelfFlags = pstRaycastList->u16SelfFlags;
+    oRaycastCallback.u16CheckMask = pstRaycastList->u16CheckMask;
+    oRaycastCallback.bEarlyExit   = pstRaycastList->bEarlyExit;
+
+    /* Issues raycast */
+    sstPhysics.poWorld->RayCast(&oRaycastCallback, vStart, vEnd);
+
+    /* Found? */
+    if(oRaycastCallback.hResult != orxHANDLE_UNDEFINED)
+    {
+      /* Stores hit */
+      pstHit->hUserData = oRaycastCallback.hResult;
+      orxVector_Set(&(pstHit->vContact), oRaycastCallback.vContact.fX, oRaycastCallback.vContact.fY, pstRay->vStart.fZ);
+      orxVector_Copy(&(pstHit->vNormal), &(oRaycastCallback.vNormal));
+    }
+    else
+    {
+      /* Clears hit */
+      pstHit->hUserData = orxHANDLE_UNDEFINED;
+      orxVector_Copy(&(pstHit->vContact), &orxVECTOR_0);
+      orxVector_Copy(&(pstHit->vNormal), &orxVECTOR_0);
+    }
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 static void orxFASTCALL orxPhysics_LiquidFun_SendContactEvent(b2Contact *_poContact, orxPHYSICS_EVENT _eEventID)
 {
   orxBODY_PART             *pstSourceBodyPart, *pstDestinationBodyPart;
@@ -936,6 +1116,7 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
   orxPHYSICS_EVENT_STORAGE *pstEventStorage;
   orxPHYSICS_BODY          *pstPhysicBody;
   b2Body                   *poBody;
+  orxVECTOR                 vWorldGravity;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxPhysics_Update");
@@ -944,6 +1125,9 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstClockInfo != orxNULL);
 
+  /* Gets world gravity */
+  orxPhysics_GetGravity(&vWorldGravity);
+
   /* For all physical bodies */
   for(pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetFirst(&(sstPhysics.stBodyList));
       pstPhysicBody != NULL;
@@ -966,7 +1150,8 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
       orxFRAME   *pstFrame;
       orxVECTOR   vSpeed, vGravity;
       orxCLOCK   *pstClock;
-      orxFLOAT    fCoef = orxFLOAT_1;
+      orxFLOAT    fCoef = orxFLOAT_1, fAngularVelocity;
+      orxBOOL     bSynced;
 
       /* Gets its clock */
       pstClock = orxObject_GetClock(pstObject);
@@ -990,6 +1175,10 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
       /* Enforces its activation state */
       poBody->SetActive(true);
 
+      /* Is Box2D state still matching the last pushed one? (static or sleeping bodies are not modified by the simulation) */
+      bSynced = (orxFLAG_TEST(pstPhysicBody->u32Flags, orxPHYSICS_KU32_BODY_FLAG_SYNCED)
+              && ((poBody->GetType() == b2_staticBody) || (poBody->IsAwake() == false))) ? orxTRUE : orxFALSE;
+
       /* Gets owner's frame */
       pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME);
 
@@ -1002,6 +1191,9 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
         orxVECTOR vPos, vScale;
         orxFRAME *pstParentFrame;
 
+        /* Always pushes its state */
+        bSynced = orxFALSE;
+
         /* Updates body position & rotation */
         orxPhysics_SetPosition(pstPhysicBody, orxFrame_GetPosition(pstFrame, orxFRAME_SPACE_GLOBAL, &vPos));
         orxPhysics_SetRotation(pstPhysicBody, orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL));
@@ -1014,19 +1206,48 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
         orxVector_Mul(&vSpeed, &vSpeed, orxFrame_GetScale(pstParentFrame, orxFRAME_SPACE_GLOBAL, &vScale));
       }
 
-      /* Applies speed & angular velocity */
-      orxPhysics_SetSpeed(pstPhysicBody, orxVector_Mulf(&vSpeed, &vSpeed, fCoef));
-      orxPhysics_SetAngularVelocity(pstPhysicBody, fCoef * orxBody_GetAngularVelocity(pstBody));
+      /* Gets modified speed & angular velocity */
+      orxVector_Mulf(&vSpeed, &vSpeed, fCoef);
+      fAngularVelocity = fCoef * orxBody_GetAngularVelocity(pstBody);
 
       /* No custom gravity */
       if(orxBody_GetCustomGravity(pstBody, &vGravity) == orxNULL)
       {
         /* Uses world gravity */
-        orxPhysics_GetGravity(&vGravity);
+        orxVector_Copy(&vGravity, &vWorldGravity);
       }
 
-      /* Applies modified gravity */
-      orxPhysics_SetCustomGravity(pstPhysicBody, orxVector_Mulf(&vGravity, &vGravity, fCoef * fCoef));
+      /* Gets modified gravity */
+      orxVector_Mulf(&vGravity, &vGravity, fCoef * fCoef);
+
+      /* Needs to push its state? */
+      if((bSynced == orxFALSE)
+      || (orxVector_AreEqual(&vSpeed, &(pstPhysicBody->vPushedSpeed)) == orxFALSE)
+      || (fAngularVelocity != pstPhysicBody->fPushedAngularVelocity)
+      || (orxVector_AreEqual(&vGravity, &(pstPhysicBody->vPushedGravity)) == orxFALSE))
+      {
+        /* Applies speed, angular velocity & gravity */
+        orxPhysics_SetSpeed(pstPhysicBody, &vSpeed);
+        orxPhysics_SetAngularVelocity(pstPhysicBody, fAngularVelocity);
+        orxPhysics_SetCustomGravity(pstPhysicBody, &vGravity);
+
+        /* Stores them */
+        orxVector_Copy(&(pstPhysicBody->vPushedSpeed), &vSpeed);
+        orxVector_Copy(&(pstPhysicBody->vPushedGravity), &vGravity);
+        pstPhysicBody->fPushedAngularVelocity = fAngularVelocity;
+
+        /* Won't be modified by the simulation? */
+        if((poBody->GetType() == b2_staticBody) || (poBody->IsAwake() == false))
+        {
+          /* Updates status */
+          orxFLAG_SET(pstPhysicBody->u32Flags, orxPHYSICS_KU32_BODY_FLAG_SYNCED, orxPHYSICS_KU32_BODY_FLAG_NONE);
+        }
+        else
+        {
+          /* Updates status */
+          orxFLAG_SET(pstPhysicBody->u32Flags, orxPHYSICS_KU32_BODY_FLAG_NONE, orxPHYSICS_KU32_BODY_FLAG_SYNCED);
+        }
+      }
     }
     else
     {
@@ -1036,6 +1257,9 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
         /* Deactivates it */
         poBody->SetActive(false);
       }
+
+      /* Updates status */
+      orxFLAG_SET(pstPhysicBody->u32Flags, orxPHYSICS_KU32_BODY_FLAG_NONE, orxPHYSICS_KU32_BODY_FLAG_SYNCED);
     }
   }
 
@@ -2117,6 +2341,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetSpeed(orxPHYSICS_BODY *
 
     /* Updates its speed */
     poBody->SetLinearVelocity(vSpeed);
+
+    /* Updates status */
+    orxFLAG_SET(_pstBody->u32Flags, orxPHYSICS_KU32_BODY_FLAG_NONE, orxPHYSICS_KU32_BODY_FLAG_SYNCED);
   }
 
   /* Done! */
@@ -2147,6 +2374,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetAngularVelocity(orxPHYS
 
     /* Updates its angular velocity */
     poBody->SetAngularVelocity(_fVelocity);
+
+    /* Updates status */
+    orxFLAG_SET(_pstBody->u32Flags, orxPHYSICS_KU32_BODY_FLAG_NONE, orxPHYSICS_KU32_BODY_FLAG_SYNCED);
   }
 
   /* Done! */
@@ -2185,6 +2415,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetCustomGravity(orxPHYSIC
 
       /* Updates it */
       poBody->SetCustomGravity(&vGravity);
+
+      /* Updates status */
+      orxFLAG_SET(_pstBody->u32Flags, orxPHYSICS_KU32_BODY_FLAG_NONE, orxPHYSICS_KU32_BODY_FLAG_SYNCED);
     }
   }
   else
@@ -2197,6 +2430,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetCustomGravity(orxPHYSIC
 
       /* Removes it */
       poBody->SetCustomGravity(orxNULL);
+
+      /* Updates status */
+      orxFLAG_SET(_pstBody->u32Flags, orxPHYSICS_KU32_BODY_FLAG_NONE, orxPHYSICS_KU32_BODY_FLAG_SYNCED);
     }
   }
 
@@ -2876,6 +3112,161 @@ extern "C" orxHANDLE orxFASTCALL orxPhysics_LiquidFun_Raycast(const orxVECTOR *_
   return hResult;
 }
 
+extern "C" orxU32 orxFASTCALL orxPhysics_LiquidFun_RaycastList(const orxPHYSICS_RAY *_astRayList, orxU32 _u32Number, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxBOOL _bEarlyExit, orxPHYSICS_RAY_HIT *_astHitList)
+{
+  orxPHYSICS_RAYCAST_LIST stRaycastList;
+  orxU32                  i, u32Result = 0;
+
+  /* Checks */
+  orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astRayList != orxNULL) || (_u32Number == 0));
+  orxASSERT((_astHitList != orxNULL) || (_u32Number == 0));
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxPhysics_RaycastList");
+
+  /* Inits raycast list */
+  stRaycastList.astRayList    = _astRayList;
+  stRaycastList.astHitList    = _astHitList;
+  stRaycastList.bEarlyExit    = _bEarlyExit;
+  stRaycastList.u16SelfFlags  = _u16SelfFlags;
+  stRaycastList.u16CheckMask  = _u16CheckMask;
+
+  /* Issues all raycasts (read-only world accesses, safe to run concurrently) */
+  orxThread_ParallelFor(0, _u32Number, orxPhysics::su32RaycastListGrain, orxPhysics_LiquidFun_ProcessRaycastList, &stRaycastList);
+
+  /* For all hits */
+  for(i = 0; i < _u32Number; i++)
+  {
+    /* Valid? */
+    if(_astHitList[i].hUserData != orxHANDLE_UNDEFINED)
+    {
+      /* Updates result */
+      u32Result++;
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return u32Result;
+}
+
+extern "C" orxU32 orxFASTCALL orxPhysics_LiquidFun_QueryBox(const orxAABOX *_pstBox, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxHANDLE *_ahUserDataList, orxU32 _u32Number)
+{
+  QueryCallback oQueryCallback;
+
+  /* Checks */
+  orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBox != orxNULL);
+  orxASSERT((_ahUserDataList != orxNULL) || (_u32Number == 0));
+
+  /* Has room for results? */
+  if(_u32Number != 0)
+  {
+    /* Inits query */
+    oQueryCallback.stAABB.lowerBound.Set(sstPhysics.fDimensionRatio * _pstBox->vTL.fX, sstPhysics.fDimensionRatio * _pstBox->vTL.fY);
+    oQueryCallback.stAABB.upperBound.Set(sstPhysics.fDimensionRatio * _pstBox->vBR.fX, sstPhysics.fDimensionRatio * _pstBox->vBR.fY);
+    oQueryCallback.ahUserDataList = _ahUserDataList;
+    oQueryCallback.u32Number      = _u32Number;
+    oQueryCallback.u16SelfFlags   = _u16SelfFlags;
+    oQueryCallback.u16CheckMask   = _u16CheckMask;
+
+    /* Issues query */
+    sstPhysics.poWorld->QueryAABB(&oQueryCallback, oQueryCallback.stAABB);
+  }
+
+  /* Done! */
+  return oQueryCallback.u32Counter;
+}
+
+extern "C" orxU32 orxFASTCALL orxPhysics_LiquidFun_QuerySphere(const orxVECTOR *_pvCenter, orxFLOAT _fRadius, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxHANDLE *_ahUserDataList, orxU32 _u32Number)
+{
+  QueryCallback oQueryCallback;
+  b2CircleShape stCircleShape;
+
+  /* Checks */
+  orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pvCenter != orxNULL);
+  orxASSERT(_fRadius >= orxFLOAT_0);
+  orxASSERT((_ahUserDataList != orxNULL) || (_u32Number == 0));
+
+  /* Has room for results? */
+  if(_u32Number != 0)
+  {
+    /* Inits shape */
+    stCircleShape.m_p.Set(sstPhysics.fDimensionRatio * _pvCenter->fX, sstPhysics.fDimensionRatio * _pvCenter->fY);
+    stCircleShape.m_radius = sstPhysics.fDimensionRatio * _fRadius;
+
+    /* Inits query */
+    stCircleShape.ComputeAABB(&(oQueryCallback.stAABB), oQueryCallback.stTransform, 0);
+    oQueryCallback.poShape        = &stCircleShape;
+    oQueryCallback.ahUserDataList = _ahUserDataList;
+    oQueryCallback.u32Number      = _u32Number;
+    oQueryCallback.u16SelfFlags   = _u16SelfFlags;
+    oQueryCallback.u16CheckMask   = _u16CheckMask;
+
+    /* Issues query */
+    sstPhysics.poWorld->QueryAABB(&oQueryCallback, oQueryCallback.stAABB);
+  }
+
+  /* Done! */
+  return oQueryCallback.u32Counter;
+}
+
+extern "C" orxU32 orxFASTCALL orxPhysics_LiquidFun_QueryMesh(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxHANDLE *_ahUserDataList, orxU32 _u32Number)
+{
+  QueryCallback oQueryCallback;
+
+  /* Checks */
+  orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
+  orxASSERT(_avVertexList != orxNULL);
+  orxASSERT(orxBODY_PART_DEF_KU32_MESH_VERTEX_NUMBER <= b2_maxPolygonVertices);
+  orxASSERT((_ahUserDataList != orxNULL) || (_u32Number == 0));
+
+  /* Valid vertex number? */
+  if((_u32VertexNumber >= 3) && (_u32VertexNumber <= orxBODY_PART_DEF_KU32_MESH_VERTEX_NUMBER))
+  {
+    /* Has room for results? */
+    if(_u32Number != 0)
+    {
+      b2PolygonShape  stPolygonShape;
+      b2Vec2          avVertexList[b2_maxPolygonVertices];
+      orxU32          i;
+
+      /* For all the vertices */
+      for(i = 0; i < _u32VertexNumber; i++)
+      {
+        /* Sets its vector */
+        avVertexList[i].Set(sstPhysics.fDimensionRatio * _avVertexList[i].fX, sstPhysics.fDimensionRatio * _avVertexList[i].fY);
+      }
+
+      /* Inits shape */
+      stPolygonShape.Set(avVertexList, (int32)_u32VertexNumber);
+
+      /* Inits query */
+      stPolygonShape.ComputeAABB(&(oQueryCallback.stAABB), oQueryCallback.stTransform, 0);
+      oQueryCallback.poShape        = &stPolygonShape;
+      oQueryCallback.ahUserDataList = _ahUserDataList;
+      oQueryCallback.u32Number      = _u32Number;
+      oQueryCallback.u16SelfFlags   = _u16SelfFlags;
+      oQueryCallback.u16CheckMask   = _u16CheckMask;
+
+      /* Issues query */
+      sstPhysics.poWorld->QueryAABB(&oQueryCallback, oQueryCallback.stAABB);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PHYSICS, "Can't query mesh: invalid vertex number <%u>, should be between 3 and %u.", _u32VertexNumber, orxBODY_PART_DEF_KU32_MESH_VERTEX_NUMBER);
+  }
+
+  /* Done! */
+  return oQueryCallback.u32Counter;
+}
+
 extern "C" void orxFASTCALL orxPhysics_LiquidFun_EnableSimulation(orxBOOL _bEnable)
 {
   /* Checks */
@@ -3228,6 +3619,10 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_SetJointMaxMotorTorque, PH
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_GetJointReactionForce, PHYSICS, GET_JOINT_REACTION_FORCE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_GetJointReactionTorque, PHYSICS, GET_JOINT_REACTION_TORQUE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_Raycast, PHYSICS, RAYCAST);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_RaycastList, PHYSICS, RAYCAST_LIST);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_QueryBox, PHYSICS, QUERY_BOX);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_QuerySphere, PHYSICS, QUERY_SPHERE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_QueryMesh, PHYSICS, QUERY_MESH);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_EnableSimulation, PHYSICS, ENABLE_SIMULATION);
 orxPLUGIN_USER_CORE_FUNCTION_END();
 
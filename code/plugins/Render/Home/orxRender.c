@@ -54,6 +54,11 @@
  */
 #define orxRENDER_KF_TICK_SIZE                      orx2F(1.0f / 10.0f)
 #define orxRENDER_KU32_ORDER_BANK_SIZE              1024
+#define orxRENDER_KU32_SORT_RADIX_BITS              8
+#define orxRENDER_KU32_SORT_RADIX_SIZE              (1 << orxRENDER_KU32_SORT_RADIX_BITS)
+#define orxRENDER_KU32_SORT_PASS_NUMBER             (64 / orxRENDER_KU32_SORT_RADIX_BITS)
+#define orxRENDER_KU32_SORT_TEXTURE_MASK            0xFFFF
+#define orxRENDER_KU32_SORT_SHADER_MASK             0x7FF
 #define orxRENDER_KST_DEFAULT_COLOR                 orx2RGBA(255, 0, 0, 255)
 #define orxRENDER_KZ_FPS_FORMAT                     "FPS: %d"
 #define orxRENDER_KF_CONSOLE_BLINK_DELAY            orx2F(0.5f)
@@ -107,17 +112,23 @@
 
 typedef struct __orxRENDER_RENDER_NODE_t
 {
-  orxLINKLIST_NODE      stNode;                     /**< Linklist node : 12 */
-  orxFLOAT              fZ;                         /**< Z coordinate : 16 */
-  orxTEXTURE           *pstTexture;                 /**< Texture pointer : 20 */
-  const orxSHADER      *pstShader;                  /**< Shader pointer : 24 */
-  orxDISPLAY_BLEND_MODE eBlendMode;                 /**< Blend mode : 28 */
-  orxDISPLAY_SMOOTHING  eSmoothing;                 /**< Smoothing : 32 */
-  orxOBJECT            *pstObject;                  /**< Object pointer : 36 */
-  orxFLOAT              fDepthCoef;                 /**< Depth coef : 40 */
+  orxFLOAT              fZ;                         /**< Z coordinate : 4 */
+  orxTEXTURE           *pstTexture;                 /**< Texture pointer : 8 */
+  const orxSHADER      *pstShader;                  /**< Shader pointer : 12 */
+  orxDISPLAY_BLEND_MODE eBlendMode;                 /**< Blend mode : 16 */
+  orxDISPLAY_SMOOTHING  eSmoothing;                 /**< Smoothing : 20 */
+  orxOBJECT            *pstObject;                  /**< Object pointer : 24 */
+  orxFLOAT              fDepthCoef;                 /**< Depth coef : 28 */
 
 } orxRENDER_NODE;
 
+typedef struct __orxRENDER_SORT_NODE_t
+{
+  orxU64                u64Key;                     /**< Sort key : 8 */
+  orxRENDER_NODE       *pstRenderNode;              /**< Render node : 12 */
+
+} orxRENDER_SORT_NODE;
+
 /** Static structure
  */
 typedef struct __orxRENDER_STATIC_t
@@ -126,7 +137,10 @@ typedef struct __orxRENDER_STATIC_t
   orxCLOCK     *pstClock;                           /**< Rendering clock pointer */
   orxFRAME     *pstFrame;                           /**< Conversion frame */
   orxBANK      *pstRenderBank;                      /**< Rendering bank */
-  orxLINKLIST   stRenderList;                       /**< Rendering list */
+  orxRENDER_SORT_NODE *astSortList;                 /**< Sort list */
+  orxRENDER_SORT_NODE *astSortBuffer;               /**< Sort buffer */
+  orxU32        u32SortSize;                        /**< Sort list size */
+  orxU32        u32SortCounter;                     /**< Sort list counter */
   orxFLOAT      fDefaultConsoleOffset;              /**< Default console offset */
   orxFLOAT      fConsoleOffset;                     /**< Console offset */
   orxU32        u32SelectedFrame;                   /**< Selected frame */
@@ -369,7 +383,7 @@ static orxINLINE void orxRender_Home_RenderProfiler()
   pstMap = orxFont_GetMap(pstFont);
 
   /* Gets its marker width */
-  fMarkerWidth = ((orxCHARACTER_GLYPH *)orxHashTable_Get(pstMap->pstCharacterTable, orxRENDER_KC_PROFILER_DEPTH_MARKER))->fWidth;
+  fMarkerWidth = orxCharacterMap_GetGlyph(pstMap, orxRENDER_KC_PROFILER_DEPTH_MARKER)->fWidth;
 
   /* Creates pixel texture */
   pstTexture = orxTexture_CreateFromFile(orxTEXTURE_KZ_PIXEL, orxFALSE);
@@ -1548,8 +1562,14 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxOBJECT *_pstOb
         }
         else
         {
-          /* Transfomrs text */
-          eResult = orxDisplay_TransformText(orxText_GetString(pstText), pstBitmap, orxFont_GetMap(pstFont), stPayload.stObject.pstTransform, _eSmoothing, _eBlendMode);
+          const orxCHARACTER_QUAD  *astQuadList;
+          orxU32                    u32QuadCounter;
+
+          /* Gets text's cached quads */
+          astQuadList = orxText_GetQuadList(pstText, &u32QuadCounter);
+
+          /* Transforms them */
+          eResult = (u32QuadCounter != 0) ? orxDisplay_TransformCharacterQuads(astQuadList, u32QuadCounter, pstBitmap, orxFont_GetMap(pstFont), stPayload.stObject.pstTransform, _eSmoothing, _eBlendMode) : orxSTATUS_SUCCESS;
         }
       }
       else
@@ -1590,6 +1610,167 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxOBJECT *_pstOb
   return eResult;
 }
 
+/** Gets a render node sort key: Z first, then texture, shader, blend mode & smoothing so as to batch similar nodes together
+ * @param[in]   _pstRenderNode  Concerned render node
+ * @return      Sort key
+ */
+static orxINLINE orxU64 orxRender_Home_GetSortKey(const orxRENDER_NODE *_pstRenderNode)
+{
+  union
+  {
+    orxFLOAT  fValue;
+    orxU32    u32Value;
+  } stZ;
+  orxU32 u32Texture, u32Shader, u32State;
+
+  /* Gets Z (-0.0 becomes 0.0) */
+  stZ.fValue = _pstRenderNode->fZ + orxFLOAT_0;
+
+  /* Maps it to an unsigned integer with the same order */
+  stZ.u32Value = (stZ.u32Value & 0x80000000) ? ~stZ.u32Value : stZ.u32Value | 0x80000000;
+
+  /* Gets texture & shader IDs (structure slots, 0 for none) */
+  u32Texture  = (_pstRenderNode->pstTexture != orxNULL) ? orxMIN((orxU32)((orxStructure_GetGUID(_pstRenderNode->pstTexture) & orxSTRUCTURE_GUID_MASK_ITEM_ID) >> orxSTRUCTURE_GUID_SHIFT_ITEM_ID) + 1, orxRENDER_KU32_SORT_TEXTURE_MASK) : 0;
+  u32Shader   = (_pstRenderNode->pstShader != orxNULL) ? orxMIN((orxU32)((orxStructure_GetGUID(_pstRenderNode->pstShader) & orxSTRUCTURE_GUID_MASK_ITEM_ID) >> orxSTRUCTURE_GUID_SHIFT_ITEM_ID) + 1, orxRENDER_KU32_SORT_SHADER_MASK) : 0;
+
+  /* Packs state (none blend mode & smoothing sort last) */
+  u32State    = (u32Texture << 16) | (u32Shader << 5) | (((orxU32)_pstRenderNode->eBlendMode & 0x7) << 2) | ((orxU32)_pstRenderNode->eSmoothing & 0x3);
+
+  /* Done! */
+  return ((orxU64)stZ.u32Value << 32) | (orxU64)u32State;
+}
+
+/** Adds a render node to the sort list
+ * @param[in]   _pstRenderNode  Render node to add
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxINLINE orxSTATUS orxRender_Home_AddSortNode(orxRENDER_NODE *_pstRenderNode)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Is list full? */
+  if(sstRender.u32SortCounter == sstRender.u32SortSize)
+  {
+    orxRENDER_SORT_NODE  *astSortList, *astSortBuffer;
+    orxU32                u32Size;
+
+    /* Gets new size */
+    u32Size = (sstRender.u32SortSize != 0) ? sstRender.u32SortSize << 1 : orxRENDER_KU32_ORDER_BANK_SIZE;
+
+    /* Resizes list & buffer */
+    astSortList   = (orxRENDER_SORT_NODE *)orxMemory_Reallocate(sstRender.astSortList, u32Size * sizeof(orxRENDER_SORT_NODE));
+    sstRender.astSortList = (astSortList != orxNULL) ? astSortList : sstRender.astSortList;
+    astSortBuffer = (orxRENDER_SORT_NODE *)orxMemory_Reallocate(sstRender.astSortBuffer, u32Size * sizeof(orxRENDER_SORT_NODE));
+    sstRender.astSortBuffer = (astSortBuffer != orxNULL) ? astSortBuffer : sstRender.astSortBuffer;
+
+    /* Success? */
+    if((astSortList != orxNULL) && (astSortBuffer != orxNULL))
+    {
+      /* Updates size */
+      sstRender.u32SortSize = u32Size;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Couldn't grow render sort list to %u nodes.", u32Size);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Stores node */
+    sstRender.astSortList[sstRender.u32SortCounter].u64Key        = orxRender_Home_GetSortKey(_pstRenderNode);
+    sstRender.astSortList[sstRender.u32SortCounter].pstRenderNode = _pstRenderNode;
+
+    /* Updates counter */
+    sstRender.u32SortCounter++;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Sorts the sort list by increasing keys (stable LSD radix sort, skipping the digits shared by all keys)
+ */
+static orxINLINE void orxRender_Home_SortNodes()
+{
+  orxU32  aau32Histogram[orxRENDER_KU32_SORT_PASS_NUMBER][orxRENDER_KU32_SORT_RADIX_SIZE];
+  orxU64  u64AndMask = 0xFFFFFFFFFFFFFFFFULL, u64OrMask = 0;
+  orxU32  i, u32Pass;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxRender_SortNodes");
+
+  /* Clears histograms */
+  orxMemory_Zero(aau32Histogram, sizeof(aau32Histogram));
+
+  /* For all nodes */
+  for(i = 0; i < sstRender.u32SortCounter; i++)
+  {
+    orxU64 u64Key;
+
+    /* Gets key */
+    u64Key = sstRender.astSortList[i].u64Key;
+
+    /* Updates masks */
+    u64AndMask &= u64Key;
+    u64OrMask  |= u64Key;
+
+    /* Updates histograms */
+    for(u32Pass = 0; u32Pass < orxRENDER_KU32_SORT_PASS_NUMBER; u32Pass++)
+    {
+      aau32Histogram[u32Pass][(u64Key >> (u32Pass * orxRENDER_KU32_SORT_RADIX_BITS)) & (orxRENDER_KU32_SORT_RADIX_SIZE - 1)]++;
+    }
+  }
+
+  /* For all passes */
+  for(u32Pass = 0; u32Pass < orxRENDER_KU32_SORT_PASS_NUMBER; u32Pass++)
+  {
+    orxU32 u32Shift;
+
+    /* Gets shift */
+    u32Shift = u32Pass * orxRENDER_KU32_SORT_RADIX_BITS;
+
+    /* Does digit vary? */
+    if((((u64AndMask ^ u64OrMask) >> u32Shift) & (orxRENDER_KU32_SORT_RADIX_SIZE - 1)) != 0)
+    {
+      orxRENDER_SORT_NODE  *astSwap;
+      orxU32               *au32Offset, u32Offset;
+
+      /* Gets offsets from histogram */
+      for(i = 0, u32Offset = 0, au32Offset = aau32Histogram[u32Pass]; i < orxRENDER_KU32_SORT_RADIX_SIZE; i++)
+      {
+        orxU32 u32Count;
+
+        u32Count      = au32Offset[i];
+        au32Offset[i] = u32Offset;
+        u32Offset    += u32Count;
+      }
+
+      /* Scatters nodes */
+      for(i = 0; i < sstRender.u32SortCounter; i++)
+      {
+        sstRender.astSortBuffer[au32Offset[(sstRender.astSortList[i].u64Key >> u32Shift) & (orxRENDER_KU32_SORT_RADIX_SIZE - 1)]++] = sstRender.astSortList[i];
+      }
+
+      /* Swaps list & buffer */
+      astSwap                 = sstRender.astSortList;
+      sstRender.astSortList   = sstRender.astSortBuffer;
+      sstRender.astSortBuffer = astSwap;
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
 /** Renders a viewport
  * @param[in]   _pstViewport    Viewport to render
  */
@@ -1967,9 +2148,6 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                             /* Creates a render node */
                             pstRenderNode = (orxRENDER_NODE *)orxBank_Allocate(sstRender.pstRenderBank);
 
-                            /* Cleans its internal node */
-                            orxMemory_Zero(pstRenderNode, sizeof(orxLINKLIST_NODE));
-
                             /* Stores object */
                             pstRenderNode->pstObject  = pstObject;
                             pstRenderNode->pstTexture = pstTexture;
@@ -1983,42 +2161,8 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                             /* Stores its depth coef */
                             pstRenderNode->fDepthCoef = fDepthCoef;
 
-                            /* Empty list? */
-                            if(orxLinkList_GetCounter(&(sstRender.stRenderList)) == 0)
-                            {
-                              /* Adds node at beginning */
-                              orxLinkList_AddStart(&(sstRender.stRenderList), (orxLINKLIST_NODE *)pstRenderNode);
-                            }
-                            else
-                            {
-                              orxRENDER_NODE *pstNode;
-
-                              /* Finds correct node position */
-                              for(pstNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(sstRender.stRenderList));
-                                  (pstNode != orxNULL)
-                               && ((vObjectPos.fZ < pstNode->fZ)
-                                || ((vObjectPos.fZ == pstNode->fZ)
-                                 && ((pstTexture < pstNode->pstTexture)
-                                  || ((pstTexture == pstNode->pstTexture)
-                                   && ((pstShader < pstNode->pstShader)
-                                    || ((pstShader == pstNode->pstShader)
-                                     && (eBlendMode < pstNode->eBlendMode))
-                                      || ((eBlendMode == pstNode->eBlendMode)
-                                       && (eSmoothing < pstNode->eSmoothing)))))));
-                                  pstNode = (orxRENDER_NODE *)orxLinkList_GetNext(&(pstNode->stNode)));
-
-                              /* End of list reached? */
-                              if(pstNode == orxNULL)
-                              {
-                                /* Adds it at end */
-                                orxLinkList_AddEnd(&(sstRender.stRenderList), &(pstRenderNode->stNode));
-                              }
-                              else
-                              {
-                                /* Adds it before found node */
-                                orxLinkList_AddBefore(&(pstNode->stNode), &(pstRenderNode->stNode));
-                              }
-                            }
+                            /* Adds it to the sort list */
+                            orxRender_Home_AddSortNode(pstRenderNode);
                           }
                         }
                       }
@@ -2026,16 +2170,20 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                   }
                 }
 
-                /* For all render nodes */
-                for(pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(sstRender.stRenderList));
-                    pstRenderNode != orxNULL;
-                    pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetNext((orxLINKLIST_NODE *)pstRenderNode))
+                /* Sorts render nodes */
+                orxRender_Home_SortNodes();
+
+                /* For all render nodes, from back to front (decreasing keys, latest first on equal keys) */
+                for(u32Number = sstRender.u32SortCounter; u32Number != 0; u32Number--)
                 {
                   orxFRAME             *pstFrame;
                   orxVECTOR             vObjectPos, vRenderPos, vObjectScale;
                   orxFLOAT              fObjectRotation, fObjectScaleX, fObjectScaleY, fRepeatX, fRepeatY;
                   orxDISPLAY_TRANSFORM  stTransform;
 
+                  /* Gets render node */
+                  pstRenderNode = sstRender.astSortList[u32Number - 1].pstRenderNode;
+
                   /* Gets object */
                   pstObject = pstRenderNode->pstObject;
 
@@ -2133,8 +2281,8 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                 /* Cleans rendering bank */
                 orxBank_Clear(sstRender.pstRenderBank);
 
-                /* Cleans rendering list */
-                orxMemory_Zero(&(sstRender.stRenderList), sizeof(orxLINKLIST));
+                /* Cleans sort list */
+                sstRender.u32SortCounter = 0;
               }
             }
             else
@@ -3007,6 +3155,16 @@ void orxFASTCALL orxRender_Home_Exit()
     /* Deletes rendering bank */
     orxBank_Delete(sstRender.pstRenderBank);
 
+    /* Deletes sort list & buffer */
+    if(sstRender.astSortList != orxNULL)
+    {
+      orxMemory_Free(sstRender.astSortList);
+    }
+    if(sstRender.astSortBuffer != orxNULL)
+    {
+      orxMemory_Free(sstRender.astSortBuffer);
+    }
+
     /* Updates flags */
     sstRender.u32Flags &= ~(orxRENDER_KU32_STATIC_FLAG_READY | orxRENDER_KU32_STATIC_FLAG_REGISTERED);
   }
@@ -82,6 +82,10 @@
 
 #define orxCLOCK_KU32_BANK_SIZE                 8           /**< Bank size */
 
+#define orxCLOCK_KU32_TIMER_TABLE_SIZE          32          /**< Timer table size */
+#define orxCLOCK_KU32_TIMER_LIST_BANK_SIZE      16          /**< Timer list bank size */
+#define orxCLOCK_KU32_TIMER_HEAP_SIZE           32          /**< Timer heap initial size */
+
 #define orxCLOCK_KF_DELAY_ADJUSTMENT            orx2F(-0.001f)
 
 
@@ -101,14 +105,20 @@ typedef struct __orxCLOCK_FUNCTION_STORAGE_t
 
 } orxCLOCK_FUNCTION_STORAGE;
 
+/** Clock timer storage structure
+ */
 typedef struct __orxCLOCK_TIMER_STORAGE_t
 {
-  orxLINKLIST_NODE            stNode;           /**< Linklist node : 12 */
+  orxLINKLIST_NODE            stNode;           /**< Linklist node (timers sharing the same callback) : 12 */
   orxCLOCK_FUNCTION           pfnCallback;      /**< Timer function pointer : 16 */
   orxFLOAT                    fDelay;           /**< Timer delay : 20 */
   void                       *pContext;         /**< Timer function context : 24 */
   orxS32                      s32Repetition;    /**< Timer repetition : 28 */
   orxFLOAT                    fTimeStamp;       /**< Next call time stamp : 32 */
+  orxCLOCK                   *pstClock;         /**< Owner clock : 36 */
+  struct __orxCLOCK_TIMER_STORAGE_t *pstNextDue; /**< Next due timer, during clock update : 40 */
+  orxU32                      u32HeapIndex;     /**< Index in owner clock's timer heap, orxU32_UNDEFINED when due : 44 */
+  orxU32                      u32ID;            /**< Creation ID, keeps timers with equal time stamps in creation order : 48 */
 
 } orxCLOCK_TIMER_STORAGE;
 
@@ -121,7 +131,9 @@ struct __orxCLOCK_t
   orxFLOAT          fPartialDT;                 /**< Clock partial DT : 44 */
   orxBANK          *pstFunctionBank;            /**< Function bank : 48 */
   orxLINKLIST       stFunctionList;             /**< Function list : 60 */
-  orxLINKLIST       stTimerList;                /**< Timer list : 72 */
+  orxCLOCK_TIMER_STORAGE **apstTimerHeap;      /**< Timer heap, sorted on next call time stamp : 64 */
+  orxU32            u32TimerCounter;            /**< Timer counter : 68 */
+  orxU32            u32TimerSize;               /**< Timer heap size : 72 */
   const orxSTRING   zReference;                 /**< Reference : 76 */
 };
 
@@ -131,12 +143,15 @@ struct __orxCLOCK_t
 typedef struct __orxCLOCK_STATIC_t
 {
   orxBANK          *pstTimerBank;               /**< Timer bank : 4 */
-  orxCLOCK_MOD_TYPE eModType;                   /**< Clock mod type : 8 */
-  orxDOUBLE         dTime;                      /**< Current time : 16 */
-  orxFLOAT          fModValue;                  /**< Clock mod value : 20 */
-  orxFLOAT          fMainClockTickSize;         /**< Main clock tick size : 24 */
-  orxHASHTABLE     *pstReferenceTable;          /**< Table to avoid clock duplication when creating through config file : 28 */
-  orxU32            u32Flags;                   /**< Control flags : 32 */
+  orxBANK          *pstTimerListBank;           /**< Timer list bank : 8 */
+  orxHASHTABLE     *pstTimerTable;              /**< Timer lists, indexed by callback : 12 */
+  orxU32            u32TimerID;                 /**< Next timer creation ID : 16 */
+  orxCLOCK_MOD_TYPE eModType;                   /**< Clock mod type : 20 */
+  orxDOUBLE         dTime;                      /**< Current time : 28 */
+  orxFLOAT          fModValue;                  /**< Clock mod value : 32 */
+  orxFLOAT          fMainClockTickSize;         /**< Main clock tick size : 36 */
+  orxHASHTABLE     *pstReferenceTable;          /**< Table to avoid clock duplication when creating through config file : 40 */
+  orxU32            u32Flags;                   /**< Control flags : 44 */
 
 } orxCLOCK_STATIC;
 
@@ -286,6 +301,233 @@ static orxINLINE orxFLOAT orxClock_ComputeDT(orxFLOAT _fDT, const orxCLOCK_INFO
   return fResult;
 }
 
+/** Is a timer due before another one?
+ * @param[in]   _pstTimer1                            First timer
+ * @param[in]   _pstTimer2                            Second timer
+ * @return      orxTRUE if first timer is due before the second one, orxFALSE otherwise
+ */
+static orxINLINE orxBOOL orxClock_IsTimerBefore(const orxCLOCK_TIMER_STORAGE *_pstTimer1, const orxCLOCK_TIMER_STORAGE *_pstTimer2)
+{
+  orxBOOL bResult;
+
+  /* Updates result (same time stamp => creation order) */
+  bResult = ((_pstTimer1->fTimeStamp < _pstTimer2->fTimeStamp)
+          || ((_pstTimer1->fTimeStamp == _pstTimer2->fTimeStamp)
+           && ((orxS32)(_pstTimer1->u32ID - _pstTimer2->u32ID) < 0))) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Moves a timer up its clock's heap until it's correctly placed
+ * @param[in]   _pstClock                             Concerned clock
+ * @param[in]   _pstTimerStorage                      Concerned timer
+ * @param[in]   _u32Index                             Index where to start
+ */
+static orxINLINE void orxClock_SiftTimerUp(orxCLOCK *_pstClock, orxCLOCK_TIMER_STORAGE *_pstTimerStorage, orxU32 _u32Index)
+{
+  /* While not at the top */
+  while(_u32Index > 0)
+  {
+    orxCLOCK_TIMER_STORAGE *pstParent;
+    orxU32                  u32Parent;
+
+    /* Gets parent */
+    u32Parent = (_u32Index - 1) >> 1;
+    pstParent = _pstClock->apstTimerHeap[u32Parent];
+
+    /* Correctly placed? */
+    if(orxClock_IsTimerBefore(_pstTimerStorage, pstParent) == orxFALSE)
+    {
+      break;
+    }
+
+    /* Moves parent down */
+    _pstClock->apstTimerHeap[_u32Index] = pstParent;
+    pstParent->u32HeapIndex             = _u32Index;
+
+    /* Goes up */
+    _u32Index = u32Parent;
+  }
+
+  /* Stores timer */
+  _pstClock->apstTimerHeap[_u32Index] = _pstTimerStorage;
+  _pstTimerStorage->u32HeapIndex      = _u32Index;
+
+  /* Done! */
+  return;
+}
+
+/** Moves a timer down its clock's heap until it's correctly placed
+ * @param[in]   _pstClock                             Concerned clock
+ * @param[in]   _pstTimerStorage                      Concerned timer
+ * @param[in]   _u32Index                             Index where to start
+ */
+static orxINLINE void orxClock_SiftTimerDown(orxCLOCK *_pstClock, orxCLOCK_TIMER_STORAGE *_pstTimerStorage, orxU32 _u32Index)
+{
+  orxU32 u32Child;
+
+  /* While it has children */
+  for(u32Child = (_u32Index << 1) + 1; u32Child < _pstClock->u32TimerCounter; u32Child = (_u32Index << 1) + 1)
+  {
+    /* Gets earliest child */
+    if((u32Child + 1 < _pstClock->u32TimerCounter)
+    && (orxClock_IsTimerBefore(_pstClock->apstTimerHeap[u32Child + 1], _pstClock->apstTimerHeap[u32Child]) != orxFALSE))
+    {
+      u32Child++;
+    }
+
+    /* Correctly placed? */
+    if(orxClock_IsTimerBefore(_pstClock->apstTimerHeap[u32Child], _pstTimerStorage) == orxFALSE)
+    {
+      break;
+    }
+
+    /* Moves child up */
+    _pstClock->apstTimerHeap[_u32Index]               = _pstClock->apstTimerHeap[u32Child];
+    _pstClock->apstTimerHeap[_u32Index]->u32HeapIndex = _u32Index;
+
+    /* Goes down */
+    _u32Index = u32Child;
+  }
+
+  /* Stores timer */
+  _pstClock->apstTimerHeap[_u32Index] = _pstTimerStorage;
+  _pstTimerStorage->u32HeapIndex      = _u32Index;
+
+  /* Done! */
+  return;
+}
+
+/** Pushes a timer in its clock's heap
+ * @param[in]   _pstTimerStorage                      Concerned timer
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxINLINE orxSTATUS orxClock_PushTimer(orxCLOCK_TIMER_STORAGE *_pstTimerStorage)
+{
+  orxCLOCK *pstClock;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Gets clock */
+  pstClock = _pstTimerStorage->pstClock;
+
+  /* Is heap full? */
+  if(pstClock->u32TimerCounter == pstClock->u32TimerSize)
+  {
+    orxCLOCK_TIMER_STORAGE **apstTimerHeap;
+    orxU32                   u32Size;
+
+    /* Gets new size */
+    u32Size = (pstClock->u32TimerSize != 0) ? pstClock->u32TimerSize << 1 : orxCLOCK_KU32_TIMER_HEAP_SIZE;
+
+    /* Resizes heap */
+    apstTimerHeap = (orxCLOCK_TIMER_STORAGE **)orxMemory_Reallocate(pstClock->apstTimerHeap, u32Size * sizeof(orxCLOCK_TIMER_STORAGE *));
+
+    /* Success? */
+    if(apstTimerHeap != orxNULL)
+    {
+      /* Stores it */
+      pstClock->apstTimerHeap = apstTimerHeap;
+      pstClock->u32TimerSize  = u32Size;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CLOCK, "Couldn't grow timer heap to %u timers.", u32Size);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Inserts it at the bottom and moves it up */
+    orxClock_SiftTimerUp(pstClock, _pstTimerStorage, pstClock->u32TimerCounter++);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Pulls a timer out of its clock's heap
+ * @param[in]   _pstTimerStorage                      Concerned timer
+ */
+static orxINLINE void orxClock_PullTimer(orxCLOCK_TIMER_STORAGE *_pstTimerStorage)
+{
+  orxCLOCK *pstClock;
+  orxU32    u32Index;
+
+  /* Checks */
+  orxASSERT(_pstTimerStorage->u32HeapIndex != orxU32_UNDEFINED);
+
+  /* Gets clock & index */
+  pstClock  = _pstTimerStorage->pstClock;
+  u32Index  = _pstTimerStorage->u32HeapIndex;
+
+  /* Updates counter */
+  pstClock->u32TimerCounter--;
+
+  /* Wasn't last? */
+  if(u32Index != pstClock->u32TimerCounter)
+  {
+    orxCLOCK_TIMER_STORAGE *pstLast;
+
+    /* Gets last timer */
+    pstLast = pstClock->apstTimerHeap[pstClock->u32TimerCounter];
+
+    /* Moves it to the free slot, either up or down */
+    if((u32Index > 0) && (orxClock_IsTimerBefore(pstLast, pstClock->apstTimerHeap[(u32Index - 1) >> 1]) != orxFALSE))
+    {
+      orxClock_SiftTimerUp(pstClock, pstLast, u32Index);
+    }
+    else
+    {
+      orxClock_SiftTimerDown(pstClock, pstLast, u32Index);
+    }
+  }
+
+  /* Updates timer */
+  _pstTimerStorage->u32HeapIndex = orxU32_UNDEFINED;
+
+  /* Done! */
+  return;
+}
+
+/** Deletes a timer (must not be in its clock's heap anymore)
+ * @param[in]   _pstTimerStorage                      Concerned timer
+ */
+static orxINLINE void orxClock_DeleteTimer(orxCLOCK_TIMER_STORAGE *_pstTimerStorage)
+{
+  orxLINKLIST *pstTimerList;
+
+  /* Checks */
+  orxASSERT(_pstTimerStorage->u32HeapIndex == orxU32_UNDEFINED);
+
+  /* Gets its list */
+  pstTimerList = orxLinkList_GetList(&(_pstTimerStorage->stNode));
+
+  /* Removes it */
+  orxLinkList_Remove(&(_pstTimerStorage->stNode));
+
+  /* Was last timer using this callback? */
+  if(orxLinkList_GetCounter(pstTimerList) == 0)
+  {
+    /* Removes list from table */
+    orxHashTable_Remove(sstClock.pstTimerTable, (orxU64)(size_t)_pstTimerStorage->pfnCallback);
+
+    /* Deletes it */
+    orxBank_Free(sstClock.pstTimerListBank, pstTimerList);
+  }
+
+  /* Deletes timer */
+  orxBank_Free(sstClock.pstTimerBank, _pstTimerStorage);
+
+  /* Done! */
+  return;
+}
+
 /** Deletes all the clocks
  */
 static orxINLINE void orxClock_DeleteAll()
@@ -473,11 +715,13 @@ orxSTATUS orxFASTCALL orxClock_Init()
       /* Cleans control structure */
       orxMemory_Zero(&sstClock, sizeof(orxCLOCK_STATIC));
 
-      /* Creates timer bank */
-      sstClock.pstTimerBank = orxBank_Create(orxCLOCK_KU32_TIMER_BANK_SIZE, sizeof(orxCLOCK_TIMER_STORAGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      /* Creates timer bank, list bank & table */
+      sstClock.pstTimerBank     = orxBank_Create(orxCLOCK_KU32_TIMER_BANK_SIZE, sizeof(orxCLOCK_TIMER_STORAGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      sstClock.pstTimerListBank = orxBank_Create(orxCLOCK_KU32_TIMER_LIST_BANK_SIZE, sizeof(orxLINKLIST), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      sstClock.pstTimerTable    = orxHashTable_Create(orxCLOCK_KU32_TIMER_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
       /* Valid? */
-      if(sstClock.pstTimerBank != orxNULL)
+      if((sstClock.pstTimerBank != orxNULL) && (sstClock.pstTimerListBank != orxNULL) && (sstClock.pstTimerTable != orxNULL))
       {
         /* Creates reference table */
         sstClock.pstReferenceTable = orxHashTable_Create(orxCLOCK_KU32_REFERENCE_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
@@ -524,9 +768,13 @@ orxSTATUS orxFASTCALL orxClock_Init()
         }
         else
         {
-          /* Deletes timer bank */
+          /* Deletes timer banks & table */
           orxBank_Delete(sstClock.pstTimerBank);
           sstClock.pstTimerBank = orxNULL;
+          orxBank_Delete(sstClock.pstTimerListBank);
+          sstClock.pstTimerListBank = orxNULL;
+          orxHashTable_Delete(sstClock.pstTimerTable);
+          sstClock.pstTimerTable = orxNULL;
 
           /* Updates result */
           eResult = orxSTATUS_FAILURE;
@@ -537,6 +785,23 @@ orxSTATUS orxFASTCALL orxClock_Init()
         /* Logs message */
         orxDEBUG_PRINT(orxDEBUG_LEVEL_CLOCK, "Failed creating clock bank.");
 
+        /* Deletes whatever was created */
+        if(sstClock.pstTimerBank != orxNULL)
+        {
+          orxBank_Delete(sstClock.pstTimerBank);
+          sstClock.pstTimerBank = orxNULL;
+        }
+        if(sstClock.pstTimerListBank != orxNULL)
+        {
+          orxBank_Delete(sstClock.pstTimerListBank);
+          sstClock.pstTimerListBank = orxNULL;
+        }
+        if(sstClock.pstTimerTable != orxNULL)
+        {
+          orxHashTable_Delete(sstClock.pstTimerTable);
+          sstClock.pstTimerTable = orxNULL;
+        }
+
         /* Clock bank not created */
         eResult = orxSTATUS_FAILURE;
       }
@@ -573,9 +838,13 @@ void orxFASTCALL orxClock_Exit()
     /* Deletes all the clocks */
     orxClock_DeleteAll();
 
-    /* Deletes timer bank */
+    /* Deletes timer banks & table */
     orxBank_Delete(sstClock.pstTimerBank);
     sstClock.pstTimerBank = orxNULL;
+    orxBank_Delete(sstClock.pstTimerListBank);
+    sstClock.pstTimerListBank = orxNULL;
+    orxHashTable_Delete(sstClock.pstTimerTable);
+    sstClock.pstTimerTable = orxNULL;
 
     /* Deletes reference table */
     orxHashTable_Delete(sstClock.pstReferenceTable);
@@ -644,7 +913,7 @@ orxSTATUS orxFASTCALL orxClock_Update()
         if(pstClock->fPartialDT >= pstClock->stClockInfo.fTickSize)
         {
           orxFLOAT                    fClockDT;
-          orxCLOCK_TIMER_STORAGE     *pstTimerStorage;
+          orxCLOCK_TIMER_STORAGE     *pstTimerStorage, *pstDueList, **ppstDueLast;
           orxCLOCK_FUNCTION_STORAGE  *pstFunctionStorage;
 
           /* Gets clock modified DT */
@@ -656,11 +925,28 @@ orxSTATUS orxFASTCALL orxClock_Update()
           /* Updates clock time */
           pstClock->stClockInfo.fTime += fClockDT;
 
-          /* For all timers */
-          for(pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetFirst(&(pstClock->stTimerList)); pstTimerStorage != orxNULL;)
+          /* For all due timers, in call order */
+          for(pstDueList = orxNULL, ppstDueLast = &pstDueList;
+              (pstClock->u32TimerCounter != 0) && (pstClock->apstTimerHeap[0]->fTimeStamp <= pstClock->stClockInfo.fTime);
+              ppstDueLast = &(pstTimerStorage->pstNextDue))
+          {
+            /* Pulls it out of the heap */
+            pstTimerStorage = pstClock->apstTimerHeap[0];
+            orxClock_PullTimer(pstTimerStorage);
+
+            /* Adds it to the due list */
+            pstTimerStorage->pstNextDue = orxNULL;
+            *ppstDueLast                = pstTimerStorage;
+          }
+
+          /* For all due timers */
+          for(pstTimerStorage = pstDueList; pstTimerStorage != orxNULL; pstTimerStorage = pstDueList)
           {
-            /* Should call it? */
-            if((pstTimerStorage->fTimeStamp <= pstClock->stClockInfo.fTime) && (pstTimerStorage->s32Repetition != 0))
+            /* Gets next one */
+            pstDueList = pstTimerStorage->pstNextDue;
+
+            /* Still active? */
+            if(pstTimerStorage->s32Repetition != 0)
             {
               /* Calls it */
               pstTimerStorage->pfnCallback(&(pstClock->stClockInfo), pstTimerStorage->pContext);
@@ -676,27 +962,12 @@ orxSTATUS orxFASTCALL orxClock_Update()
               }
             }
 
-            /* Should delete it */
-            if(pstTimerStorage->s32Repetition == 0)
+            /* Should delete it or couldn't put it back in the heap? */
+            if((pstTimerStorage->s32Repetition == 0)
+            || (orxClock_PushTimer(pstTimerStorage) == orxSTATUS_FAILURE))
             {
-              orxCLOCK_TIMER_STORAGE *pstDelete;
-
-              /* Gets timer to delete */
-              pstDelete = pstTimerStorage;
-
-              /* Gets the next timer */
-              pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetNext(&(pstTimerStorage->stNode));
-
-              /* Removes current timer */
-              orxLinkList_Remove(&(pstDelete->stNode));
-
               /* Deletes it */
-              orxBank_Free(sstClock.pstTimerBank, pstDelete);
-            }
-            else
-            {
-              /* Gets the next timer */
-              pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetNext(&(pstTimerStorage->stNode));
+              orxClock_DeleteTimer(pstTimerStorage);
             }
           }
 
@@ -940,18 +1211,26 @@ orxSTATUS orxFASTCALL orxClock_Delete(orxCLOCK *_pstClock)
     /* Not locked? */
     if(!orxStructure_TestFlags(_pstClock, orxCLOCK_KU32_FLAG_UPDATE_LOCK))
     {
-      orxCLOCK_TIMER_STORAGE *pstTimerStorage;
-
       /* For all stored timers */
-      for(pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetFirst(&(_pstClock->stTimerList));
-          pstTimerStorage != orxNULL;
-          pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetFirst(&(_pstClock->stTimerList)))
+      while(_pstClock->u32TimerCounter != 0)
       {
+        orxCLOCK_TIMER_STORAGE *pstTimerStorage;
+
+        /* Gets last one */
+        pstTimerStorage = _pstClock->apstTimerHeap[_pstClock->u32TimerCounter - 1];
+
         /* Removes it */
-        orxLinkList_Remove(&(pstTimerStorage->stNode));
+        orxClock_PullTimer(pstTimerStorage);
 
         /* Deletes it */
-        orxBank_Free(sstClock.pstTimerBank, pstTimerStorage);
+        orxClock_DeleteTimer(pstTimerStorage);
+      }
+
+      /* Has timer heap? */
+      if(_pstClock->apstTimerHeap != orxNULL)
+      {
+        /* Frees it */
+        orxMemory_Free(_pstClock->apstTimerHeap);
       }
 
       /* Deletes function bank */
@@ -1563,31 +1842,81 @@ orxSTATUS orxFASTCALL orxClock_AddTimer(orxCLOCK *_pstClock, const orxCLOCK_FUNC
   /* Are delay and repetition correct? */
   if((_fDelay > orxFLOAT_0) && (_s32Repetition != 0))
   {
-    orxCLOCK_TIMER_STORAGE *pstTimerStorage;
+    orxLINKLIST *pstTimerList;
+
+    /* Gets list of timers using this callback */
+    pstTimerList = (orxLINKLIST *)orxHashTable_Get(sstClock.pstTimerTable, (orxU64)(size_t)_pfnCallback);
 
-    /* Allocates a timer storage */
-    pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxBank_Allocate(sstClock.pstTimerBank);
+    /* Not found? */
+    if(pstTimerList == orxNULL)
+    {
+      /* Allocates it */
+      pstTimerList = (orxLINKLIST *)orxBank_Allocate(sstClock.pstTimerListBank);
+
+      /* Valid? */
+      if(pstTimerList != orxNULL)
+      {
+        /* Clears it */
+        orxMemory_Zero(pstTimerList, sizeof(orxLINKLIST));
+
+        /* Adds it to the table */
+        if(orxHashTable_Add(sstClock.pstTimerTable, (orxU64)(size_t)_pfnCallback, pstTimerList) == orxSTATUS_FAILURE)
+        {
+          /* Deletes it */
+          orxBank_Free(sstClock.pstTimerListBank, pstTimerList);
+          pstTimerList = orxNULL;
+        }
+      }
+    }
 
     /* Valid? */
-    if(pstTimerStorage != orxNULL)
+    if(pstTimerList != orxNULL)
     {
-      /* Clears it */
-      orxMemory_Zero(pstTimerStorage, sizeof(orxCLOCK_TIMER_STORAGE));
+      orxCLOCK_TIMER_STORAGE *pstTimerStorage;
 
-      /* Adds it to clock timer list */
-      orxLinkList_AddEnd(&(_pstClock->stTimerList), &(pstTimerStorage->stNode));
+      /* Allocates a timer storage */
+      pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxBank_Allocate(sstClock.pstTimerBank);
 
-      /* Inits it */
-      pstTimerStorage->pfnCallback    = _pfnCallback;
-      pstTimerStorage->pContext       = _pContext;
-      pstTimerStorage->fDelay         = _fDelay;
-      pstTimerStorage->s32Repetition  = _s32Repetition;
+      /* Valid? */
+      if(pstTimerStorage != orxNULL)
+      {
+        /* Clears it */
+        orxMemory_Zero(pstTimerStorage, sizeof(orxCLOCK_TIMER_STORAGE));
 
-      /* Gets it next call time stamp */
-      pstTimerStorage->fTimeStamp = _pstClock->stClockInfo.fTime + _fDelay;
+        /* Adds it to the callback's timer list */
+        orxLinkList_AddEnd(pstTimerList, &(pstTimerStorage->stNode));
 
-      /* Updates result */
-      eResult = orxSTATUS_SUCCESS;
+        /* Inits it */
+        pstTimerStorage->pfnCallback    = _pfnCallback;
+        pstTimerStorage->pContext       = _pContext;
+        pstTimerStorage->fDelay         = _fDelay;
+        pstTimerStorage->s32Repetition  = _s32Repetition;
+        pstTimerStorage->pstClock       = _pstClock;
+        pstTimerStorage->u32HeapIndex   = orxU32_UNDEFINED;
+        pstTimerStorage->u32ID          = sstClock.u32TimerID++;
+
+        /* Gets it next call time stamp */
+        pstTimerStorage->fTimeStamp = _pstClock->stClockInfo.fTime + _fDelay;
+
+        /* Adds it to the clock's heap */
+        eResult = orxClock_PushTimer(pstTimerStorage);
+
+        /* Failure? */
+        if(eResult == orxSTATUS_FAILURE)
+        {
+          /* Deletes it */
+          orxClock_DeleteTimer(pstTimerStorage);
+        }
+      }
+      /* Empty list? */
+      else if(orxLinkList_GetCounter(pstTimerList) == 0)
+      {
+        /* Removes it from table */
+        orxHashTable_Remove(sstClock.pstTimerTable, (orxU64)(size_t)_pfnCallback);
+
+        /* Deletes it */
+        orxBank_Free(sstClock.pstTimerListBank, pstTimerList);
+      }
     }
   }
 
@@ -1604,28 +1933,52 @@ orxSTATUS orxFASTCALL orxClock_AddTimer(orxCLOCK *_pstClock, const orxCLOCK_FUNC
  */
 orxSTATUS orxFASTCALL orxClock_RemoveTimer(orxCLOCK *_pstClock, const orxCLOCK_FUNCTION _pfnCallback, orxFLOAT _fDelay, void *_pContext)
 {
-  orxCLOCK_TIMER_STORAGE *pstTimerStorage;
-  orxSTATUS               eResult = orxSTATUS_SUCCESS;
+  orxLINKLIST  *pstTimerList;
+  orxSTATUS     eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
   orxASSERT(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstClock);
   orxASSERT(_pfnCallback != orxNULL);
 
-  /* For all stored timers */
-  for(pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetFirst(&(_pstClock->stTimerList));
-      pstTimerStorage != orxNULL;
-      pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetNext(&(pstTimerStorage->stNode)))
+  /* Gets list of timers using this callback */
+  pstTimerList = (orxLINKLIST *)orxHashTable_Get(sstClock.pstTimerTable, (orxU64)(size_t)_pfnCallback);
+
+  /* Found? */
+  if(pstTimerList != orxNULL)
   {
-    /* Matches criteria? */
-    if((pstTimerStorage->pfnCallback == _pfnCallback)
-    && ((_fDelay < orxFLOAT_0)
-     || (pstTimerStorage->fDelay == _fDelay))
-    && ((_pContext == orxNULL)
-     || (pstTimerStorage->pContext == _pContext)))
+    orxCLOCK_TIMER_STORAGE *pstTimerStorage, *pstNextTimerStorage;
+
+    /* For all its timers */
+    for(pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetFirst(pstTimerList);
+        pstTimerStorage != orxNULL;
+        pstTimerStorage = pstNextTimerStorage)
     {
-      /* Marks it for deletion */
-      pstTimerStorage->s32Repetition = 0;
+      /* Gets next timer (list will be deleted along with its last timer) */
+      pstNextTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetNext(&(pstTimerStorage->stNode));
+
+      /* Matches criteria? */
+      if((pstTimerStorage->pstClock == _pstClock)
+      && ((_fDelay < orxFLOAT_0)
+       || (pstTimerStorage->fDelay == _fDelay))
+      && ((_pContext == orxNULL)
+       || (pstTimerStorage->pContext == _pContext)))
+      {
+        /* Is in heap? */
+        if(pstTimerStorage->u32HeapIndex != orxU32_UNDEFINED)
+        {
+          /* Removes it */
+          orxClock_PullTimer(pstTimerStorage);
+
+          /* Deletes it */
+          orxClock_DeleteTimer(pstTimerStorage);
+        }
+        else
+        {
+          /* Marks it for deletion (currently due, will be deleted by the clock update) */
+          pstTimerStorage->s32Repetition = 0;
+        }
+      }
     }
   }
 
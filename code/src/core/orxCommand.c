@@ -39,6 +39,7 @@
 #include "memory/orxMemory.h"
 #include "memory/orxBank.h"
 #include "object/orxTimeLine.h"
+#include "utils/orxHashTable.h"
 #include "utils/orxString.h"
 #include "utils/orxTree.h"
 
@@ -55,6 +56,7 @@
 #define orxCOMMAND_KU32_STATIC_FLAG_NONE              0x00000000                      /**< No flags */
 
 #define orxCOMMAND_KU32_STATIC_FLAG_READY             0x00000001                      /**< Ready flag */
+#define orxCOMMAND_KU32_STATIC_FLAG_CACHE_DIRTY       0x00000002                      /**< Cache dirty flag */
 
 #define orxCOMMAND_KU32_STATIC_MASK_ALL               0xFFFFFFFF                      /**< All mask */
 
@@ -67,6 +69,12 @@
 #define orxCOMMAND_KU32_RESULT_BUFFER_SIZE            256
 
 #define orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE       256
+#define orxCOMMAND_KU32_SLOT_BUFFER_SIZE              (orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE + 2)
+
+#define orxCOMMAND_KU32_CACHE_SIZE                    256
+#define orxCOMMAND_KU32_CACHE_MAX_COUNTER             1024
+
+#define orxCOMMAND_KU32_ALIAS_MAX_DEPTH               32
 
 #define orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE          4096
 #define orxCOMMAND_KU32_PROTOTYPE_BUFFER_SIZE         512
@@ -88,6 +96,20 @@ typedef struct __orxCOMMAND_STACK_ENTRY_t
 
 } orxCOMMAND_STACK_ENTRY;
 
+/** Compiled argument op enum
+ */
+typedef enum __orxCOMMAND_ARG_OP_t
+{
+  orxCOMMAND_ARG_OP_LITERAL = 0,                                                      /**< Pre-parsed literal */
+  orxCOMMAND_ARG_OP_POP,                                                              /**< Popped from the stack at runtime */
+  orxCOMMAND_ARG_OP_GUID,                                                             /**< Owner's GUID at runtime */
+
+  orxCOMMAND_ARG_OP_NUMBER,
+
+  orxCOMMAND_ARG_OP_NONE = orxENUM_NONE
+
+} orxCOMMAND_ARG_OP;
+
 /** Command variable info structure
  */
 typedef struct __orxCOMMAND_VAR_INFO_t
@@ -124,6 +146,20 @@ typedef struct __orxCOMMAND_t
 
 } orxCOMMAND;
 
+/** Compiled command line structure
+ */
+typedef struct __orxCOMMAND_COMPILED_t
+{
+  const orxCOMMAND         *pstCommand;                                               /**< Resolved command, orxNULL if the line has to be processed as text : 4 */
+  orxCOMMAND_VAR           *astArgList;                                               /**< Pre-parsed argument list : 8 */
+  orxU8                    *au8OpList;                                                /**< Argument op list : 12 */
+  const orxCHAR            *zCommandLine;                                             /**< Source command line : 16 */
+  orxU32                    u32ArgNumber;                                             /**< Argument number : 20 */
+  orxU32                    u32PushCounter;                                           /**< Push counter : 24 */
+  orxU32                    u32SlotCounter;                                           /**< Runtime argument slot counter : 28 */
+
+} orxCOMMAND_COMPILED;
+
 /** Command trie node
  */
 typedef struct __orxCOMMAND_TRIE_NODE_t
@@ -142,7 +178,12 @@ typedef struct __orxCOMMAND_STATIC_t
   orxBANK                  *pstTrieBank;                                              /**< Command trie bank */
   orxTREE                   stCommandTrie;                                            /**< Command trie */
   orxBANK                  *pstResultBank;                                            /**< Command result bank */
+  orxHASHTABLE             *pstCacheTable;                                            /**< Compiled command line cache table */
   orxCHAR                   acEvaluateBuffer[orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE];   /**< Evaluate buffer */
+  orxCHAR                   acCompileBuffer[orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE];    /**< Compile buffer */
+  orxCHAR                   acSlotBuffer[orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE];       /**< Runtime argument slot buffer */
+  orxU32                    u32SlotBufferOffset;                                      /**< Runtime argument slot buffer offset */
+  orxU32                    u32Depth;                                                 /**< Process depth */
   orxCHAR                   acPrototypeBuffer[orxCOMMAND_KU32_PROTOTYPE_BUFFER_SIZE]; /**< Prototype buffer */
   orxCHAR                   acResultBuffer[orxCOMMAND_KU32_RESULT_BUFFER_SIZE];       /**< Result buffer */
   orxU32                    u32Flags;                                                 /**< Control flags */
@@ -438,14 +479,304 @@ static orxINLINE const orxCOMMAND *orxCommand_FindNext(const orxCOMMAND_TRIE_NOD
   return pstResult;
 }
 
-static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandLine, const orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
+/** Pushes a result on the stack
+ */
+static orxINLINE void orxCommand_Push(const orxCOMMAND_VAR *_pstResult, orxU32 _u32PushCounter)
+{
+  /* For all requested pushes */
+  while(_u32PushCounter > 0)
+  {
+    orxCOMMAND_STACK_ENTRY *pstEntry;
+
+    /* Allocates stack entry */
+    pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_Allocate(sstCommand.pstResultBank);
+
+    /* Checks */
+    orxASSERT(pstEntry != orxNULL);
+
+    /* Is a string or numeric value? */
+    if((_pstResult->eType == orxCOMMAND_VAR_TYPE_STRING)
+    || (_pstResult->eType == orxCOMMAND_VAR_TYPE_NUMERIC))
+    {
+      /* Checks */
+      orxASSERT(orxString_GetLength(_pstResult->zValue) < orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE);
+
+      /* Duplicates it */
+      pstEntry->stValue.eType   = _pstResult->eType;
+      pstEntry->stValue.zValue  = pstEntry->acBuffer;
+      orxString_NCopy(pstEntry->acBuffer, _pstResult->zValue, orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE - 1);
+      pstEntry->acBuffer[orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE - 1] = orxCHAR_NULL;
+    }
+    else
+    {
+      /* Stores value */
+      orxMemory_Copy(&(pstEntry->stValue), _pstResult, sizeof(orxCOMMAND_VAR));
+    }
+
+    /* Updates push counter */
+    _u32PushCounter--;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Parses an argument, in place
+ */
+static orxINLINE orxSTATUS orxCommand_ParseArg(orxCOMMAND_VAR_TYPE _eType, const orxCHAR **_ppcSrc, orxCOMMAND_VAR *_pstArg)
+{
+  const orxCHAR  *pcSrc;
+  const orxSTRING zArg;
+  orxBOOL         bInBlock = orxFALSE, bUseDefault = orxFALSE;
+  orxSTATUS       eResult = orxSTATUS_SUCCESS;
+
+  /* Gets arg's beginning */
+  zArg = pcSrc = *_ppcSrc;
+
+  /* Is a block marker? */
+  if(*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
+  {
+    /* Updates arg pointer */
+    zArg++;
+    pcSrc++;
+
+    /* Is an empty block? */
+    if((*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
+    && (*(pcSrc + 1) != orxCOMMAND_KC_BLOCK_MARKER))
+    {
+      /* Uses default */
+      bUseDefault = orxTRUE;
+
+      /* Updates arg pointer */
+      zArg++;
+      pcSrc++;
+    }
+    else
+    {
+      /* Updates block status */
+      bInBlock = orxTRUE;
+    }
+  }
+
+  /* Stores its type */
+  _pstArg->eType = _eType;
+
+  /* Depending on its type */
+  switch(_eType)
+  {
+    case orxCOMMAND_VAR_TYPE_NUMERIC:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Replaces block end marker with 0 */
+        pcSrc--;
+        zArg--;
+        *((orxCHAR *)pcSrc) = '0';
+
+        /* Fall through */
+      }
+      else
+      {
+        orxVECTOR vValue;
+
+        /* Is a vector */
+        if(orxString_ToVector(zArg, &vValue, &pcSrc) != orxSTATUS_FAILURE)
+        {
+          /* Stores its value */
+          _pstArg->zValue = zArg;
+
+          /* Stops */
+          break;
+        }
+        else
+        {
+          /* Fall through */
+        }
+      }
+    }
+
+    default:
+    case orxCOMMAND_VAR_TYPE_STRING:
+    {
+      /* For all argument characters */
+      for(; *pcSrc != orxCHAR_NULL; pcSrc++)
+      {
+        /* Is a block marker? */
+        if(*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
+        {
+          orxCHAR *pcTemp;
+
+          /* Erases it */
+          for(pcTemp = (orxCHAR *)pcSrc; *pcTemp != orxCHAR_NULL; pcTemp++)
+          {
+            *pcTemp = *(pcTemp + 1);
+          }
+
+          /* Not double marker? */
+          if(*pcSrc != orxCOMMAND_KC_BLOCK_MARKER)
+          {
+            /* Updates block status */
+            bInBlock = !bInBlock;
+
+            /* Handles current character in new mode */
+            pcSrc--;
+          }
+          continue;
+        }
+
+        /* Not in block? */
+        if(bInBlock == orxFALSE)
+        {
+          /* End of string? */
+          if(orxCommand_IsWhiteSpace(*pcSrc) != orxFALSE)
+          {
+            /* Stops */
+            break;
+          }
+        }
+      }
+
+      /* Stores its value */
+      _pstArg->zValue = zArg;
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_FLOAT:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        _pstArg->fValue = orxFLOAT_0;
+      }
+      else
+      {
+        /* Gets its value */
+        eResult = orxString_ToFloat(zArg, &(_pstArg->fValue), &pcSrc);
+      }
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_S32:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        _pstArg->s32Value = 0;
+      }
+      else
+      {
+        /* Gets its value */
+        eResult = orxString_ToS32(zArg, &(_pstArg->s32Value), &pcSrc);
+      }
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_U32:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        _pstArg->u32Value = 0;
+      }
+      else
+      {
+        /* Gets its value */
+        eResult = orxString_ToU32(zArg, &(_pstArg->u32Value), &pcSrc);
+      }
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_S64:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        _pstArg->s64Value = 0;
+      }
+      else
+      {
+        /* Gets its value */
+        eResult = orxString_ToS64(zArg, &(_pstArg->s64Value), &pcSrc);
+      }
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_U64:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        _pstArg->u64Value = 0;
+      }
+      else
+      {
+        /* Gets its value */
+        eResult = orxString_ToU64(zArg, &(_pstArg->u64Value), &pcSrc);
+      }
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_BOOL:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        _pstArg->bValue = orxFALSE;
+      }
+      else
+      {
+        /* Gets its value */
+        eResult = orxString_ToBool(zArg, &(_pstArg->bValue), &pcSrc);
+      }
+
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_VECTOR:
+    {
+      /* Should use default? */
+      if(bUseDefault != orxFALSE)
+      {
+        /* Uses default value */
+        orxVector_Copy(&(_pstArg->vValue), &orxVECTOR_0);
+      }
+      else
+      {
+        /* Gets its value */
+        eResult = orxString_ToVector(zArg, &(_pstArg->vValue), &pcSrc);
+      }
+
+      break;
+    }
+  }
+
+  /* Updates source */
+  *_ppcSrc = pcSrc;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Processes a command line as text
+ */
+static orxCOMMAND_VAR *orxFASTCALL orxCommand_ProcessText(const orxSTRING _zCommandLine, const orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
 {
   const orxSTRING zCommand;
   orxCOMMAND_VAR *pstResult = orxNULL;
 
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxCommand_Process");
-
   /* Gets start of command */
   zCommand = orxString_SkipWhiteSpaces(_zCommandLine);
 
@@ -481,14 +812,12 @@ static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandL
     /* Found? */
     if(pstCommand != orxNULL)
     {
-#define orxCOMMAND_KU32_ALIAS_MAX_DEPTH             32
       orxSTATUS             eStatus;
       orxS32                s32GUIDLength, s32BufferCounter = 0, i;
       orxBOOL               bInBlock = orxFALSE;
       orxCOMMAND_TRIE_NODE *pstCommandNode;
       const orxCHAR        *pcSrc;
       orxCHAR              *pcDst;
-      const orxSTRING       zArg;
       const orxSTRING       azBufferList[orxCOMMAND_KU32_ALIAS_MAX_DEPTH];
       orxU32                u32ArgNumber, u32ParamNumber = (orxU32)pstCommand->u16RequiredParamNumber + (orxU32)pstCommand->u16OptionalParamNumber;
 
@@ -692,7 +1021,7 @@ static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandL
       *pcDst = orxCHAR_NULL;
 
       /* For all characters in the buffer */
-      for(pcSrc = sstCommand.acEvaluateBuffer, eStatus = orxSTATUS_SUCCESS, zArg = orxSTRING_EMPTY, u32ArgNumber = 0;
+      for(pcSrc = sstCommand.acEvaluateBuffer, eStatus = orxSTATUS_SUCCESS, u32ArgNumber = 0;
           (u32ArgNumber < u32ParamNumber) && (pcSrc - sstCommand.acEvaluateBuffer < orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE) && (*pcSrc != orxCHAR_NULL);
           pcSrc++, u32ArgNumber++)
       {
@@ -702,340 +1031,622 @@ static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandL
         /* Valid? */
         if(*pcSrc != orxCHAR_NULL)
         {
-          orxBOOL bInBlock = orxFALSE, bUseDefault = orxFALSE;
+          /* Parses it */
+          eStatus = orxCommand_ParseArg(pstCommand->astParamList[u32ArgNumber].eType, &pcSrc, &(astArgList[u32ArgNumber]));
+
+          /* Interrupted? */
+          if((eStatus == orxSTATUS_FAILURE) || (*pcSrc == orxCHAR_NULL))
+          {
+            /* Updates argument counter */
+            u32ArgNumber++;
+
+            /* Stops processing */
+            break;
+          }
+          else
+          {
+            /* Ends current argument */
+            *(orxCHAR *)pcSrc = orxCHAR_NULL;
+          }
+        }
+      }
+
+      /* Error? */
+      if((eStatus == orxSTATUS_FAILURE) || (u32ArgNumber < (orxU32)pstCommand->u16RequiredParamNumber))
+      {
+        /* Incorrect parameter? */
+        if(eStatus == orxSTATUS_FAILURE)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s], invalid argument #%d.", _zCommandLine, u32ArgNumber);
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s], expected %d[+%d] arguments, found %d.", _zCommandLine, (orxU32)pstCommand->u16RequiredParamNumber, (orxU32)pstCommand->u16OptionalParamNumber, u32ArgNumber);
+        }
+      }
+      else
+      {
+        /* Runs it */
+        pstResult = orxCommand_Run(pstCommand, orxFALSE, u32ArgNumber, astArgList, _pstResult);
+      }
+    }
+    else
+    {
+      /* Restores command end */
+      *(orxCHAR *)pcCommandEnd = cBackupChar;
+
+      /* Not silent? */
+      if(_bSilent == orxFALSE)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+      }
+    }
+
+    /* Failure? */
+    if(pstResult == orxNULL)
+    {
+      /* Stores error */
+      _pstResult->eType   = orxCOMMAND_VAR_TYPE_STRING;
+      _pstResult->zValue  = orxCOMMAND_KZ_ERROR_VALUE;
+    }
+
+    /* Pushes result */
+    orxCommand_Push(_pstResult, u32PushCounter);
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Invalidates compiled command lines
+ */
+static orxINLINE void orxCommand_InvalidateCache()
+{
+  /* Updates status */
+  orxFLAG_SET(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_CACHE_DIRTY, orxCOMMAND_KU32_STATIC_FLAG_NONE);
+
+  /* Done! */
+  return;
+}
+
+/** Clears compiled command lines
+ */
+static void orxFASTCALL orxCommand_ClearCache()
+{
+  orxHANDLE             hIterator;
+  orxCOMMAND_COMPILED  *pstCompiled;
+
+  /* Checks */
+  orxASSERT(sstCommand.u32Depth == 0);
+
+  /* For all compiled command lines */
+  for(hIterator = orxHashTable_GetNext(sstCommand.pstCacheTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstCompiled);
+      hIterator != orxHANDLE_UNDEFINED;
+      hIterator = orxHashTable_GetNext(sstCommand.pstCacheTable, hIterator, orxNULL, (void **)&pstCompiled))
+  {
+    /* Deletes it */
+    orxMemory_Free(pstCompiled);
+  }
+
+  /* Clears table */
+  orxHashTable_Clear(sstCommand.pstCacheTable);
+
+  /* Updates status */
+  orxFLAG_SET(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_NONE, orxCOMMAND_KU32_STATIC_FLAG_CACHE_DIRTY);
+
+  /* Done! */
+  return;
+}
+
+/** Compiles a command line: resolves its command & aliases and pre-parses all its literal arguments
+ * Lines that can't be safely compiled are stored without command and will be processed as text
+ */
+static orxCOMMAND_COMPILED *orxFASTCALL orxCommand_Compile(const orxSTRING _zCommandLine)
+{
+  const orxSTRING       zCommand;
+  orxCOMMAND           *pstCommand = orxNULL;
+  orxCOMMAND_COMPILED  *pstResult;
+  orxU32                u32PushCounter = 0, u32ParamNumber = 0, u32TemplateLength = 0, u32LineLength, u32HeaderSize;
+
+  /* Gets start of command */
+  zCommand = orxString_SkipWhiteSpaces(_zCommandLine);
+
+  /* Valid? */
+  if(zCommand != orxSTRING_EMPTY)
+  {
+    const orxCHAR *pcCommandEnd;
+    orxCHAR        cBackupChar;
+
+    /* For all push markers / spaces */
+    for(; (*zCommand == orxCOMMAND_KC_PUSH_MARKER) || (orxCommand_IsWhiteSpace(*zCommand) != orxFALSE); zCommand++)
+    {
+      /* Is a push marker? */
+      if(*zCommand == orxCOMMAND_KC_PUSH_MARKER)
+      {
+        /* Updates push counter */
+        u32PushCounter++;
+      }
+    }
+
+    /* Finds end of command */
+    for(pcCommandEnd = zCommand + 1; (*pcCommandEnd != orxCHAR_NULL) && (orxCommand_IsWhiteSpace(*pcCommandEnd) == orxFALSE) && (*pcCommandEnd != orxCHAR_CR) && (*pcCommandEnd != orxCHAR_LF); pcCommandEnd++);
+
+    /* Ends command */
+    cBackupChar               = *pcCommandEnd;
+    *(orxCHAR *)pcCommandEnd  = orxCHAR_NULL;
+
+    /* Gets it */
+    pstCommand = orxCommand_FindNoAlias(zCommand);
+
+    /* Found? */
+    if(pstCommand != orxNULL)
+    {
+      orxCOMMAND_TRIE_NODE *pstCommandNode;
+      const orxCHAR        *pcSrc;
+      orxCHAR              *pcDst;
+      const orxSTRING       azBufferList[orxCOMMAND_KU32_ALIAS_MAX_DEPTH];
+      orxS32                s32BufferCounter = 0, i;
+
+      /* Gets its param number */
+      u32ParamNumber = (orxU32)pstCommand->u16RequiredParamNumber + (orxU32)pstCommand->u16OptionalParamNumber;
+
+      /* Adds input to the buffer list */
+      azBufferList[s32BufferCounter++] = pcCommandEnd + 1;
+
+      /* For all alias nodes */
+      for(pstCommandNode = orxCommand_FindTrieNode(zCommand, orxFALSE);
+          (pstCommandNode->pstCommand->bIsAlias != orxFALSE) && (s32BufferCounter < orxCOMMAND_KU32_ALIAS_MAX_DEPTH);
+          pstCommandNode = orxCommand_FindTrieNode(pstCommandNode->pstCommand->zAliasedCommandName, orxFALSE))
+      {
+        /* Has args? */
+        if(pstCommandNode->pstCommand->zArgs != orxNULL)
+        {
+          /* Adds it to the buffer list */
+          azBufferList[s32BufferCounter++] = pstCommandNode->pstCommand->zArgs;
+        }
+      }
+
+      /* Restores command end */
+      *(orxCHAR *)pcCommandEnd = cBackupChar;
+
+      /* For all stacked buffers */
+      for(i = s32BufferCounter - 1, pcDst = sstCommand.acCompileBuffer; i >= 0; i--)
+      {
+        /* Has room for next buffer? */
+        if((i != s32BufferCounter - 1) && (*azBufferList[i] != orxCHAR_NULL) && (pcDst - sstCommand.acCompileBuffer < orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE - 2))
+        {
+          /* Inserts space */
+          *pcDst++ = ' ';
+        }
+
+        /* For all characters */
+        for(pcSrc = azBufferList[i]; (*pcSrc != orxCHAR_NULL) && (pcDst - sstCommand.acCompileBuffer < orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE - 2); pcSrc++)
+        {
+          /* Copies it, markers will be resolved at runtime */
+          *pcDst++ = *pcSrc;
+        }
+      }
+
+      /* Ends template */
+      *pcDst = orxCHAR_NULL;
+
+      /* Gets its length */
+      u32TemplateLength = (orxU32)(pcDst - sstCommand.acCompileBuffer);
+    }
+    else
+    {
+      /* Restores command end */
+      *(orxCHAR *)pcCommandEnd = cBackupChar;
+    }
+  }
+
+  /* Gets sizes */
+  u32LineLength = orxString_GetLength(_zCommandLine);
+  u32HeaderSize = (orxU32)orxALIGN(sizeof(orxCOMMAND_COMPILED), sizeof(orxU64));
+
+  /* Allocates compiled command line */
+  pstResult = (orxCOMMAND_COMPILED *)orxMemory_Allocate(u32HeaderSize + u32ParamNumber * (sizeof(orxCOMMAND_VAR) + sizeof(orxU8)) + u32LineLength + u32TemplateLength + 2, orxMEMORY_TYPE_MAIN);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    orxCHAR *pcTemplate;
+
+    /* Inits it */
+    orxMemory_Zero(pstResult, u32HeaderSize + u32ParamNumber * (sizeof(orxCOMMAND_VAR) + sizeof(orxU8)));
+    pstResult->astArgList     = (orxCOMMAND_VAR *)((orxU8 *)pstResult + u32HeaderSize);
+    pstResult->au8OpList      = (orxU8 *)(pstResult->astArgList + u32ParamNumber);
+    pstResult->zCommandLine   = (const orxCHAR *)(pstResult->au8OpList + u32ParamNumber);
+    pstResult->u32PushCounter = u32PushCounter;
+    pcTemplate                = (orxCHAR *)pstResult->zCommandLine + u32LineLength + 1;
+    orxMemory_Copy((orxCHAR *)pstResult->zCommandLine, _zCommandLine, u32LineLength + 1);
+
+    /* Has command? */
+    if(pstCommand != orxNULL)
+    {
+      const orxCHAR  *pcSrc;
+      orxSTATUS       eStatus;
+      orxU32          u32ArgNumber, u32PopCounter = 0, u32GUIDCounter = 0;
+
+      /* Copies template */
+      orxMemory_Copy(pcTemplate, sstCommand.acCompileBuffer, u32TemplateLength + 1);
+
+      /* For all characters */
+      for(pcSrc = pcTemplate; *pcSrc != orxCHAR_NULL; pcSrc++)
+      {
+        /* Counts runtime markers */
+        if(*pcSrc == orxCOMMAND_KC_POP_MARKER)
+        {
+          u32PopCounter++;
+        }
+        else if(*pcSrc == orxCOMMAND_KC_GUID_MARKER)
+        {
+          u32GUIDCounter++;
+        }
+      }
+
+      /* For all arguments */
+      for(pcSrc = pcTemplate, eStatus = orxSTATUS_SUCCESS, u32ArgNumber = 0;
+          (u32ArgNumber < u32ParamNumber) && (*pcSrc != orxCHAR_NULL);
+          pcSrc++, u32ArgNumber++)
+      {
+        /* Skips all whitespaces */
+        pcSrc = orxString_SkipWhiteSpaces(pcSrc);
+
+        /* Valid? */
+        if(*pcSrc != orxCHAR_NULL)
+        {
+          /* Is a standalone pop or GUID marker? */
+          if(((*pcSrc == orxCOMMAND_KC_POP_MARKER) || (*pcSrc == orxCOMMAND_KC_GUID_MARKER))
+          && ((*(pcSrc + 1) == orxCHAR_NULL) || (orxCommand_IsWhiteSpace(*(pcSrc + 1)) != orxFALSE)))
+          {
+            /* Pop? */
+            if(*pcSrc == orxCOMMAND_KC_POP_MARKER)
+            {
+              /* Stores it */
+              pstResult->au8OpList[u32ArgNumber] = (orxU8)orxCOMMAND_ARG_OP_POP;
+              u32PopCounter--;
+            }
+            else
+            {
+              /* Stores it */
+              pstResult->au8OpList[u32ArgNumber] = (orxU8)orxCOMMAND_ARG_OP_GUID;
+              u32GUIDCounter--;
+            }
+
+            /* Stores its type */
+            pstResult->astArgList[u32ArgNumber].eType = pstCommand->astParamList[u32ArgNumber].eType;
+
+            /* Updates slot counter */
+            pstResult->u32SlotCounter++;
+
+            /* Skips it */
+            pcSrc++;
+          }
+          else
+          {
+            /* Parses it */
+            pstResult->au8OpList[u32ArgNumber] = (orxU8)orxCOMMAND_ARG_OP_LITERAL;
+            eStatus = orxCommand_ParseArg(pstCommand->astParamList[u32ArgNumber].eType, &pcSrc, &(pstResult->astArgList[u32ArgNumber]));
+          }
+
+          /* Interrupted? */
+          if((eStatus == orxSTATUS_FAILURE) || (*pcSrc == orxCHAR_NULL))
+          {
+            /* Updates argument counter */
+            u32ArgNumber++;
+
+            /* Stops processing */
+            break;
+          }
+          else
+          {
+            /* Ends current argument */
+            *(orxCHAR *)pcSrc = orxCHAR_NULL;
+          }
+        }
+        else
+        {
+          /* Lets text processing handle trailing whitespaces */
+          eStatus = orxSTATUS_FAILURE;
+
+          break;
+        }
+      }
+
+      /* Valid: all arguments parsed and all markers are standalone arguments? */
+      if((eStatus != orxSTATUS_FAILURE)
+      && (u32ArgNumber >= (orxU32)pstCommand->u16RequiredParamNumber)
+      && (u32PopCounter == 0)
+      && (u32GUIDCounter == 0))
+      {
+        /* Stores command & argument number */
+        pstResult->pstCommand   = pstCommand;
+        pstResult->u32ArgNumber = u32ArgNumber;
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets a compiled command line, from cache if possible
+ */
+static orxINLINE const orxCOMMAND_COMPILED *orxCommand_GetCompiled(const orxSTRING _zCommandLine)
+{
+  const orxCOMMAND_COMPILED *pstResult = orxNULL;
 
-          /* Gets arg's beginning */
-          zArg = pcSrc;
+  /* Not nested? */
+  if(sstCommand.u32Depth == 0)
+  {
+    /* Is cache dirty or full? */
+    if((orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_CACHE_DIRTY))
+    || (orxHashTable_GetCounter(sstCommand.pstCacheTable) >= orxCOMMAND_KU32_CACHE_MAX_COUNTER))
+    {
+      /* Clears it */
+      orxCommand_ClearCache();
+    }
+  }
 
-          /* Is a block marker? */
-          if(*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
-          {
-            /* Updates arg pointer */
-            zArg++;
-            pcSrc++;
+  /* Is cache valid? (compiled command lines can't be deleted while nested, as they might be in use) */
+  if(!orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_CACHE_DIRTY))
+  {
+    orxCOMMAND_COMPILED  *pstCompiled;
+    orxU32                u32CRC;
 
-            /* Is an empty block? */
-            if((*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
-            && (*(pcSrc + 1) != orxCOMMAND_KC_BLOCK_MARKER))
-            {
-              /* Uses default */
-              bUseDefault = orxTRUE;
+    /* Gets its CRC */
+    u32CRC = orxString_ToCRC(_zCommandLine);
 
-              /* Updates arg pointer */
-              zArg++;
-              pcSrc++;
-            }
-            else
-            {
-              /* Updates block status */
-              bInBlock = orxTRUE;
-            }
-          }
+    /* Gets compiled version */
+    pstCompiled = (orxCOMMAND_COMPILED *)orxHashTable_Get(sstCommand.pstCacheTable, (orxU64)u32CRC);
 
-          /* Stores its type */
-          astArgList[u32ArgNumber].eType = pstCommand->astParamList[u32ArgNumber].eType;
+    /* Found? */
+    if(pstCompiled != orxNULL)
+    {
+      /* Not a collision? */
+      if(orxString_Compare(pstCompiled->zCommandLine, _zCommandLine) == 0)
+      {
+        /* Updates result */
+        pstResult = pstCompiled;
+      }
+    }
+    /* Has room? */
+    else if(orxHashTable_GetCounter(sstCommand.pstCacheTable) < orxCOMMAND_KU32_CACHE_MAX_COUNTER)
+    {
+      /* Compiles it */
+      pstCompiled = orxCommand_Compile(_zCommandLine);
 
-          /* Depending on its type */
-          switch(pstCommand->astParamList[u32ArgNumber].eType)
-          {
-            case orxCOMMAND_VAR_TYPE_NUMERIC:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Replaces block end marker with 0 */
-                pcSrc--;
-                zArg--;
-                *((orxCHAR *)pcSrc) = '0';
+      /* Success? */
+      if(pstCompiled != orxNULL)
+      {
+        /* Stores it */
+        orxHashTable_Add(sstCommand.pstCacheTable, (orxU64)u32CRC, pstCompiled);
 
-                /* Fall through */
-              }
-              else
-              {
-                orxVECTOR vValue;
+        /* Updates result */
+        pstResult = pstCompiled;
+      }
+    }
+  }
 
-                /* Is a vector */
-                if(orxString_ToVector(zArg, &vValue, &pcSrc) != orxSTATUS_FAILURE)
-                {
-                  /* Stores its value */
-                  astArgList[u32ArgNumber].zValue = zArg;
+  /* Done! */
+  return pstResult;
+}
 
-                  /* Stops */
-                  break;
-                }
-                else
-                {
-                  /* Fall through */
-                }
-              }
-            }
+/** Runs a compiled command line, resolving its pop & GUID arguments
+ * @return Command result if run, orxNULL if it needs to be processed as text
+ */
+static orxCOMMAND_VAR *orxFASTCALL orxCommand_RunCompiled(const orxCOMMAND_COMPILED *_pstCompiled, const orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult)
+{
+  orxCOMMAND_VAR *pstResult = orxNULL;
 
-            default:
-            case orxCOMMAND_VAR_TYPE_STRING:
-            {
-              /* For all argument characters */
-              for(; *pcSrc != orxCHAR_NULL; pcSrc++)
-              {
-                /* Is a block marker? */
-                if(*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
-                {
-                  orxCHAR *pcTemp;
+  /* Checks */
+  orxASSERT(_pstCompiled->pstCommand != orxNULL);
 
-                  /* Erases it */
-                  for(pcTemp = (orxCHAR *)pcSrc; *pcTemp != orxCHAR_NULL; pcTemp++)
-                  {
-                    *pcTemp = *(pcTemp + 1);
-                  }
+  /* No runtime argument? */
+  if(_pstCompiled->u32SlotCounter == 0)
+  {
+    /* Runs it */
+    pstResult = orxCommand_Run(_pstCompiled->pstCommand, orxFALSE, _pstCompiled->u32ArgNumber, _pstCompiled->astArgList, _pstResult);
+  }
+  /* Enough room for its slots? */
+  else if(sstCommand.u32SlotBufferOffset + _pstCompiled->u32SlotCounter * orxCOMMAND_KU32_SLOT_BUFFER_SIZE <= orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE)
+  {
+    orxCOMMAND_STACK_ENTRY *pstEntry;
+    orxCHAR                *pcSlot;
+    orxU32                  u32StackCounter, u32PopCounter = 0, u32SlotBufferOffset, i;
 
-                  /* Not double marker? */
-                  if(*pcSrc != orxCOMMAND_KC_BLOCK_MARKER)
-                  {
-                    /* Updates block status */
-                    bInBlock = !bInBlock;
+#ifdef __orxMSVC__
 
-                    /* Handles current character in new mode */
-                    pcSrc--;
-                  }
-                  continue;
-                }
+    orxCOMMAND_VAR *astArgList = (orxCOMMAND_VAR *)alloca(_pstCompiled->u32ArgNumber * sizeof(orxCOMMAND_VAR));
 
-                /* Not in block? */
-                if(bInBlock == orxFALSE)
-                {
-                  /* End of string? */
-                  if(orxCommand_IsWhiteSpace(*pcSrc) != orxFALSE)
-                  {
-                    /* Stops */
-                    break;
-                  }
-                }
-              }
+#else /* __orxMSVC__ */
 
-              /* Stores its value */
-              astArgList[u32ArgNumber].zValue = zArg;
+    orxCOMMAND_VAR astArgList[_pstCompiled->u32ArgNumber];
 
-              break;
-            }
+#endif /* __orxMSVC__ */
 
-            case orxCOMMAND_VAR_TYPE_FLOAT:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].fValue = orxFLOAT_0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToFloat(zArg, &(astArgList[u32ArgNumber].fValue), &pcSrc);
-              }
+    /* Copies pre-parsed arguments */
+    orxMemory_Copy(astArgList, _pstCompiled->astArgList, _pstCompiled->u32ArgNumber * sizeof(orxCOMMAND_VAR));
 
-              break;
-            }
+    /* Reserves slot buffer */
+    u32SlotBufferOffset               = sstCommand.u32SlotBufferOffset;
+    pcSlot                            = sstCommand.acSlotBuffer + u32SlotBufferOffset;
+    sstCommand.u32SlotBufferOffset   += _pstCompiled->u32SlotCounter * orxCOMMAND_KU32_SLOT_BUFFER_SIZE;
 
-            case orxCOMMAND_VAR_TYPE_S32:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].s32Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToS32(zArg, &(astArgList[u32ArgNumber].s32Value), &pcSrc);
-              }
+    /* Gets stack counter */
+    u32StackCounter = orxBank_GetCounter(sstCommand.pstResultBank);
 
-              break;
-            }
+    /* For all arguments */
+    for(i = 0; i < _pstCompiled->u32ArgNumber; i++)
+    {
+      /* Runtime argument? */
+      if(_pstCompiled->au8OpList[i] != (orxU8)orxCOMMAND_ARG_OP_LITERAL)
+      {
+        const orxCHAR *pcSrc = pcSlot;
 
-            case orxCOMMAND_VAR_TYPE_U32:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].u32Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToU32(zArg, &(astArgList[u32ArgNumber].u32Value), &pcSrc);
-              }
+        /* GUID? */
+        if(_pstCompiled->au8OpList[i] == (orxU8)orxCOMMAND_ARG_OP_GUID)
+        {
+          /* Is GUID valid? */
+          if(_u64GUID != orxU64_UNDEFINED)
+          {
+            /* Prints it */
+            orxString_NPrint(pcSlot, orxCOMMAND_KU32_SLOT_BUFFER_SIZE - 1, "0x%016llX", _u64GUID);
+          }
+          else
+          {
+            /* Keeps marker */
+            pcSlot[0] = orxCOMMAND_KC_GUID_MARKER;
+            pcSlot[1] = orxCHAR_NULL;
+          }
+        }
+        else
+        {
+          /* Empty stack? */
+          if(u32PopCounter >= u32StackCounter)
+          {
+            /* Stops */
+            break;
+          }
 
-              break;
-            }
+          /* Peeks at stack entry */
+          pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_GetAtIndex(sstCommand.pstResultBank, u32StackCounter - 1 - u32PopCounter++);
 
-            case orxCOMMAND_VAR_TYPE_S64:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].s64Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToS64(zArg, &(astArgList[u32ArgNumber].s64Value), &pcSrc);
-              }
+          /* String? */
+          if(pstEntry->stValue.eType == orxCOMMAND_VAR_TYPE_STRING)
+          {
+            const orxCHAR  *pc;
+            orxBOOL         bUseStringMarker = orxFALSE;
 
+            /* Contains a block marker? */
+            if(orxString_SearchChar(pstEntry->stValue.zValue, orxCOMMAND_KC_BLOCK_MARKER) != orxNULL)
+            {
+              /* Stops */
               break;
             }
 
-            case orxCOMMAND_VAR_TYPE_U64:
+            /* For all characters */
+            pc = pstEntry->stValue.zValue;
+            do
             {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].u64Value = 0;
-              }
-              else
+              /* Is a white space? */
+              if((*pc == orxCHAR_NULL) || (orxCommand_IsWhiteSpace(*pc) != orxFALSE))
               {
-                /* Gets its value */
-                eStatus = orxString_ToU64(zArg, &(astArgList[u32ArgNumber].u64Value), &pcSrc);
+                /* Updates string marker status */
+                bUseStringMarker = orxTRUE;
+
+                break;
               }
 
-              break;
-            }
+              /* Gets next character */
+              pc++;
 
-            case orxCOMMAND_VAR_TYPE_BOOL:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].bValue = orxFALSE;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToBool(zArg, &(astArgList[u32ArgNumber].bValue), &pcSrc);
-              }
+            } while(*pc != orxCHAR_NULL);
 
-              break;
+            /* Used a string marker? */
+            if(bUseStringMarker != orxFALSE)
+            {
+              /* Prints it as a block */
+              orxString_NPrint(pcSlot, orxCOMMAND_KU32_SLOT_BUFFER_SIZE - 1, "%c%s%c", orxCOMMAND_KC_BLOCK_MARKER, pstEntry->stValue.zValue, orxCOMMAND_KC_BLOCK_MARKER);
             }
-
-            case orxCOMMAND_VAR_TYPE_VECTOR:
+            else
             {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                orxVector_Copy(&(astArgList[u32ArgNumber].vValue), &orxVECTOR_0);
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToVector(zArg, &(astArgList[u32ArgNumber].vValue), &pcSrc);
-              }
-
-              break;
+              /* Copies it */
+              orxString_NCopy(pcSlot, pstEntry->stValue.zValue, orxCOMMAND_KU32_SLOT_BUFFER_SIZE - 1);
             }
           }
-
-          /* Interrupted? */
-          if((eStatus == orxSTATUS_FAILURE) || (*pcSrc == orxCHAR_NULL))
-          {
-            /* Updates argument counter */
-            u32ArgNumber++;
-
-            /* Stops processing */
-            break;
-          }
           else
           {
-            /* Ends current argument */
-            *(orxCHAR *)pcSrc = orxCHAR_NULL;
+            /* Prints it */
+            orxCommand_PrintVar(pcSlot, orxCOMMAND_KU32_SLOT_BUFFER_SIZE - 1, &(pstEntry->stValue));
           }
+          pcSlot[orxCOMMAND_KU32_SLOT_BUFFER_SIZE - 1] = orxCHAR_NULL;
         }
-      }
 
-      /* Error? */
-      if((eStatus == orxSTATUS_FAILURE) || (u32ArgNumber < (orxU32)pstCommand->u16RequiredParamNumber))
-      {
-        /* Incorrect parameter? */
-        if(eStatus == orxSTATUS_FAILURE)
-        {
-          /* Logs message */
-          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s], invalid argument #%d.", _zCommandLine, u32ArgNumber);
-        }
-        else
+        /* Can't be parsed as a single argument? */
+        if((orxCommand_ParseArg(_pstCompiled->pstCommand->astParamList[i].eType, &pcSrc, &(astArgList[i])) == orxSTATUS_FAILURE)
+        || (*pcSrc != orxCHAR_NULL))
         {
-          /* Logs message */
-          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s], expected %d[+%d] arguments, found %d.", _zCommandLine, (orxU32)pstCommand->u16RequiredParamNumber, (orxU32)pstCommand->u16OptionalParamNumber, u32ArgNumber);
+          /* Stops */
+          break;
         }
-      }
-      else
-      {
-        /* Runs it */
-        pstResult = orxCommand_Run(pstCommand, orxFALSE, u32ArgNumber, astArgList, _pstResult);
+
+        /* Gets next slot */
+        pcSlot += orxCOMMAND_KU32_SLOT_BUFFER_SIZE;
       }
     }
-    else
-    {
-      /* Restores command end */
-      *(orxCHAR *)pcCommandEnd = cBackupChar;
 
-      /* Not silent? */
-      if(_bSilent == orxFALSE)
+    /* All arguments resolved? */
+    if(i == _pstCompiled->u32ArgNumber)
+    {
+      /* For all popped entries */
+      for(; u32PopCounter > 0; u32PopCounter--)
       {
-        /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+        /* Deletes it */
+        orxBank_Free(sstCommand.pstResultBank, orxBank_GetAtIndex(sstCommand.pstResultBank, orxBank_GetCounter(sstCommand.pstResultBank) - 1));
       }
-    }
 
-    /* Failure? */
-    if(pstResult == orxNULL)
-    {
-      /* Stores error */
-      _pstResult->eType   = orxCOMMAND_VAR_TYPE_STRING;
-      _pstResult->zValue  = orxCOMMAND_KZ_ERROR_VALUE;
+      /* Runs it */
+      pstResult = orxCommand_Run(_pstCompiled->pstCommand, orxFALSE, _pstCompiled->u32ArgNumber, astArgList, _pstResult);
     }
 
-    /* For all requested pushes */
-    while(u32PushCounter > 0)
-    {
-      orxCOMMAND_STACK_ENTRY *pstEntry;
+    /* Releases slot buffer (values stay valid till next evaluation) */
+    sstCommand.u32SlotBufferOffset = u32SlotBufferOffset;
+  }
+
+  /* Done! */
+  return pstResult;
+}
 
-      /* Allocates stack entry */
-      pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_Allocate(sstCommand.pstResultBank);
+/** Processes a command line
+ */
+static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandLine, const orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
+{
+  const orxCOMMAND_COMPILED  *pstCompiled;
+  orxCOMMAND_VAR             *pstResult = orxNULL;
 
-      /* Checks */
-      orxASSERT(pstEntry != orxNULL);
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxCommand_Process");
 
-      /* Is a string or numeric value? */
-      if((_pstResult->eType == orxCOMMAND_VAR_TYPE_STRING)
-      || (_pstResult->eType == orxCOMMAND_VAR_TYPE_NUMERIC))
-      {
-        /* Checks */
-        orxASSERT(orxString_GetLength(_pstResult->zValue) < orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE);
+  /* Gets compiled version */
+  pstCompiled = orxCommand_GetCompiled(_zCommandLine);
 
-        /* Duplicates it */
-        pstEntry->stValue.eType   = _pstResult->eType;
-        pstEntry->stValue.zValue  = pstEntry->acBuffer;
-        orxString_NCopy(pstEntry->acBuffer, _pstResult->zValue, orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE - 1);
-        pstEntry->acBuffer[orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE - 1] = orxCHAR_NULL;
-      }
-      else
-      {
-        /* Stores value */
-        orxMemory_Copy(&(pstEntry->stValue), _pstResult, sizeof(orxCOMMAND_VAR));
-      }
+  /* Updates depth */
+  sstCommand.u32Depth++;
+
+  /* Has command? */
+  if((pstCompiled != orxNULL) && (pstCompiled->pstCommand != orxNULL))
+  {
+    /* Runs it */
+    pstResult = orxCommand_RunCompiled(pstCompiled, _u64GUID, _pstResult);
 
-      /* Updates push counter */
-      u32PushCounter--;
+    /* Success? */
+    if(pstResult != orxNULL)
+    {
+      /* Pushes result */
+      orxCommand_Push(pstResult, pstCompiled->u32PushCounter);
     }
   }
-  else
+
+  /* Not processed? */
+  if(pstResult == orxNULL)
   {
-    /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+    /* Processes it as text */
+    pstResult = orxCommand_ProcessText(_zCommandLine, _u64GUID, _pstResult, _bSilent);
   }
 
+  /* Updates depth */
+  sstCommand.u32Depth--;
+
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
@@ -2084,6 +2695,38 @@ void orxFASTCALL orxCommand_CommandVersion(orxU32 _u32ArgNumber, const orxCOMMAN
   return;
 }
 
+#ifdef __orxMEMORY_TRACKING__
+
+/* Command: LogSites (memory module, registered here as it can't depend on the command module) */
+static void orxFASTCALL orxMemory_CommandLogSites(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  orxU32 u32Number;
+
+  /* Gets number of sites to log */
+  u32Number = (_u32ArgNumber > 0) ? _astArgList[0].u32Value : 20;
+
+  /* Logs sites */
+  orxMemory_LogSites(u32Number);
+
+  /* Updates result */
+  _pstResult->u32Value = orxMemory_GetSiteCounter();
+
+  /* Done! */
+  return;
+}
+
+/* Command: SaveSites (memory module, registered here as it can't depend on the command module) */
+static void orxFASTCALL orxMemory_CommandSaveSites(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Saves snapshot */
+  _pstResult->bValue = (orxMemory_SaveSiteSnapshot(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+#endif /* __orxMEMORY_TRACKING__ */
+
 /** Registers all the command commands
  */
 static orxINLINE void orxCommand_RegisterCommands()
@@ -2160,6 +2803,15 @@ static orxINLINE void orxCommand_RegisterCommands()
   /* Command: Version */
   orxCOMMAND_REGISTER_CORE_COMMAND(Command, Version, "String", orxCOMMAND_VAR_TYPE_STRING, 0, 1, {"Type = full [minor|major|build|release|numeric|full]", orxCOMMAND_VAR_TYPE_STRING});
 
+#ifdef __orxMEMORY_TRACKING__
+
+  /* Command: LogSites */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Memory, LogSites, "Sites", orxCOMMAND_VAR_TYPE_U32, 0, 1, {"Number = 20 (0 for all)", orxCOMMAND_VAR_TYPE_U32});
+  /* Command: SaveSites */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Memory, SaveSites, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"File", orxCOMMAND_VAR_TYPE_STRING});
+
+#endif /* __orxMEMORY_TRACKING__ */
+
   /* Alias: Help */
   orxCommand_AddAlias("Help", "Command.Help", orxNULL);
   orxCommand_AddAlias("?", "Command.Help", orxNULL);
@@ -2439,6 +3091,15 @@ static orxINLINE void orxCommand_UnregisterCommands()
 
   /* Command: Version */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, Version);
+
+#ifdef __orxMEMORY_TRACKING__
+
+  /* Command: LogSites */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Memory, LogSites);
+  /* Command: SaveSites */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Memory, SaveSites);
+
+#endif /* __orxMEMORY_TRACKING__ */
 }
 
 /***************************************************************************
@@ -2481,8 +3142,11 @@ orxSTATUS orxFASTCALL orxCommand_Init()
       sstCommand.pstTrieBank    = orxBank_Create(orxCOMMAND_KU32_TRIE_BANK_SIZE, sizeof(orxCOMMAND_TRIE_NODE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
       sstCommand.pstResultBank  = orxBank_Create(orxCOMMAND_KU32_RESULT_BANK_SIZE, sizeof(orxCOMMAND_STACK_ENTRY), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+      /* Creates cache table */
+      sstCommand.pstCacheTable  = orxHashTable_Create(orxCOMMAND_KU32_CACHE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
       /* Valid? */
-      if((sstCommand.pstBank != orxNULL) && (sstCommand.pstTrieBank != orxNULL) && (sstCommand.pstResultBank != orxNULL))
+      if((sstCommand.pstBank != orxNULL) && (sstCommand.pstTrieBank != orxNULL) && (sstCommand.pstResultBank != orxNULL) && (sstCommand.pstCacheTable != orxNULL))
       {
         orxCOMMAND_TRIE_NODE *pstTrieRoot;
 
@@ -2524,6 +3188,9 @@ orxSTATUS orxFASTCALL orxCommand_Init()
           orxBank_Delete(sstCommand.pstTrieBank);
           orxBank_Delete(sstCommand.pstResultBank);
 
+          /* Deletes cache table */
+          orxHashTable_Delete(sstCommand.pstCacheTable);
+
           /* Logs message */
           orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Failed to create command trie.");
         }
@@ -2544,6 +3211,20 @@ orxSTATUS orxFASTCALL orxCommand_Init()
           orxBank_Delete(sstCommand.pstBank);
         }
 
+        /* Partly initialized? */
+        if(sstCommand.pstResultBank != orxNULL)
+        {
+          /* Deletes bank */
+          orxBank_Delete(sstCommand.pstResultBank);
+        }
+
+        /* Partly initialized? */
+        if(sstCommand.pstCacheTable != orxNULL)
+        {
+          /* Deletes cache table */
+          orxHashTable_Delete(sstCommand.pstCacheTable);
+        }
+
         /* Removes event handler */
         orxEvent_RemoveHandler(orxEVENT_TYPE_TIMELINE, orxCommand_EventHandler);
 
@@ -2580,6 +3261,12 @@ void orxFASTCALL orxCommand_Exit()
     /* Unregisters commands */
     orxCommand_UnregisterCommands();
 
+    /* Clears cache */
+    orxCommand_ClearCache();
+
+    /* Deletes cache table */
+    orxHashTable_Delete(sstCommand.pstCacheTable);
+
     /* Clears trie */
     orxTree_Clean(&(sstCommand.stCommandTrie));
 
@@ -2664,6 +3351,9 @@ orxSTATUS orxFASTCALL orxCommand_Register(const orxSTRING _zCommand, const orxCO
         /* Inserts in trie */
         orxCommand_InsertInTrie(pstCommand);
 
+        /* Invalidates compiled command lines */
+        orxCommand_InvalidateCache();
+
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
       }
@@ -2716,6 +3406,9 @@ orxSTATUS orxFASTCALL orxCommand_Unregister(const orxSTRING _zCommand)
       /* Deletes it */
       orxBank_Free(sstCommand.pstBank, pstCommand);
 
+      /* Invalidates compiled command lines */
+      orxCommand_InvalidateCache();
+
       /* Updates result */
       eResult = orxSTATUS_SUCCESS;
     }
@@ -2863,6 +3556,9 @@ orxSTATUS orxFASTCALL orxCommand_AddAlias(const orxSTRING _zAlias, const orxSTRI
             /* Updates aliased name */
             pstAliasNode->pstCommand->zAliasedCommandName = orxString_Duplicate(_zCommand);
             pstAliasNode->pstCommand->zArgs               = (_zArgs != orxNULL) ? orxString_Duplicate(_zArgs) : orxNULL;
+
+            /* Invalidates compiled command lines */
+            orxCommand_InvalidateCache();
           }
         }
         else
@@ -2929,6 +3625,9 @@ orxSTATUS orxFASTCALL orxCommand_RemoveAlias(const orxSTRING _zAlias)
         /* Removes its reference */
         pstNode->pstCommand = orxNULL;
 
+        /* Invalidates compiled command lines */
+        orxCommand_InvalidateCache();
+
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
       }
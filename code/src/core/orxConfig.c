@@ -82,6 +82,8 @@
 #define orxCONFIG_KU32_SECTION_BANK_SIZE          2048        /**< Default section bank size */
 #define orxCONFIG_KU32_STACK_BANK_SIZE            32          /**< Default stack bank size */
 #define orxCONFIG_KU32_ENTRY_BANK_SIZE            8192        /**< Default entry bank size */
+#define orxCONFIG_KU32_ENTRY_TABLE_SIZE           32          /**< Default entry table size */
+#define orxCONFIG_KU32_ENTRY_TABLE_THRESHOLD      8           /**< Number of entries from which a section gets an entry table */
 #define orxCONFIG_KU32_HISTORY_BANK_SIZE          32          /**< Default history bank size */
 #define orxCONFIG_KU32_BASE_FILENAME_LENGTH       256         /**< Base file name length */
 
@@ -114,6 +116,16 @@
 
 #define orxCONFIG_KZ_CONFIG_MEMORY                "Memory"    /**< Memory buffer name */
 
+#define orxCONFIG_KZ_BINARY_TAG                   "OBCF"      /**< Binary file tag */
+#define orxCONFIG_KU32_BINARY_TAG_LENGTH          4           /**< Binary file tag length */
+#define orxCONFIG_KU32_BINARY_VERSION             1           /**< Binary file version */
+#define orxCONFIG_KU32_BINARY_BANK_SIZE           32          /**< Binary source bank size */
+#define orxCONFIG_KU32_BINARY_TABLE_SIZE          4096        /**< Binary string table size */
+#define orxCONFIG_KU32_BINARY_NONE                0xFFFFFFFF  /**< Binary undefined index/offset */
+#define orxCONFIG_KU32_BINARY_NO_DEFAULT_PARENT   0xFFFFFFFE  /**< Binary 'no default' parent index */
+#define orxCONFIG_KU32_BINARY_SOURCE_FLAG_NONE    0x00000000  /**< Binary source: no flags */
+#define orxCONFIG_KU32_BINARY_SOURCE_FLAG_ROOT    0x00000001  /**< Binary source: loaded from top level */
+
 #if defined(__orxDEBUG__)
 
   #define orxCONFIG_KZ_DEFAULT_FILE               "orxd.ini"  /**< Default config file name */
@@ -209,8 +221,9 @@ typedef struct __orxCONFIG_SECTION_t
   const orxSTRING   zName;                  /**< Name : 16 */
   struct __orxCONFIG_SECTION_t *pstParent;  /**< Parent section : 20 */
   orxLINKLIST       stEntryList;            /**< Entry list : 32 */
-  orxS32            s32ProtectionCounter;   /**< Protection counter : 36 */
-  orxU32            u32OriginID;            /**< Origin : 40 */
+  orxHASHTABLE     *pstEntryTable;          /**< Entry table (large sections only) : 36 */
+  orxS32            s32ProtectionCounter;   /**< Protection counter : 40 */
+  orxU32            u32OriginID;            /**< Origin : 44 */
 
 } orxCONFIG_SECTION;
 
@@ -223,6 +236,80 @@ typedef struct __orxCONFIG_STACK_ENTRY_t
 
 } orxCONFIG_STACK_ENTRY;
 
+/** Config binary header structure, followed by sources, sections, entries, string table, list indices and data
+ */
+typedef struct __orxCONFIG_BINARY_HEADER_t
+{
+  orxCHAR             acTag[orxCONFIG_KU32_BINARY_TAG_LENGTH]; /**< Tag : 4 */
+  orxU32              u32Version;           /**< Version : 8 */
+  orxU32              u32SourceCount;       /**< Source count : 12 */
+  orxU32              u32SectionCount;      /**< Section count : 16 */
+  orxU32              u32EntryCount;        /**< Entry count : 20 */
+  orxU32              u32StringCount;       /**< String count : 24 */
+  orxU32              u32IndexCount;        /**< List index count : 28 */
+  orxU32              u32DataSize;          /**< Data size : 32 */
+
+} orxCONFIG_BINARY_HEADER;
+
+/** Config binary source structure
+ */
+typedef struct __orxCONFIG_BINARY_SOURCE_t
+{
+  orxS64              s64Time;              /**< Modification time : 8 */
+  orxU32              u32NameIndex;         /**< Name string index : 12 */
+  orxU32              u32Flags;             /**< Flags : 16 */
+
+} orxCONFIG_BINARY_SOURCE;
+
+/** Config binary section structure
+ */
+typedef struct __orxCONFIG_BINARY_SECTION_t
+{
+  orxU32              u32NameIndex;         /**< Name string index : 4 */
+  orxU32              u32OriginIndex;       /**< Origin string index : 8 */
+  orxU32              u32ParentIndex;       /**< Parent section index : 12 */
+  orxU32              u32EntryIndex;        /**< First entry index : 16 */
+  orxU32              u32EntryCount;        /**< Entry count : 20 */
+  orxU32              u32Reserved;          /**< Reserved : 24 */
+
+} orxCONFIG_BINARY_SECTION;
+
+/** Config binary entry structure
+ */
+typedef struct __orxCONFIG_BINARY_ENTRY_t
+{
+  orxU64              au64Value[2];         /**< Cached value : 16 */
+  orxU64              au64AltValue[2];      /**< Cached alternate value : 32 */
+  orxU32              u32KeyIndex;          /**< Key string index : 36 */
+  orxU32              u32OriginIndex;       /**< Origin string index : 40 */
+  orxU32              u32ValueIndex;        /**< Value string index (single values only) : 44 */
+  orxU32              u32ValueOffset;       /**< Value data offset (lists only) : 48 */
+  orxU32              u32ValueSize;         /**< Value data size, including all list items (lists only) : 52 */
+  orxU32              u32IndexIndex;        /**< First list index index (lists only) : 56 */
+  orxU16              u16Type;              /**< Cached value type : 58 */
+  orxU16              u16Flags;             /**< Value flags : 60 */
+  orxU16              u16ListCounter;       /**< List counter : 62 */
+  orxU16              u16CacheIndex;        /**< Cache index : 64 */
+
+} orxCONFIG_BINARY_ENTRY;
+
+/** Config binary writing context structure
+ */
+typedef struct __orxCONFIG_BINARY_CONTEXT_t
+{
+  orxHASHTABLE       *pstStringTable;       /**< String table */
+  orxHASHTABLE       *pstSourceTable;       /**< Source table */
+  orxBANK            *pstSourceBank;        /**< Source bank */
+  orxCHAR            *acData;               /**< Data */
+  orxU32             *au32StringList;       /**< String list (offsets) */
+  orxU32              u32DataSize;          /**< Data size */
+  orxU32              u32DataCapacity;      /**< Data capacity */
+  orxU32              u32StringCount;       /**< String count */
+  orxU32              u32StringCapacity;    /**< String capacity */
+  orxSTATUS           eResult;              /**< Result */
+
+} orxCONFIG_BINARY_CONTEXT;
+
 /** Static structure
  */
 typedef struct __orxCONFIG_STATIC_t
@@ -318,14 +405,67 @@ static orxINLINE void orxConfig_CleanValue(orxCONFIG_VALUE *_pstValue)
   return;
 }
 
+/** Indexes an entry, creating the section's entry table when it gets large enough
+ * @param[in] _pstSection       Concerned section
+ * @param[in] _pstEntry         Entry to index
+ */
+static orxINLINE void orxConfig_IndexEntry(orxCONFIG_SECTION *_pstSection, orxCONFIG_ENTRY *_pstEntry)
+{
+  /* Checks */
+  orxASSERT(_pstSection != orxNULL);
+  orxASSERT(_pstEntry != orxNULL);
+
+  /* Has entry table? */
+  if(_pstSection->pstEntryTable != orxNULL)
+  {
+    /* Adds entry to it */
+    orxHashTable_Add(_pstSection->pstEntryTable, _pstEntry->u32ID, _pstEntry);
+  }
+  /* Large enough? */
+  else if(orxLinkList_GetCounter(&(_pstSection->stEntryList)) >= orxCONFIG_KU32_ENTRY_TABLE_THRESHOLD)
+  {
+    /* Creates entry table */
+    _pstSection->pstEntryTable = orxHashTable_Create(orxCONFIG_KU32_ENTRY_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_CONFIG);
+
+    /* Success? */
+    if(_pstSection->pstEntryTable != orxNULL)
+    {
+      orxCONFIG_ENTRY *pstEntry;
+
+      /* For all entries */
+      for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(_pstSection->stEntryList));
+          pstEntry != orxNULL;
+          pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+      {
+        /* Adds it to table */
+        orxHashTable_Add(_pstSection->pstEntryTable, pstEntry->u32ID, pstEntry);
+      }
+    }
+  }
+
+  return;
+}
+
 /** Deletes an entry
  * @param[in] _pstEntry         Entry to delete
  */
 static orxINLINE void orxConfig_DeleteEntry(orxCONFIG_ENTRY *_pstEntry)
 {
+  orxCONFIG_SECTION *pstSection;
+
   /* Checks */
   orxASSERT(_pstEntry != orxNULL);
 
+  /* Gets its section */
+  pstSection = orxSTRUCT_GET_FROM_FIELD(orxCONFIG_SECTION, stEntryList, orxLinkList_GetList(&(_pstEntry->stNode)));
+
+  /* Has entry table? */
+  if(pstSection->pstEntryTable != orxNULL)
+  {
+    /* Removes it from table */
+    orxHashTable_Remove(pstSection->pstEntryTable, _pstEntry->u32ID);
+  }
+
   /* Deletes value */
   orxConfig_CleanValue(&(_pstEntry->stValue));
 
@@ -925,18 +1065,27 @@ static orxINLINE orxCONFIG_ENTRY *orxConfig_GetEntry(orxU32 _u32KeyID)
   /* Checks */
   orxASSERT(sstConfig.pstCurrentSection != orxNULL);
 
-  /* For all entries */
-  for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(sstConfig.pstCurrentSection->stEntryList));
-      pstEntry != orxNULL;
-      pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+  /* Has entry table? */
+  if(sstConfig.pstCurrentSection->pstEntryTable != orxNULL)
   {
-    /* Found? */
-    if(_u32KeyID == pstEntry->u32ID)
+    /* Updates result */
+    pstResult = (orxCONFIG_ENTRY *)orxHashTable_Get(sstConfig.pstCurrentSection->pstEntryTable, _u32KeyID);
+  }
+  else
+  {
+    /* For all entries */
+    for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(sstConfig.pstCurrentSection->stEntryList));
+        pstEntry != orxNULL;
+        pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
     {
-      /* Updates result */
-      pstResult = pstEntry;
+      /* Found? */
+      if(_u32KeyID == pstEntry->u32ID)
+      {
+        /* Updates result */
+        pstResult = pstEntry;
 
-      break;
+        break;
+      }
     }
   }
 
@@ -1326,6 +1475,9 @@ static orxINLINE orxSTATUS orxConfig_SetEntry(const orxSTRING _zKey, const orxST
 
           /* Sets its ID */
           pstEntry->u32ID = u32KeyID;
+
+          /* Indexes it */
+          orxConfig_IndexEntry(sstConfig.pstCurrentSection, pstEntry);
         }
 
         /* Inits its type */
@@ -1342,6 +1494,13 @@ static orxINLINE orxSTATUS orxConfig_SetEntry(const orxSTRING _zKey, const orxST
           /* Reusing entry? */
           if(bReuse != orxFALSE)
           {
+            /* Has entry table? */
+            if(sstConfig.pstCurrentSection->pstEntryTable != orxNULL)
+            {
+              /* Removes it from table */
+              orxHashTable_Remove(sstConfig.pstCurrentSection->pstEntryTable, u32KeyID);
+            }
+
             /* Removes it from list */
             orxLinkList_Remove(&(pstEntry->stNode));
           }
@@ -1377,8 +1536,9 @@ static orxINLINE orxCONFIG_SECTION *orxConfig_CreateSection(const orxSTRING _zSe
     /* Creates origin */
     pstSection->u32OriginID = sstConfig.u32LoadFileID;
 
-    /* Clears its entry list */
+    /* Clears its entry list & table */
     orxMemory_Zero(&(pstSection->stEntryList), sizeof(orxLINKLIST));
+    pstSection->pstEntryTable = orxNULL;
 
     /* Adds it to list */
     orxMemory_Zero(&(pstSection->stNode), sizeof(orxLINKLIST_NODE));
@@ -1468,6 +1628,13 @@ static orxINLINE void orxConfig_DeleteSection(orxCONFIG_SECTION *_pstSection)
     /* Removes it from table */
     orxHashTable_Remove(sstConfig.pstSectionTable, orxString_ToCRC(_pstSection->zName));
 
+    /* Has entry table? */
+    if(_pstSection->pstEntryTable != orxNULL)
+    {
+      /* Deletes it */
+      orxHashTable_Delete(_pstSection->pstEntryTable);
+    }
+
     /* Removes section */
     orxBank_Free(sstConfig.pstSectionBank, _pstSection);
   }
@@ -3001,175 +3168,838 @@ static orxSTATUS orxConfig_SelectSectionInternal(const orxSTRING _zSectionName)
   /* Done! */
   return eResult;
 }
-/** Origin save callback
+/** Adds data to a binary context
+ * @param[in] _pstContext       Concerned context
+ * @param[in] _pData            Data to add
+ * @param[in] _u32Size          Size of the data
+ * @return                      Data offset / orxCONFIG_KU32_BINARY_NONE
  */
-orxBOOL orxFASTCALL orxConfig_OriginSaveCallback(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption)
+static orxU32 orxFASTCALL orxConfig_AddBinaryData(orxCONFIG_BINARY_CONTEXT *_pstContext, const void *_pData, orxU32 _u32Size)
 {
-  orxBOOL bResult;
+  orxU32 u32Result = orxCONFIG_KU32_BINARY_NONE;
 
-#ifdef __orxWINDOWS__
+  /* Needs to grow? */
+  if(_pstContext->u32DataSize + _u32Size > _pstContext->u32DataCapacity)
+  {
+    orxCHAR  *acData;
+    orxU32    u32Capacity;
 
-  /* Updates result */
-  bResult = ((_zKeyName != orxNULL) || (orxString_ICompare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+    /* Computes new capacity */
+    for(u32Capacity = (_pstContext->u32DataCapacity != 0) ? _pstContext->u32DataCapacity : orxCONFIG_KU32_LARGE_BUFFER_SIZE;
+        u32Capacity < _pstContext->u32DataSize + _u32Size;
+        u32Capacity <<= 1)
+    ;
 
-#else /* __orxWINDOWS__ */
+    /* Reallocates data */
+    acData = (orxCHAR *)orxMemory_Reallocate(_pstContext->acData, u32Capacity);
 
-  /* Updates result */
-  bResult = ((_zKeyName != orxNULL) || (orxString_Compare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+    /* Success? */
+    if(acData != orxNULL)
+    {
+      /* Stores it */
+      _pstContext->acData           = acData;
+      _pstContext->u32DataCapacity  = u32Capacity;
+    }
+  }
 
-#endif /* __orxWINDOWS__ */
+  /* Has room? */
+  if(_pstContext->u32DataSize + _u32Size <= _pstContext->u32DataCapacity)
+  {
+    /* Copies data */
+    orxMemory_Copy(_pstContext->acData + _pstContext->u32DataSize, _pData, _u32Size);
 
-  /* Done! */
-  return bResult;
-}
+    /* Updates result */
+    u32Result = _pstContext->u32DataSize;
 
-/** Command: Load
- */
-void orxFASTCALL orxConfig_CommandLoad(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->bValue = (orxConfig_Load(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+    /* Updates size */
+    _pstContext->u32DataSize += _u32Size;
+  }
+  else
+  {
+    /* Updates context result */
+    _pstContext->eResult = orxSTATUS_FAILURE;
+  }
 
   /* Done! */
-  return;
+  return u32Result;
 }
 
-/** Command: Save
+/** Adds a string to a binary context's string table, only once
+ * @param[in] _pstContext       Concerned context
+ * @param[in] _zString          String to add
+ * @return                      String index / orxCONFIG_KU32_BINARY_NONE
  */
-void orxFASTCALL orxConfig_CommandSave(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+static orxU32 orxFASTCALL orxConfig_AddBinaryString(orxCONFIG_BINARY_CONTEXT *_pstContext, const orxSTRING _zString)
 {
-  /* Updates result */
-  _pstResult->bValue = (orxConfig_Save(_astArgList[0].zValue, (_u32ArgNumber > 2) ? _astArgList[2].bValue : orxFALSE, ((_u32ArgNumber > 1) && (_astArgList[1].bValue != orxFALSE)) ? orxConfig_OriginSaveCallback : orxNULL) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+  void  **ppIndex;
+  orxU32  u32Result = orxCONFIG_KU32_BINARY_NONE;
 
-  /* Done! */
-  return;
-}
+  /* Gets its index bucket */
+  ppIndex = orxHashTable_Retrieve(_pstContext->pstStringTable, orxString_ToCRC(_zString));
 
-/** Command: Reload
- */
-void orxFASTCALL orxConfig_CommandReload(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->bValue = (orxConfig_ReloadHistory() != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+  /* Success? */
+  if(ppIndex != orxNULL)
+  {
+    /* Not already added? */
+    if(*ppIndex == orxNULL)
+    {
+      /* Needs to grow? */
+      if(_pstContext->u32StringCount == _pstContext->u32StringCapacity)
+      {
+        orxU32 *au32StringList;
+        orxU32  u32Capacity;
 
-  /* Done! */
-  return;
-}
+        /* Computes new capacity */
+        u32Capacity = (_pstContext->u32StringCapacity != 0) ? _pstContext->u32StringCapacity << 1 : orxCONFIG_KU32_BINARY_TABLE_SIZE;
 
-/** Command: GetOrigin
- */
-void orxFASTCALL orxConfig_CommandGetOrigin(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->zValue = orxConfig_GetOrigin(_astArgList[0].zValue);
+        /* Reallocates string list */
+        au32StringList = (orxU32 *)orxMemory_Reallocate(_pstContext->au32StringList, u32Capacity * sizeof(orxU32));
 
-  /* Done! */
-  return;
-}
+        /* Success? */
+        if(au32StringList != orxNULL)
+        {
+          /* Stores it */
+          _pstContext->au32StringList     = au32StringList;
+          _pstContext->u32StringCapacity  = u32Capacity;
+        }
+      }
 
-/** Command: GetParent
- */
-void orxFASTCALL orxConfig_CommandGetParent(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->zValue = orxConfig_GetParent(_astArgList[0].zValue);
-  if(_pstResult->zValue == orxNULL)
+      /* Has room? */
+      if(_pstContext->u32StringCount < _pstContext->u32StringCapacity)
+      {
+        /* Adds its content */
+        _pstContext->au32StringList[_pstContext->u32StringCount] = orxConfig_AddBinaryData(_pstContext, _zString, orxString_GetLength(_zString) + 1);
+
+        /* Updates result */
+        u32Result = _pstContext->u32StringCount++;
+
+        /* Stores its index (+1, as null marks new buckets) */
+        *ppIndex = (void *)((size_t)u32Result + 1);
+      }
+      else
+      {
+        /* Updates context result */
+        _pstContext->eResult = orxSTATUS_FAILURE;
+      }
+    }
+    else
+    {
+      /* Updates result */
+      u32Result = (orxU32)((size_t)*ppIndex - 1);
+    }
+  }
+  else
   {
-    _pstResult->zValue = orxSTRING_EMPTY;
+    /* Updates context result */
+    _pstContext->eResult = orxSTATUS_FAILURE;
   }
 
   /* Done! */
-  return;
+  return u32Result;
 }
 
-/** Command: SetParent
+/** Adds a source to a binary context, only once
+ * @param[in] _pstContext       Concerned context
+ * @param[in] _u32NameID        Source name ID
+ * @param[in] _u32Flags         Source flags
+ * @return                      Source name string index / orxCONFIG_KU32_BINARY_NONE
  */
-void orxFASTCALL orxConfig_CommandSetParent(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+static orxU32 orxFASTCALL orxConfig_AddBinarySource(orxCONFIG_BINARY_CONTEXT *_pstContext, orxU32 _u32NameID, orxU32 _u32Flags)
 {
-  /* Updates result */
-  _pstResult->zValue = (orxConfig_SetParent(_astArgList[0].zValue, (_u32ArgNumber > 1) ? ((_astArgList[1].zValue[0] != orxCONFIG_KC_INHERITANCE_MARKER) ? _astArgList[1].zValue : orxSTRING_EMPTY) : orxNULL) != orxSTATUS_FAILURE) ? _astArgList[0].zValue : orxSTRING_EMPTY;
+  const orxSTRING zName;
+  orxU32          u32Result = orxCONFIG_KU32_BINARY_NONE;
 
-  /* Done! */
-  return;
-}
+  /* Gets its name */
+  zName = orxString_GetFromID(_u32NameID);
 
-/** Command: CreateSection
- */
-void orxFASTCALL orxConfig_CommandCreateSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->zValue = (orxConfig_SelectSection(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? _astArgList[0].zValue : orxSTRING_EMPTY;
+  /* Valid? */
+  if(zName != orxSTRING_EMPTY)
+  {
+    orxCONFIG_BINARY_SOURCE *pstSource;
 
-  /* Done! */
-  return;
-}
+    /* Updates result */
+    u32Result = orxConfig_AddBinaryString(_pstContext, zName);
 
-/** Command: HasSection
- */
-void orxFASTCALL orxConfig_CommandHasSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->bValue = (orxConfig_HasSection(_astArgList[0].zValue));
+    /* Isn't a memory buffer? */
+    if(orxString_Compare(zName, orxCONFIG_KZ_CONFIG_MEMORY) != 0)
+    {
+      /* Gets it */
+      pstSource = (orxCONFIG_BINARY_SOURCE *)orxHashTable_Get(_pstContext->pstSourceTable, _u32NameID);
 
-  /* Done! */
-  return;
-}
+      /* New source? */
+      if(pstSource == orxNULL)
+      {
+        /* Allocates it */
+        pstSource = (orxCONFIG_BINARY_SOURCE *)orxBank_Allocate(_pstContext->pstSourceBank);
 
-/** Command: ClearSection
- */
-void orxFASTCALL orxConfig_CommandClearSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Clears section */
-   orxConfig_ClearSection(_astArgList[0].zValue);
+        /* Success? */
+        if(pstSource != orxNULL)
+        {
+          const orxSTRING zLocation;
 
-  /* Updates result */
-  _pstResult->zValue = _astArgList[0].zValue;
+          /* Inits it */
+          zLocation               = orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, zName);
+          pstSource->s64Time      = (zLocation != orxNULL) ? orxResource_GetTime(zLocation) : 0;
+          pstSource->u32NameIndex = u32Result;
+          pstSource->u32Flags     = _u32Flags;
+
+          /* Adds it to table */
+          orxHashTable_Add(_pstContext->pstSourceTable, _u32NameID, pstSource);
+        }
+        else
+        {
+          /* Updates context result */
+          _pstContext->eResult = orxSTATUS_FAILURE;
+        }
+      }
+      else
+      {
+        /* Updates its flags */
+        pstSource->u32Flags |= _u32Flags;
+      }
+    }
+  }
 
   /* Done! */
-  return;
+  return u32Result;
 }
 
-/** Command: ClearValue
+/** Processes a binary config buffer
+ * @param[in] _zName            Name of the buffer (file name)
+ * @param[in] _pu8Buffer        Buffer to process
+ * @param[in] _u32Size          Size of the buffer
+ * @return                      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-void orxFASTCALL orxConfig_CommandClearValue(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+static orxSTATUS orxFASTCALL orxConfig_ProcessBinary(const orxSTRING _zName, const orxU8 *_pu8Buffer, orxU32 _u32Size)
 {
-  /* Pushes section */
-  orxConfig_PushSection(_astArgList[0].zValue);
+  const orxCONFIG_BINARY_HEADER  *pstHeader;
+  const orxCONFIG_BINARY_SOURCE  *astSourceList;
+  const orxCONFIG_BINARY_SECTION *astSectionList;
+  const orxCONFIG_BINARY_ENTRY   *astEntryList;
+  const orxU32                   *au32StringList, *au32IndexList;
+  const orxCHAR                  *acData;
+  orxU32                          i, j;
+  orxSTATUS                       eResult = orxSTATUS_FAILURE;
 
-  /* Clears value */
-  orxConfig_ClearValue(_astArgList[1].zValue);
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxConfig_ProcessBinary");
 
-  /* Pops section */
-  orxConfig_PopSection();
+  /* Gets header */
+  pstHeader = (const orxCONFIG_BINARY_HEADER *)_pu8Buffer;
 
-  /* Updates result */
-  _pstResult->zValue = _astArgList[1].zValue;
+  /* Valid? */
+  if((_u32Size >= sizeof(orxCONFIG_BINARY_HEADER))
+  && (orxString_NCompare(pstHeader->acTag, orxCONFIG_KZ_BINARY_TAG, orxCONFIG_KU32_BINARY_TAG_LENGTH) == 0)
+  && (pstHeader->u32Version == orxCONFIG_KU32_BINARY_VERSION)
+  && ((orxU64)sizeof(orxCONFIG_BINARY_HEADER)
+    + (orxU64)pstHeader->u32SourceCount * sizeof(orxCONFIG_BINARY_SOURCE)
+    + (orxU64)pstHeader->u32SectionCount * sizeof(orxCONFIG_BINARY_SECTION)
+    + (orxU64)pstHeader->u32EntryCount * sizeof(orxCONFIG_BINARY_ENTRY)
+    + (orxU64)pstHeader->u32StringCount * sizeof(orxU32)
+    + (orxU64)pstHeader->u32IndexCount * sizeof(orxU32)
+    + (orxU64)pstHeader->u32DataSize == (orxU64)_u32Size)
+  && ((pstHeader->u32DataSize == 0) || (_pu8Buffer[_u32Size - 1] == orxCHAR_NULL)))
+  {
+    orxBOOL bStale = orxFALSE;
+
+    /* Gets all tables */
+    astSourceList   = (const orxCONFIG_BINARY_SOURCE *)(pstHeader + 1);
+    astSectionList  = (const orxCONFIG_BINARY_SECTION *)(astSourceList + pstHeader->u32SourceCount);
+    astEntryList    = (const orxCONFIG_BINARY_ENTRY *)(astSectionList + pstHeader->u32SectionCount);
+    au32StringList  = (const orxU32 *)(astEntryList + pstHeader->u32EntryCount);
+    au32IndexList   = au32StringList + pstHeader->u32StringCount;
+    acData          = (const orxCHAR *)(au32IndexList + pstHeader->u32IndexCount);
 
-  /* Done! */
-  return;
-}
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
 
-/** Command: HasValue
- */
-void orxFASTCALL orxConfig_CommandHasValue(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Pushes section */
-  orxConfig_PushSection(_astArgList[0].zValue);
+    /* For all strings */
+    for(i = 0; i < pstHeader->u32StringCount; i++)
+    {
+      /* Invalid? (the data block being null-terminated, all strings will be as well) */
+      if(au32StringList[i] >= pstHeader->u32DataSize)
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
 
-  /* Updates result */
-  _pstResult->bValue = (orxConfig_HasValue(_astArgList[1].zValue));
+        break;
+      }
+    }
 
-  /* Pops section */
-  orxConfig_PopSection();
+    /* For all sources */
+    for(i = 0; (i < pstHeader->u32SourceCount) && (eResult != orxSTATUS_FAILURE); i++)
+    {
+      /* Valid? */
+      if(astSourceList[i].u32NameIndex < pstHeader->u32StringCount)
+      {
+        const orxSTRING zLocation;
 
-  /* Done! */
-  return;
-}
+        /* Hasn't found a stale source yet and this one is newer than the snapshot? (missing sources are ignored) */
+        if((bStale == orxFALSE)
+        && ((zLocation = orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, acData + au32StringList[astSourceList[i].u32NameIndex])) != orxNULL)
+        && (orxResource_GetTime(zLocation) > astSourceList[i].s64Time))
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Binary config is older than its source <%s>, loading text sources instead.", _zName, acData + au32StringList[astSourceList[i].u32NameIndex]);
 
-/** Command: GetValue
- */
-void orxFASTCALL orxConfig_CommandGetValue(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
+          /* Updates status */
+          bStale = orxTRUE;
+        }
+      }
+      else
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+
+    /* For all sections */
+    for(i = 0; (i < pstHeader->u32SectionCount) && (eResult != orxSTATUS_FAILURE); i++)
+    {
+      const orxCONFIG_BINARY_SECTION *pstSection;
+
+      /* Gets it */
+      pstSection = &astSectionList[i];
+
+      /* Invalid? */
+      if((pstSection->u32NameIndex >= pstHeader->u32StringCount)
+      || ((pstSection->u32OriginIndex != orxCONFIG_KU32_BINARY_NONE) && (pstSection->u32OriginIndex >= pstHeader->u32StringCount))
+      || ((pstSection->u32ParentIndex != orxCONFIG_KU32_BINARY_NONE) && (pstSection->u32ParentIndex != orxCONFIG_KU32_BINARY_NO_DEFAULT_PARENT) && (pstSection->u32ParentIndex >= pstHeader->u32SectionCount))
+      || ((orxU64)pstSection->u32EntryIndex + (orxU64)pstSection->u32EntryCount > (orxU64)pstHeader->u32EntryCount))
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+
+    /* For all entries */
+    for(i = 0; (i < pstHeader->u32EntryCount) && (eResult != orxSTATUS_FAILURE); i++)
+    {
+      const orxCONFIG_BINARY_ENTRY *pstEntry;
+
+      /* Gets it */
+      pstEntry = &astEntryList[i];
+
+      /* Invalid? */
+      if((pstEntry->u32KeyIndex >= pstHeader->u32StringCount)
+      || ((pstEntry->u32OriginIndex != orxCONFIG_KU32_BINARY_NONE) && (pstEntry->u32OriginIndex >= pstHeader->u32StringCount))
+      || (pstEntry->u16ListCounter == 0))
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+      /* List? */
+      else if(orxFLAG_TEST(pstEntry->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST))
+      {
+        /* Invalid? */
+        if((pstEntry->u16ListCounter < 2)
+        || (pstEntry->u32ValueSize == 0)
+        || ((orxU64)pstEntry->u32ValueOffset + (orxU64)pstEntry->u32ValueSize > (orxU64)pstHeader->u32DataSize)
+        || (acData[pstEntry->u32ValueOffset + pstEntry->u32ValueSize - 1] != orxCHAR_NULL)
+        || ((orxU64)pstEntry->u32IndexIndex + (orxU64)pstEntry->u16ListCounter - 1 > (orxU64)pstHeader->u32IndexCount))
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+        else
+        {
+          /* For all list indices */
+          for(j = 0; j < (orxU32)pstEntry->u16ListCounter - 1; j++)
+          {
+            /* Invalid? */
+            if(au32IndexList[pstEntry->u32IndexIndex + j] >= pstEntry->u32ValueSize)
+            {
+              /* Updates result */
+              eResult = orxSTATUS_FAILURE;
+
+              break;
+            }
+          }
+        }
+      }
+      /* Invalid single value? */
+      else if(pstEntry->u32ValueIndex >= pstHeader->u32StringCount)
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+
+    /* Valid? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Stale? */
+      if(bStale != orxFALSE)
+      {
+        /* For all sources */
+        for(i = 0; i < pstHeader->u32SourceCount; i++)
+        {
+          /* Was loaded from top level? */
+          if(orxFLAG_TEST(astSourceList[i].u32Flags, orxCONFIG_KU32_BINARY_SOURCE_FLAG_ROOT))
+          {
+            /* Loads it */
+            if(orxConfig_Load(acData + au32StringList[astSourceList[i].u32NameIndex]) == orxSTATUS_FAILURE)
+            {
+              /* Updates result */
+              eResult = orxSTATUS_FAILURE;
+            }
+          }
+        }
+      }
+      else
+      {
+        const orxSTRING    *azStringList;
+        orxU32             *au32IDList;
+        orxCONFIG_SECTION **apstSectionList;
+
+        /* Allocates string, ID & section lists */
+        azStringList    = (const orxSTRING *)orxMemory_Allocate(orxMAX(pstHeader->u32StringCount, 1) * sizeof(orxSTRING), orxMEMORY_TYPE_TEMP);
+        au32IDList      = (orxU32 *)orxMemory_Allocate(orxMAX(pstHeader->u32StringCount, 1) * sizeof(orxU32), orxMEMORY_TYPE_TEMP);
+        apstSectionList = (orxCONFIG_SECTION **)orxMemory_Allocate(orxMAX(pstHeader->u32SectionCount, 1) * sizeof(orxCONFIG_SECTION *), orxMEMORY_TYPE_TEMP);
+
+        /* Success? */
+        if((azStringList != orxNULL) && (au32IDList != orxNULL) && (apstSectionList != orxNULL))
+        {
+          orxCONFIG_SECTION *pstPreviousSection;
+
+          /* Backups current section */
+          pstPreviousSection = sstConfig.pstCurrentSection;
+
+          /* For all strings */
+          for(i = 0; i < pstHeader->u32StringCount; i++)
+          {
+            /* Stores it, only once for the whole snapshot */
+            azStringList[i] = orxString_Store(acData + au32StringList[i]);
+            au32IDList[i]   = orxString_ToCRC(azStringList[i]);
+          }
+
+          /* For all sections */
+          for(i = 0; i < pstHeader->u32SectionCount; i++)
+          {
+            /* Gets it from table */
+            apstSectionList[i] = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, au32IDList[astSectionList[i].u32NameIndex]);
+
+            /* Not found? */
+            if(apstSectionList[i] == orxNULL)
+            {
+              /* Creates it */
+              apstSectionList[i] = orxConfig_CreateSection(azStringList[astSectionList[i].u32NameIndex], orxNULL);
+
+              /* Success? */
+              if(apstSectionList[i] != orxNULL)
+              {
+                /* Restores its origin */
+                apstSectionList[i]->u32OriginID = (astSectionList[i].u32OriginIndex != orxCONFIG_KU32_BINARY_NONE) ? au32IDList[astSectionList[i].u32OriginIndex] : 0;
+              }
+              else
+              {
+                /* Logs message */
+                orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Failed to create config section [%s].", _zName, azStringList[astSectionList[i].u32NameIndex]);
+
+                /* Updates result */
+                eResult = orxSTATUS_FAILURE;
+              }
+            }
+          }
+
+          /* For all sections */
+          for(i = 0; i < pstHeader->u32SectionCount; i++)
+          {
+            const orxCONFIG_BINARY_SECTION *pstBinarySection;
+            orxCONFIG_SECTION              *pstSection;
+
+            /* Gets both versions */
+            pstBinarySection  = &astSectionList[i];
+            pstSection        = apstSectionList[i];
+
+            /* Valid? */
+            if(pstSection != orxNULL)
+            {
+              /* Forces 'no default' parent? */
+              if(pstBinarySection->u32ParentIndex == orxCONFIG_KU32_BINARY_NO_DEFAULT_PARENT)
+              {
+                /* Updates parent */
+                pstSection->pstParent = (orxCONFIG_SECTION *)orxHANDLE_UNDEFINED;
+              }
+              /* Has parent? */
+              else if((pstBinarySection->u32ParentIndex != orxCONFIG_KU32_BINARY_NONE)
+                   && (apstSectionList[pstBinarySection->u32ParentIndex] != orxNULL))
+              {
+                /* Updates parent */
+                pstSection->pstParent = apstSectionList[pstBinarySection->u32ParentIndex];
+
+                /* Protects it */
+                pstSection->pstParent->s32ProtectionCounter++;
+
+                /* Checks */
+                orxASSERT(pstSection->pstParent->s32ProtectionCounter >= 0);
+              }
+
+              /* Selects it */
+              sstConfig.pstCurrentSection = pstSection;
+
+              /* For all its entries */
+              for(j = 0; j < pstBinarySection->u32EntryCount; j++)
+              {
+                const orxCONFIG_BINARY_ENTRY *pstBinaryEntry;
+                orxCONFIG_ENTRY              *pstEntry;
+                orxU32                        u32KeyID;
+
+                /* Gets binary entry */
+                pstBinaryEntry = &astEntryList[pstBinarySection->u32EntryIndex + j];
+
+                /* Gets key ID */
+                u32KeyID = au32IDList[pstBinaryEntry->u32KeyIndex];
+
+                /* Gets existing entry */
+                pstEntry = orxConfig_GetEntry(u32KeyID);
+
+                /* Found? */
+                if(pstEntry != orxNULL)
+                {
+                  /* Deletes value */
+                  orxConfig_CleanValue(&(pstEntry->stValue));
+                }
+                else
+                {
+                  /* Creates entry */
+                  pstEntry = (orxCONFIG_ENTRY *)orxBank_Allocate(sstConfig.pstEntryBank);
+
+                  /* Success? */
+                  if(pstEntry != orxNULL)
+                  {
+                    /* Adds it to list */
+                    orxMemory_Zero(&(pstEntry->stNode), sizeof(orxLINKLIST_NODE));
+                    orxLinkList_AddEnd(&(pstSection->stEntryList), &(pstEntry->stNode));
+
+                    /* Sets its ID */
+                    pstEntry->u32ID = u32KeyID;
+
+                    /* Indexes it */
+                    orxConfig_IndexEntry(pstSection, pstEntry);
+                  }
+                  else
+                  {
+                    /* Logs message */
+                    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Failed to create config entry <%s.%s>.", _zName, pstSection->zName, azStringList[pstBinaryEntry->u32KeyIndex]);
+
+                    /* Updates result */
+                    eResult = orxSTATUS_FAILURE;
+
+                    continue;
+                  }
+                }
+
+                /* List? */
+                if(orxFLAG_TEST(pstBinaryEntry->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST))
+                {
+                  /* Allocates value & index table */
+                  pstEntry->stValue.zValue              = (orxSTRING)orxMemory_Allocate(pstBinaryEntry->u32ValueSize, orxMEMORY_TYPE_TEXT);
+                  pstEntry->stValue.au32ListIndexTable  = (orxU32 *)orxMemory_Allocate(((orxU32)pstBinaryEntry->u16ListCounter - 1) * sizeof(orxU32), orxMEMORY_TYPE_CONFIG);
+
+                  /* Checks */
+                  orxASSERT(pstEntry->stValue.zValue != orxNULL);
+                  orxASSERT(pstEntry->stValue.au32ListIndexTable != orxNULL);
+
+                  /* Copies them */
+                  orxMemory_Copy(pstEntry->stValue.zValue, acData + pstBinaryEntry->u32ValueOffset, pstBinaryEntry->u32ValueSize);
+                  orxMemory_Copy(pstEntry->stValue.au32ListIndexTable, au32IndexList + pstBinaryEntry->u32IndexIndex, ((orxU32)pstBinaryEntry->u16ListCounter - 1) * sizeof(orxU32));
+                }
+                else
+                {
+                  /* Uses stored value */
+                  pstEntry->stValue.zValue              = (orxSTRING)azStringList[pstBinaryEntry->u32ValueIndex];
+                  pstEntry->stValue.au32ListIndexTable  = orxNULL;
+                }
+
+                /* Restores the rest of the value, including its cached conversion */
+                pstEntry->stValue.u16Type         = pstBinaryEntry->u16Type;
+                pstEntry->stValue.u16Flags        = pstBinaryEntry->u16Flags;
+                pstEntry->stValue.u16ListCounter  = pstBinaryEntry->u16ListCounter;
+                pstEntry->stValue.u16CacheIndex   = pstBinaryEntry->u16CacheIndex;
+                orxMemory_Copy(&(pstEntry->stValue.vValue), pstBinaryEntry->au64Value, sizeof(orxVECTOR));
+                orxMemory_Copy(&(pstEntry->stValue.vAltValue), pstBinaryEntry->au64AltValue, sizeof(orxVECTOR));
+
+                /* Restores its origin */
+                pstEntry->u32OriginID = (pstBinaryEntry->u32OriginIndex != orxCONFIG_KU32_BINARY_NONE) ? au32IDList[pstBinaryEntry->u32OriginIndex] : 0;
+              }
+            }
+          }
+
+          /* Restores current section */
+          sstConfig.pstCurrentSection = pstPreviousSection;
+        }
+        else
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+
+        /* Frees lists */
+        if(apstSectionList != orxNULL)
+        {
+          orxMemory_Free(apstSectionList);
+        }
+        if(au32IDList != orxNULL)
+        {
+          orxMemory_Free(au32IDList);
+        }
+        if(azStringList != orxNULL)
+        {
+          orxMemory_Free((void *)azStringList);
+        }
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't load binary config, corrupted content.", _zName);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't load binary config, invalid header or size.", _zName);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
+/** Loads a binary config resource
+ * @param[in] _zName            Name of the resource (file name)
+ * @param[in] _hResource        Concerned resource
+ * @param[in] _acBuffer         Already read content
+ * @param[in] _u32Size          Size of the already read content
+ * @return                      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxConfig_LoadBinary(const orxSTRING _zName, orxHANDLE _hResource, const orxCHAR *_acBuffer, orxU32 _u32Size)
+{
+  orxS64    s64Size;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Gets resource size */
+  s64Size = orxResource_GetSize(_hResource);
+
+  /* Valid? */
+  if((s64Size >= (orxS64)_u32Size) && (s64Size <= (orxS64)orxU32_UNDEFINED))
+  {
+    orxU8 *pu8Buffer;
+
+    /* Allocates buffer for the whole content, in one piece */
+    pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_TEMP);
+
+    /* Success? */
+    if(pu8Buffer != orxNULL)
+    {
+      /* Copies what was already read */
+      orxMemory_Copy(pu8Buffer, _acBuffer, _u32Size);
+
+      /* Reads the remaining content */
+      if((_u32Size == (orxU32)s64Size)
+      || (orxResource_Read(_hResource, s64Size - (orxS64)_u32Size, pu8Buffer + _u32Size, orxNULL, orxNULL) == s64Size - (orxS64)_u32Size))
+      {
+        /* Processes it */
+        eResult = orxConfig_ProcessBinary(_zName, pu8Buffer, (orxU32)s64Size);
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't load binary config, read error.", _zName);
+      }
+
+      /* Frees buffer */
+      orxMemory_Free(pu8Buffer);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Origin save callback
+ */
+orxBOOL orxFASTCALL orxConfig_OriginSaveCallback(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption)
+{
+  orxBOOL bResult;
+
+#ifdef __orxWINDOWS__
+
+  /* Updates result */
+  bResult = ((_zKeyName != orxNULL) || (orxString_ICompare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+
+#else /* __orxWINDOWS__ */
+
+  /* Updates result */
+  bResult = ((_zKeyName != orxNULL) || (orxString_Compare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return bResult;
+}
+
+/** Command: Load
+ */
+void orxFASTCALL orxConfig_CommandLoad(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_Load(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: Save
+ */
+void orxFASTCALL orxConfig_CommandSave(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_Save(_astArgList[0].zValue, (_u32ArgNumber > 2) ? _astArgList[2].bValue : orxFALSE, ((_u32ArgNumber > 1) && (_astArgList[1].bValue != orxFALSE)) ? orxConfig_OriginSaveCallback : orxNULL) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: SaveBinary
+ */
+void orxFASTCALL orxConfig_CommandSaveBinary(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_SaveBinary(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: Reload
+ */
+void orxFASTCALL orxConfig_CommandReload(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_ReloadHistory() != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: GetOrigin
+ */
+void orxFASTCALL orxConfig_CommandGetOrigin(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = orxConfig_GetOrigin(_astArgList[0].zValue);
+
+  /* Done! */
+  return;
+}
+
+/** Command: GetParent
+ */
+void orxFASTCALL orxConfig_CommandGetParent(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = orxConfig_GetParent(_astArgList[0].zValue);
+  if(_pstResult->zValue == orxNULL)
+  {
+    _pstResult->zValue = orxSTRING_EMPTY;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Command: SetParent
+ */
+void orxFASTCALL orxConfig_CommandSetParent(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = (orxConfig_SetParent(_astArgList[0].zValue, (_u32ArgNumber > 1) ? ((_astArgList[1].zValue[0] != orxCONFIG_KC_INHERITANCE_MARKER) ? _astArgList[1].zValue : orxSTRING_EMPTY) : orxNULL) != orxSTATUS_FAILURE) ? _astArgList[0].zValue : orxSTRING_EMPTY;
+
+  /* Done! */
+  return;
+}
+
+/** Command: CreateSection
+ */
+void orxFASTCALL orxConfig_CommandCreateSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = (orxConfig_SelectSection(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? _astArgList[0].zValue : orxSTRING_EMPTY;
+
+  /* Done! */
+  return;
+}
+
+/** Command: HasSection
+ */
+void orxFASTCALL orxConfig_CommandHasSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_HasSection(_astArgList[0].zValue));
+
+  /* Done! */
+  return;
+}
+
+/** Command: ClearSection
+ */
+void orxFASTCALL orxConfig_CommandClearSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Clears section */
+   orxConfig_ClearSection(_astArgList[0].zValue);
+
+  /* Updates result */
+  _pstResult->zValue = _astArgList[0].zValue;
+
+  /* Done! */
+  return;
+}
+
+/** Command: ClearValue
+ */
+void orxFASTCALL orxConfig_CommandClearValue(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Pushes section */
+  orxConfig_PushSection(_astArgList[0].zValue);
+
+  /* Clears value */
+  orxConfig_ClearValue(_astArgList[1].zValue);
+
+  /* Pops section */
+  orxConfig_PopSection();
+
+  /* Updates result */
+  _pstResult->zValue = _astArgList[1].zValue;
+
+  /* Done! */
+  return;
+}
+
+/** Command: HasValue
+ */
+void orxFASTCALL orxConfig_CommandHasValue(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Pushes section */
+  orxConfig_PushSection(_astArgList[0].zValue);
+
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_HasValue(_astArgList[1].zValue));
+
+  /* Pops section */
+  orxConfig_PopSection();
+
+  /* Done! */
+  return;
+}
+
+/** Command: GetValue
+ */
+void orxFASTCALL orxConfig_CommandGetValue(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
   orxS32 s32Index;
 
   /* Gets index */
@@ -3373,6 +4203,8 @@ static orxINLINE void orxConfig_RegisterCommands()
   orxCOMMAND_REGISTER_CORE_COMMAND(Config, Load, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"FileName", orxCOMMAND_VAR_TYPE_STRING});
   /* Command: Save */
   orxCOMMAND_REGISTER_CORE_COMMAND(Config, Save, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 2, {"FileName", orxCOMMAND_VAR_TYPE_STRING}, {"OnlyOrigin = false", orxCOMMAND_VAR_TYPE_BOOL}, {"Encrypt = false", orxCOMMAND_VAR_TYPE_BOOL});
+  /* Command: SaveBinary */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Config, SaveBinary, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"FileName", orxCOMMAND_VAR_TYPE_STRING});
 
   /* Command: Reload */
   orxCOMMAND_REGISTER_CORE_COMMAND(Config, Reload, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 0);
@@ -3442,6 +4274,8 @@ static orxINLINE void orxConfig_UnregisterCommands()
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Config, Load);
   /* Command: Save */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Config, Save);
+  /* Command: SaveBinary */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Config, SaveBinary);
   /* Command: Reload */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Config, Reload);
 
@@ -3662,6 +4496,8 @@ void orxFASTCALL orxConfig_Exit()
   /* Initialized? */
   if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY))
   {
+    orxCONFIG_SECTION *pstSection;
+
     /* Removes event handler */
     orxEvent_RemoveHandler(orxEVENT_TYPE_RESOURCE, orxConfig_EventHandler);
 
@@ -3674,6 +4510,19 @@ void orxFASTCALL orxConfig_Exit()
     /* Clears all data */
     orxConfig_Clear();
 
+    /* For all remaining sections */
+    for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+        pstSection != orxNULL;
+        pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+    {
+      /* Has entry table? */
+      if(pstSection->pstEntryTable != orxNULL)
+      {
+        /* Deletes it */
+        orxHashTable_Delete(pstSection->pstEntryTable);
+      }
+    }
+
     /* Clears section list */
     orxLinkList_Clean(&(sstConfig.stSectionList));
 
@@ -3921,7 +4770,7 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
   {
     orxCHAR             acBuffer[orxCONFIG_KU32_BUFFER_SIZE], *pcPreviousEncryptionChar;
     orxU32              u32Size, u32Offset;
-    orxBOOL             bUseEncryption = orxFALSE, bFirstTime;
+    orxBOOL             bUseEncryption = orxFALSE, bBinary = orxFALSE, bFirstTime;
     orxCONFIG_SECTION  *pstPreviousSection;
 
     /* Gets previous config section */
@@ -3941,8 +4790,21 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
       /* First time? */
       if(bFirstTime != orxFALSE)
       {
+        /* Has binary tag? */
+        if((u32Size >= orxCONFIG_KU32_BINARY_TAG_LENGTH)
+        && (orxString_NCompare(acBuffer, orxCONFIG_KZ_BINARY_TAG, orxCONFIG_KU32_BINARY_TAG_LENGTH) == 0))
+        {
+          /* Updates binary status */
+          bBinary = orxTRUE;
+
+          /* Loads it, consuming the whole resource */
+          eResult = orxConfig_LoadBinary(_zFileName, hResource, acBuffer, u32Size);
+
+          /* Clears offset */
+          u32Offset = 0;
+        }
         /* Has encryption tag? */
-        if(orxString_NCompare(acBuffer, orxCONFIG_KZ_ENCRYPTION_TAG, orxCONFIG_KU32_ENCRYPTION_TAG_LENGTH) == 0)
+        else if(orxString_NCompare(acBuffer, orxCONFIG_KZ_ENCRYPTION_TAG, orxCONFIG_KU32_ENCRYPTION_TAG_LENGTH) == 0)
         {
           /* Updates encryption status */
           bUseEncryption = orxTRUE;
@@ -3959,8 +4821,13 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
           bUseEncryption = orxFALSE;
         }
 
+        /* Binary? */
+        if(bBinary != orxFALSE)
+        {
+          /* Nothing to do */
+        }
         /* Has UTF-8 BOM? */
-        if(orxString_NCompare(acBuffer + u32Offset, orxCONFIG_KZ_UTF8_BOM, orxCONFIG_KU32_UTF8_BOM_LENGTH) == 0)
+        else if(orxString_NCompare(acBuffer + u32Offset, orxCONFIG_KZ_UTF8_BOM, orxCONFIG_KU32_UTF8_BOM_LENGTH) == 0)
         {
           /* Skips it */
           u32Offset += orxCONFIG_KU32_UTF8_BOM_LENGTH;
@@ -3987,8 +4854,8 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
         }
       }
 
-      /* Success? */
-      if(eResult != orxSTATUS_FAILURE)
+      /* Success and not binary? */
+      if((eResult != orxSTATUS_FAILURE) && (bBinary == orxFALSE))
       {
         /* Uses encryption? */
         if((bUseEncryption != orxFALSE)
@@ -4073,9 +4940,17 @@ orxSTATUS orxFASTCALL orxConfig_LoadFromMemory(orxCHAR *_acBuffer, orxU32 _u32Bu
   orxASSERT(_acBuffer != orxNULL);
   orxASSERT(_u32BufferSize > 0);
 
-  /* Valid? */
+  /* Binary? */
   if((_acBuffer != orxNULL)
-  && (_u32BufferSize > 0))
+  && (_u32BufferSize >= orxCONFIG_KU32_BINARY_TAG_LENGTH)
+  && (orxString_NCompare(_acBuffer, orxCONFIG_KZ_BINARY_TAG, orxCONFIG_KU32_BINARY_TAG_LENGTH) == 0))
+  {
+    /* Processes it */
+    eResult = orxConfig_ProcessBinary(orxCONFIG_KZ_CONFIG_MEMORY, (const orxU8 *)_acBuffer, _u32BufferSize);
+  }
+  /* Valid? */
+  else if((_acBuffer != orxNULL)
+       && (_u32BufferSize > 0))
   {
     orxBOOL bProcess = orxTRUE;
 
@@ -4445,6 +5320,302 @@ orxSTATUS orxFASTCALL orxConfig_Save(const orxSTRING _zFileName, orxBOOL _bUseEn
   return eResult;
 }
 
+/** Writes a binary snapshot of the whole config to given file: it can be loaded with orxConfig_Load/orxConfig_LoadFromMemory,
+ * without any parsing, and will be replaced by its text sources if any of them is found to be more recent.
+ * @param[in] _zFileName        File name, if null or empty the default file name will be used
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_SaveBinary(const orxSTRING _zFileName)
+{
+  orxCONFIG_BINARY_CONTEXT  stContext;
+  const orxSTRING           zFileName;
+  orxSTATUS                 eResult = orxSTATUS_FAILURE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxConfig_SaveBinary");
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+
+  /* Is given an invalid file name? */
+  if((_zFileName == orxNULL) || (_zFileName == orxSTRING_EMPTY))
+  {
+    /* Uses default file */
+    zFileName = sstConfig.zBaseFile;
+  }
+  else
+  {
+    /* Uses given one */
+    zFileName = _zFileName;
+  }
+
+  /* Inits context */
+  orxMemory_Zero(&stContext, sizeof(orxCONFIG_BINARY_CONTEXT));
+  stContext.pstStringTable  = orxHashTable_Create(orxCONFIG_KU32_BINARY_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+  stContext.pstSourceTable  = orxHashTable_Create(orxCONFIG_KU32_BINARY_BANK_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+  stContext.pstSourceBank   = orxBank_Create(orxCONFIG_KU32_BINARY_BANK_SIZE, sizeof(orxCONFIG_BINARY_SOURCE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+  stContext.eResult         = orxSTATUS_SUCCESS;
+
+  /* Valid? */
+  if((stContext.pstStringTable != orxNULL) && (stContext.pstSourceTable != orxNULL) && (stContext.pstSourceBank != orxNULL))
+  {
+    orxCONFIG_BINARY_HEADER   stHeader;
+    orxCONFIG_BINARY_SECTION *astSectionList;
+    orxCONFIG_BINARY_ENTRY   *astEntryList;
+    orxU32                   *au32IndexList;
+    orxHASHTABLE             *pstIndexTable;
+    orxCONFIG_SECTION        *pstSection;
+    orxU32                   *pu32HistoryEntry;
+
+    /* Inits header */
+    orxMemory_Zero(&stHeader, sizeof(orxCONFIG_BINARY_HEADER));
+    orxMemory_Copy(stHeader.acTag, orxCONFIG_KZ_BINARY_TAG, orxCONFIG_KU32_BINARY_TAG_LENGTH);
+    stHeader.u32Version = orxCONFIG_KU32_BINARY_VERSION;
+
+    /* Creates section index table */
+    pstIndexTable = orxHashTable_Create(orxCONFIG_KU32_SECTION_BANK_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+
+    /* For all sections */
+    for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+        pstSection != orxNULL;
+        pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+    {
+      orxCONFIG_ENTRY *pstEntry;
+
+      /* Stores its index (+1, as null marks missing items) */
+      orxHashTable_Add(pstIndexTable, (orxU64)(size_t)pstSection, (void *)((size_t)stHeader.u32SectionCount + 1));
+
+      /* Updates section count */
+      stHeader.u32SectionCount++;
+
+      /* For all entries */
+      for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(pstSection->stEntryList));
+          pstEntry != orxNULL;
+          pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+      {
+        /* Updates counts */
+        stHeader.u32EntryCount++;
+        stHeader.u32IndexCount += (orxU32)pstEntry->stValue.u16ListCounter - 1;
+      }
+    }
+
+    /* Allocates lists */
+    astSectionList  = (orxCONFIG_BINARY_SECTION *)orxMemory_Allocate(orxMAX(stHeader.u32SectionCount, 1) * sizeof(orxCONFIG_BINARY_SECTION), orxMEMORY_TYPE_TEMP);
+    astEntryList    = (orxCONFIG_BINARY_ENTRY *)orxMemory_Allocate(orxMAX(stHeader.u32EntryCount, 1) * sizeof(orxCONFIG_BINARY_ENTRY), orxMEMORY_TYPE_TEMP);
+    au32IndexList   = (orxU32 *)orxMemory_Allocate(orxMAX(stHeader.u32IndexCount, 1) * sizeof(orxU32), orxMEMORY_TYPE_TEMP);
+
+    /* Valid? */
+    if((pstIndexTable != orxNULL) && (astSectionList != orxNULL) && (astEntryList != orxNULL) && (au32IndexList != orxNULL))
+    {
+      const orxSTRING zResourceLocation;
+      orxHANDLE       hResource;
+      orxU32          u32SectionIndex, u32EntryIndex, u32IndexIndex;
+
+      /* For all files loaded from top level (they're the ones to reload when the snapshot gets stale) */
+      for(pu32HistoryEntry = (orxU32 *)orxBank_GetNext(sstConfig.pstHistoryBank, orxNULL);
+          pu32HistoryEntry != orxNULL;
+          pu32HistoryEntry = (orxU32 *)orxBank_GetNext(sstConfig.pstHistoryBank, pu32HistoryEntry))
+      {
+        const orxSTRING zName;
+
+        /* Gets its name */
+        zName = orxString_GetFromID(*pu32HistoryEntry);
+
+        /* Not the snapshot itself and still available? */
+        if((orxString_Compare(zName, zFileName) != 0)
+        && (orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, zName) != orxNULL))
+        {
+          /* Adds it */
+          orxConfig_AddBinarySource(&stContext, *pu32HistoryEntry, orxCONFIG_KU32_BINARY_SOURCE_FLAG_ROOT);
+        }
+      }
+
+      /* For all sections */
+      for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList)), u32SectionIndex = 0, u32EntryIndex = 0, u32IndexIndex = 0;
+          pstSection != orxNULL;
+          pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)), u32SectionIndex++)
+      {
+        orxCONFIG_BINARY_SECTION *pstBinarySection;
+        orxCONFIG_ENTRY          *pstEntry;
+
+        /* Gets binary section */
+        pstBinarySection = &astSectionList[u32SectionIndex];
+
+        /* Inits it */
+        orxMemory_Zero(pstBinarySection, sizeof(orxCONFIG_BINARY_SECTION));
+        pstBinarySection->u32NameIndex    = orxConfig_AddBinaryString(&stContext, pstSection->zName);
+        pstBinarySection->u32OriginIndex  = orxConfig_AddBinarySource(&stContext, pstSection->u32OriginID, orxCONFIG_KU32_BINARY_SOURCE_FLAG_NONE);
+        pstBinarySection->u32ParentIndex  = (pstSection->pstParent == orxNULL)
+                                            ? orxCONFIG_KU32_BINARY_NONE
+                                            : (pstSection->pstParent == (orxCONFIG_SECTION *)orxHANDLE_UNDEFINED)
+                                              ? orxCONFIG_KU32_BINARY_NO_DEFAULT_PARENT
+                                              : (orxU32)((size_t)orxHashTable_Get(pstIndexTable, (orxU64)(size_t)pstSection->pstParent) - 1);
+        pstBinarySection->u32EntryIndex   = u32EntryIndex;
+
+        /* For all entries */
+        for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(pstSection->stEntryList));
+            pstEntry != orxNULL;
+            pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)), u32EntryIndex++)
+        {
+          orxCONFIG_BINARY_ENTRY *pstBinaryEntry;
+
+          /* Gets binary entry */
+          pstBinaryEntry = &astEntryList[u32EntryIndex];
+
+          /* Inits it */
+          orxMemory_Zero(pstBinaryEntry, sizeof(orxCONFIG_BINARY_ENTRY));
+          pstBinaryEntry->u32KeyIndex     = orxConfig_AddBinaryString(&stContext, orxString_GetFromID(pstEntry->u32ID));
+          pstBinaryEntry->u32OriginIndex  = orxConfig_AddBinarySource(&stContext, pstEntry->u32OriginID, orxCONFIG_KU32_BINARY_SOURCE_FLAG_NONE);
+          pstBinaryEntry->u16Type         = pstEntry->stValue.u16Type;
+          pstBinaryEntry->u16Flags        = pstEntry->stValue.u16Flags;
+          pstBinaryEntry->u16ListCounter  = pstEntry->stValue.u16ListCounter;
+          pstBinaryEntry->u16CacheIndex   = pstEntry->stValue.u16CacheIndex;
+          orxMemory_Copy(pstBinaryEntry->au64Value, &(pstEntry->stValue.vValue), sizeof(orxVECTOR));
+          orxMemory_Copy(pstBinaryEntry->au64AltValue, &(pstEntry->stValue.vAltValue), sizeof(orxVECTOR));
+
+          /* List? */
+          if(orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST))
+          {
+            orxU32 u32LastIndex;
+
+            /* Gets last item index */
+            u32LastIndex = pstEntry->stValue.au32ListIndexTable[pstEntry->stValue.u16ListCounter - 2];
+
+            /* Adds all items, with their null separators */
+            pstBinaryEntry->u32ValueIndex = orxCONFIG_KU32_BINARY_NONE;
+            pstBinaryEntry->u32ValueSize  = u32LastIndex + orxString_GetLength(pstEntry->stValue.zValue + u32LastIndex) + 1;
+            pstBinaryEntry->u32ValueOffset= orxConfig_AddBinaryData(&stContext, pstEntry->stValue.zValue, pstBinaryEntry->u32ValueSize);
+
+            /* Adds indices */
+            pstBinaryEntry->u32IndexIndex = u32IndexIndex;
+            orxMemory_Copy(au32IndexList + u32IndexIndex, pstEntry->stValue.au32ListIndexTable, ((orxU32)pstEntry->stValue.u16ListCounter - 1) * sizeof(orxU32));
+            u32IndexIndex += (orxU32)pstEntry->stValue.u16ListCounter - 1;
+          }
+          else
+          {
+            /* Adds it to the string table */
+            pstBinaryEntry->u32ValueIndex = orxConfig_AddBinaryString(&stContext, pstEntry->stValue.zValue);
+            pstBinaryEntry->u32IndexIndex = orxCONFIG_KU32_BINARY_NONE;
+          }
+        }
+
+        /* Updates entry count */
+        pstBinarySection->u32EntryCount = u32EntryIndex - pstBinarySection->u32EntryIndex;
+      }
+
+      /* Updates header */
+      stHeader.u32SourceCount = orxBank_GetCounter(stContext.pstSourceBank);
+      stHeader.u32StringCount = stContext.u32StringCount;
+      stHeader.u32DataSize    = stContext.u32DataSize;
+
+      /* Valid content? */
+      if(stContext.eResult != orxSTATUS_FAILURE)
+      {
+        /* Valid file to open? */
+        if(((zResourceLocation = orxResource_LocateInStorage(orxCONFIG_KZ_RESOURCE_GROUP, orxNULL, zFileName)) != orxNULL)
+        && ((hResource = orxResource_Open(zResourceLocation, orxTRUE)) != orxHANDLE_UNDEFINED))
+        {
+          orxCONFIG_BINARY_SOURCE *pstSource;
+          orxS64                   s64Size, s64Written;
+
+          /* Writes header */
+          s64Size     = (orxS64)sizeof(orxCONFIG_BINARY_HEADER);
+          s64Written  = orxResource_Write(hResource, (orxS64)sizeof(orxCONFIG_BINARY_HEADER), &stHeader, orxNULL, orxNULL);
+
+          /* For all sources */
+          for(pstSource = (orxCONFIG_BINARY_SOURCE *)orxBank_GetNext(stContext.pstSourceBank, orxNULL);
+              pstSource != orxNULL;
+              pstSource = (orxCONFIG_BINARY_SOURCE *)orxBank_GetNext(stContext.pstSourceBank, pstSource))
+          {
+            /* Writes it */
+            s64Size    += (orxS64)sizeof(orxCONFIG_BINARY_SOURCE);
+            s64Written += orxResource_Write(hResource, (orxS64)sizeof(orxCONFIG_BINARY_SOURCE), pstSource, orxNULL, orxNULL);
+          }
+
+          /* Writes sections, entries, string table, list indices & data */
+          s64Size    += (orxS64)(stHeader.u32SectionCount * sizeof(orxCONFIG_BINARY_SECTION) + stHeader.u32EntryCount * sizeof(orxCONFIG_BINARY_ENTRY) + stHeader.u32StringCount * sizeof(orxU32) + stHeader.u32IndexCount * sizeof(orxU32) + stHeader.u32DataSize);
+          s64Written += orxResource_Write(hResource, (orxS64)(stHeader.u32SectionCount * sizeof(orxCONFIG_BINARY_SECTION)), astSectionList, orxNULL, orxNULL);
+          s64Written += orxResource_Write(hResource, (orxS64)(stHeader.u32EntryCount * sizeof(orxCONFIG_BINARY_ENTRY)), astEntryList, orxNULL, orxNULL);
+          s64Written += orxResource_Write(hResource, (orxS64)(stHeader.u32StringCount * sizeof(orxU32)), stContext.au32StringList, orxNULL, orxNULL);
+          s64Written += orxResource_Write(hResource, (orxS64)(stHeader.u32IndexCount * sizeof(orxU32)), au32IndexList, orxNULL, orxNULL);
+          s64Written += orxResource_Write(hResource, (orxS64)stHeader.u32DataSize, stContext.acData, orxNULL, orxNULL);
+
+          /* Flushes & closes the resource */
+          orxResource_Close(hResource);
+
+          /* Success? */
+          if(s64Written == s64Size)
+          {
+            /* Updates result */
+            eResult = orxSTATUS_SUCCESS;
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save binary file, write error!", zFileName);
+          }
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save binary file, can't open file on disk!", zFileName);
+        }
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save binary file, out of memory!", zFileName);
+      }
+    }
+
+    /* Deletes lists & index table */
+    if(au32IndexList != orxNULL)
+    {
+      orxMemory_Free(au32IndexList);
+    }
+    if(astEntryList != orxNULL)
+    {
+      orxMemory_Free(astEntryList);
+    }
+    if(astSectionList != orxNULL)
+    {
+      orxMemory_Free(astSectionList);
+    }
+    if(pstIndexTable != orxNULL)
+    {
+      orxHashTable_Delete(pstIndexTable);
+    }
+  }
+
+  /* Deletes context */
+  if(stContext.au32StringList != orxNULL)
+  {
+    orxMemory_Free(stContext.au32StringList);
+  }
+  if(stContext.acData != orxNULL)
+  {
+    orxMemory_Free(stContext.acData);
+  }
+  if(stContext.pstSourceBank != orxNULL)
+  {
+    orxBank_Delete(stContext.pstSourceBank);
+  }
+  if(stContext.pstSourceTable != orxNULL)
+  {
+    orxHashTable_Delete(stContext.pstSourceTable);
+  }
+  if(stContext.pstStringTable != orxNULL)
+  {
+    orxHashTable_Delete(stContext.pstStringTable);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
 /** Copies a file with optional encryption
  * @param[in] _zDstFileName     Name of the destination file
  * @param[in] _zSrcFileName     Name of the source file
@@ -46,6 +46,7 @@
 #define orxEVENT_KU32_STATIC_FLAG_NONE    0x00000000  /**< No flags */
 
 #define orxEVENT_KU32_STATIC_FLAG_READY   0x00000001  /**< Ready flag */
+#define orxEVENT_KU32_STATIC_FLAG_FLUSH   0x00000002  /**< Flush flag */
 
 #define orxEVENT_KU32_STATIC_MASK_ALL     0xFFFFFFFF  /**< All mask */
 
@@ -56,6 +57,11 @@
 #define orxEVENT_KU32_HANDLER_BANK_SIZE   32
 #define orxEVENT_KU32_STORAGE_BANK_SIZE   32
 
+#define orxEVENT_KU32_QUEUE_BUFFER_SIZE   4096        /**< Initial type list buffer size, in bytes */
+#define orxEVENT_KU32_QUEUE_LIST_NUMBER   16          /**< Initial number of queue type lists */
+#define orxEVENT_KU32_QUEUE_ALIGNMENT     8           /**< Queue payload alignment */
+#define orxEVENT_KU32_QUEUE_ENTRY_SIZE    ((orxU32)orxALIGN(sizeof(orxEVENT_QUEUE_ENTRY), orxEVENT_KU32_QUEUE_ALIGNMENT))
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -80,6 +86,40 @@ typedef struct __orxEVENT_HANDLER_STORAGE_t
 
 } orxEVENT_HANDLER_STORAGE;
 
+/** Event queue entry, followed by its payload copy
+ */
+typedef struct __orxEVENT_QUEUE_ENTRY_t
+{
+  orxHANDLE         hSender;                          /**< Sender handle */
+  orxHANDLE         hRecipient;                       /**< Recipient handle */
+  void             *pstPayload;                       /**< Payload, when not copied */
+  orxENUM           eID;                              /**< Event ID */
+  orxU32            u32PayloadSize;                   /**< Copied payload size */
+
+} orxEVENT_QUEUE_ENTRY;
+
+/** Event queue type list, storing its entries contiguously
+ */
+typedef struct __orxEVENT_QUEUE_LIST_t
+{
+  orxU8            *au8Buffer;                        /**< Entry buffer */
+  orxEVENT_TYPE     eType;                            /**< Event type */
+  orxU32            u32Size;                          /**< Used buffer size */
+  orxU32            u32Capacity;                      /**< Buffer capacity */
+
+} orxEVENT_QUEUE_LIST;
+
+/** Event queue
+ */
+typedef struct __orxEVENT_QUEUE_t
+{
+  orxEVENT_QUEUE_LIST      *astList;                  /**< Type list array, in first posting order */
+  orxU32                    u32ListCounter;           /**< Used type list counter */
+  orxU32                    u32ListCapacity;          /**< Type list capacity */
+  orxU32                    au32CoreListIndexList[orxEVENT_TYPE_CORE_NUMBER]; /**< Core type list indices (+1), 0 for none */
+
+} orxEVENT_QUEUE;
+
 /** Static structure
  */
 typedef struct __orxEVENT_STATIC_t
@@ -89,6 +129,10 @@ typedef struct __orxEVENT_STATIC_t
   orxHASHTABLE             *pstHandlerStorageTable;   /**< Handler storage table */
   orxBANK                  *pstHandlerStorageBank;    /**< Handler storage bank */
   orxEVENT_HANDLER_STORAGE *astCoreHandlerStorageList[orxEVENT_TYPE_CORE_NUMBER]; /**< Core handler storage list */
+  orxEVENT_QUEUE            astQueueList[2];          /**< Main thread queues (posting / flushing) */
+  orxEVENT_QUEUE            stThreadQueue;            /**< Other threads queue */
+  orxTHREAD_SEMAPHORE      *pstThreadQueueSemaphore;  /**< Other threads queue semaphore */
+  orxU32                    u32QueueIndex;            /**< Current posting queue index */
 
 } orxEVENT_STATIC;
 
@@ -104,6 +148,244 @@ static orxEVENT_STATIC sstEvent;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Gets an event handler storage
+ * @param[in] _eEventType           Concerned type of event
+ * @return orxEVENT_HANDLER_STORAGE / orxNULL
+ */
+static orxINLINE orxEVENT_HANDLER_STORAGE *orxEvent_GetHandlerStorage(orxEVENT_TYPE _eEventType)
+{
+  /* Done! */
+  return (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
+}
+
+/** Calls all the handlers of a storage for an event
+ * @param[in] _pstStorage           Concerned handler storage
+ * @param[in] _pstEvent             Event to send
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxINLINE orxSTATUS orxEvent_CallHandlers(const orxEVENT_HANDLER_STORAGE *_pstStorage, orxEVENT *_pstEvent)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Has handler(s)? */
+  if(orxLinkList_GetCounter(&(_pstStorage->stList)) != 0)
+  {
+    orxEVENT_HANDLER_INFO *pstInfo;
+
+    /* For all handlers */
+    for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(_pstStorage->stList));
+        pstInfo != orxNULL;
+        pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode)))
+    {
+      /* Stores context */
+      _pstEvent->pContext = pstInfo->pContext;
+
+      /* Calls it */
+      if((pstInfo->pfnHandler)(_pstEvent) == orxSTATUS_FAILURE)
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+
+        break;
+      }
+    }
+
+    /* Clears context */
+    _pstEvent->pContext = orxNULL;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Adds an entry to a queue
+ * @param[in] _pstQueue             Concerned queue
+ * @param[in] _eType                Event type
+ * @param[in] _u32PayloadSize       Payload size
+ * @return orxEVENT_QUEUE_ENTRY / orxNULL
+ */
+static orxEVENT_QUEUE_ENTRY *orxFASTCALL orxEvent_AddQueueEntry(orxEVENT_QUEUE *_pstQueue, orxEVENT_TYPE _eType, orxU32 _u32PayloadSize)
+{
+  orxEVENT_QUEUE_LIST  *pstList = orxNULL;
+  orxEVENT_QUEUE_ENTRY *pstResult = orxNULL;
+  orxU32                u32EntrySize;
+
+  /* Core event? */
+  if(_eType < orxEVENT_TYPE_CORE_NUMBER)
+  {
+    /* Has list? */
+    if(_pstQueue->au32CoreListIndexList[_eType] != 0)
+    {
+      /* Gets it */
+      pstList = &(_pstQueue->astList[_pstQueue->au32CoreListIndexList[_eType] - 1]);
+    }
+  }
+  else
+  {
+    orxU32 i;
+
+    /* For all lists */
+    for(i = 0; i < _pstQueue->u32ListCounter; i++)
+    {
+      /* Found? */
+      if(_pstQueue->astList[i].eType == _eType)
+      {
+        /* Gets it */
+        pstList = &(_pstQueue->astList[i]);
+
+        break;
+      }
+    }
+  }
+
+  /* No list yet? */
+  if(pstList == orxNULL)
+  {
+    /* Needs to grow the list array? */
+    if(_pstQueue->u32ListCounter == _pstQueue->u32ListCapacity)
+    {
+      orxEVENT_QUEUE_LIST  *astNewList;
+      orxU32                u32NewCapacity;
+
+      /* Gets new capacity */
+      u32NewCapacity = (_pstQueue->u32ListCapacity != 0) ? _pstQueue->u32ListCapacity << 1 : orxEVENT_KU32_QUEUE_LIST_NUMBER;
+
+      /* Reallocates list array */
+      astNewList = (orxEVENT_QUEUE_LIST *)orxMemory_Reallocate(_pstQueue->astList, u32NewCapacity * sizeof(orxEVENT_QUEUE_LIST));
+
+      /* Success? */
+      if(astNewList != orxNULL)
+      {
+        /* Clears new lists */
+        orxMemory_Zero(astNewList + _pstQueue->u32ListCapacity, (u32NewCapacity - _pstQueue->u32ListCapacity) * sizeof(orxEVENT_QUEUE_LIST));
+
+        /* Stores it */
+        _pstQueue->astList          = astNewList;
+        _pstQueue->u32ListCapacity  = u32NewCapacity;
+      }
+    }
+
+    /* Any room left? */
+    if(_pstQueue->u32ListCounter < _pstQueue->u32ListCapacity)
+    {
+      /* Inits new list, keeping its buffer */
+      pstList         = &(_pstQueue->astList[_pstQueue->u32ListCounter++]);
+      pstList->eType  = _eType;
+
+      /* Core event? */
+      if(_eType < orxEVENT_TYPE_CORE_NUMBER)
+      {
+        /* Stores its index */
+        _pstQueue->au32CoreListIndexList[_eType] = _pstQueue->u32ListCounter;
+      }
+    }
+  }
+
+  /* Valid? */
+  if(pstList != orxNULL)
+  {
+    /* Gets entry size */
+    u32EntrySize = orxEVENT_KU32_QUEUE_ENTRY_SIZE + (orxU32)orxALIGN(_u32PayloadSize, orxEVENT_KU32_QUEUE_ALIGNMENT);
+
+    /* Needs to grow the buffer? */
+    if(pstList->u32Size + u32EntrySize > pstList->u32Capacity)
+    {
+      orxU8  *au8NewBuffer;
+      orxU32  u32NewCapacity;
+
+      /* Gets new capacity */
+      for(u32NewCapacity = (pstList->u32Capacity != 0) ? pstList->u32Capacity << 1 : orxEVENT_KU32_QUEUE_BUFFER_SIZE;
+          u32NewCapacity < pstList->u32Size + u32EntrySize;
+          u32NewCapacity <<= 1);
+
+      /* Reallocates buffer */
+      au8NewBuffer = (orxU8 *)orxMemory_Reallocate(pstList->au8Buffer, u32NewCapacity);
+
+      /* Success? */
+      if(au8NewBuffer != orxNULL)
+      {
+        /* Stores it */
+        pstList->au8Buffer    = au8NewBuffer;
+        pstList->u32Capacity  = u32NewCapacity;
+      }
+    }
+
+    /* Enough room? */
+    if(pstList->u32Size + u32EntrySize <= pstList->u32Capacity)
+    {
+      /* Gets entry */
+      pstResult                 = (orxEVENT_QUEUE_ENTRY *)(pstList->au8Buffer + pstList->u32Size);
+      pstResult->u32PayloadSize = _u32PayloadSize;
+
+      /* Updates size */
+      pstList->u32Size += u32EntrySize;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Clears a queue, keeping its storage for later use
+ * @param[in] _pstQueue             Concerned queue
+ */
+static void orxFASTCALL orxEvent_ClearQueue(orxEVENT_QUEUE *_pstQueue)
+{
+  orxU32 i;
+
+  /* For all used lists */
+  for(i = 0; i < _pstQueue->u32ListCounter; i++)
+  {
+    /* Core event? */
+    if(_pstQueue->astList[i].eType < orxEVENT_TYPE_CORE_NUMBER)
+    {
+      /* Clears its index */
+      _pstQueue->au32CoreListIndexList[_pstQueue->astList[i].eType] = 0;
+    }
+
+    /* Clears its size */
+    _pstQueue->astList[i].u32Size = 0;
+  }
+
+  /* Clears list counter */
+  _pstQueue->u32ListCounter = 0;
+
+  /* Done! */
+  return;
+}
+
+/** Deletes a queue's storage
+ * @param[in] _pstQueue             Concerned queue
+ */
+static void orxFASTCALL orxEvent_DeleteQueue(orxEVENT_QUEUE *_pstQueue)
+{
+  /* Has lists? */
+  if(_pstQueue->astList != orxNULL)
+  {
+    orxU32 i;
+
+    /* For all lists */
+    for(i = 0; i < _pstQueue->u32ListCapacity; i++)
+    {
+      /* Has buffer? */
+      if(_pstQueue->astList[i].au8Buffer != orxNULL)
+      {
+        /* Frees it */
+        orxMemory_Free(_pstQueue->astList[i].au8Buffer);
+      }
+    }
+
+    /* Frees them */
+    orxMemory_Free(_pstQueue->astList);
+  }
+
+  /* Clears it */
+  orxMemory_Zero(_pstQueue, sizeof(orxEVENT_QUEUE));
+
+  /* Done! */
+  return;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -145,8 +427,11 @@ orxSTATUS orxFASTCALL orxEvent_Init()
       /* Creates handler storage bank */
       sstEvent.pstHandlerStorageBank = orxBank_Create(orxEVENT_KU32_STORAGE_BANK_SIZE, sizeof(orxEVENT_HANDLER_STORAGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+      /* Creates thread queue semaphore */
+      sstEvent.pstThreadQueueSemaphore = orxThread_CreateSemaphore(1);
+
       /* Success? */
-      if(sstEvent.pstHandlerStorageBank != orxNULL)
+      if((sstEvent.pstHandlerStorageBank != orxNULL) && (sstEvent.pstThreadQueueSemaphore != orxNULL))
       {
         /* Inits Flags */
         orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY, orxEVENT_KU32_STATIC_MASK_ALL);
@@ -159,8 +444,22 @@ orxSTATUS orxFASTCALL orxEvent_Init()
         /* Deletes table */
         orxHashTable_Delete(sstEvent.pstHandlerStorageTable);
 
+        /* Has bank? */
+        if(sstEvent.pstHandlerStorageBank != orxNULL)
+        {
+          /* Deletes it */
+          orxBank_Delete(sstEvent.pstHandlerStorageBank);
+        }
+
+        /* Has semaphore? */
+        if(sstEvent.pstThreadQueueSemaphore != orxNULL)
+        {
+          /* Deletes it */
+          orxThread_DeleteSemaphore(sstEvent.pstThreadQueueSemaphore);
+        }
+
         /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Event module failed to create bank.");
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Event module failed to create bank/semaphore.");
 
         /* Updates result */
         eResult = orxSTATUS_FAILURE;
@@ -201,6 +500,14 @@ void orxFASTCALL orxEvent_Exit()
     /* Deletes bank */
     orxBank_Delete(sstEvent.pstHandlerStorageBank);
 
+    /* Deletes queues */
+    orxEvent_DeleteQueue(&(sstEvent.astQueueList[0]));
+    orxEvent_DeleteQueue(&(sstEvent.astQueueList[1]));
+    orxEvent_DeleteQueue(&(sstEvent.stThreadQueue));
+
+    /* Deletes semaphore */
+    orxThread_DeleteSemaphore(sstEvent.pstThreadQueueSemaphore);
+
     /* Updates flags */
     orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_NONE, orxEVENT_KU32_STATIC_MASK_ALL);
   }
@@ -409,7 +716,7 @@ orxSTATUS orxFASTCALL orxEvent_Send(orxEVENT *_pstEvent)
   orxASSERT(_pstEvent != orxNULL);
 
   /* Gets corresponding storage */
-  pstStorage = (_pstEvent->eType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_pstEvent->eType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _pstEvent->eType);
+  pstStorage = orxEvent_GetHandlerStorage(_pstEvent->eType);
 
   /* Valid? */
   if(pstStorage != orxNULL)
@@ -419,41 +726,18 @@ orxSTATUS orxFASTCALL orxEvent_Send(orxEVENT *_pstEvent)
     {
       /* Updates event send counter */
       sstEvent.s32EventSendCounter++;
-    }
-
-    /* Has handler(s)? */
-    if(orxLinkList_GetCounter(&(pstStorage->stList)) != 0)
-    {
-      orxEVENT_HANDLER_INFO *pstInfo;
-
-      /* For all handlers */
-      for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(pstStorage->stList));
-          pstInfo != orxNULL;
-          pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode)))
-      {
-        /* Stores context */
-        _pstEvent->pContext = pstInfo->pContext;
-
-        /* Calls it */
-        if((pstInfo->pfnHandler)(_pstEvent) == orxSTATUS_FAILURE)
-        {
-          /* Updates result */
-          eResult = orxSTATUS_FAILURE;
-
-          break;
-        }
-      }
 
-      /* Clears context */
-      _pstEvent->pContext = orxNULL;
-    }
+      /* Calls handlers */
+      eResult = orxEvent_CallHandlers(pstStorage, _pstEvent);
 
-    /* Main thread? */
-    if(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
-    {
       /* Updates event send counter */
       sstEvent.s32EventSendCounter--;
     }
+    else
+    {
+      /* Calls handlers */
+      eResult = orxEvent_CallHandlers(pstStorage, _pstEvent);
+    }
   }
 
   /* Done! */
@@ -485,6 +769,214 @@ orxSTATUS orxFASTCALL orxEvent_SendShort(orxEVENT_TYPE _eEventType, orxENUM _eEv
   return eResult;
 }
 
+/** Posts an event: it will be sent during the next call to orxEvent_Flush, grouped with all the other posted events of the same type, in posting order
+ * This function can be called from any thread. The payload gets copied, however sender & recipient handles need to remain valid till the event is sent
+ * @param[in] _pstEvent             Event to post
+ * @param[in] _u32PayloadSize       Size of the payload to copy, 0 to keep the payload pointer as is
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxEvent_Post(const orxEVENT *_pstEvent, orxU32 _u32PayloadSize)
+{
+  orxEVENT_QUEUE       *pstQueue;
+  orxEVENT_QUEUE_ENTRY *pstEntry;
+  orxBOOL               bMainThread;
+  orxSTATUS             eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_pstEvent != orxNULL);
+  orxASSERT((_u32PayloadSize == 0) || (_pstEvent->pstPayload != orxNULL));
+
+  /* Is main thread? */
+  bMainThread = (orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID) ? orxTRUE : orxFALSE;
+
+  /* Main thread? */
+  if(bMainThread != orxFALSE)
+  {
+    /* Uses current posting queue */
+    pstQueue = &(sstEvent.astQueueList[sstEvent.u32QueueIndex]);
+  }
+  else
+  {
+    /* Locks thread queue */
+    orxThread_WaitSemaphore(sstEvent.pstThreadQueueSemaphore);
+
+    /* Uses it */
+    pstQueue = &(sstEvent.stThreadQueue);
+  }
+
+  /* Adds entry */
+  pstEntry = orxEvent_AddQueueEntry(pstQueue, _pstEvent->eType, _u32PayloadSize);
+
+  /* Success? */
+  if(pstEntry != orxNULL)
+  {
+    /* Stores event */
+    pstEntry->hSender     = _pstEvent->hSender;
+    pstEntry->hRecipient  = _pstEvent->hRecipient;
+    pstEntry->pstPayload  = _pstEvent->pstPayload;
+    pstEntry->eID         = _pstEvent->eID;
+
+    /* Has payload to copy? */
+    if(_u32PayloadSize != 0)
+    {
+      /* Copies it */
+      orxMemory_Copy((orxU8 *)pstEntry + orxEVENT_KU32_QUEUE_ENTRY_SIZE, _pstEvent->pstPayload, _u32PayloadSize);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't post event [%u/%u]: out of memory.", _pstEvent->eType, _pstEvent->eID);
+  }
+
+  /* Not main thread? */
+  if(bMainThread == orxFALSE)
+  {
+    /* Unlocks thread queue */
+    orxThread_SignalSemaphore(sstEvent.pstThreadQueueSemaphore);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Sends all the posted events, grouped by type, events posted during the flush will be sent by the next one (called once per frame by the main loop, main thread only)
+ * @return Number of sent events
+ */
+orxU32 orxFASTCALL orxEvent_Flush()
+{
+  orxU32 u32Result = 0;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxEvent_Flush");
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+  orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
+
+  /* Not already flushing? */
+  if(!orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_FLUSH))
+  {
+    orxEVENT_QUEUE *pstQueue;
+    orxU32          i;
+
+    /* Updates status */
+    orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_FLUSH, orxEVENT_KU32_STATIC_FLAG_NONE);
+
+    /* Gets queue to flush and swaps posting one */
+    pstQueue                = &(sstEvent.astQueueList[sstEvent.u32QueueIndex]);
+    sstEvent.u32QueueIndex ^= 1;
+
+    /* Locks thread queue */
+    orxThread_WaitSemaphore(sstEvent.pstThreadQueueSemaphore);
+
+    /* For all its lists */
+    for(i = 0; i < sstEvent.stThreadQueue.u32ListCounter; i++)
+    {
+      const orxEVENT_QUEUE_LIST *pstList;
+      orxU32                     u32Offset;
+
+      /* Gets it */
+      pstList = &(sstEvent.stThreadQueue.astList[i]);
+
+      /* For all its entries */
+      for(u32Offset = 0; u32Offset < pstList->u32Size;)
+      {
+        const orxEVENT_QUEUE_ENTRY *pstSrcEntry;
+        orxEVENT_QUEUE_ENTRY       *pstDstEntry;
+
+        /* Gets source entry */
+        pstSrcEntry = (const orxEVENT_QUEUE_ENTRY *)(pstList->au8Buffer + u32Offset);
+
+        /* Transfers it */
+        pstDstEntry = orxEvent_AddQueueEntry(pstQueue, pstList->eType, pstSrcEntry->u32PayloadSize);
+        if(pstDstEntry != orxNULL)
+        {
+          orxMemory_Copy(pstDstEntry, pstSrcEntry, orxEVENT_KU32_QUEUE_ENTRY_SIZE + pstSrcEntry->u32PayloadSize);
+        }
+
+        /* Goes to next entry */
+        u32Offset += orxEVENT_KU32_QUEUE_ENTRY_SIZE + (orxU32)orxALIGN(pstSrcEntry->u32PayloadSize, orxEVENT_KU32_QUEUE_ALIGNMENT);
+      }
+    }
+
+    /* Clears thread queue */
+    orxEvent_ClearQueue(&(sstEvent.stThreadQueue));
+
+    /* Unlocks it */
+    orxThread_SignalSemaphore(sstEvent.pstThreadQueueSemaphore);
+
+    /* Updates event send counter */
+    sstEvent.s32EventSendCounter++;
+
+    /* For all lists */
+    for(i = 0; i < pstQueue->u32ListCounter; i++)
+    {
+      const orxEVENT_QUEUE_LIST *pstList;
+      orxEVENT_HANDLER_STORAGE  *pstStorage;
+      orxU32                     u32Offset;
+
+      /* Gets it */
+      pstList = &(pstQueue->astList[i]);
+
+      /* Gets its handler storage */
+      pstStorage = orxEvent_GetHandlerStorage(pstList->eType);
+
+      /* For all its entries */
+      for(u32Offset = 0; u32Offset < pstList->u32Size;)
+      {
+        const orxEVENT_QUEUE_ENTRY *pstEntry;
+
+        /* Gets entry */
+        pstEntry = (const orxEVENT_QUEUE_ENTRY *)(pstList->au8Buffer + u32Offset);
+
+        /* Has handlers? */
+        if(pstStorage != orxNULL)
+        {
+          orxEVENT stEvent;
+
+          /* Inits event */
+          orxEVENT_INIT(stEvent, pstList->eType, pstEntry->eID, pstEntry->hSender, pstEntry->hRecipient, (pstEntry->u32PayloadSize != 0) ? (orxU8 *)pstEntry + orxEVENT_KU32_QUEUE_ENTRY_SIZE : pstEntry->pstPayload);
+          stEvent.pContext = orxNULL;
+
+          /* Calls them */
+          orxEvent_CallHandlers(pstStorage, &stEvent);
+        }
+
+        /* Goes to next entry */
+        u32Offset += orxEVENT_KU32_QUEUE_ENTRY_SIZE + (orxU32)orxALIGN(pstEntry->u32PayloadSize, orxEVENT_KU32_QUEUE_ALIGNMENT);
+
+        /* Updates result */
+        u32Result++;
+      }
+    }
+
+    /* Updates event send counter */
+    sstEvent.s32EventSendCounter--;
+
+    /* Clears queue */
+    orxEvent_ClearQueue(pstQueue);
+
+    /* Updates status */
+    orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_NONE, orxEVENT_KU32_STATIC_FLAG_FLUSH);
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't flush events from an event handler called by a flush.");
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Is currently sending an event?
  * @return orxTRUE / orxFALSE
  */
@@ -52,6 +52,27 @@
 
 #endif /* __orxANDROID__ || __orxANDROID_NATIVE__ */
 
+#if defined(__orxLINUX__) || defined(__orxRASPBERRY_PI__) || defined(__orxMAC__) || defined(__orxIOS__)
+
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+
+  #define orxRESOURCE_PACK_USE_MMAP
+
+#endif /* __orxLINUX__ || __orxRASPBERRY_PI__ || __orxMAC__ || __orxIOS__ */
+
+#if defined(__orxLINUX__) || defined(__orxRASPBERRY_PI__)
+
+  #include <dirent.h>
+  #include <errno.h>
+  #include <sys/inotify.h>
+
+  #define orxRESOURCE_WATCH_USE_INOTIFY
+
+#endif /* __orxLINUX__ || __orxRASPBERRY_PI__ */
+
 /** Module flags
  */
 #define orxRESOURCE_KU32_STATIC_FLAG_NONE             0x00000000                      /**< No flags */
@@ -60,6 +81,7 @@
 #define orxRESOURCE_KU32_STATIC_FLAG_CONFIG_LOADED    0x00000002                      /**< Config loaded flag */
 #define orxRESOURCE_KU32_STATIC_FLAG_WATCH_SET        0x00000004                      /**< Watch set flag */
 #define orxRESOURCE_KU32_STATIC_FLAG_NOTIFY_SET       0x00000008                      /**< Notify set flag */
+#define orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFY     0x00000010                      /**< Watch notify flag: file resources are watched through system notifications instead of polling */
 
 #define orxRESOURCE_KU32_STATIC_MASK_ALL              0xFFFFFFFF                      /**< All mask */
 
@@ -76,13 +98,20 @@
 
 #define orxRESOURCE_KU32_OPEN_INFO_BANK_SIZE          64                              /**< Open resource info bank size */
 
+#define orxRESOURCE_KU32_PACK_BANK_SIZE               8                               /**< Pack bank size */
+#define orxRESOURCE_KU32_PACK_TABLE_SIZE              16                              /**< Pack table size */
+#define orxRESOURCE_KU32_PACK_MAX_ENTRY_SIZE          0x40000000                      /**< Pack entry max decompressed size */
+#define orxRESOURCE_KU32_PACK_MAX_RATIO               256                             /**< Pack entry max decompressed/stored size ratio (LZ4 can't go beyond ~255) */
+
 #define orxRESOURCE_KU32_WATCH_ITERATION_LIMIT        2                               /**< Watch iteration limit */
 #define orxRESOURCE_KU32_WATCH_TIME_UNINITIALIZED     -1                              /**< Watch time uninitialized */
 #define orxRESOURCE_KF_WATCH_NOTIFICATION_DELAY       0.2                             /**< Watch notification delay */
+#define orxRESOURCE_KU32_WATCH_TABLE_SIZE             64                              /**< Watch table size */
 
 #define orxRESOURCE_KZ_DEFAULT_STORAGE                "."                             /**< Default storage */
 
 #define orxRESOURCE_KZ_TYPE_TAG_FILE                  "file"                          /**< Resource type file tag */
+#define orxRESOURCE_KZ_TYPE_TAG_PACK                  "pack"                          /**< Resource type pack tag */
 
 #define orxRESOURCE_KU32_BUFFER_SIZE                  256                             /**< Buffer size */
 
@@ -150,6 +179,33 @@ typedef struct __orxRESOURCE_OPEN_INFO_t
 
 } orxRESOURCE_OPEN_INFO;
 
+/** Pack archive
+ */
+typedef struct __orxRESOURCE_PACK_t
+{
+  const orxU8                  *pu8Data;                                              /**< Archive data, orxNULL if the storage isn't a pack */
+  const orxRESOURCE_PACK_ENTRY *astEntryList;                                         /**< Entry list, sorted by name CRC */
+  const orxCHAR                *acNameList;                                           /**< Name block */
+  orxSTRING                     zStorage;                                             /**< Storage */
+  struct __orxRESOURCE_PACK_t  *pstNext;                                              /**< Next pack with the same storage CRC */
+  orxS64                        s64Size;                                              /**< Archive size */
+  orxU32                        u32EntryCount;                                        /**< Number of entries */
+
+} orxRESOURCE_PACK;
+
+/** Open pack resource
+ */
+typedef struct __orxRESOURCE_PACK_HANDLE_t
+{
+  const orxU8                  *pu8Data;                                              /**< Resource data: mapped archive data if stored as-is, decompressed data otherwise */
+  const orxRESOURCE_PACK_ENTRY *pstEntry;                                             /**< Archive entry */
+  const orxU8                  *pu8Source;                                            /**< Stored data */
+  orxU8                        *pu8Buffer;                                            /**< Decompression buffer, orxNULL if stored as-is */
+  orxS64                        s64Size;                                              /**< Resource size */
+  orxS64                        s64Cursor;                                            /**< Read cursor */
+
+} orxRESOURCE_PACK_HANDLE;
+
 /** Request type enum
  */
 typedef enum __orxRESOURCE_REQUEST_TYPE_t
@@ -186,12 +242,26 @@ typedef struct __orxRESOURCE_STATIC_t
   orxBANK                  *pstTypeBank;                                              /**< Type info bank */
   orxBANK                  *pstResourceInfoBank;                                      /**< Resource info bank */
   orxBANK                  *pstOpenInfoBank;                                          /**< Open resource table size */
+  orxBANK                  *pstPackBank;                                              /**< Pack bank */
+  orxHASHTABLE             *pstPackTable;                                             /**< Pack table, indexed by storage CRC */
   orxTHREAD_SEMAPHORE*      pstRequestSemaphore;                                      /**< Request semaphore */
   orxTHREAD_SEMAPHORE*      pstWorkerSemaphore;                                       /**< Worker semaphore */
   orxLINKLIST               stTypeList;                                               /**< Type list */
   orxSTRING                 zLastUncachedLocation;                                    /**< Last uncached location */
   volatile orxSTATUS        eThreadResult;                                            /**< Thread result */
   orxCHAR                   acFileLocationBuffer[orxRESOURCE_KU32_BUFFER_SIZE];       /**< File location buffer size */
+  orxCHAR                   acPackLocationBuffer[orxRESOURCE_KU32_BUFFER_SIZE];       /**< Pack location buffer size */
+  const orxRESOURCE_TYPE_INFO *pstFileTypeInfo;                                       /**< File type info */
+
+#ifdef orxRESOURCE_WATCH_USE_INOTIFY
+
+  orxHASHTABLE             *pstWatchTable;                                            /**< Watched directory table, indexed by watch descriptor */
+  orxHASHTABLE             *pstWatchStorageTable;                                     /**< Watched storage table, indexed by storage ID */
+  orxS32                    s32WatchDescriptor;                                       /**< Watch notification descriptor */
+  orxCHAR                   acWatchBuffer[orxRESOURCE_KU32_BUFFER_SIZE];              /**< Watch path buffer */
+
+#endif /* orxRESOURCE_WATCH_USE_INOTIFY */
+
   volatile orxRESOURCE_REQUEST astRequestList[orxRESOURCE_KU32_REQUEST_LIST_SIZE];    /**< Request list */
   volatile orxU32           u32RequestInIndex;                                        /**< Request in index */
   volatile orxU32           u32RequestProcessIndex;                                   /**< Request process index */
@@ -365,11 +435,702 @@ static orxS64 orxFASTCALL orxResource_File_Write(orxHANDLE _hResource, orxS64 _s
   orxFILE  *pstFile;
   orxS64    s64Result;
 
-  /* Gets file */
-  pstFile = (orxFILE *)_hResource;
+  /* Gets file */
+  pstFile = (orxFILE *)_hResource;
+
+  /* Updates result */
+  s64Result = orxFile_Write(_pBuffer, sizeof(orxCHAR), _s64Size, pstFile);
+
+  /* Done! */
+  return s64Result;
+}
+
+/** Maps a pack archive, the result will have a orxNULL pu8Data if the storage isn't a valid pack
+ */
+static void orxFASTCALL orxResource_Pack_Map(orxRESOURCE_PACK *_pstPack, const orxSTRING _zStorage)
+{
+  const orxU8  *pu8Data = orxNULL;
+  orxS64        s64Size = 0;
+
+#if defined(__orxWINDOWS__)
+
+  HANDLE hFile;
+
+  /* Opens file */
+  hFile = CreateFileA(_zStorage, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+  /* Success? */
+  if(hFile != INVALID_HANDLE_VALUE)
+  {
+    LARGE_INTEGER liSize;
+
+    /* Is big enough? */
+    if((GetFileSizeEx(hFile, &liSize) != FALSE)
+    && (liSize.QuadPart >= (LONGLONG)sizeof(orxRESOURCE_PACK_HEADER)))
+    {
+      HANDLE hMapping;
+
+      /* Creates mapping */
+      hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+
+      /* Success? */
+      if(hMapping != NULL)
+      {
+        /* Maps the whole file, the view remains valid once handles are closed */
+        pu8Data = (const orxU8 *)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+        s64Size = (orxS64)liSize.QuadPart;
+
+        /* Closes mapping */
+        CloseHandle(hMapping);
+      }
+    }
+
+    /* Closes file */
+    CloseHandle(hFile);
+  }
+
+#elif defined(orxRESOURCE_PACK_USE_MMAP)
+
+  int iFile;
+
+  /* Opens file */
+  iFile = open(_zStorage, O_RDONLY);
+
+  /* Success? */
+  if(iFile >= 0)
+  {
+    struct stat stStat;
+
+    /* Is a regular file, big enough? */
+    if((fstat(iFile, &stStat) == 0)
+    && (S_ISREG(stStat.st_mode))
+    && (stStat.st_size >= (off_t)sizeof(orxRESOURCE_PACK_HEADER)))
+    {
+      void *pMapping;
+
+      /* Maps it */
+      pMapping = mmap(NULL, (size_t)stStat.st_size, PROT_READ, MAP_PRIVATE, iFile, 0);
+
+      /* Success? */
+      if(pMapping != MAP_FAILED)
+      {
+        /* Stores it */
+        pu8Data = (const orxU8 *)pMapping;
+        s64Size = (orxS64)stStat.st_size;
+      }
+    }
+
+    /* Closes file, the mapping remains valid */
+    close(iFile);
+  }
+
+#else /* __orxWINDOWS__ */
+
+  orxFILE *pstFile;
+
+  /* No mapping support: loads the whole archive in memory instead */
+  pstFile = orxFile_Open(_zStorage, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  /* Success? */
+  if(pstFile != orxNULL)
+  {
+    orxRESOURCE_PACK_HEADER stHeader;
+
+    /* Looks like a pack? */
+    if((orxFile_Read(&stHeader, sizeof(orxRESOURCE_PACK_HEADER), 1, pstFile) == 1)
+    && (stHeader.u32Magic == orxRESOURCE_KU32_PACK_MAGIC))
+    {
+      orxU8 *pu8Buffer;
+
+      /* Allocates buffer */
+      s64Size   = orxFile_GetSize(pstFile);
+      pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(pu8Buffer != orxNULL)
+      {
+        /* Reads whole archive */
+        orxFile_Seek(pstFile, 0, orxSEEK_OFFSET_WHENCE_START);
+        if(orxFile_Read(pu8Buffer, sizeof(orxU8), s64Size, pstFile) == s64Size)
+        {
+          /* Stores it */
+          pu8Data = pu8Buffer;
+        }
+        else
+        {
+          /* Frees buffer */
+          orxMemory_Free(pu8Buffer);
+        }
+      }
+    }
+
+    /* Closes file */
+    orxFile_Close(pstFile);
+  }
+
+#endif /* __orxWINDOWS__ */
+
+  /* Has data? */
+  if(pu8Data != orxNULL)
+  {
+    const orxRESOURCE_PACK_HEADER *pstHeader;
+    orxBOOL                        bValid = orxFALSE;
+
+    /* Gets header */
+    pstHeader = (const orxRESOURCE_PACK_HEADER *)pu8Data;
+
+    /* Valid header? */
+    if((pstHeader->u32Magic == orxRESOURCE_KU32_PACK_MAGIC)
+    && (pstHeader->u32Version == orxRESOURCE_KU32_PACK_VERSION)
+    && (pstHeader->u32NameSize > 0)
+    && ((orxS64)sizeof(orxRESOURCE_PACK_HEADER) + (orxS64)pstHeader->u32EntryCount * (orxS64)sizeof(orxRESOURCE_PACK_ENTRY) + (orxS64)pstHeader->u32NameSize <= s64Size))
+    {
+      const orxRESOURCE_PACK_ENTRY *astEntryList;
+      const orxCHAR                *acNameList;
+      orxU32                        i;
+
+      /* Gets entry & name lists */
+      astEntryList  = (const orxRESOURCE_PACK_ENTRY *)(pu8Data + sizeof(orxRESOURCE_PACK_HEADER));
+      acNameList    = (const orxCHAR *)(astEntryList + pstHeader->u32EntryCount);
+
+      /* Checks all entries once, so that lookups and reads don't have to */
+      for(i = 0, bValid = (acNameList[pstHeader->u32NameSize - 1] == orxCHAR_NULL) ? orxTRUE : orxFALSE;
+          (bValid != orxFALSE) && (i < pstHeader->u32EntryCount);
+          i++)
+      {
+        const orxRESOURCE_PACK_ENTRY *pstEntry = &astEntryList[i];
+
+        /* Updates status */
+        bValid = ((pstEntry->u32NameOffset < pstHeader->u32NameSize)
+               && (pstEntry->u64Offset <= (orxU64)s64Size)
+               && ((orxU64)pstEntry->u32StoredSize <= (orxU64)s64Size - pstEntry->u64Offset)
+               && (orxFLAG_TEST(pstEntry->u32Flags, orxRESOURCE_KU32_PACK_ENTRY_FLAG_COMPRESSED)
+                   ? ((pstEntry->u32Size <= orxRESOURCE_KU32_PACK_MAX_ENTRY_SIZE) && ((orxU64)pstEntry->u32Size <= (orxU64)pstEntry->u32StoredSize * orxRESOURCE_KU32_PACK_MAX_RATIO))
+                   : (pstEntry->u32StoredSize == pstEntry->u32Size))
+               && ((i == 0) || (astEntryList[i - 1].u32NameCRC <= pstEntry->u32NameCRC))) ? orxTRUE : orxFALSE;
+      }
+
+      /* Valid? */
+      if(bValid != orxFALSE)
+      {
+        /* Stores it */
+        _pstPack->pu8Data       = pu8Data;
+        _pstPack->astEntryList  = astEntryList;
+        _pstPack->acNameList    = acNameList;
+        _pstPack->s64Size       = s64Size;
+        _pstPack->u32EntryCount = pstHeader->u32EntryCount;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't use pack <%s>: corrupted entry list.", _zStorage);
+      }
+    }
+
+    /* Invalid? */
+    if(bValid == orxFALSE)
+    {
+#if defined(__orxWINDOWS__)
+
+      /* Unmaps it */
+      UnmapViewOfFile(pu8Data);
+
+#elif defined(orxRESOURCE_PACK_USE_MMAP)
+
+      /* Unmaps it */
+      munmap((void *)pu8Data, (size_t)s64Size);
+
+#else /* __orxWINDOWS__ */
+
+      /* Frees it */
+      orxMemory_Free((void *)pu8Data);
+
+#endif /* __orxWINDOWS__ */
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Unmaps a pack archive
+ */
+static void orxFASTCALL orxResource_Pack_Unmap(orxRESOURCE_PACK *_pstPack)
+{
+  /* Is mapped? */
+  if(_pstPack->pu8Data != orxNULL)
+  {
+#if defined(__orxWINDOWS__)
+
+    /* Unmaps it */
+    UnmapViewOfFile(_pstPack->pu8Data);
+
+#elif defined(orxRESOURCE_PACK_USE_MMAP)
+
+    /* Unmaps it */
+    munmap((void *)_pstPack->pu8Data, (size_t)_pstPack->s64Size);
+
+#else /* __orxWINDOWS__ */
+
+    /* Frees it */
+    orxMemory_Free((void *)_pstPack->pu8Data);
+
+#endif /* __orxWINDOWS__ */
+
+    /* Clears it */
+    _pstPack->pu8Data = orxNULL;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets a pack archive from its storage, mapping it on first use
+ */
+static const orxRESOURCE_PACK *orxFASTCALL orxResource_Pack_Get(const orxSTRING _zStorage, orxU32 _u32Length)
+{
+  orxRESOURCE_PACK *pstFirst, *pstResult;
+  orxU32            u32Key;
+
+  /* Gets key */
+  u32Key = orxString_NToCRC(_zStorage, _u32Length);
+
+  /* Gets first pack with this key */
+  pstFirst = (orxRESOURCE_PACK *)orxHashTable_Get(sstResource.pstPackTable, u32Key);
+
+  /* For all packs with this key */
+  for(pstResult = pstFirst; pstResult != orxNULL; pstResult = pstResult->pstNext)
+  {
+    /* Not a collision? */
+    if((pstResult->zStorage != orxNULL)
+    && (orxString_NCompare(pstResult->zStorage, _zStorage, _u32Length) == 0)
+    && (pstResult->zStorage[_u32Length] == orxCHAR_NULL))
+    {
+      break;
+    }
+  }
+
+  /* Not found and valid length? */
+  if((pstResult == orxNULL) && (_u32Length < orxRESOURCE_KU32_BUFFER_SIZE))
+  {
+    /* Allocates it */
+    pstResult = (orxRESOURCE_PACK *)orxBank_Allocate(sstResource.pstPackBank);
+
+    /* Success? */
+    if(pstResult != orxNULL)
+    {
+      /* Inits it */
+      orxMemory_Zero(pstResult, sizeof(orxRESOURCE_PACK));
+
+      /* Copies storage (it might not be NULL-terminated) */
+      orxMemory_Copy(sstResource.acPackLocationBuffer, _zStorage, _u32Length);
+      sstResource.acPackLocationBuffer[_u32Length] = orxCHAR_NULL;
+      pstResult->zStorage = orxString_Duplicate(sstResource.acPackLocationBuffer);
+
+      /* Maps it: storages that aren't packs are kept too, with no data, so that they only get checked once */
+      orxResource_Pack_Map(pstResult, sstResource.acPackLocationBuffer);
+
+      /* Collision? */
+      if(pstFirst != orxNULL)
+      {
+        /* Links it after the first one */
+        pstResult->pstNext  = pstFirst->pstNext;
+        pstFirst->pstNext   = pstResult;
+      }
+      else
+      {
+        /* Adds it to table */
+        orxHashTable_Add(sstResource.pstPackTable, u32Key, pstResult);
+      }
+    }
+  }
+
+  /* Updates result */
+  pstResult = ((pstResult != orxNULL) && (pstResult->pu8Data != orxNULL)) ? pstResult : orxNULL;
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Finds an entry in a pack archive
+ */
+static const orxRESOURCE_PACK_ENTRY *orxFASTCALL orxResource_Pack_Find(const orxRESOURCE_PACK *_pstPack, const orxSTRING _zName)
+{
+  const orxRESOURCE_PACK_ENTRY *pstResult = orxNULL;
+  orxU32                        u32CRC, u32Min, u32Max;
+
+  /* Gets name CRC */
+  u32CRC = orxString_ToCRC(_zName);
+
+  /* Finds first entry with this CRC */
+  for(u32Min = 0, u32Max = _pstPack->u32EntryCount; u32Min < u32Max;)
+  {
+    orxU32 u32Middle;
+
+    /* Gets middle */
+    u32Middle = (u32Min + u32Max) >> 1;
+
+    /* Updates range */
+    if(_pstPack->astEntryList[u32Middle].u32NameCRC < u32CRC)
+    {
+      u32Min = u32Middle + 1;
+    }
+    else
+    {
+      u32Max = u32Middle;
+    }
+  }
+
+  /* For all entries with the same CRC */
+  for(; (u32Min < _pstPack->u32EntryCount) && (_pstPack->astEntryList[u32Min].u32NameCRC == u32CRC); u32Min++)
+  {
+    /* Same name? */
+    if(orxString_Compare(_pstPack->acNameList + _pstPack->astEntryList[u32Min].u32NameOffset, _zName) == 0)
+    {
+      /* Updates result */
+      pstResult = &(_pstPack->astEntryList[u32Min]);
+      break;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Decompresses a LZ4 block
+ */
+static orxSTATUS orxFASTCALL orxResource_Pack_Decompress(const orxU8 *_pu8Source, orxU32 _u32SourceSize, orxU8 *_pu8Destination, orxU32 _u32DestinationSize)
+{
+  const orxU8  *pu8Source, *pu8SourceEnd;
+  orxU8        *pu8Destination, *pu8DestinationEnd;
+  orxSTATUS     eResult = orxSTATUS_FAILURE;
+
+  /* For all sequences */
+  for(pu8Source = _pu8Source, pu8SourceEnd = _pu8Source + _u32SourceSize, pu8Destination = _pu8Destination, pu8DestinationEnd = _pu8Destination + _u32DestinationSize;
+      pu8Source < pu8SourceEnd;
+      )
+  {
+    orxU32 u32Token, u32Length, u32Offset;
+
+    /* Gets token */
+    u32Token = *pu8Source++;
+
+    /* Gets literal length */
+    u32Length = u32Token >> 4;
+    if(u32Length == 15)
+    {
+      orxU32 u32Byte;
+
+      do
+      {
+        u32Byte     = (pu8Source < pu8SourceEnd) ? *pu8Source++ : 0;
+        u32Length  += u32Byte;
+      } while(u32Byte == 255);
+    }
+
+    /* Out of bounds? */
+    if(((orxU32)(pu8SourceEnd - pu8Source) < u32Length) || ((orxU32)(pu8DestinationEnd - pu8Destination) < u32Length))
+    {
+      break;
+    }
+
+    /* Copies literals */
+    orxMemory_Copy(pu8Destination, pu8Source, u32Length);
+    pu8Source      += u32Length;
+    pu8Destination += u32Length;
+
+    /* End of block? */
+    if(pu8Source == pu8SourceEnd)
+    {
+      /* Updates result */
+      eResult = (pu8Destination == pu8DestinationEnd) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+      break;
+    }
+
+    /* Gets match offset */
+    if(pu8SourceEnd - pu8Source < 2)
+    {
+      break;
+    }
+    u32Offset   = (orxU32)pu8Source[0] | ((orxU32)pu8Source[1] << 8);
+    pu8Source  += 2;
+
+    /* Gets match length */
+    u32Length = u32Token & 0xF;
+    if(u32Length == 15)
+    {
+      orxU32 u32Byte;
+
+      do
+      {
+        u32Byte     = (pu8Source < pu8SourceEnd) ? *pu8Source++ : 0;
+        u32Length  += u32Byte;
+      } while(u32Byte == 255);
+    }
+    u32Length += 4;
+
+    /* Out of bounds? */
+    if((u32Offset == 0) || ((orxU32)(pu8Destination - _pu8Destination) < u32Offset) || ((orxU32)(pu8DestinationEnd - pu8Destination) < u32Length))
+    {
+      break;
+    }
+
+    /* Doesn't overlap? */
+    if(u32Offset >= u32Length)
+    {
+      /* Copies match */
+      orxMemory_Copy(pu8Destination, pu8Destination - u32Offset, u32Length);
+      pu8Destination += u32Length;
+    }
+    else
+    {
+      const orxU8 *pu8Match;
+
+      /* Copies match, byte per byte, as it repeats itself */
+      for(pu8Match = pu8Destination - u32Offset; u32Length > 0; u32Length--)
+      {
+        *pu8Destination++ = *pu8Match++;
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static const orxSTRING orxFASTCALL orxResource_Pack_Locate(const orxSTRING _zStorage, const orxSTRING _zName, orxBOOL _bRequireExistence)
+{
+  const orxRESOURCE_PACK *pstPack;
+  const orxSTRING         zResult = orxNULL;
+
+  /* Gets pack */
+  pstPack = orxResource_Pack_Get(_zStorage, orxString_GetLength(_zStorage));
+
+  /* Valid? */
+  if(pstPack != orxNULL)
+  {
+    /* Packs are read-only: only existing resources can be located */
+    if(orxResource_Pack_Find(pstPack, _zName) != orxNULL)
+    {
+      /* Composes location */
+      if(orxString_NPrint(sstResource.acPackLocationBuffer, orxRESOURCE_KU32_BUFFER_SIZE - 1, "%s%c%s", _zStorage, orxRESOURCE_KC_LOCATION_SEPARATOR, _zName) < orxRESOURCE_KU32_BUFFER_SIZE - 1)
+      {
+        /* Updates result */
+        zResult = sstResource.acPackLocationBuffer;
+      }
+    }
+  }
+
+  /* Done! */
+  return zResult;
+}
+
+static orxHANDLE orxFASTCALL orxResource_Pack_Open(const orxSTRING _zPath, orxBOOL _bEraseMode)
+{
+  orxHANDLE hResult = orxHANDLE_UNDEFINED;
+
+  /* Not in erase mode? */
+  if(_bEraseMode == orxFALSE)
+  {
+    const orxCHAR *pc, *pcSeparator = orxNULL;
+
+    /* Finds last separator: storages can contain some (drive letters) while entry names can't */
+    for(pc = _zPath; *pc != orxCHAR_NULL; pc++)
+    {
+      if(*pc == orxRESOURCE_KC_LOCATION_SEPARATOR)
+      {
+        pcSeparator = pc;
+      }
+    }
+
+    /* Found? */
+    if(pcSeparator != orxNULL)
+    {
+      const orxRESOURCE_PACK *pstPack;
+
+      /* Gets pack */
+      pstPack = orxResource_Pack_Get(_zPath, (orxU32)(pcSeparator - _zPath));
+
+      /* Valid? */
+      if(pstPack != orxNULL)
+      {
+        const orxRESOURCE_PACK_ENTRY *pstEntry;
+
+        /* Finds entry */
+        pstEntry = orxResource_Pack_Find(pstPack, pcSeparator + 1);
+
+        /* Found? */
+        if(pstEntry != orxNULL)
+        {
+          orxRESOURCE_PACK_HANDLE  *pstHandle;
+          orxBOOL                   bCompressed;
+
+          /* Is compressed? */
+          bCompressed = orxFLAG_TEST(pstEntry->u32Flags, orxRESOURCE_KU32_PACK_ENTRY_FLAG_COMPRESSED);
+
+          /* Allocates handle (handles can be closed from the resource thread, hence no bank) */
+          pstHandle = (orxRESOURCE_PACK_HANDLE *)orxMemory_Allocate(sizeof(orxRESOURCE_PACK_HANDLE), orxMEMORY_TYPE_MAIN);
+
+          /* Success? */
+          if(pstHandle != orxNULL)
+          {
+            /* Inits it: stored data is used in place, compressed data gets decompressed on first read */
+            pstHandle->pu8Source  = pstPack->pu8Data + pstEntry->u64Offset;
+            pstHandle->pu8Data    = (bCompressed != orxFALSE) ? orxNULL : pstHandle->pu8Source;
+            pstHandle->pu8Buffer  = orxNULL;
+            pstHandle->pstEntry   = pstEntry;
+            pstHandle->s64Size    = (orxS64)pstEntry->u32Size;
+            pstHandle->s64Cursor  = 0;
+
+            /* Is compressed? */
+            if(bCompressed != orxFALSE)
+            {
+              /* Checks (sizes were bounded when mapping the archive) */
+              orxASSERT(pstEntry->u32Size <= orxRESOURCE_KU32_PACK_MAX_ENTRY_SIZE);
+
+              /* Allocates decompression buffer */
+              pstHandle->pu8Buffer = (pstEntry->u32Size <= orxRESOURCE_KU32_PACK_MAX_ENTRY_SIZE) ? (orxU8 *)orxMemory_Allocate(orxMAX(pstEntry->u32Size, 1), orxMEMORY_TYPE_MAIN) : orxNULL;
+
+              /* Failure? */
+              if(pstHandle->pu8Buffer == orxNULL)
+              {
+                /* Logs message */
+                orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't open pack resource <%s>: couldn't allocate %u bytes for decompression.", _zPath, pstEntry->u32Size);
+
+                /* Frees handle */
+                orxMemory_Free(pstHandle);
+                pstHandle = orxNULL;
+              }
+            }
+
+            /* Updates result */
+            hResult = (pstHandle != orxNULL) ? (orxHANDLE)pstHandle : orxHANDLE_UNDEFINED;
+          }
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return hResult;
+}
+
+static void orxFASTCALL orxResource_Pack_Close(orxHANDLE _hResource)
+{
+  /* Has decompression buffer? */
+  if(((orxRESOURCE_PACK_HANDLE *)_hResource)->pu8Buffer != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(((orxRESOURCE_PACK_HANDLE *)_hResource)->pu8Buffer);
+  }
+
+  /* Frees handle */
+  orxMemory_Free((void *)_hResource);
+
+  /* Done! */
+  return;
+}
+
+static orxS64 orxFASTCALL orxResource_Pack_GetSize(orxHANDLE _hResource)
+{
+  /* Done! */
+  return ((orxRESOURCE_PACK_HANDLE *)_hResource)->s64Size;
+}
+
+static orxS64 orxFASTCALL orxResource_Pack_Seek(orxHANDLE _hResource, orxS64 _s64Offset, orxSEEK_OFFSET_WHENCE _eWhence)
+{
+  orxRESOURCE_PACK_HANDLE  *pstHandle;
+  orxS64                    s64Cursor;
+
+  /* Gets handle */
+  pstHandle = (orxRESOURCE_PACK_HANDLE *)_hResource;
+
+  /* Depending on whence */
+  switch(_eWhence)
+  {
+    case orxSEEK_OFFSET_WHENCE_START:
+    {
+      s64Cursor = _s64Offset;
+      break;
+    }
+
+    case orxSEEK_OFFSET_WHENCE_CURRENT:
+    {
+      s64Cursor = pstHandle->s64Cursor + _s64Offset;
+      break;
+    }
+
+    case orxSEEK_OFFSET_WHENCE_END:
+    {
+      s64Cursor = pstHandle->s64Size + _s64Offset;
+      break;
+    }
+
+    default:
+    {
+      s64Cursor = pstHandle->s64Cursor;
+      break;
+    }
+  }
+
+  /* Updates cursor */
+  pstHandle->s64Cursor = orxCLAMP(s64Cursor, 0, pstHandle->s64Size);
+
+  /* Done! */
+  return pstHandle->s64Cursor;
+}
+
+static orxS64 orxFASTCALL orxResource_Pack_Tell(orxHANDLE _hResource)
+{
+  /* Done! */
+  return ((orxRESOURCE_PACK_HANDLE *)_hResource)->s64Cursor;
+}
+
+static orxS64 orxFASTCALL orxResource_Pack_Read(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer)
+{
+  orxRESOURCE_PACK_HANDLE  *pstHandle;
+  orxS64                    s64Result = 0;
+
+  /* Gets handle */
+  pstHandle = (orxRESOURCE_PACK_HANDLE *)_hResource;
+
+  /* Not decompressed yet? */
+  if(pstHandle->pu8Data == orxNULL)
+  {
+    /* Decompresses it */
+    if(orxResource_Pack_Decompress(pstHandle->pu8Source, pstHandle->pstEntry->u32StoredSize, pstHandle->pu8Buffer, pstHandle->pstEntry->u32Size) != orxSTATUS_FAILURE)
+    {
+      /* Stores data */
+      pstHandle->pu8Data = pstHandle->pu8Buffer;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't read pack resource: corrupted data.");
+    }
+  }
+
+  /* Has data? */
+  if(pstHandle->pu8Data != orxNULL)
+  {
+    /* Gets readable size */
+    s64Result = orxMIN(_s64Size, pstHandle->s64Size - pstHandle->s64Cursor);
 
-  /* Updates result */
-  s64Result = orxFile_Write(_pBuffer, sizeof(orxCHAR), _s64Size, pstFile);
+    /* Valid? */
+    if(s64Result > 0)
+    {
+      /* Copies data straight from the archive */
+      orxMemory_Copy(_pBuffer, pstHandle->pu8Data + pstHandle->s64Cursor, (orxU32)s64Result);
+
+      /* Updates cursor */
+      pstHandle->s64Cursor += s64Result;
+    }
+    else
+    {
+      /* Updates result */
+      s64Result = 0;
+    }
+  }
 
   /* Done! */
   return s64Result;
@@ -663,26 +1424,37 @@ static void orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE _eType, orxS64 _s64S
   orxThread_SignalSemaphore(sstResource.pstRequestSemaphore);
 }
 
-static void orxFASTCALL orxResource_NotifyUpdateChange(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+static void orxFASTCALL orxResource_SendEvent(orxRESOURCE_EVENT _eEvent, const orxRESOURCE_INFO *_pstResourceInfo)
 {
-  orxRESOURCE_INFO         *pstResourceInfo;
   orxRESOURCE_EVENT_PAYLOAD stPayload;
 
-  /* Gets resource info */
-  pstResourceInfo = (orxRESOURCE_INFO *)_pContext;
-
   /* Clears payload */
   orxMemory_Zero(&stPayload, sizeof(orxRESOURCE_EVENT_PAYLOAD));
 
   /* Inits payload */
-  stPayload.s64Time     = pstResourceInfo->s64Time;
-  stPayload.zLocation   = pstResourceInfo->zLocation;
-  stPayload.pstTypeInfo = pstResourceInfo->pstTypeInfo;
-  stPayload.u32GroupID  = pstResourceInfo->u32GroupID;
-  stPayload.u32NameID   = pstResourceInfo->u32NameID;
+  stPayload.s64Time     = _pstResourceInfo->s64Time;
+  stPayload.zLocation   = _pstResourceInfo->zLocation;
+  stPayload.pstTypeInfo = _pstResourceInfo->pstTypeInfo;
+  stPayload.u32GroupID  = _pstResourceInfo->u32GroupID;
+  stPayload.u32NameID   = _pstResourceInfo->u32NameID;
+
+  /* Sends event */
+  orxEVENT_SEND(orxEVENT_TYPE_RESOURCE, _eEvent, orxNULL, orxNULL, &stPayload);
+}
 
+static void orxFASTCALL orxResource_NotifyUpdateChange(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
   /* Sends event */
-  orxEVENT_SEND(orxEVENT_TYPE_RESOURCE, orxRESOURCE_EVENT_UPDATE, orxNULL, orxNULL, &stPayload);
+  orxResource_SendEvent(orxRESOURCE_EVENT_UPDATE, (orxRESOURCE_INFO *)_pContext);
+}
+
+static orxINLINE void orxResource_DeferUpdateChange(orxRESOURCE_INFO *_pstResourceInfo)
+{
+  /* Removes potential pending update notification */
+  orxClock_RemoveGlobalTimer(orxResource_NotifyUpdateChange, orxRESOURCE_KF_WATCH_NOTIFICATION_DELAY, _pstResourceInfo);
+
+  /* Defers update notification to cope with potential slow external resource writes */
+  orxClock_AddGlobalTimer(orxResource_NotifyUpdateChange, orxRESOURCE_KF_WATCH_NOTIFICATION_DELAY, 1, _pstResourceInfo);
 }
 
 static void orxFASTCALL orxResource_NotifyChange(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer, void *_pContext)
@@ -701,50 +1473,374 @@ static void orxFASTCALL orxResource_NotifyChange(orxHANDLE _hResource, orxS64 _s
       /* Removed or added? */
       if((_s64Size == 0) || (pstResourceInfo->s64Time == 0))
       {
-        orxRESOURCE_EVENT_PAYLOAD stPayload;
+        /* Stores its new modification time */
+        pstResourceInfo->s64Time = _s64Size;
 
+        /* Sends event */
+        orxResource_SendEvent((_s64Size == 0) ? orxRESOURCE_EVENT_REMOVE : orxRESOURCE_EVENT_ADD, pstResourceInfo);
+      }
+      else
+      {
         /* Stores its new modification time */
         pstResourceInfo->s64Time = _s64Size;
 
-        /* Clears payload */
-        orxMemory_Zero(&stPayload, sizeof(orxRESOURCE_EVENT_PAYLOAD));
+        /* Defers update notification */
+        orxResource_DeferUpdateChange(pstResourceInfo);
+      }
+    }
+    else
+    {
+      /* Stores its new modification time */
+      pstResourceInfo->s64Time = _s64Size;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+#ifdef orxRESOURCE_WATCH_USE_INOTIFY
+
+#define orxRESOURCE_KU32_WATCH_NOTIFY_MASK            (IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE | IN_ATTRIB | IN_ONLYDIR)
+
+static void orxFASTCALL orxResource_AddDirectoryWatch(const orxSTRING _zPath)
+{
+  int iWatch;
+
+  /* Adds watch */
+  iWatch = inotify_add_watch(sstResource.s32WatchDescriptor, _zPath, orxRESOURCE_KU32_WATCH_NOTIFY_MASK);
+
+  /* Success? */
+  if(iWatch >= 0)
+  {
+    DIR *pstDirectory;
+
+    /* New directory? (the same watch is returned for directories reached through different storages) */
+    if(orxHashTable_Get(sstResource.pstWatchTable, (orxU64)iWatch) == orxNULL)
+    {
+      /* Stores its path */
+      orxHashTable_Add(sstResource.pstWatchTable, (orxU64)iWatch, orxString_Duplicate(_zPath));
+    }
+
+    /* Opens it */
+    pstDirectory = opendir(_zPath);
+
+    /* Success? */
+    if(pstDirectory != NULL)
+    {
+      struct dirent *pstEntry;
+
+      /* For all entries */
+      while((pstEntry = readdir(pstDirectory)) != NULL)
+      {
+        /* Is a non-hidden directory (symbolic links aren't followed)? */
+        if((pstEntry->d_name[0] != '.')
+        && ((pstEntry->d_type == DT_DIR) || (pstEntry->d_type == DT_UNKNOWN)))
+        {
+          orxCHAR *acPath;
+
+          /* Composes its path the same way locations are, without a leading default storage */
+          acPath = (orxCHAR *)orxMemory_Allocate(orxString_GetLength(_zPath) + orxString_GetLength(pstEntry->d_name) + 2, orxMEMORY_TYPE_TEMP);
+          if(orxString_Compare(_zPath, orxRESOURCE_KZ_DEFAULT_STORAGE) == 0)
+          {
+            orxString_Print(acPath, "%s", pstEntry->d_name);
+          }
+          else
+          {
+            orxString_Print(acPath, "%s%c%s", _zPath, orxCHAR_DIRECTORY_SEPARATOR_LINUX, pstEntry->d_name);
+          }
+
+          /* Watches it (non-directories get rejected by IN_ONLYDIR) */
+          orxResource_AddDirectoryWatch(acPath);
+
+          /* Frees path */
+          orxMemory_Free(acPath);
+        }
+      }
+
+      /* Closes it */
+      closedir(pstDirectory);
+    }
+  }
+  /* Not a missing storage or a non-directory one (eg. pack)? */
+  else if((errno != ENOENT) && (errno != ENOTDIR))
+  {
+    /* Falls back to polling for file resources */
+    orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_NONE, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFY);
+
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't watch directory <%s> (error %d): falling back to polling.", _zPath, errno);
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxResource_NotifyWatchEvent(const orxSTRING _zPath, orxU32 _u32Mask)
+{
+  orxS64  s64Time;
+  orxBOOL bModified;
+  orxS32  s32GroupIndex, s32GroupCounter;
+
+  /* Gets new time */
+  s64Time = orxFLAG_TEST(_u32Mask, IN_DELETE | IN_MOVED_FROM) ? 0 : orxResource_File_GetTime(_zPath);
+
+  /* Has been written to? (timestamps might not change for quick successive writes) */
+  bModified = orxFLAG_TEST(_u32Mask, IN_CLOSE_WRITE | IN_MOVED_TO);
+
+  /* For all watched groups */
+  for(s32GroupIndex = 0, s32GroupCounter = orxConfig_GetListCounter(orxRESOURCE_KZ_CONFIG_WATCH_LIST); s32GroupIndex < s32GroupCounter; s32GroupIndex++)
+  {
+    orxRESOURCE_GROUP  *pstGroup;
+    orxU32              u32GroupID;
+
+    /* Gets its ID */
+    u32GroupID = orxString_ToCRC(orxConfig_GetListString(orxRESOURCE_KZ_CONFIG_WATCH_LIST, s32GroupIndex));
+
+    /* Looks for it in registered groups */
+    for(pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, orxNULL);
+        (pstGroup != orxNULL) && (pstGroup->u32ID != u32GroupID);
+        pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, pstGroup))
+    ;
+
+    /* Found? */
+    if(pstGroup != orxNULL)
+    {
+      orxRESOURCE_STORAGE *pstStorage;
+
+      /* For all its storages */
+      for(pstStorage = (orxRESOURCE_STORAGE *)orxLinkList_GetFirst(&(pstGroup->stStorageList));
+          pstStorage != orxNULL;
+          pstStorage = (orxRESOURCE_STORAGE *)orxLinkList_GetNext(&(pstStorage->stNode)))
+      {
+        const orxSTRING zStorage;
+        const orxSTRING zName = orxNULL;
+        orxU32          u32Length;
 
-        /* Inits payload */
-        stPayload.s64Time     = _s64Size;
-        stPayload.zLocation   = pstResourceInfo->zLocation;
-        stPayload.pstTypeInfo = pstResourceInfo->pstTypeInfo;
-        stPayload.u32GroupID  = pstResourceInfo->u32GroupID;
-        stPayload.u32NameID   = pstResourceInfo->u32NameID;
+        /* Gets storage */
+        zStorage  = orxString_GetFromID(pstStorage->u32StorageID);
+        u32Length = orxString_GetLength(zStorage);
 
-        /* Removed? */
-        if(_s64Size == 0)
+        /* Gets resource name, relative to storage */
+        if(orxString_Compare(zStorage, orxRESOURCE_KZ_DEFAULT_STORAGE) == 0)
         {
-          /* Sends event */
-          orxEVENT_SEND(orxEVENT_TYPE_RESOURCE, orxRESOURCE_EVENT_REMOVE, orxNULL, orxNULL, &stPayload);
+          zName = _zPath;
         }
-        /* Added */
-        else
+        else if((orxString_NCompare(_zPath, zStorage, u32Length) == 0)
+             && (_zPath[u32Length] == orxCHAR_DIRECTORY_SEPARATOR_LINUX))
+        {
+          zName = _zPath + u32Length + 1;
+        }
+
+        /* Valid? */
+        if(zName != orxNULL)
         {
-          /* Sends event */
-          orxEVENT_SEND(orxEVENT_TYPE_RESOURCE, orxRESOURCE_EVENT_ADD, orxNULL, orxNULL, &stPayload);
+          orxRESOURCE_INFO *pstResourceInfo;
+
+          /* Gets cached resource */
+          pstResourceInfo = (orxRESOURCE_INFO *)orxHashTable_Get(pstGroup->pstCacheTable, orxString_ToCRC(zName));
+
+          /* Found and located from this path? */
+          if((pstResourceInfo != orxNULL)
+          && (pstResourceInfo->pstTypeInfo == sstResource.pstFileTypeInfo)
+          && (orxString_Compare(pstResourceInfo->zLocation + orxString_GetLength(pstResourceInfo->pstTypeInfo->zTag) + 1, _zPath) == 0))
+          {
+            /* Removed? */
+            if(s64Time == 0)
+            {
+              /* Wasn't already? */
+              if(pstResourceInfo->s64Time != 0)
+              {
+                /* Stores its new modification time */
+                pstResourceInfo->s64Time = 0;
+
+                /* Sends event */
+                orxResource_SendEvent(orxRESOURCE_EVENT_REMOVE, pstResourceInfo);
+              }
+            }
+            /* Added? */
+            else if(pstResourceInfo->s64Time == 0)
+            {
+              /* Stores its new modification time */
+              pstResourceInfo->s64Time = s64Time;
+
+              /* Sends event */
+              orxResource_SendEvent(orxRESOURCE_EVENT_ADD, pstResourceInfo);
+            }
+            /* Updated? (resources that have never been polled have an uninitialized time) */
+            else if((bModified != orxFALSE) || (s64Time != pstResourceInfo->s64Time))
+            {
+              /* Stores its new modification time */
+              pstResourceInfo->s64Time = s64Time;
+
+              /* Defers update notification */
+              orxResource_DeferUpdateChange(pstResourceInfo);
+            }
+          }
         }
       }
-      else
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxResource_UpdateWatchNotifications()
+{
+  orxS32 s32GroupIndex, s32GroupCounter;
+
+  /* Not initialized yet? */
+  if(sstResource.pstWatchTable == orxNULL)
+  {
+    /* Creates tables */
+    sstResource.pstWatchTable         = orxHashTable_Create(orxRESOURCE_KU32_WATCH_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstResource.pstWatchStorageTable  = orxHashTable_Create(orxRESOURCE_KU32_WATCH_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+    /* Creates notification descriptor */
+    sstResource.s32WatchDescriptor    = (orxS32)inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    /* Success? */
+    if((sstResource.pstWatchTable != orxNULL) && (sstResource.pstWatchStorageTable != orxNULL) && (sstResource.s32WatchDescriptor >= 0))
+    {
+      /* Updates flags */
+      orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFY, orxRESOURCE_KU32_STATIC_FLAG_NONE);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't initialize resource watch notifications: falling back to polling.");
+    }
+  }
+
+  /* Has notifications? */
+  if(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFY))
+  {
+    orxU64  au64Buffer[4096 / sizeof(orxU64)];
+    ssize_t sSize;
+
+    /* For all watched groups */
+    for(s32GroupIndex = 0, s32GroupCounter = orxConfig_GetListCounter(orxRESOURCE_KZ_CONFIG_WATCH_LIST); s32GroupIndex < s32GroupCounter; s32GroupIndex++)
+    {
+      orxRESOURCE_GROUP  *pstGroup;
+      orxU32              u32GroupID;
+
+      /* Gets its ID */
+      u32GroupID = orxString_ToCRC(orxConfig_GetListString(orxRESOURCE_KZ_CONFIG_WATCH_LIST, s32GroupIndex));
+
+      /* Looks for it in registered groups */
+      for(pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, orxNULL);
+          (pstGroup != orxNULL) && (pstGroup->u32ID != u32GroupID);
+          pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, pstGroup))
+      ;
+
+      /* Found? */
+      if(pstGroup != orxNULL)
       {
-        /* Stores its new modification time */
-        pstResourceInfo->s64Time = _s64Size;
+        orxRESOURCE_STORAGE *pstStorage;
+
+        /* For all its storages */
+        for(pstStorage = (orxRESOURCE_STORAGE *)orxLinkList_GetFirst(&(pstGroup->stStorageList));
+            pstStorage != orxNULL;
+            pstStorage = (orxRESOURCE_STORAGE *)orxLinkList_GetNext(&(pstStorage->stNode)))
+        {
+          /* Not watched yet? */
+          if(orxHashTable_Get(sstResource.pstWatchStorageTable, pstStorage->u32StorageID) == orxNULL)
+          {
+            const orxSTRING zStorage;
 
-        /* Removes potential pending update notification */
-        orxClock_RemoveGlobalTimer(orxResource_NotifyUpdateChange, orxRESOURCE_KF_WATCH_NOTIFICATION_DELAY, _pContext);
+            /* Gets it */
+            zStorage = orxString_GetFromID(pstStorage->u32StorageID);
 
-        /* Defers update notification to cope with potential slow external resource writes */
-        orxClock_AddGlobalTimer(orxResource_NotifyUpdateChange, orxRESOURCE_KF_WATCH_NOTIFICATION_DELAY, 1, _pContext);
+            /* Watches it, along with all its subdirectories */
+            orxResource_AddDirectoryWatch(zStorage);
+
+            /* Marks it as watched */
+            orxHashTable_Add(sstResource.pstWatchStorageTable, pstStorage->u32StorageID, (void *)zStorage);
+          }
+        }
       }
     }
-    else
+
+    /* For all pending notifications */
+    while((sSize = read(sstResource.s32WatchDescriptor, au64Buffer, sizeof(au64Buffer))) > 0)
     {
-      /* Stores its new modification time */
-      pstResourceInfo->s64Time = _s64Size;
+      const orxU8 *pu8Event;
+
+      /* For all events */
+      for(pu8Event = (const orxU8 *)au64Buffer;
+          pu8Event < (const orxU8 *)au64Buffer + sSize;
+          pu8Event += sizeof(struct inotify_event) + ((const struct inotify_event *)pu8Event)->len)
+      {
+        const struct inotify_event *pstEvent;
+
+        /* Gets it */
+        pstEvent = (const struct inotify_event *)pu8Event;
+
+        /* Overflow? */
+        if(orxFLAG_TEST(pstEvent->mask, IN_Q_OVERFLOW))
+        {
+          /* Falls back to polling for file resources, as some notifications were lost */
+          orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_NONE, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFY);
+
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Resource watch notifications overflowed: falling back to polling.");
+        }
+        /* Watch removed? */
+        else if(orxFLAG_TEST(pstEvent->mask, IN_IGNORED))
+        {
+          orxSTRING zPath;
+
+          /* Gets its path */
+          zPath = (orxSTRING)orxHashTable_Get(sstResource.pstWatchTable, (orxU64)pstEvent->wd);
+
+          /* Found? */
+          if(zPath != orxNULL)
+          {
+            /* Removes it */
+            orxHashTable_Remove(sstResource.pstWatchTable, (orxU64)pstEvent->wd);
+            orxString_Delete(zPath);
+          }
+        }
+        /* Has name? */
+        else if(pstEvent->len > 0)
+        {
+          const orxSTRING zPath;
+
+          /* Gets directory path */
+          zPath = (const orxSTRING)orxHashTable_Get(sstResource.pstWatchTable, (orxU64)pstEvent->wd);
+
+          /* Found? */
+          if(zPath != orxNULL)
+          {
+            /* Composes full path, the same way locations are */
+            if(orxString_Compare(zPath, orxRESOURCE_KZ_DEFAULT_STORAGE) == 0)
+            {
+              orxString_NPrint(sstResource.acWatchBuffer, orxRESOURCE_KU32_BUFFER_SIZE - 1, "%s", pstEvent->name);
+            }
+            else
+            {
+              orxString_NPrint(sstResource.acWatchBuffer, orxRESOURCE_KU32_BUFFER_SIZE - 1, "%s%c%s", zPath, orxCHAR_DIRECTORY_SEPARATOR_LINUX, pstEvent->name);
+            }
+
+            /* Directory? */
+            if(orxFLAG_TEST(pstEvent->mask, IN_ISDIR))
+            {
+              /* New one? */
+              if(orxFLAG_TEST(pstEvent->mask, IN_CREATE | IN_MOVED_TO))
+              {
+                /* Watches it */
+                orxResource_AddDirectoryWatch(sstResource.acWatchBuffer);
+              }
+            }
+            else
+            {
+              /* Notifies it */
+              orxResource_NotifyWatchEvent(sstResource.acWatchBuffer, pstEvent->mask);
+            }
+          }
+        }
+      }
     }
   }
 
@@ -752,6 +1848,8 @@ static void orxFASTCALL orxResource_NotifyChange(orxHANDLE _hResource, orxS64 _s
   return;
 }
 
+#endif /* orxRESOURCE_WATCH_USE_INOTIFY */
+
 static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
 {
   static orxS32 ss32GroupIndex = 0;
@@ -765,6 +1863,13 @@ static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, vo
   /* Pushes config section */
   orxConfig_PushSection(orxRESOURCE_KZ_CONFIG_SECTION);
 
+#ifdef orxRESOURCE_WATCH_USE_INOTIFY
+
+  /* Updates watch notifications */
+  orxResource_UpdateWatchNotifications();
+
+#endif /* orxRESOURCE_WATCH_USE_INOTIFY */
+
   /* For all watched groups */
   for(s32ListCounter = orxConfig_GetListCounter(orxRESOURCE_KZ_CONFIG_WATCH_LIST); ss32GroupIndex < s32ListCounter; ss32GroupIndex++)
   {
@@ -803,8 +1908,10 @@ static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, vo
           shIterator != orxHANDLE_UNDEFINED;
           shIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, shIterator, &u64Key, (void **)&pstResourceInfo))
       {
-        /* Does its type support time? */
-        if(pstResourceInfo->pstTypeInfo->pfnGetTime != orxNULL)
+        /* Does its type support time and isn't it watched through notifications? */
+        if((pstResourceInfo->pstTypeInfo->pfnGetTime != orxNULL)
+        && ((pstResourceInfo->pstTypeInfo != sstResource.pstFileTypeInfo)
+         || !orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFY)))
         {
           /* Adds request */
           orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_GET_TIME, 0, orxNULL, &orxResource_NotifyChange, pstResourceInfo, orxNULL);
@@ -1067,6 +2174,13 @@ orxSTATUS orxFASTCALL orxResource_Init()
     /* Cleans control structure */
     orxMemory_Zero(&sstResource, sizeof(orxRESOURCE_STATIC));
 
+#ifdef orxRESOURCE_WATCH_USE_INOTIFY
+
+    /* Inits notification descriptor */
+    sstResource.s32WatchDescriptor = -1;
+
+#endif /* orxRESOURCE_WATCH_USE_INOTIFY */
+
     /* Creates semaphores */
     sstResource.pstRequestSemaphore = orxThread_CreateSemaphore(1);
     sstResource.pstWorkerSemaphore  = orxThread_CreateSemaphore(1);
@@ -1089,8 +2203,12 @@ orxSTATUS orxFASTCALL orxResource_Init()
       /* Creates type info bank */
       sstResource.pstTypeBank         = orxBank_Create(orxRESOURCE_KU32_TYPE_BANK_SIZE, sizeof(orxRESOURCE_TYPE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+      /* Creates pack bank & table */
+      sstResource.pstPackBank         = orxBank_Create(orxRESOURCE_KU32_PACK_BANK_SIZE, sizeof(orxRESOURCE_PACK), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      sstResource.pstPackTable        = orxHashTable_Create(orxRESOURCE_KU32_PACK_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
       /* Success? */
-      if((sstResource.pstResourceInfoBank != orxNULL) && (sstResource.pstOpenInfoBank != orxNULL) && (sstResource.pstGroupBank != orxNULL) && (sstResource.pstTypeBank != orxNULL))
+      if((sstResource.pstResourceInfoBank != orxNULL) && (sstResource.pstOpenInfoBank != orxNULL) && (sstResource.pstGroupBank != orxNULL) && (sstResource.pstTypeBank != orxNULL) && (sstResource.pstPackBank != orxNULL) && (sstResource.pstPackTable != orxNULL))
       {
         orxRESOURCE_TYPE_INFO stTypeInfo;
 
@@ -1112,6 +2230,28 @@ orxSTATUS orxFASTCALL orxResource_Init()
         /* Registers it */
         eResult = orxResource_RegisterType(&stTypeInfo);
 
+        /* Success? */
+        if(eResult != orxSTATUS_FAILURE)
+        {
+          /* Stores file type info */
+          sstResource.pstFileTypeInfo = &(((orxRESOURCE_TYPE *)orxLinkList_GetFirst(&(sstResource.stTypeList)))->stInfo);
+
+          /* Inits pack type: registered after file so that pack storages get checked first, without hitting the file system */
+          stTypeInfo.zTag       = orxRESOURCE_KZ_TYPE_TAG_PACK;
+          stTypeInfo.pfnLocate  = orxResource_Pack_Locate;
+          stTypeInfo.pfnGetTime = orxNULL;
+          stTypeInfo.pfnOpen    = orxResource_Pack_Open;
+          stTypeInfo.pfnClose   = orxResource_Pack_Close;
+          stTypeInfo.pfnGetSize = orxResource_Pack_GetSize;
+          stTypeInfo.pfnSeek    = orxResource_Pack_Seek;
+          stTypeInfo.pfnTell    = orxResource_Pack_Tell;
+          stTypeInfo.pfnRead    = orxResource_Pack_Read;
+          stTypeInfo.pfnWrite   = orxNULL;
+
+          /* Registers it */
+          eResult = orxResource_RegisterType(&stTypeInfo);
+        }
+
         /* Success? */
         if(eResult != orxSTATUS_FAILURE)
         {
@@ -1181,6 +2321,18 @@ orxSTATUS orxFASTCALL orxResource_Init()
         orxBank_Delete(sstResource.pstTypeBank);
       }
 
+      /* Deletes pack bank */
+      if(sstResource.pstPackBank != orxNULL)
+      {
+        orxBank_Delete(sstResource.pstPackBank);
+      }
+
+      /* Deletes pack table */
+      if(sstResource.pstPackTable != orxNULL)
+      {
+        orxHashTable_Delete(sstResource.pstPackTable);
+      }
+
       /* Has request thread? */
       if(sstResource.u32RequestThreadID != orxU32_UNDEFINED)
       {
@@ -1215,6 +2367,7 @@ void orxFASTCALL orxResource_Exit()
   {
     orxRESOURCE_GROUP      *pstGroup;
     orxRESOURCE_OPEN_INFO  *pstOpenInfo;
+    orxRESOURCE_PACK       *pstPack;
 
     /* Unregisters commands */
     orxResource_UnregisterCommands();
@@ -1274,6 +2427,64 @@ void orxFASTCALL orxResource_Exit()
     /* Deletes open info bank */
     orxBank_Delete(sstResource.pstOpenInfoBank);
 
+    /* For all packs */
+    while((pstPack = (orxRESOURCE_PACK *)orxBank_GetNext(sstResource.pstPackBank, orxNULL)) != orxNULL)
+    {
+      /* Unmaps it */
+      orxResource_Pack_Unmap(pstPack);
+
+      /* Deletes its storage */
+      if(pstPack->zStorage != orxNULL)
+      {
+        orxString_Delete(pstPack->zStorage);
+      }
+
+      /* Frees it */
+      orxBank_Free(sstResource.pstPackBank, pstPack);
+    }
+
+    /* Deletes pack bank & table */
+    orxBank_Delete(sstResource.pstPackBank);
+    orxHashTable_Delete(sstResource.pstPackTable);
+
+#ifdef orxRESOURCE_WATCH_USE_INOTIFY
+
+    /* Has watch notifications? */
+    if(sstResource.pstWatchTable != orxNULL)
+    {
+      orxHANDLE hIterator;
+      orxU64    u64Key;
+      orxSTRING zPath;
+
+      /* For all watched directories */
+      for(hIterator = orxHashTable_GetNext(sstResource.pstWatchTable, orxHANDLE_UNDEFINED, &u64Key, (void **)&zPath);
+          hIterator != orxHANDLE_UNDEFINED;
+          hIterator = orxHashTable_GetNext(sstResource.pstWatchTable, hIterator, &u64Key, (void **)&zPath))
+      {
+        /* Deletes its path */
+        orxString_Delete(zPath);
+      }
+
+      /* Deletes table */
+      orxHashTable_Delete(sstResource.pstWatchTable);
+    }
+
+    /* Has watched storages? */
+    if(sstResource.pstWatchStorageTable != orxNULL)
+    {
+      /* Deletes table */
+      orxHashTable_Delete(sstResource.pstWatchStorageTable);
+    }
+
+    /* Has notification descriptor? */
+    if(sstResource.s32WatchDescriptor >= 0)
+    {
+      /* Closes it */
+      close(sstResource.s32WatchDescriptor);
+    }
+
+#endif /* orxRESOURCE_WATCH_USE_INOTIFY */
+
     /* Checks */
     orxASSERT(orxBank_GetCounter(sstResource.pstResourceInfoBank) == 0);
 
@@ -34,6 +34,7 @@
 #include "core/orxThread.h"
 
 #include "core/orxClock.h"
+#include "core/orxConfig.h"
 #include "core/orxSystem.h"
 #include "debug/orxDebug.h"
 #include "memory/orxMemory.h"
@@ -79,13 +80,34 @@
 #define orxTHREAD_KU32_INFO_MASK_ALL                  0xFFFFFFFF  /**< The module has been initialized */
 
 
+#define orxTHREAD_KU32_TASK_FLAG_NONE                 0x00000000  /**< No flags have been set */
+#define orxTHREAD_KU32_TASK_FLAG_ORDERED              0x00000001  /**< Ordered flag */
+#define orxTHREAD_KU32_TASK_FLAG_DONE                 0x00000002  /**< Done flag */
+#define orxTHREAD_KU32_TASK_FLAG_DETACHED             0x00000004  /**< Detached flag: no follow-ups, freed as soon as run */
+#define orxTHREAD_KU32_TASK_MASK_ALL                  0xFFFFFFFF  /**< All mask */
+
+
 /** Misc
  */
-#define orxTHREAD_KU32_TASK_LIST_SIZE                 64
+#define orxTHREAD_KU32_TASK_CHUNK_SIZE                64
+#define orxTHREAD_KU32_WORKER_QUEUE_SIZE              64
+#define orxTHREAD_KU32_MAX_WORKER_NUMBER              8
+#define orxTHREAD_KU32_PARALLEL_CHUNK_PER_THREAD      4
+
+#if defined(__orxMSVC__)
+  #define orxTHREAD_ATOMIC_INCREMENT(VALUE)           ((orxU32)InterlockedIncrement((volatile LONG *)&(VALUE)))
+  #define orxTHREAD_ATOMIC_DECREMENT(VALUE)           ((orxU32)InterlockedDecrement((volatile LONG *)&(VALUE)))
+#else /* __orxMSVC__ */
+  #define orxTHREAD_ATOMIC_INCREMENT(VALUE)           __sync_add_and_fetch(&(VALUE), 1)
+  #define orxTHREAD_ATOMIC_DECREMENT(VALUE)           __sync_sub_and_fetch(&(VALUE), 1)
+#endif /* __orxMSVC__ */
 
 #define orxTHREAD_KZ_THREAD_NAME_MAIN                 "Main"
 #define orxTHREAD_KZ_THREAD_NAME_WORKER               "Task Runner"
 
+#define orxTHREAD_KZ_CONFIG_SECTION                   "Thread"
+#define orxTHREAD_KZ_CONFIG_WORKER_NUMBER             "WorkerNumber"
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -119,14 +141,55 @@ typedef struct __orxTHREAD_INFO_t
  */
 typedef struct __orxTHREAD_TASK_t
 {
-  orxTHREAD_FUNCTION      pfnRun;
-  orxTHREAD_FUNCTION      pfnThen;
-  orxTHREAD_FUNCTION      pfnElse;
-  void                   *pContext;
-  orxSTATUS               eResult;
+  orxTHREAD_FUNCTION                pfnRun;
+  orxTHREAD_FUNCTION                pfnThen;
+  orxTHREAD_FUNCTION                pfnElse;
+  void                             *pContext;
+  struct __orxTHREAD_TASK_t        *pstNext;                    /**< Next task, in submission order (or in free list) */
+  struct __orxTHREAD_TASK_t        *pstNextOrdered;             /**< Next ordered task */
+  volatile orxSTATUS                eResult;
+  volatile orxU32                   u32Flags;
 
 } orxTHREAD_TASK;
 
+/** Task chunk
+ */
+typedef struct __orxTHREAD_TASK_CHUNK_t
+{
+  struct __orxTHREAD_TASK_CHUNK_t  *pstNext;
+  orxTHREAD_TASK                    astTaskList[orxTHREAD_KU32_TASK_CHUNK_SIZE];
+
+} orxTHREAD_TASK_CHUNK;
+
+/** Worker
+ */
+typedef struct __orxTHREAD_WORKER_t
+{
+  orxTHREAD_SEMAPHORE              *pstSemaphore;               /**< Protects the task queue */
+  orxTHREAD_TASK                  **apstTaskList;               /**< Task queue: owner pushes/pops at the tail, thieves steal from the head */
+  volatile orxU32                   u32Head;
+  volatile orxU32                   u32Tail;
+  orxU32                            u32Size;
+  orxU32                            u32ThreadID;
+
+} orxTHREAD_WORKER;
+
+/** Parallel job
+ */
+typedef struct __orxTHREAD_PARALLEL_JOB_t
+{
+  orxTHREAD_PARALLEL_FUNCTION       pfnRun;
+  void                             *pContext;
+  orxU32                            u32Start;
+  orxU32                            u32End;
+  orxU32                            u32Grain;
+  orxU32                            u32ChunkNumber;
+  volatile orxU32                   u32ChunkCounter;            /**< Number of claimed chunks */
+  volatile orxU32                   u32HelperCounter;           /**< Number of helper tasks that haven't completed yet */
+  volatile orxSTATUS                eResult;
+
+} orxTHREAD_PARALLEL_JOB;
+
 /** Static structure
  */
 typedef struct __orxTHREAD_STATIC_t
@@ -134,147 +197,812 @@ typedef struct __orxTHREAD_STATIC_t
   orxTHREAD_SEMAPHORE    *pstThreadSemaphore;
   orxTHREAD_SEMAPHORE    *pstTaskSemaphore;
   orxTHREAD_SEMAPHORE    *pstWorkerSemaphore;
-  orxU32                  u32WorkerID;
-  volatile orxU32         u32TaskInIndex;
-  volatile orxU32         u32TaskProcessIndex;
-  volatile orxU32         u32TaskOutIndex;
+  orxTHREAD_TASK_CHUNK   *pstTaskChunk;
+  orxTHREAD_TASK         *pstFreeTask;
+  orxTHREAD_TASK         *pstFirstTask;
+  orxTHREAD_TASK         *pstLastTask;
+  orxTHREAD_TASK         *volatile pstFirstOrderedTask;
+  orxTHREAD_TASK         *pstLastOrderedTask;
+  volatile orxBOOL        bOrderedTaskRunning;
+  volatile orxU32         u32TaskCounter;
+  orxU32                  u32WorkerNumber;
+  orxU32                  u32NextWorker;
   volatile orxTHREAD_INFO astThreadInfoList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
-  volatile orxTHREAD_TASK astTaskList[orxTHREAD_KU32_TASK_LIST_SIZE];
+  orxTHREAD_WORKER        astWorkerList[orxTHREAD_KU32_MAX_WORKER_NUMBER];
 
   orxU32                  u32Flags;
 
 } orxTHREAD_STATIC;
 
 
-/***************************************************************************
- * Static variables                                                        *
- ***************************************************************************/
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxTHREAD_STATIC sstThread;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+#ifdef __orxWINDOWS__
+static unsigned int WINAPI orxThread_Execute(void *_pContext)
+#else /* __orxWINDOWS__ */
+static void *orxThread_Execute(void *_pContext)
+#endif /* __orxWINDOWS__ */
+{
+  volatile orxTHREAD_INFO  *pstInfo;
+  orxSTATUS                 eResult;
+
+  /* Gets thread's info */
+  pstInfo = (orxTHREAD_INFO *)_pContext;
+
+#ifdef __orxWINDOWS__
+
+  /* Stores thread ID */
+  pstInfo->u32ThreadID = GetCurrentThreadId();
+  orxMEMORY_BARRIER();
+
+#endif /* __orxWINDOWS__ */
+
+  /* Spins until ready */
+  while(pstInfo->hThread == 0)
+    ;
+
+#if defined(__orxANDROID__) || defined(__orxANDROID_NATIVE__)
+
+  /* Notifies the Java framework */
+  orxAndroid_JNI_SetupThread();
+
+#endif /* __orxANDROID__ || __orxANDROID_NATIVE__ */
+
+  do
+  {
+    /* Runs thread function */
+    eResult = pstInfo->pfnRun(pstInfo->pContext);
+
+    /* Yields */
+    orxThread_Yield();
+
+    /* Waits for its enable semaphore */
+    orxThread_WaitSemaphore(pstInfo->pstEnableSemaphore);
+
+    /* Signals its enable semaphore */
+    orxThread_SignalSemaphore(pstInfo->pstEnableSemaphore);
+  }
+  /* While stop hasn't been requested */
+  while((eResult != orxSTATUS_FAILURE) && !orxFLAG_TEST(pstInfo->u32Flags, orxTHREAD_KU32_INFO_FLAG_STOP));
+
+  /* Done! */
+  return 0;
+}
+
+static orxU32 orxFASTCALL orxThread_GetCoreNumber()
+{
+  orxU32 u32Result;
+
+#ifdef __orxWINDOWS__
+
+  {
+    SYSTEM_INFO stInfo;
+
+    /* Gets system info */
+    GetSystemInfo(&stInfo);
+
+    /* Updates result */
+    u32Result = (orxU32)stInfo.dwNumberOfProcessors;
+  }
+
+#else /* __orxWINDOWS__ */
+
+  {
+    long lNumber;
+
+    /* Gets number of online processors */
+    lNumber = sysconf(_SC_NPROCESSORS_ONLN);
+
+    /* Updates result */
+    u32Result = (lNumber > 0) ? (orxU32)lNumber : 1;
+  }
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return u32Result;
+}
+
+static orxINLINE orxTHREAD_WORKER *orxThread_GetCurrentWorker()
+{
+  orxU32            u32ThreadID, i;
+  orxTHREAD_WORKER *pstResult = orxNULL;
+
+  /* Gets current thread ID */
+  u32ThreadID = orxThread_GetCurrent();
+
+  /* For all workers */
+  for(i = 0; i < sstThread.u32WorkerNumber; i++)
+  {
+    /* Matches? */
+    if(sstThread.astWorkerList[i].u32ThreadID == u32ThreadID)
+    {
+      /* Updates result */
+      pstResult = &(sstThread.astWorkerList[i]);
+      break;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+static orxINLINE orxBOOL orxThread_HasQueuedTask()
+{
+  orxU32  i;
+  orxBOOL bResult;
+
+  /* Has pending ordered task? */
+  bResult = ((sstThread.pstFirstOrderedTask != orxNULL) && (sstThread.bOrderedTaskRunning == orxFALSE)) ? orxTRUE : orxFALSE;
+
+  /* For all workers */
+  for(i = 0; (i < sstThread.u32WorkerNumber) && (bResult == orxFALSE); i++)
+  {
+    /* Updates result */
+    bResult = (sstThread.astWorkerList[i].u32Head != sstThread.astWorkerList[i].u32Tail) ? orxTRUE : orxFALSE;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+static orxSTATUS orxFASTCALL orxThread_PushTask(orxTHREAD_WORKER *_pstWorker, orxTHREAD_TASK *_pstTask)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Waits for worker's semaphore */
+  orxThread_WaitSemaphore(_pstWorker->pstSemaphore);
+
+  /* Is queue full? */
+  if(_pstWorker->u32Tail - _pstWorker->u32Head == _pstWorker->u32Size)
+  {
+    orxTHREAD_TASK **apstTaskList;
+
+    /* Allocates twice as big a queue */
+    apstTaskList = (orxTHREAD_TASK **)orxMemory_Allocate(2 * _pstWorker->u32Size * sizeof(orxTHREAD_TASK *), orxMEMORY_TYPE_SYSTEM);
+
+    /* Success? */
+    if(apstTaskList != orxNULL)
+    {
+      orxU32 i;
+
+      /* For all queued tasks */
+      for(i = 0; i < _pstWorker->u32Size; i++)
+      {
+        /* Copies it */
+        apstTaskList[i] = _pstWorker->apstTaskList[(_pstWorker->u32Head + i) & (_pstWorker->u32Size - 1)];
+      }
+
+      /* Frees old queue */
+      orxMemory_Free(_pstWorker->apstTaskList);
+
+      /* Stores new one */
+      _pstWorker->apstTaskList  = apstTaskList;
+      _pstWorker->u32Head       = 0;
+      _pstWorker->u32Tail       = _pstWorker->u32Size;
+      _pstWorker->u32Size     <<= 1;
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Stores task */
+    _pstWorker->apstTaskList[_pstWorker->u32Tail & (_pstWorker->u32Size - 1)] = _pstTask;
+    orxMEMORY_BARRIER();
+
+    /* Updates tail */
+    _pstWorker->u32Tail++;
+  }
+
+  /* Signals worker's semaphore */
+  orxThread_SignalSemaphore(_pstWorker->pstSemaphore);
+
+  /* Done! */
+  return eResult;
+}
+
+static orxTHREAD_TASK *orxFASTCALL orxThread_PopTask(orxTHREAD_WORKER *_pstWorker, orxBOOL _bSteal)
+{
+  orxTHREAD_TASK *pstResult = orxNULL;
+
+  /* Isn't empty? */
+  if(_pstWorker->u32Head != _pstWorker->u32Tail)
+  {
+    /* Waits for worker's semaphore */
+    orxThread_WaitSemaphore(_pstWorker->pstSemaphore);
+
+    /* Still not empty? */
+    if(_pstWorker->u32Head != _pstWorker->u32Tail)
+    {
+      /* Steal? */
+      if(_bSteal != orxFALSE)
+      {
+        /* Takes oldest task */
+        pstResult = _pstWorker->apstTaskList[_pstWorker->u32Head & (_pstWorker->u32Size - 1)];
+        _pstWorker->u32Head++;
+      }
+      else
+      {
+        /* Takes newest task */
+        _pstWorker->u32Tail--;
+        pstResult = _pstWorker->apstTaskList[_pstWorker->u32Tail & (_pstWorker->u32Size - 1)];
+      }
+    }
+
+    /* Signals worker's semaphore */
+    orxThread_SignalSemaphore(_pstWorker->pstSemaphore);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+static orxTHREAD_TASK *orxFASTCALL orxThread_GetTask(orxTHREAD_WORKER *_pstWorker)
+{
+  orxTHREAD_TASK *pstResult;
+
+  /* Gets task from own queue */
+  pstResult = orxThread_PopTask(_pstWorker, orxFALSE);
+
+  /* None and ordered task available? */
+  if((pstResult == orxNULL)
+  && (sstThread.pstFirstOrderedTask != orxNULL)
+  && (sstThread.bOrderedTaskRunning == orxFALSE))
+  {
+    /* Waits for task semaphore */
+    orxThread_WaitSemaphore(sstThread.pstTaskSemaphore);
+
+    /* Still available? */
+    if((sstThread.pstFirstOrderedTask != orxNULL)
+    && (sstThread.bOrderedTaskRunning == orxFALSE))
+    {
+      /* Takes it */
+      pstResult                       = sstThread.pstFirstOrderedTask;
+      sstThread.pstFirstOrderedTask   = pstResult->pstNextOrdered;
+      sstThread.bOrderedTaskRunning   = orxTRUE;
+      if(sstThread.pstFirstOrderedTask == orxNULL)
+      {
+        sstThread.pstLastOrderedTask  = orxNULL;
+      }
+    }
+
+    /* Signals task semaphore */
+    orxThread_SignalSemaphore(sstThread.pstTaskSemaphore);
+  }
+
+  /* Still none? */
+  if(pstResult == orxNULL)
+  {
+    orxU32 u32Index, i;
+
+    /* Gets worker index */
+    u32Index = (orxU32)(_pstWorker - sstThread.astWorkerList);
+
+    /* For all other workers */
+    for(i = 1; (i < sstThread.u32WorkerNumber) && (pstResult == orxNULL); i++)
+    {
+      /* Steals from it */
+      pstResult = orxThread_PopTask(&(sstThread.astWorkerList[(u32Index + i) % sstThread.u32WorkerNumber]), orxTRUE);
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+static void orxFASTCALL orxThread_ExecuteTask(orxTHREAD_TASK *_pstTask)
+{
+  /* Runs it */
+  _pstTask->eResult = (_pstTask->pfnRun != orxNULL) ? _pstTask->pfnRun(_pstTask->pContext) : orxSTATUS_SUCCESS;
+
+  /* Detached? */
+  if(orxFLAG_TEST(_pstTask->u32Flags, orxTHREAD_KU32_TASK_FLAG_DETACHED))
+  {
+    /* Waits for task semaphore */
+    orxThread_WaitSemaphore(sstThread.pstTaskSemaphore);
+
+    /* Frees task */
+    _pstTask->pstNext     = sstThread.pstFreeTask;
+    sstThread.pstFreeTask = _pstTask;
+
+    /* Signals task semaphore */
+    orxThread_SignalSemaphore(sstThread.pstTaskSemaphore);
+  }
+  else
+  {
+    orxBOOL bOrdered;
+
+    /* Is ordered? */
+    bOrdered = orxFLAG_TEST(_pstTask->u32Flags, orxTHREAD_KU32_TASK_FLAG_ORDERED) ? orxTRUE : orxFALSE;
+
+    /* Updates its status */
+    orxMEMORY_BARRIER();
+    orxFLAG_SET(_pstTask->u32Flags, orxTHREAD_KU32_TASK_FLAG_DONE, orxTHREAD_KU32_TASK_FLAG_NONE);
+
+    /* Was ordered? */
+    if(bOrdered != orxFALSE)
+    {
+      /* Lets the next ordered task run */
+      orxMEMORY_BARRIER();
+      sstThread.bOrderedTaskRunning = orxFALSE;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxThread_NotifyTask(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  orxTHREAD_TASK *pstTask;
+
+  /* For all tasks, in submission order */
+  do
+  {
+    /* Waits for task semaphore */
+    orxThread_WaitSemaphore(sstThread.pstTaskSemaphore);
+
+    /* Gets first task */
+    pstTask = sstThread.pstFirstTask;
+
+    /* Is done? */
+    if((pstTask != orxNULL) && (orxFLAG_TEST(pstTask->u32Flags, orxTHREAD_KU32_TASK_FLAG_DONE)))
+    {
+      /* Removes it from list */
+      sstThread.pstFirstTask = pstTask->pstNext;
+      if(sstThread.pstFirstTask == orxNULL)
+      {
+        sstThread.pstLastTask = orxNULL;
+      }
+    }
+    else
+    {
+      /* Stops */
+      pstTask = orxNULL;
+    }
+
+    /* Signals task semaphore */
+    orxThread_SignalSemaphore(sstThread.pstTaskSemaphore);
+
+    /* Valid? */
+    if(pstTask != orxNULL)
+    {
+      /* Succeeded? */
+      if(pstTask->eResult != orxSTATUS_FAILURE)
+      {
+        /* Has THEN callback? */
+        if(pstTask->pfnThen != orxNULL)
+        {
+          /* Calls it */
+          pstTask->pfnThen(pstTask->pContext);
+        }
+      }
+      else
+      {
+        /* Has ELSE callback? */
+        if(pstTask->pfnElse != orxNULL)
+        {
+          /* Calls it */
+          pstTask->pfnElse(pstTask->pContext);
+        }
+      }
+
+      /* Waits for task semaphore */
+      orxThread_WaitSemaphore(sstThread.pstTaskSemaphore);
+
+      /* Frees task */
+      pstTask->pstNext      = sstThread.pstFreeTask;
+      sstThread.pstFreeTask = pstTask;
+
+      /* Updates task counter */
+      sstThread.u32TaskCounter--;
+
+      /* Signals task semaphore */
+      orxThread_SignalSemaphore(sstThread.pstTaskSemaphore);
+    }
+  } while(pstTask != orxNULL);
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxThread_Work(void *_pContext)
+{
+  orxTHREAD_WORKER *pstWorker;
+  orxTHREAD_TASK   *pstTask;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* Gets worker */
+  pstWorker = (orxTHREAD_WORKER *)_pContext;
+
+  /* Waits for worker semaphore */
+  orxThread_WaitSemaphore(sstThread.pstWorkerSemaphore);
+
+  /* Should stop? */
+  if(orxFLAG_TEST(sstThread.astThreadInfoList[pstWorker->u32ThreadID].u32Flags, orxTHREAD_KU32_INFO_FLAG_STOP))
+  {
+    /* Passes the wake up along to the other workers */
+    orxThread_SignalSemaphore(sstThread.pstWorkerSemaphore);
+  }
+  else
+  {
+    /* While there are pending tasks */
+    while((pstTask = orxThread_GetTask(pstWorker)) != orxNULL)
+    {
+      /* More tasks queued? */
+      if(orxThread_HasQueuedTask() != orxFALSE)
+      {
+        /* Wakes up another worker */
+        orxThread_SignalSemaphore(sstThread.pstWorkerSemaphore);
+      }
+
+      /* Executes it */
+      orxThread_ExecuteTask(pstTask);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL orxThread_StartWorkers()
+{
+  orxU32    u32WorkerNumber, i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Gets default worker number */
+  u32WorkerNumber = orxThread_GetCoreNumber();
+
+  /* Is config module initialized? */
+  if(orxModule_IsInitialized(orxMODULE_ID_CONFIG) != orxFALSE)
+  {
+    /* Pushes config section */
+    orxConfig_PushSection(orxTHREAD_KZ_CONFIG_SECTION);
+
+    /* Has worker number? */
+    if(orxConfig_HasValue(orxTHREAD_KZ_CONFIG_WORKER_NUMBER) != orxFALSE)
+    {
+      /* Gets it */
+      u32WorkerNumber = orxConfig_GetU32(orxTHREAD_KZ_CONFIG_WORKER_NUMBER);
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+  }
+
+  /* Clamps it */
+  u32WorkerNumber = orxCLAMP(u32WorkerNumber, 1, orxTHREAD_KU32_MAX_WORKER_NUMBER);
+
+  /* For all workers */
+  for(i = 0; i < u32WorkerNumber; i++)
+  {
+    orxTHREAD_WORKER *pstWorker;
+
+    /* Gets it */
+    pstWorker = &(sstThread.astWorkerList[i]);
+
+    /* Creates its semaphore and queue */
+    pstWorker->pstSemaphore = orxThread_CreateSemaphore(1);
+    pstWorker->apstTaskList = (orxTHREAD_TASK **)orxMemory_Allocate(orxTHREAD_KU32_WORKER_QUEUE_SIZE * sizeof(orxTHREAD_TASK *), orxMEMORY_TYPE_SYSTEM);
+    pstWorker->u32Size      = orxTHREAD_KU32_WORKER_QUEUE_SIZE;
+    pstWorker->u32Head      =
+    pstWorker->u32Tail      = 0;
+
+    /* Success? */
+    if((pstWorker->pstSemaphore != orxNULL) && (pstWorker->apstTaskList != orxNULL))
+    {
+      /* Starts its thread */
+      pstWorker->u32ThreadID = orxThread_Start(orxThread_Work, orxTHREAD_KZ_THREAD_NAME_WORKER, pstWorker);
+    }
+    else
+    {
+      /* Invalidates it */
+      pstWorker->u32ThreadID = orxU32_UNDEFINED;
+    }
+
+    /* Failure? */
+    if(pstWorker->u32ThreadID == orxU32_UNDEFINED)
+    {
+      /* Deletes its semaphore and queue */
+      if(pstWorker->pstSemaphore != orxNULL)
+      {
+        orxThread_DeleteSemaphore(pstWorker->pstSemaphore);
+        pstWorker->pstSemaphore = orxNULL;
+      }
+      if(pstWorker->apstTaskList != orxNULL)
+      {
+        orxMemory_Free(pstWorker->apstTaskList);
+        pstWorker->apstTaskList = orxNULL;
+      }
+
+      /* Stops */
+      break;
+    }
+  }
+
+  /* Stores worker number */
+  orxMEMORY_BARRIER();
+  sstThread.u32WorkerNumber = i;
+
+  /* No worker? */
+  if(i == 0)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't start internal worker thread.");
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL orxThread_Register()
+{
+  orxSTATUS eResult;
+
+  /* Is notify callback not registered? */
+  if(!orxFLAG_TEST(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_REGISTERED))
+  {
+    /* Are we on main thread, is clock module initialized and did we register callback? */
+    if((orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
+    && (orxModule_IsInitialized(orxMODULE_ID_CLOCK) != orxFALSE)
+    && (orxThread_StartWorkers() != orxSTATUS_FAILURE)
+    && (orxClock_Register(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxThread_NotifyTask, orxNULL, orxMODULE_ID_RESOURCE, orxCLOCK_PRIORITY_LOWEST) != orxSTATUS_FAILURE))
+    {
+      /* Updates status */
+      orxFLAG_SET(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_REGISTERED, orxTHREAD_KU32_STATIC_FLAG_NONE);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL orxThread_AddTask(const orxTHREAD_FUNCTION _pfnRun, const orxTHREAD_FUNCTION _pfnThen, const orxTHREAD_FUNCTION _pfnElse, void *_pContext, orxU32 _u32Flags)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
 
-/** Static data
- */
-static orxTHREAD_STATIC sstThread;
+  /* Registers */
+  eResult = orxThread_Register();
 
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    orxTHREAD_TASK   *pstTask;
+    orxTHREAD_WORKER *pstWorker = orxNULL;
 
-/***************************************************************************
- * Private functions                                                       *
- ***************************************************************************/
+    /* Waits for task semaphore */
+    orxThread_WaitSemaphore(sstThread.pstTaskSemaphore);
 
-#ifdef __orxWINDOWS__
-static unsigned int WINAPI orxThread_Execute(void *_pContext)
-#else /* __orxWINDOWS__ */
-static void *orxThread_Execute(void *_pContext)
-#endif /* __orxWINDOWS__ */
-{
-  volatile orxTHREAD_INFO  *pstInfo;
-  orxSTATUS                 eResult;
+    /* No free task left? */
+    if(sstThread.pstFreeTask == orxNULL)
+    {
+      orxTHREAD_TASK_CHUNK *pstChunk;
 
-  /* Gets thread's info */
-  pstInfo = (orxTHREAD_INFO *)_pContext;
+      /* Allocates a new chunk */
+      pstChunk = (orxTHREAD_TASK_CHUNK *)orxMemory_Allocate(sizeof(orxTHREAD_TASK_CHUNK), orxMEMORY_TYPE_SYSTEM);
 
-#ifdef __orxWINDOWS__
+      /* Success? */
+      if(pstChunk != orxNULL)
+      {
+        orxU32 i;
 
-  /* Stores thread ID */
-  pstInfo->u32ThreadID = GetCurrentThreadId();
-  orxMEMORY_BARRIER();
+        /* Stores it */
+        pstChunk->pstNext       = sstThread.pstTaskChunk;
+        sstThread.pstTaskChunk  = pstChunk;
 
-#endif /* __orxWINDOWS__ */
+        /* For all its tasks */
+        for(i = 0; i < orxTHREAD_KU32_TASK_CHUNK_SIZE; i++)
+        {
+          /* Adds it to free list */
+          pstChunk->astTaskList[i].pstNext  = sstThread.pstFreeTask;
+          sstThread.pstFreeTask             = &(pstChunk->astTaskList[i]);
+        }
+      }
+    }
 
-  /* Spins until ready */
-  while(pstInfo->hThread == 0)
-    ;
+    /* Gets free task */
+    pstTask = sstThread.pstFreeTask;
 
-#if defined(__orxANDROID__) || defined(__orxANDROID_NATIVE__)
+    /* Valid? */
+    if(pstTask != orxNULL)
+    {
+      /* Removes it from free list */
+      sstThread.pstFreeTask = pstTask->pstNext;
+
+      /* Inits it */
+      pstTask->pfnRun         = _pfnRun;
+      pstTask->pfnThen        = _pfnThen;
+      pstTask->pfnElse        = _pfnElse;
+      pstTask->pContext       = _pContext;
+      pstTask->pstNext        = orxNULL;
+      pstTask->pstNextOrdered = orxNULL;
+      pstTask->eResult        = orxSTATUS_SUCCESS;
+      pstTask->u32Flags       = _u32Flags;
+
+      /* Not detached? */
+      if(!orxFLAG_TEST(_u32Flags, orxTHREAD_KU32_TASK_FLAG_DETACHED))
+      {
+        /* Adds it at the end of the completion list */
+        if(sstThread.pstLastTask != orxNULL)
+        {
+          sstThread.pstLastTask->pstNext = pstTask;
+        }
+        else
+        {
+          sstThread.pstFirstTask = pstTask;
+        }
+        sstThread.pstLastTask = pstTask;
 
-  /* Notifies the Java framework */
-  orxAndroid_JNI_SetupThread();
+        /* Updates task counter */
+        sstThread.u32TaskCounter++;
+      }
 
-#endif /* __orxANDROID__ || __orxANDROID_NATIVE__ */
+      /* Ordered? */
+      if(orxFLAG_TEST(_u32Flags, orxTHREAD_KU32_TASK_FLAG_ORDERED))
+      {
+        /* Adds it at the end of the ordered queue */
+        orxMEMORY_BARRIER();
+        if(sstThread.pstLastOrderedTask != orxNULL)
+        {
+          sstThread.pstLastOrderedTask->pstNextOrdered = pstTask;
+        }
+        else
+        {
+          sstThread.pstFirstOrderedTask = pstTask;
+        }
+        sstThread.pstLastOrderedTask = pstTask;
+      }
+      else
+      {
+        /* Gets current worker */
+        pstWorker = orxThread_GetCurrentWorker();
 
-  do
-  {
-    /* Runs thread function */
-    eResult = pstInfo->pfnRun(pstInfo->pContext);
+        /* Not called from a worker? */
+        if(pstWorker == orxNULL)
+        {
+          /* Picks next worker */
+          pstWorker = &(sstThread.astWorkerList[sstThread.u32NextWorker]);
+          sstThread.u32NextWorker = (sstThread.u32NextWorker + 1) % sstThread.u32WorkerNumber;
+        }
+      }
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
 
-    /* Yields */
-    orxThread_Yield();
+    /* Signals task semaphore */
+    orxThread_SignalSemaphore(sstThread.pstTaskSemaphore);
 
-    /* Waits for its enable semaphore */
-    orxThread_WaitSemaphore(pstInfo->pstEnableSemaphore);
+    /* Has worker? */
+    if(pstWorker != orxNULL)
+    {
+      /* Adds task to its queue */
+      if(orxThread_PushTask(pstWorker, pstTask) == orxSTATUS_FAILURE)
+      {
+        /* Executes it directly */
+        orxThread_ExecuteTask(pstTask);
+      }
+    }
 
-    /* Signals its enable semaphore */
-    orxThread_SignalSemaphore(pstInfo->pstEnableSemaphore);
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Signals worker semaphore */
+      orxThread_SignalSemaphore(sstThread.pstWorkerSemaphore);
+    }
   }
-  /* While stop hasn't been requested */
-  while((eResult != orxSTATUS_FAILURE) && !orxFLAG_TEST(pstInfo->u32Flags, orxTHREAD_KU32_INFO_FLAG_STOP));
 
   /* Done! */
-  return 0;
+  return eResult;
 }
 
-static void orxFASTCALL orxThread_NotifyTask(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+
+static void orxFASTCALL orxThread_ProcessParallelJob(orxTHREAD_PARALLEL_JOB *_pstJob)
 {
-  /* While there are processed tasks */
-  while(sstThread.u32TaskOutIndex != sstThread.u32TaskProcessIndex)
+  orxU32 u32Chunk;
+
+  /* While there are chunks left */
+  while((u32Chunk = orxTHREAD_ATOMIC_INCREMENT(_pstJob->u32ChunkCounter) - 1) < _pstJob->u32ChunkNumber)
   {
-    volatile orxTHREAD_TASK *pstTask;
+    orxU32 u32Start, u32End;
 
-    /* Gets Task */
-    pstTask = &(sstThread.astTaskList[sstThread.u32TaskOutIndex]);
+    /* Gets its range */
+    u32Start  = _pstJob->u32Start + u32Chunk * _pstJob->u32Grain;
+    u32End    = ((_pstJob->u32End - u32Start) > _pstJob->u32Grain) ? u32Start + _pstJob->u32Grain : _pstJob->u32End;
 
-    /* Succeeded? */
-    if(pstTask->eResult != orxSTATUS_FAILURE)
-    {
-      /* Has THEN callback? */
-      if(pstTask->pfnThen != orxNULL)
-      {
-        /* Calls it */
-        pstTask->pfnThen(pstTask->pContext);
-      }
-    }
-    else
+    /* Runs it */
+    if(_pstJob->pfnRun(u32Start, u32End, _pstJob->pContext) == orxSTATUS_FAILURE)
     {
-      /* Has ELSE callback? */
-      if(pstTask->pfnElse != orxNULL)
-      {
-        /* Calls it */
-        pstTask->pfnElse(pstTask->pContext);
-      }
+      /* Updates result */
+      _pstJob->eResult = orxSTATUS_FAILURE;
     }
-
-    /* Updates task out index */
-    orxMEMORY_BARRIER();
-    sstThread.u32TaskOutIndex = (sstThread.u32TaskOutIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
   }
 
   /* Done! */
   return;
 }
 
-static orxSTATUS orxFASTCALL orxThread_Work(void *_pContext)
+static orxSTATUS orxFASTCALL orxThread_RunParallelJob(void *_pContext)
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxTHREAD_PARALLEL_JOB *pstJob;
 
-  /* Waits for worker semaphore */
-  orxThread_WaitSemaphore(sstThread.pstWorkerSemaphore);
+  /* Gets job */
+  pstJob = (orxTHREAD_PARALLEL_JOB *)_pContext;
 
-  /* While there are pending requests */
-  while(sstThread.u32TaskProcessIndex != sstThread.u32TaskInIndex)
-  {
-    volatile orxTHREAD_TASK *pstTask;
+  /* Processes it */
+  orxThread_ProcessParallelJob(pstJob);
 
-    /* Gets task */
-    pstTask = &(sstThread.astTaskList[sstThread.u32TaskProcessIndex]);
+  /* Updates helper counter (job mustn't be accessed past this point) */
+  orxMEMORY_BARRIER();
+  orxTHREAD_ATOMIC_DECREMENT(pstJob->u32HelperCounter);
 
-    /* Runs it */
-    pstTask->eResult = (pstTask->pfnRun != orxNULL) ? pstTask->pfnRun(pstTask->pContext) : orxSTATUS_SUCCESS;
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
 
-    /* Updates task process index */
-    orxMEMORY_BARRIER();
-    sstThread.u32TaskProcessIndex = (sstThread.u32TaskProcessIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+static orxBOOL orxFASTCALL orxThread_HelpTask()
+{
+  orxTHREAD_TASK *pstTask = orxNULL;
+  orxU32          i;
+  orxBOOL         bResult = orxFALSE;
+
+  /* For all workers */
+  for(i = 0; (i < sstThread.u32WorkerNumber) && (pstTask == orxNULL); i++)
+  {
+    /* Steals from it */
+    pstTask = orxThread_PopTask(&(sstThread.astWorkerList[i]), orxTRUE);
+  }
+
+  /* Found? */
+  if(pstTask != orxNULL)
+  {
+    /* Executes it */
+    orxThread_ExecuteTask(pstTask);
+
+    /* Updates result */
+    bResult = orxTRUE;
   }
 
   /* Done! */
-  return eResult;
+  return bResult;
 }
 
 
@@ -302,7 +1030,7 @@ orxSTATUS orxFASTCALL orxThread_Init()
   orxSTATUS eResult = orxSTATUS_FAILURE;
 
   /* Checks */
-  orxASSERT(orxMath_IsPowerOfTwo(orxTHREAD_KU32_TASK_LIST_SIZE) != orxFALSE);
+  orxASSERT(orxMath_IsPowerOfTwo(orxTHREAD_KU32_WORKER_QUEUE_SIZE) != orxFALSE);
 
   /* Was not already initialized? */
   if(!(sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY))
@@ -358,38 +1086,11 @@ orxSTATUS orxFASTCALL orxThread_Init()
 
 #endif /* __orxWINDOWS__ */
 
-      /* Waits for worker semaphore */
+      /* Waits for worker semaphore (workers will be started along with the first task) */
       orxThread_WaitSemaphore(sstThread.pstWorkerSemaphore);
 
-      /* Creates worker thread */
-      sstThread.u32WorkerID = orxThread_Start(orxThread_Work, orxTHREAD_KZ_THREAD_NAME_WORKER, orxNULL);
-
-      /* Success? */
-      if(sstThread.u32WorkerID != orxU32_UNDEFINED)
-      {
-        /* Updates result */
-        eResult = orxSTATUS_SUCCESS;
-      }
-      else
-      {
-        /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't start internal worker thread.");
-
-        /* Deletes semaphores */
-        orxThread_DeleteSemaphore(sstThread.pstThreadSemaphore);
-        orxThread_DeleteSemaphore(sstThread.pstTaskSemaphore);
-        orxThread_DeleteSemaphore(sstThread.pstWorkerSemaphore);
-
-#ifdef __orxWINDOWS__
-
-        /* Asks for small time slices */
-        timeEndPeriod(1);
-
-#endif /* __orxWINDOWS__ */
-
-        /* Updates status */
-        sstThread.u32Flags &= ~orxTHREAD_KU32_STATIC_FLAG_READY;
-      }
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
     }
     else
     {
@@ -426,8 +1127,15 @@ void orxFASTCALL orxThread_Exit()
   /* Checks */
   if((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY)
   {
-    /* Updates worker thread stop flag */
-    orxFLAG_SET(sstThread.astThreadInfoList[sstThread.u32WorkerID].u32Flags, orxTHREAD_KU32_INFO_FLAG_STOP, orxTHREAD_KU32_INFO_FLAG_NONE);
+    orxTHREAD_TASK_CHUNK *pstChunk;
+    orxU32                i;
+
+    /* For all workers */
+    for(i = 0; i < sstThread.u32WorkerNumber; i++)
+    {
+      /* Updates worker thread stop flag */
+      orxFLAG_SET(sstThread.astThreadInfoList[sstThread.astWorkerList[i].u32ThreadID].u32Flags, orxTHREAD_KU32_INFO_FLAG_STOP, orxTHREAD_KU32_INFO_FLAG_NONE);
+    }
     orxMEMORY_BARRIER();
 
     /* Re-enables all threads */
@@ -439,6 +1147,29 @@ void orxFASTCALL orxThread_Exit()
     /* Joins all remaining threads */
     orxThread_JoinAll();
 
+    /* For all workers */
+    for(i = 0; i < sstThread.u32WorkerNumber; i++)
+    {
+      /* Deletes its semaphore and queue */
+      orxThread_DeleteSemaphore(sstThread.astWorkerList[i].pstSemaphore);
+      orxMemory_Free(sstThread.astWorkerList[i].apstTaskList);
+    }
+
+    /* For all task chunks */
+    for(pstChunk = sstThread.pstTaskChunk; pstChunk != orxNULL;)
+    {
+      orxTHREAD_TASK_CHUNK *pstNextChunk;
+
+      /* Gets next chunk */
+      pstNextChunk = pstChunk->pstNext;
+
+      /* Frees it */
+      orxMemory_Free(pstChunk);
+
+      /* Goes to next chunk */
+      pstChunk = pstNextChunk;
+    }
+
 #ifdef __orxWINDOWS__
 
     /* Resets time slices */
@@ -1001,7 +1732,7 @@ orxSTATUS orxFASTCALL orxThread_SignalSemaphore(orxTHREAD_SEMAPHORE *_pstSemapho
 }
 
 /** Runs an asynchronous task and optional follow-ups
- * @param[in]   _pfnRun                               Asynchronous task to run, executed on a different thread dedicated to tasks
+ * @param[in]   _pfnRun                               Asynchronous task to run, executed on a worker thread, after all the previously submitted ordered tasks, if orxNULL defaults to an empty task that always succeed
  * @param[in]   _pfnThen                              Executed (on the main thread) if Run does *not* return orxSTATUS_FAILURE, can be orxNULL
  * @param[in]   _pfnElse                              Executed (on the main thread) if Run returns orxSTATUS_FAILURE, can be orxNULL
  * @param[in]   _pContext                             Context that will be transmitted to all the task functions
@@ -1014,73 +1745,29 @@ orxSTATUS orxFASTCALL orxThread_RunTask(const orxTHREAD_FUNCTION _pfnRun, const
   /* Checks */
   orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
 
-  /* Is notify callback not registered? */
-  if(!orxFLAG_TEST(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_REGISTERED))
-  {
-    /* Are we on main thread, is clock module initialized and did we register callback? */
-    if((orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
-    && (orxModule_IsInitialized(orxMODULE_ID_CLOCK) != orxFALSE)
-    && (orxClock_Register(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxThread_NotifyTask, orxNULL, orxMODULE_ID_RESOURCE, orxCLOCK_PRIORITY_LOWEST) != orxSTATUS_FAILURE))
-    {
-      /* Updates status */
-      orxFLAG_SET(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_REGISTERED, orxTHREAD_KU32_STATIC_FLAG_NONE);
-
-      /* Updates result */
-      eResult = orxSTATUS_SUCCESS;
-    }
-    else
-    {
-      /* Updates result */
-      eResult = orxSTATUS_FAILURE;
-    }
-  }
-  else
-  {
-    /* Updates result */
-    eResult = orxSTATUS_SUCCESS;
-  }
-
-  /* Valid? */
-  if(eResult != orxSTATUS_FAILURE)
-  {
-    volatile orxTHREAD_TASK  *pstTask;
-    orxU32                    u32NextTaskIndex;
-
-    /* Waits for task semaphore */
-    orxThread_WaitSemaphore(sstThread.pstTaskSemaphore);
-
-    /* Gets next task index */
-    u32NextTaskIndex = (sstThread.u32TaskInIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
-
-    /* Waits for a free slot */
-    while(u32NextTaskIndex == sstThread.u32TaskOutIndex)
-    {
-      /* On main thread? */
-      if(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
-      {
-        /* Manually pumps some task notifications */
-        orxThread_NotifyTask(orxNULL, orxNULL);
-      }
-    }
-    /* Gets current task */
-    pstTask = &(sstThread.astTaskList[sstThread.u32TaskInIndex]);
+  /* Adds ordered task */
+  eResult = orxThread_AddTask(_pfnRun, _pfnThen, _pfnElse, _pContext, orxTHREAD_KU32_TASK_FLAG_ORDERED);
 
-    /* Inits it */
-    pstTask->pfnRun   = _pfnRun;
-    pstTask->pfnThen  = _pfnThen;
-    pstTask->pfnElse  = _pfnElse;
-    pstTask->pContext = _pContext;
+  /* Done! */
+  return eResult;
+}
 
-    /* Commits Task */
-    orxMEMORY_BARRIER();
-    sstThread.u32TaskInIndex = u32NextTaskIndex;
+/** Runs an asynchronous task that can be executed concurrently with any other task, and optional follow-ups
+ * @param[in]   _pfnRun                               Asynchronous task to run, executed on any worker thread, if orxNULL defaults to an empty task that always succeed
+ * @param[in]   _pfnThen                              Executed (on the main thread) if Run does *not* return orxSTATUS_FAILURE, can be orxNULL
+ * @param[in]   _pfnElse                              Executed (on the main thread) if Run returns orxSTATUS_FAILURE, can be orxNULL
+ * @param[in]   _pContext                             Context that will be transmitted to all the task functions
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxThread_RunParallelTask(const orxTHREAD_FUNCTION _pfnRun, const orxTHREAD_FUNCTION _pfnThen, const orxTHREAD_FUNCTION _pfnElse, void *_pContext)
+{
+  orxSTATUS eResult;
 
-    /* Signals task semaphore */
-    orxThread_SignalSemaphore(sstThread.pstTaskSemaphore);
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
 
-    /* Signals worker semaphore */
-    orxThread_SignalSemaphore(sstThread.pstWorkerSemaphore);
-  }
+  /* Adds task */
+  eResult = orxThread_AddTask(_pfnRun, _pfnThen, _pfnElse, _pContext, orxTHREAD_KU32_TASK_FLAG_NONE);
 
   /* Done! */
   return eResult;
@@ -1091,7 +1778,7 @@ orxSTATUS orxFASTCALL orxThread_RunTask(const orxTHREAD_FUNCTION _pfnRun, const
  */
 orxU32 orxFASTCALL orxThread_GetTaskCounter()
 {
-  orxU32 u32TaskInIndex, u32TaskOutIndex, u32Result;
+  orxU32 u32Result;
 
   /* Checks */
   orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
@@ -1103,13 +1790,96 @@ orxU32 orxFASTCALL orxThread_GetTaskCounter()
     orxThread_NotifyTask(orxNULL, orxNULL);
   }
 
-  /* Gets indices */
-  u32TaskInIndex  = sstThread.u32TaskInIndex;
-  u32TaskOutIndex = sstThread.u32TaskOutIndex;
-
   /* Updates result */
-  u32Result = (u32TaskInIndex >= u32TaskOutIndex) ? u32TaskInIndex - u32TaskOutIndex : u32TaskInIndex + orxTHREAD_KU32_TASK_LIST_SIZE - u32TaskOutIndex;
+  u32Result = sstThread.u32TaskCounter;
 
   /* Done! */
   return u32Result;
 }
+
+/** Runs a function over a range, split in chunks that are processed in parallel by the worker threads and the calling thread, and waits for their completion
+ * @param[in]   _u32Start                             Start of the range (inclusive)
+ * @param[in]   _u32End                               End of the range (exclusive)
+ * @param[in]   _u32Grain                             Number of items per chunk, 0 for automatic
+ * @param[in]   _pfnRun                               Function to run on each chunk
+ * @param[in]   _pContext                             Context that will be transmitted to the function when called
+ * @return      orxSTATUS_SUCCESS if all the chunks succeeded, orxSTATUS_FAILURE otherwise
+ */
+orxSTATUS orxFASTCALL orxThread_ParallelFor(orxU32 _u32Start, orxU32 _u32End, orxU32 _u32Grain, const orxTHREAD_PARALLEL_FUNCTION _pfnRun, void *_pContext)
+{
+  orxTHREAD_PARALLEL_JOB  stJob;
+  orxU32                  u32Count, i;
+  orxSTATUS               eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_u32Start <= _u32End);
+  orxASSERT(_pfnRun != orxNULL);
+
+  /* Gets item count */
+  u32Count = _u32End - _u32Start;
+
+  /* Not empty? */
+  if(u32Count != 0)
+  {
+    /* Inits job */
+    orxMemory_Zero(&stJob, sizeof(orxTHREAD_PARALLEL_JOB));
+    stJob.pfnRun    = _pfnRun;
+    stJob.pContext  = _pContext;
+    stJob.u32Start  = _u32Start;
+    stJob.u32End    = _u32End;
+    stJob.eResult   = orxSTATUS_SUCCESS;
+
+    /* Has workers? */
+    if(orxThread_Register() != orxSTATUS_FAILURE)
+    {
+      /* Gets grain */
+      stJob.u32Grain = (_u32Grain != 0) ? _u32Grain : orxMAX(u32Count / ((sstThread.u32WorkerNumber + 1) * orxTHREAD_KU32_PARALLEL_CHUNK_PER_THREAD), 1);
+
+      /* Gets chunk number */
+      stJob.u32ChunkNumber = (u32Count / stJob.u32Grain) + (((u32Count % stJob.u32Grain) != 0) ? 1 : 0);
+
+      /* Gets helper number */
+      stJob.u32HelperCounter = orxMIN(stJob.u32ChunkNumber - 1, sstThread.u32WorkerNumber);
+      orxMEMORY_BARRIER();
+
+      /* For all helpers */
+      for(i = stJob.u32HelperCounter; i != 0; i--)
+      {
+        /* Adds helper task */
+        if(orxThread_AddTask(orxThread_RunParallelJob, orxNULL, orxNULL, &stJob, orxTHREAD_KU32_TASK_FLAG_DETACHED) == orxSTATUS_FAILURE)
+        {
+          /* Updates helper counter */
+          orxTHREAD_ATOMIC_DECREMENT(stJob.u32HelperCounter);
+        }
+      }
+    }
+    else
+    {
+      /* Uses a single chunk */
+      stJob.u32Grain        = u32Count;
+      stJob.u32ChunkNumber  = 1;
+    }
+
+    /* Participates */
+    orxThread_ProcessParallelJob(&stJob);
+
+    /* While some helpers are still pending */
+    while(stJob.u32HelperCounter != 0)
+    {
+      /* Can't help with any queued task? */
+      if(orxThread_HelpTask() == orxFALSE)
+      {
+        /* Yields */
+        orxThread_Yield();
+      }
+    }
+    orxMEMORY_BARRIER();
+
+    /* Updates result */
+    eResult = stJob.eResult;
+  }
+
+  /* Done! */
+  return eResult;
+}
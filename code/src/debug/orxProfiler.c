@@ -35,6 +35,7 @@
 #include "memory/orxMemory.h"
 #include "core/orxSystem.h"
 #include "core/orxThread.h"
+#include "io/orxFile.h"
 #include "utils/orxString.h"
 
 
@@ -50,6 +51,7 @@
 #define orxPROFILER_KU32_STATIC_FLAG_READY        0x00000001
 #define orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS   0x10000000
 #define orxPROFILER_KU32_STATIC_FLAG_PAUSED       0x20000000
+#define orxPROFILER_KU32_STATIC_FLAG_TRACE        0x40000000
 
 #define orxPROFILER_KU32_STATIC_MASK_ALL          0xFFFFFFFF
 
@@ -68,10 +70,16 @@
 /** Misc defines
  */
 #define orxPROFILER_KU32_MAX_MARKER_NUMBER        (orxPROFILER_KU32_MASK_MARKER_ID + 1)
-#define orxPROFILER_KU32_SHIFT_MARKER_ID          7
-#define orxPROFILER_KU32_MASK_MARKER_ID           0x7F
+#define orxPROFILER_KU32_SHIFT_MARKER_ID          12
+#define orxPROFILER_KU32_MASK_MARKER_ID           0xFFF
+#define orxPROFILER_KU32_MARKER_PAGE_SIZE         (orxPROFILER_KU32_MASK_MARKER_PAGE + 1)
+#define orxPROFILER_KU32_MARKER_PAGE_NUMBER       (orxPROFILER_KU32_MAX_MARKER_NUMBER >> orxPROFILER_KU32_SHIFT_MARKER_PAGE)
+#define orxPROFILER_KU32_SHIFT_MARKER_PAGE        7
+#define orxPROFILER_KU32_MASK_MARKER_PAGE         0x7F
 #define orxPROFILER_KS32_MARKER_ID_ROOT           -2
 #define orxPROFILER_KU32_MARKER_DATA_NUMBER       orxTHREAD_KU32_MAX_THREAD_NUMBER
+#define orxPROFILER_KU32_TRACE_EVENT_NUMBER       65536
+#define orxPROFILER_KU32_TRACE_NAME_BUFFER_SIZE   256
 
 
 /***************************************************************************
@@ -109,13 +117,33 @@ typedef struct __orxPROFILER_MARKER_INFO_t
 
 } orxPROFILER_MARKER_INFO;
 
+/** Internal marker page structure
+ */
+typedef struct __orxPROFILER_MARKER_PAGE_t
+{
+  orxPROFILER_HISTORY_ENTRY aastHistory[orxPROFILER_KU32_HISTORY_LENGTH][orxPROFILER_KU32_MARKER_PAGE_SIZE];
+  orxPROFILER_MARKER_INFO astMarkerInfoList[orxPROFILER_KU32_MARKER_PAGE_SIZE];
+
+} orxPROFILER_MARKER_PAGE;
+
+/** Internal trace event structure
+ */
+typedef struct __orxPROFILER_TRACE_EVENT_t
+{
+  orxDOUBLE               dStartTime;
+  orxDOUBLE               dEndTime;
+  orxS32                  s32MarkerID;
+
+} orxPROFILER_TRACE_EVENT;
+
 /** Internal marker data structure
  */
 typedef struct __orxPROFILER_MARKER_DATA_t
 {
-  orxPROFILER_HISTORY_ENTRY aastHistory[orxPROFILER_KU32_HISTORY_LENGTH][orxPROFILER_KU32_MAX_MARKER_NUMBER];
+  orxPROFILER_MARKER_PAGE *apstPageList[orxPROFILER_KU32_MARKER_PAGE_NUMBER];
   orxDOUBLE               adTimeStampHistory[orxPROFILER_KU32_HISTORY_LENGTH];
-  orxPROFILER_MARKER_INFO astMarkerInfoList[orxPROFILER_KU32_MAX_MARKER_NUMBER];
+  orxPROFILER_TRACE_EVENT *astTraceEventList;
+  volatile orxU32         u32TraceEventCounter;
   orxS32                  s32MarkerCounter;
   orxS32                  s32CurrentMarker;
   orxU32                  u32MarkerPopToSkip;
@@ -136,7 +164,10 @@ typedef struct __orxPROFILER_STATIC_t
   orxU32                  u32QueryDataIndex;
   orxS32                  s32MarkerCounter;
   orxTHREAD_SEMAPHORE    *pstSemaphore;
-  orxPROFILER_MARKER      astMarkerList[orxPROFILER_KU32_MAX_MARKER_NUMBER];
+  orxPROFILER_MARKER     *apstMarkerPageList[orxPROFILER_KU32_MARKER_PAGE_NUMBER];
+  orxPROFILER_MARKER_INFO stUndefinedMarkerInfo;
+  orxDOUBLE               dTraceStartTime;
+  orxCHAR                 acNameBuffer[orxPROFILER_KU32_TRACE_NAME_BUFFER_SIZE];
   orxU32                  u32Flags;
 
   orxPROFILER_MARKER_DATA *apstMarkerDataList[orxPROFILER_KU32_MARKER_DATA_NUMBER];
@@ -170,8 +201,6 @@ static orxINLINE orxPROFILER_MARKER_DATA *orxProfiler_GetMarkerData(orxU32 _u32I
   /* Not yet created? */
   if((pstResult == orxNULL) && (_bReadOnly == orxFALSE))
   {
-    orxU32 i;
-
     /* Allocates it */
     pstResult = (orxPROFILER_MARKER_DATA *)orxMemory_Allocate(sizeof(orxPROFILER_MARKER_DATA), orxMEMORY_TYPE_DEBUG);
 
@@ -183,14 +212,6 @@ static orxINLINE orxPROFILER_MARKER_DATA *orxProfiler_GetMarkerData(orxU32 _u32I
     pstResult->adTimeStampHistory[pstResult->u32HistoryIndex] = orxSystem_GetTime();
     pstResult->s32CurrentMarker = orxPROFILER_KS32_MARKER_ID_ROOT;
 
-    /* Inits all marker info */
-    for(i = 0; i < orxPROFILER_KU32_MAX_MARKER_NUMBER; i++)
-    {
-      pstResult->astMarkerInfoList[i].dTimeStamp  = orxDOUBLE_0;
-      pstResult->astMarkerInfoList[i].s32ParentID = orxPROFILER_KS32_MARKER_ID_NONE;
-      pstResult->astMarkerInfoList[i].u32Flags    = orxPROFILER_KU32_FLAG_UNIQUE;
-    }
-
     /* Stores it */
     orxMEMORY_BARRIER();
     sstProfiler.apstMarkerDataList[_u32ID] = pstResult;
@@ -223,6 +244,154 @@ static orxINLINE orxPROFILER_MARKER_DATA *orxProfiler_GetCurrentMarkerData()
   return pstResult;
 }
 
+static orxINLINE orxPROFILER_MARKER *orxProfiler_GetMarker(orxS32 _s32ID)
+{
+  /* Checks */
+  orxASSERT((_s32ID >= 0) && (_s32ID < sstProfiler.s32MarkerCounter));
+
+  /* Done! */
+  return &(sstProfiler.apstMarkerPageList[_s32ID >> orxPROFILER_KU32_SHIFT_MARKER_PAGE][_s32ID & orxPROFILER_KU32_MASK_MARKER_PAGE]);
+}
+
+static orxINLINE orxPROFILER_MARKER_PAGE *orxProfiler_GetMarkerPage(orxPROFILER_MARKER_DATA *_pstData, orxS32 _s32ID, orxBOOL _bReadOnly)
+{
+  orxPROFILER_MARKER_PAGE *pstResult;
+  orxU32                   u32PageIndex;
+
+  /* Checks */
+  orxASSERT((_s32ID >= 0) && (_s32ID < orxPROFILER_KU32_MAX_MARKER_NUMBER));
+
+  /* Gets page index */
+  u32PageIndex = (orxU32)_s32ID >> orxPROFILER_KU32_SHIFT_MARKER_PAGE;
+
+  /* Gets page */
+  pstResult = _pstData->apstPageList[u32PageIndex];
+
+  /* Not yet created? */
+  if((pstResult == orxNULL) && (_bReadOnly == orxFALSE))
+  {
+    orxU32 i;
+
+    /* Allocates it */
+    pstResult = (orxPROFILER_MARKER_PAGE *)orxMemory_Allocate(sizeof(orxPROFILER_MARKER_PAGE), orxMEMORY_TYPE_DEBUG);
+
+    /* Checks */
+    orxASSERT(pstResult != orxNULL);
+
+    /* Inits it */
+    orxMemory_Zero(pstResult, sizeof(orxPROFILER_MARKER_PAGE));
+
+    /* Inits all its marker info */
+    for(i = 0; i < orxPROFILER_KU32_MARKER_PAGE_SIZE; i++)
+    {
+      pstResult->astMarkerInfoList[i].dTimeStamp  = orxDOUBLE_0;
+      pstResult->astMarkerInfoList[i].s32ParentID = orxPROFILER_KS32_MARKER_ID_NONE;
+      pstResult->astMarkerInfoList[i].u32Flags    = orxPROFILER_KU32_FLAG_UNIQUE;
+    }
+
+    /* Stores it */
+    orxMEMORY_BARRIER();
+    _pstData->apstPageList[u32PageIndex] = pstResult;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+static orxINLINE orxPROFILER_MARKER_INFO *orxProfiler_GetMarkerInfo(orxPROFILER_MARKER_DATA *_pstData, orxS32 _s32ID)
+{
+  orxPROFILER_MARKER_PAGE *pstPage;
+  orxPROFILER_MARKER_INFO *pstResult;
+
+  /* Gets its page */
+  pstPage = orxProfiler_GetMarkerPage(_pstData, _s32ID, orxTRUE);
+
+  /* Updates result (markers without a page have never been pushed on this thread) */
+  pstResult = (pstPage != orxNULL) ? &(pstPage->astMarkerInfoList[_s32ID & orxPROFILER_KU32_MASK_MARKER_PAGE]) : &(sstProfiler.stUndefinedMarkerInfo);
+
+  /* Done! */
+  return pstResult;
+}
+
+static orxINLINE orxPROFILER_HISTORY_ENTRY *orxProfiler_GetHistoryEntry(orxPROFILER_MARKER_DATA *_pstData, orxU32 _u32Index, orxS32 _s32ID)
+{
+  orxPROFILER_MARKER_PAGE *pstPage;
+
+  /* Gets its page */
+  pstPage = orxProfiler_GetMarkerPage(_pstData, _s32ID, orxTRUE);
+
+  /* Checks */
+  orxASSERT(pstPage != orxNULL);
+
+  /* Done! */
+  return &(pstPage->aastHistory[_u32Index][_s32ID & orxPROFILER_KU32_MASK_MARKER_PAGE]);
+}
+
+static orxINLINE void orxProfiler_AddTraceEvent(orxPROFILER_MARKER_DATA *_pstData, orxS32 _s32ID, orxDOUBLE _dStartTime, orxDOUBLE _dEndTime)
+{
+  /* No event buffer yet? */
+  if(_pstData->astTraceEventList == orxNULL)
+  {
+    /* Allocates it */
+    _pstData->astTraceEventList = (orxPROFILER_TRACE_EVENT *)orxMemory_Allocate(orxPROFILER_KU32_TRACE_EVENT_NUMBER * sizeof(orxPROFILER_TRACE_EVENT), orxMEMORY_TYPE_DEBUG);
+  }
+
+  /* Valid? */
+  if(_pstData->astTraceEventList != orxNULL)
+  {
+    orxPROFILER_TRACE_EVENT  *pstEvent;
+    orxU32                    u32Counter;
+
+    /* Gets next event (only this thread writes to its buffer, readers use the counter to detect overwrites) */
+    u32Counter  = _pstData->u32TraceEventCounter;
+    pstEvent    = &(_pstData->astTraceEventList[u32Counter & (orxPROFILER_KU32_TRACE_EVENT_NUMBER - 1)]);
+
+    /* Inits it */
+    pstEvent->dStartTime  = _dStartTime;
+    pstEvent->dEndTime    = _dEndTime;
+    pstEvent->s32MarkerID = _s32ID;
+
+    /* Publishes it */
+    orxMEMORY_BARRIER();
+    _pstData->u32TraceEventCounter = u32Counter + 1;
+  }
+
+  /* Done! */
+  return;
+}
+
+static const orxSTRING orxFASTCALL orxProfiler_EscapeTraceName(const orxSTRING _zName)
+{
+  const orxCHAR  *pcSrc;
+  orxCHAR        *pcDst;
+
+  /* For all characters */
+  for(pcSrc = _zName, pcDst = sstProfiler.acNameBuffer;
+      (*pcSrc != orxCHAR_NULL) && (pcDst - sstProfiler.acNameBuffer < orxPROFILER_KU32_TRACE_NAME_BUFFER_SIZE - 2);
+      pcSrc++)
+  {
+    /* Needs escaping? */
+    if((*pcSrc == '"') || (*pcSrc == '\\'))
+    {
+      /* Escapes it */
+      *pcDst++ = '\\';
+      *pcDst++ = *pcSrc;
+    }
+    /* Printable? */
+    else if((orxU8)*pcSrc >= ' ')
+    {
+      /* Copies it */
+      *pcDst++ = *pcSrc;
+    }
+  }
+
+  /* Terminates it */
+  *pcDst = orxCHAR_NULL;
+
+  /* Done! */
+  return sstProfiler.acNameBuffer;
+}
+
 static orxINLINE void orxProfiler_ResetData(orxPROFILER_MARKER_DATA *_pstData)
 {
   orxS32 i;
@@ -234,21 +403,36 @@ static orxINLINE void orxProfiler_ResetData(orxPROFILER_MARKER_DATA *_pstData)
   /* For all markers */
   for(i = 0; i < sstProfiler.s32MarkerCounter; i++)
   {
-    orxPROFILER_HISTORY_ENTRY *pstEntry;
+    orxPROFILER_MARKER_PAGE *pstPage;
 
-    /* Gets its info */
-    pstEntry = &(_pstData->aastHistory[u32NextIndex][i]);
+    /* Gets its page */
+    pstPage = orxProfiler_GetMarkerPage(_pstData, i, orxTRUE);
 
-    /* Inits it */
-    pstEntry->dFirstTimeStamp   = orxDOUBLE_0;
-    pstEntry->dCumulatedTime    = orxDOUBLE_0;
-    pstEntry->dMaxCumulatedTime = _pstData->aastHistory[_pstData->u32HistoryIndex][i].dMaxCumulatedTime;
-    pstEntry->u32PushCounter    = 0;
-    pstEntry->u32Depth          = 0;
-
-    /* Resets marker */
-    _pstData->astMarkerInfoList[i].dTimeStamp = orxDOUBLE_0;
-    orxFLAG_SET(_pstData->astMarkerInfoList[i].u32Flags, orxPROFILER_KU32_FLAG_NONE, orxPROFILER_KU32_FLAG_PUSHED|orxPROFILER_KU32_FLAG_INIT);
+    /* Valid? */
+    if(pstPage != orxNULL)
+    {
+      orxPROFILER_HISTORY_ENTRY  *pstEntry;
+      orxPROFILER_MARKER_INFO    *pstMarkerInfo;
+      orxS32                      s32Index;
+
+      /* Gets its index in the page */
+      s32Index = i & orxPROFILER_KU32_MASK_MARKER_PAGE;
+
+      /* Gets its info */
+      pstEntry      = &(pstPage->aastHistory[u32NextIndex][s32Index]);
+      pstMarkerInfo = &(pstPage->astMarkerInfoList[s32Index]);
+
+      /* Inits it */
+      pstEntry->dFirstTimeStamp   = orxDOUBLE_0;
+      pstEntry->dCumulatedTime    = orxDOUBLE_0;
+      pstEntry->dMaxCumulatedTime = pstPage->aastHistory[_pstData->u32HistoryIndex][s32Index].dMaxCumulatedTime;
+      pstEntry->u32PushCounter    = 0;
+      pstEntry->u32Depth          = 0;
+
+      /* Resets marker */
+      pstMarkerInfo->dTimeStamp = orxDOUBLE_0;
+      orxFLAG_SET(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_NONE, orxPROFILER_KU32_FLAG_PUSHED|orxPROFILER_KU32_FLAG_INIT);
+    }
   }
 
   /* Updates new time stamps */
@@ -291,6 +475,8 @@ orxSTATUS orxFASTCALL orxProfiler_Init()
 
   /* Checks */
   orxASSERT(orxMath_IsPowerOfTwo(orxPROFILER_KU32_MAX_MARKER_NUMBER) != orxFALSE);
+  orxASSERT(orxMath_IsPowerOfTwo(orxPROFILER_KU32_MARKER_PAGE_SIZE) != orxFALSE);
+  orxASSERT(orxMath_IsPowerOfTwo(orxPROFILER_KU32_TRACE_EVENT_NUMBER) != orxFALSE);
 
   /* Not already Initialized? */
   if(!(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY))
@@ -304,6 +490,10 @@ orxSTATUS orxFASTCALL orxProfiler_Init()
     /* Success? */
     if(sstProfiler.pstSemaphore != orxNULL)
     {
+      /* Inits undefined marker info */
+      sstProfiler.stUndefinedMarkerInfo.s32ParentID = orxPROFILER_KS32_MARKER_ID_NONE;
+      sstProfiler.stUndefinedMarkerInfo.u32Flags    = orxPROFILER_KU32_FLAG_UNIQUE;
+
       /* Creates data for main thread */
       orxProfiler_GetMarkerData(orxTHREAD_KU32_MAIN_THREAD_ID, orxFALSE);
 
@@ -357,6 +547,26 @@ void orxFASTCALL orxProfiler_Exit()
       /* Valid? */
       if(pstData != orxNULL)
       {
+        orxU32 j;
+
+        /* For all its pages */
+        for(j = 0; j < orxPROFILER_KU32_MARKER_PAGE_NUMBER; j++)
+        {
+          /* Valid? */
+          if(pstData->apstPageList[j] != orxNULL)
+          {
+            /* Deletes it */
+            orxMemory_Free(pstData->apstPageList[j]);
+          }
+        }
+
+        /* Has trace events? */
+        if(pstData->astTraceEventList != orxNULL)
+        {
+          /* Deletes them */
+          orxMemory_Free(pstData->astTraceEventList);
+        }
+
         /* Deletes data */
         orxMemory_Free(pstData);
         sstProfiler.apstMarkerDataList[i] = orxNULL;
@@ -367,7 +577,18 @@ void orxFASTCALL orxProfiler_Exit()
     for(i = 0; i < (orxU32)sstProfiler.s32MarkerCounter; i++)
     {
       /* Deletes its name */
-      orxString_Delete(sstProfiler.astMarkerList[i].zName);
+      orxString_Delete(orxProfiler_GetMarker(i)->zName);
+    }
+
+    /* For all marker pages */
+    for(i = 0; i < orxPROFILER_KU32_MARKER_PAGE_NUMBER; i++)
+    {
+      /* Valid? */
+      if(sstProfiler.apstMarkerPageList[i] != orxNULL)
+      {
+        /* Deletes it */
+        orxMemory_Free(sstProfiler.apstMarkerPageList[i]);
+      }
     }
 
     /* Deletes semaphore */
@@ -408,7 +629,7 @@ orxS32 orxFASTCALL orxProfiler_GetIDFromName(const orxSTRING _zName)
   for(s32MarkerID = 0; s32MarkerID < sstProfiler.s32MarkerCounter; s32MarkerID++)
   {
     /* Matches? */
-    if(u32NameID == sstProfiler.astMarkerList[s32MarkerID].u32NameID)
+    if(u32NameID == orxProfiler_GetMarker(s32MarkerID)->u32NameID)
     {
       /* Stops */
       break;
@@ -418,15 +639,33 @@ orxS32 orxFASTCALL orxProfiler_GetIDFromName(const orxSTRING _zName)
   /* Not found? */
   if(s32MarkerID >= sstProfiler.s32MarkerCounter)
   {
+    orxPROFILER_MARKER **ppstPage;
+
+    /* Gets its page */
+    ppstPage = &(sstProfiler.apstMarkerPageList[s32MarkerID >> orxPROFILER_KU32_SHIFT_MARKER_PAGE]);
+
+    /* Has free marker IDs and page not yet created? */
+    if((s32MarkerID < orxPROFILER_KU32_MAX_MARKER_NUMBER) && (*ppstPage == orxNULL))
+    {
+      /* Creates it */
+      *ppstPage = (orxPROFILER_MARKER *)orxMemory_Allocate(orxPROFILER_KU32_MARKER_PAGE_SIZE * sizeof(orxPROFILER_MARKER), orxMEMORY_TYPE_DEBUG);
+    }
+
     /* Has free marker IDs? */
-    if(sstProfiler.s32MarkerCounter < orxPROFILER_KU32_MAX_MARKER_NUMBER)
+    if((s32MarkerID < orxPROFILER_KU32_MAX_MARKER_NUMBER) && (*ppstPage != orxNULL))
     {
-      /* Updates marker counter */
-      sstProfiler.s32MarkerCounter++;
+      orxPROFILER_MARKER *pstMarker;
+
+      /* Gets it */
+      pstMarker = &((*ppstPage)[s32MarkerID & orxPROFILER_KU32_MASK_MARKER_PAGE]);
 
       /* Inits it */
-      sstProfiler.astMarkerList[s32MarkerID].zName     = orxString_Duplicate(_zName);
-      sstProfiler.astMarkerList[s32MarkerID].u32NameID = u32NameID;
+      pstMarker->zName      = orxString_Duplicate(_zName);
+      pstMarker->u32NameID  = u32NameID;
+
+      /* Updates marker counter */
+      orxMEMORY_BARRIER();
+      sstProfiler.s32MarkerCounter++;
 
       /* Stamps result */
       s32MarkerID |= sstProfiler.s32WaterStamp;
@@ -504,12 +743,16 @@ void orxFASTCALL orxProfiler_PushMarker(orxS32 _s32MarkerID)
     /* Valid marker ID? */
     if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter))
     {
+      orxPROFILER_MARKER_PAGE    *pstPage;
       orxPROFILER_MARKER_INFO    *pstMarkerInfo;
       orxPROFILER_HISTORY_ENTRY  *pstEntry;
 
+      /* Gets marker page */
+      pstPage = orxProfiler_GetMarkerPage(pstData, s32ID, orxFALSE);
+
       /* Gets marker & current info */
-      pstMarkerInfo = &(pstData->astMarkerInfoList[s32ID]);
-      pstEntry      = &(pstData->aastHistory[pstData->u32HistoryIndex][s32ID]);
+      pstMarkerInfo = &(pstPage->astMarkerInfoList[s32ID & orxPROFILER_KU32_MASK_MARKER_PAGE]);
+      pstEntry      = &(pstPage->aastHistory[pstData->u32HistoryIndex][s32ID & orxPROFILER_KU32_MASK_MARKER_PAGE]);
 
       /* Not already pushed? */
       if(!orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_PUSHED))
@@ -541,13 +784,13 @@ void orxFASTCALL orxProfiler_PushMarker(orxS32 _s32MarkerID)
             orxPROFILER_MARKER_INFO *pstTestMarkerInfo;
 
             /* Gets it */
-            pstTestMarkerInfo = &(pstData->astMarkerInfoList[i]);
+            pstTestMarkerInfo = orxProfiler_GetMarkerInfo(pstData, i);
 
             /* Is child of current marker? */
             if(pstTestMarkerInfo->s32ParentID == s32ID)
             {
               /* Updates its depth */
-              pstData->aastHistory[pstData->u32HistoryIndex][i].u32Depth--;
+              orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryIndex, i)->u32Depth--;
             }
           }
         }
@@ -594,7 +837,7 @@ void orxFASTCALL orxProfiler_PushMarker(orxS32 _s32MarkerID)
       else
       {
         /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Marker <%s> is already pushed, skipping.", sstProfiler.astMarkerList[s32ID].zName);
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Marker <%s> is already pushed, skipping.", orxProfiler_GetMarker(s32ID)->zName);
 
         /* Skips marker */
         bSkip = orxTRUE;
@@ -643,13 +886,17 @@ void orxFASTCALL orxProfiler_PopMarker()
       {
         orxPROFILER_MARKER_INFO    *pstMarkerInfo;
         orxPROFILER_HISTORY_ENTRY  *pstEntry;
+        orxDOUBLE                   dTimeStamp;
 
         /* Gets marker & current info */
-        pstMarkerInfo = &(pstData->astMarkerInfoList[pstData->s32CurrentMarker]);
-        pstEntry      = &(pstData->aastHistory[pstData->u32HistoryIndex][pstData->s32CurrentMarker]);
+        pstMarkerInfo = orxProfiler_GetMarkerInfo(pstData, pstData->s32CurrentMarker);
+        pstEntry      = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryIndex, pstData->s32CurrentMarker);
+
+        /* Gets time stamp */
+        dTimeStamp = orxSystem_GetTime();
 
         /* Updates cumulated time */
-        pstEntry->dCumulatedTime += orxSystem_GetTime() - pstMarkerInfo->dTimeStamp;
+        pstEntry->dCumulatedTime += dTimeStamp - pstMarkerInfo->dTimeStamp;
 
         /* Updates max cumulated time */
         if(pstEntry->dCumulatedTime > pstEntry->dMaxCumulatedTime)
@@ -657,6 +904,13 @@ void orxFASTCALL orxProfiler_PopMarker()
           pstEntry->dMaxCumulatedTime = pstEntry->dCumulatedTime;
         }
 
+        /* Is tracing? */
+        if(orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_TRACE))
+        {
+          /* Adds trace event */
+          orxProfiler_AddTraceEvent(pstData, pstData->s32CurrentMarker, pstMarkerInfo->dTimeStamp, dTimeStamp);
+        }
+
         /* Pops previous marker */
         pstData->s32CurrentMarker = pstMarkerInfo->s32ParentID;
 
@@ -748,6 +1002,196 @@ orxBOOL orxFASTCALL orxProfiler_IsPaused()
   return orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_PAUSED) ? orxTRUE : orxFALSE;
 }
 
+/** Enables/disables marker event tracing, used to export timelines with orxProfiler_SaveTrace
+ * @param[in] _bEnable          Enable
+ */
+void orxFASTCALL orxProfiler_EnableTrace(orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Not already tracing? */
+    if(!orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_TRACE))
+    {
+      /* Stores start time: events from previous traces will be ignored */
+      sstProfiler.dTraceStartTime = orxSystem_GetTime();
+
+      /* Updates flags */
+      orxMEMORY_BARRIER();
+      orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_TRACE, orxPROFILER_KU32_STATIC_FLAG_NONE);
+    }
+  }
+  else
+  {
+    /* Updates flags */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_NONE, orxPROFILER_KU32_STATIC_FLAG_TRACE);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Is marker event tracing enabled?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxProfiler_IsTraceEnabled()
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_TRACE) ? orxTRUE : orxFALSE;
+}
+
+/** Saves all the marker events traced since the last call to orxProfiler_EnableTrace, using the Chrome Trace Event format (JSON), which can be opened with chrome://tracing or Perfetto
+ * @param[in] _zFileName        Name of the file to save
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxProfiler_SaveTrace(const orxSTRING _zFileName)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Is file module initialized? */
+  if(orxModule_IsInitialized(orxMODULE_ID_FILE) != orxFALSE)
+  {
+    orxPROFILER_TRACE_EVENT  *astEventList;
+
+    /* Allocates event copy buffer */
+    astEventList = (orxPROFILER_TRACE_EVENT *)orxMemory_Allocate(orxPROFILER_KU32_TRACE_EVENT_NUMBER * sizeof(orxPROFILER_TRACE_EVENT), orxMEMORY_TYPE_TEMP);
+
+    /* Success? */
+    if(astEventList != orxNULL)
+    {
+      orxFILE *pstFile;
+
+      /* Opens file */
+      pstFile = orxFile_Open(_zFileName, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+      /* Success? */
+      if(pstFile != orxNULL)
+      {
+        orxU32 i, u32EventCounter = 0;
+
+        /* Writes header */
+        orxFile_Print(pstFile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"orx\"}}");
+
+        /* For all marker data */
+        for(i = 0; i < orxPROFILER_KU32_MARKER_DATA_NUMBER; i++)
+        {
+          orxPROFILER_MARKER_DATA *pstData;
+
+          /* Gets it */
+          pstData = sstProfiler.apstMarkerDataList[i];
+
+          /* Valid? */
+          if(pstData != orxNULL)
+          {
+            orxU32 u32Start, u32End, u32Number, j;
+
+            /* Gets event range */
+            u32End    = pstData->u32TraceEventCounter;
+            orxMEMORY_BARRIER();
+            u32Number = orxMIN(u32End, orxPROFILER_KU32_TRACE_EVENT_NUMBER);
+            u32Start  = u32End - u32Number;
+
+            /* Has events? */
+            if((u32Number != 0) && (pstData->astTraceEventList != orxNULL))
+            {
+              const orxSTRING zThreadName;
+              orxU32          u32Skip;
+
+              /* Copies them */
+              for(j = 0; j < u32Number; j++)
+              {
+                astEventList[j] = pstData->astTraceEventList[(u32Start + j) & (orxPROFILER_KU32_TRACE_EVENT_NUMBER - 1)];
+              }
+
+              /* Gets number of events that might have been overwritten by the owning thread during the copy */
+              orxMEMORY_BARRIER();
+              u32Skip = pstData->u32TraceEventCounter - u32Start;
+              u32Skip = (u32Skip >= orxPROFILER_KU32_TRACE_EVENT_NUMBER) ? orxMIN(u32Skip - orxPROFILER_KU32_TRACE_EVENT_NUMBER + 1, u32Number) : 0;
+
+              /* Gets thread name */
+              zThreadName = orxThread_GetName(i);
+
+              /* Has name? (the thread might have been stopped since) */
+              if((zThreadName != orxNULL) && (*zThreadName != orxCHAR_NULL))
+              {
+                /* Writes it */
+                orxFile_Print(pstFile, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"%s\"}}", i, orxProfiler_EscapeTraceName(zThreadName));
+              }
+              else
+              {
+                /* Writes default name */
+                orxFile_Print(pstFile, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"Thread #%u\"}}", i, i);
+              }
+
+              /* For all valid events */
+              for(j = u32Skip; j < u32Number; j++)
+              {
+                orxPROFILER_TRACE_EVENT *pstEvent;
+
+                /* Gets it */
+                pstEvent = &(astEventList[j]);
+
+                /* Belongs to current trace? */
+                if(pstEvent->dStartTime >= sstProfiler.dTraceStartTime)
+                {
+                  /* Writes it (complete event, times in microseconds) */
+                  orxFile_Print(pstFile, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", orxProfiler_EscapeTraceName(orxProfiler_GetMarker(pstEvent->s32MarkerID)->zName), i, (pstEvent->dStartTime - sstProfiler.dTraceStartTime) * 1e6, (pstEvent->dEndTime - pstEvent->dStartTime) * 1e6);
+
+                  /* Updates counter */
+                  u32EventCounter++;
+                }
+              }
+            }
+          }
+        }
+
+        /* Writes footer */
+        orxFile_Print(pstFile, "\n]}\n");
+
+        /* Closes file */
+        orxFile_Close(pstFile);
+
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Saved %u trace events to <%s>.", u32EventCounter, _zFileName);
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't save trace: couldn't open file <%s>.", _zFileName);
+      }
+
+      /* Frees event copy buffer */
+      orxMemory_Free(astEventList);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't save trace to <%s>: couldn't allocate event buffer.", _zFileName);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't save trace to <%s>: file module isn't initialized.", _zFileName);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Resets all markers (usually called at the end of the frame)
  */
 void orxFASTCALL orxProfiler_ResetAllMarkers()
@@ -817,8 +1261,17 @@ void orxFASTCALL orxProfiler_ResetAllMaxima()
         /* For all markers */
         for(j = 0; j < sstProfiler.s32MarkerCounter; j++)
         {
-          /* Resets its maximum */
-          pstData->aastHistory[u32Index][j].dMaxCumulatedTime = pstData->aastHistory[u32Index][j].dCumulatedTime;
+          /* Defined? */
+          if(orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, j)->u32Flags, orxPROFILER_KU32_FLAG_DEFINED))
+          {
+            orxPROFILER_HISTORY_ENTRY *pstEntry;
+
+            /* Gets its entry */
+            pstEntry = orxProfiler_GetHistoryEntry(pstData, u32Index, j);
+
+            /* Resets its maximum */
+            pstEntry->dMaxCumulatedTime = pstEntry->dCumulatedTime;
+          }
         }
 
       }
@@ -946,7 +1399,7 @@ orxS32 orxFASTCALL orxProfiler_GetNextMarkerID(orxS32 _s32MarkerID)
         /* Prepares ID for next potential iteration */
         _s32MarkerID = s32Result;
       }
-    } while((s32Result != orxPROFILER_KS32_MARKER_ID_NONE) && (!orxFLAG_TEST(pstData->astMarkerInfoList[s32Result & orxPROFILER_KU32_MASK_MARKER_ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)));
+    } while((s32Result != orxPROFILER_KS32_MARKER_ID_NONE) && (!orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32Result & orxPROFILER_KU32_MASK_MARKER_ID)->u32Flags, orxPROFILER_KU32_FLAG_DEFINED)));
   }
   else
   {
@@ -987,7 +1440,7 @@ orxS32 orxFASTCALL orxProfiler_GetNextSortedMarkerID(orxS32 _s32MarkerID)
       s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
       /* Get previous marker's time stamp */
-      dPreviousTime = ((s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED))) ? pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].dFirstTimeStamp : orxDOUBLE_0;
+      dPreviousTime = ((s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32ID)->u32Flags, orxPROFILER_KU32_FLAG_DEFINED))) ? orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, s32ID)->dFirstTimeStamp : orxDOUBLE_0;
     }
     else
     {
@@ -1002,12 +1455,12 @@ orxS32 orxFASTCALL orxProfiler_GetNextSortedMarkerID(orxS32 _s32MarkerID)
     for(i = 0, dBestTime = orxSystem_GetTime(); i < sstProfiler.s32MarkerCounter; i++)
     {
       // Defined?
-      if(orxFLAG_TEST(pstData->astMarkerInfoList[i].u32Flags, orxPROFILER_KU32_FLAG_DEFINED))
+      if(orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, i)->u32Flags, orxPROFILER_KU32_FLAG_DEFINED))
       {
         orxDOUBLE dTime;
 
         /* Gets its time */
-        dTime = pstData->aastHistory[pstData->u32HistoryQueryIndex][i].dFirstTimeStamp;
+        dTime = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, i)->dFirstTimeStamp;
 
         /* Is better candidate? */
         if((((dTime == dPreviousTime)
@@ -1089,10 +1542,10 @@ orxDOUBLE orxFASTCALL orxProfiler_GetMarkerTime(orxS32 _s32MarkerID)
     s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
     /* Valid marker ID? */
-    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
+    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32ID)->u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
     {
       /* Updates result */
-      dResult = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].dCumulatedTime;
+      dResult = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, s32ID)->dCumulatedTime;
     }
     else
     {
@@ -1138,10 +1591,10 @@ orxDOUBLE orxFASTCALL orxProfiler_GetMarkerMaxTime(orxS32 _s32MarkerID)
     s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
     /* Valid marker ID? */
-    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
+    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32ID)->u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
     {
       /* Updates result */
-      dResult = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].dMaxCumulatedTime;
+      dResult = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, s32ID)->dMaxCumulatedTime;
     }
     else
     {
@@ -1182,7 +1635,7 @@ const orxSTRING orxFASTCALL orxProfiler_GetMarkerName(orxS32 _s32MarkerID)
   if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter))
   {
     /* Updates result */
-    zResult = sstProfiler.astMarkerList[s32ID].zName;
+    zResult = orxProfiler_GetMarker(s32ID)->zName;
   }
   else
   {
@@ -1222,10 +1675,10 @@ orxU32 orxFASTCALL orxProfiler_GetMarkerPushCounter(orxS32 _s32MarkerID)
     s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
     /* Valid marker ID? */
-    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
+    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32ID)->u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
     {
       /* Updates result */
-      u32Result = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].u32PushCounter;
+      u32Result = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, s32ID)->u32PushCounter;
     }
     else
     {
@@ -1271,10 +1724,10 @@ orxBOOL orxFASTCALL orxProfiler_IsUniqueMarker(orxS32 _s32MarkerID)
     s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
     /* Valid marker ID? */
-    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
+    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32ID)->u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
     {
       /* Updates result */
-      bResult = orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_UNIQUE) ? orxTRUE : orxFALSE;
+      bResult = orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32ID)->u32Flags, orxPROFILER_KU32_FLAG_UNIQUE) ? orxTRUE : orxFALSE;
     }
     else
     {
@@ -1320,18 +1773,18 @@ orxDOUBLE orxFASTCALL orxProfiler_GetUniqueMarkerStartTime(orxS32 _s32MarkerID)
     s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
     /* Valid marker ID? */
-    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
+    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32ID)->u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
     {
       /* Is unique? */
-      if(orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
+      if(orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32ID)->u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
       {
         /* Updates result */
-        dResult = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].dFirstTimeStamp;
+        dResult = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, s32ID)->dFirstTimeStamp;
       }
       else
       {
         /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't get start time of marker <%s> [ID: %d] as it hasn't been uniquely pushed.", sstProfiler.astMarkerList[s32ID].zName, _s32MarkerID);
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't get start time of marker <%s> [ID: %d] as it hasn't been uniquely pushed.", orxProfiler_GetMarker(s32ID)->zName, _s32MarkerID);
 
         /* Updates result */
         dResult = orxDOUBLE_0;
@@ -1381,18 +1834,18 @@ orxU32 orxFASTCALL orxProfiler_GetUniqueMarkerDepth(orxS32 _s32MarkerID)
     s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
     /* Valid marker ID? */
-    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
+    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCounter) && (orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32ID)->u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
     {
       /* Is unique? */
-      if(orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
+      if(orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32ID)->u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
       {
         /* Updates result */
-        u32Result = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].u32Depth;
+        u32Result = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, s32ID)->u32Depth;
       }
       else
       {
         /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't get push depth of marker <%s> [ID: %d] as it hasn't been uniquely pushed.", sstProfiler.astMarkerList[s32ID].zName, _s32MarkerID);
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't get push depth of marker <%s> [ID: %d] as it hasn't been uniquely pushed.", orxProfiler_GetMarker(s32ID)->zName, _s32MarkerID);
 
         /* Updates result */
         u32Result = 0;
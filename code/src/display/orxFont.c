@@ -141,6 +141,12 @@ static void orxFASTCALL orxFont_UpdateMap(orxFONT *_pstFont)
   /* Clears UTF-8 bank */
   orxBank_Clear(_pstFont->pstMap->pstCharacterBank);
 
+  /* Clears direct table */
+  orxMemory_Zero(_pstFont->pstMap->apstDirectTable, orxCHARACTER_MAP_KU32_DIRECT_TABLE_SIZE * sizeof(orxCHARACTER_GLYPH *));
+
+  /* Updates revision */
+  _pstFont->pstMap->u32Revision++;
+
   /* Has texture, texture size, character size and character list? */
   if((_pstFont->pstTexture != orxNULL)
   && (_pstFont->fWidth > orxFLOAT_0)
@@ -179,6 +185,13 @@ static void orxFASTCALL orxFont_UpdateMap(orxFONT *_pstFont)
 
         /* Adds it to table */
         *ppstBucket = pstGlyph;
+
+        /* Directly indexed? */
+        if(u32CharacterCodePoint < orxCHARACTER_MAP_KU32_DIRECT_TABLE_SIZE)
+        {
+          /* Stores it */
+          _pstFont->pstMap->apstDirectTable[u32CharacterCodePoint] = pstGlyph;
+        }
       }
       else
       {
@@ -811,6 +824,9 @@ orxFONT *orxFASTCALL orxFont_Create()
     /* Valid? */
     if(pstResult->pstMap != orxNULL)
     {
+      /* Cleans it */
+      orxMemory_Zero(pstResult->pstMap, sizeof(orxCHARACTER_MAP));
+
       /* Creates its character bank */
       pstResult->pstMap->pstCharacterBank = orxBank_Create(orxFONT_KU32_CHARACTER_BANK_SIZE, sizeof(orxCHARACTER_GLYPH), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
@@ -1373,7 +1389,7 @@ orxFLOAT orxFASTCALL orxFont_GetCharacterHeight(const orxFONT *_pstFont)
  */
 orxFLOAT orxFASTCALL orxFont_GetCharacterWidth(const orxFONT *_pstFont, orxU32 _u32CharacterCodePoint)
 {
-  orxCHARACTER_GLYPH *pstGlyph;
+  const orxCHARACTER_GLYPH *pstGlyph;
   orxFLOAT fResult = orxFLOAT_0;
 
   /* Checks */
@@ -1384,7 +1400,7 @@ orxFLOAT orxFASTCALL orxFont_GetCharacterWidth(const orxFONT *_pstFont, orxU32 _
   if(_pstFont->pstMap != orxNULL)
   {
     /* Gets glyph */
-    pstGlyph = (orxCHARACTER_GLYPH *)orxHashTable_Get(_pstFont->pstMap->pstCharacterTable, _u32CharacterCodePoint);
+    pstGlyph = orxCharacterMap_GetGlyph(_pstFont->pstMap, _u32CharacterCodePoint);
 
     /* Valid? */
     if(pstGlyph != orxNULL)
@@ -87,6 +87,7 @@
 #define orxGRAPHIC_KZ_BOTH                        "both"
 
 #define orxGRAPHIC_KU32_BANK_SIZE                 1024
+#define orxGRAPHIC_KU32_UPDATE_CALLBACK_NUMBER    4
 
 
 /***************************************************************************
@@ -115,6 +116,7 @@ struct __orxGRAPHIC_t
 typedef struct __orxGRAPHIC_STATIC_t
 {
   orxU32 u32Flags;                          /**< Control flags : 4 */
+  orxGRAPHIC_UPDATE_FUNCTION apfnUpdateList[orxGRAPHIC_KU32_UPDATE_CALLBACK_NUMBER]; /**< Update callbacks : 20 */
 
 } orxGRAPHIC_STATIC;
 
@@ -132,6 +134,27 @@ static orxGRAPHIC_STATIC sstGraphic;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Notifies a change of graphic size or pivot
+ * @param[in]   _pstGraphic     Concerned graphic
+ */
+static orxINLINE void orxGraphic_NotifyUpdate(const orxGRAPHIC *_pstGraphic)
+{
+  orxU32 i;
+
+  /* For all callbacks */
+  for(i = 0; i < orxGRAPHIC_KU32_UPDATE_CALLBACK_NUMBER; i++)
+  {
+    /* Valid? */
+    if(sstGraphic.apfnUpdateList[i] != orxNULL)
+    {
+      /* Calls it */
+      sstGraphic.apfnUpdateList[i](_pstGraphic);
+    }
+  }
+
+  return;
+}
+
 /** Event handler
  * @param[in]   _pstEvent                     Sent event
  * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
@@ -285,6 +308,9 @@ static orxINLINE orxSTATUS orxGraphic_SetDataInternal(orxGRAPHIC *_pstGraphic, o
     orxStructure_SetFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_NONE, orxGRAPHIC_KU32_MASK_TYPE);
   }
 
+  /* Notifies update */
+  orxGraphic_NotifyUpdate(_pstGraphic);
+
   /* Done! */
   return eResult;
 }
@@ -889,6 +915,83 @@ const orxSTRING orxFASTCALL orxGraphic_GetName(const orxGRAPHIC *_pstGraphic)
   return zResult;
 }
 
+/** Adds a graphic update callback: it will be called every time a graphic's size or pivot changes
+ * @param[in]   _pfnCallback    Callback to add
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxGraphic_AddUpdateCallback(const orxGRAPHIC_UPDATE_FUNCTION _pfnCallback)
+{
+  orxU32    i, u32Free = orxGRAPHIC_KU32_UPDATE_CALLBACK_NUMBER;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstGraphic.u32Flags & orxGRAPHIC_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* For all callback slots */
+  for(i = 0; i < orxGRAPHIC_KU32_UPDATE_CALLBACK_NUMBER; i++)
+  {
+    /* Already registered? */
+    if(sstGraphic.apfnUpdateList[i] == _pfnCallback)
+    {
+      /* Stops */
+      u32Free = orxGRAPHIC_KU32_UPDATE_CALLBACK_NUMBER;
+      break;
+    }
+    /* First free slot? */
+    else if((sstGraphic.apfnUpdateList[i] == orxNULL) && (u32Free == orxGRAPHIC_KU32_UPDATE_CALLBACK_NUMBER))
+    {
+      /* Stores it */
+      u32Free = i;
+    }
+  }
+
+  /* Found a free slot? */
+  if(u32Free < orxGRAPHIC_KU32_UPDATE_CALLBACK_NUMBER)
+  {
+    /* Stores callback */
+    sstGraphic.apfnUpdateList[u32Free] = _pfnCallback;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Removes a graphic update callback
+ * @param[in]   _pfnCallback    Callback to remove
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxGraphic_RemoveUpdateCallback(const orxGRAPHIC_UPDATE_FUNCTION _pfnCallback)
+{
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstGraphic.u32Flags & orxGRAPHIC_KU32_STATIC_FLAG_READY);
+
+  /* For all callback slots */
+  for(i = 0; i < orxGRAPHIC_KU32_UPDATE_CALLBACK_NUMBER; i++)
+  {
+    /* Found? */
+    if(sstGraphic.apfnUpdateList[i] == _pfnCallback)
+    {
+      /* Removes it */
+      sstGraphic.apfnUpdateList[i] = orxNULL;
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Sets graphic data
  * @param[in]   _pstGraphic     Graphic concerned
  * @param[in]   _pstData        Data structure to set / orxNULL
@@ -1009,6 +1112,9 @@ orxSTATUS orxFASTCALL orxGraphic_SetPivot(orxGRAPHIC *_pstGraphic, const orxVECT
     orxStructure_SetFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_NONE, orxGRAPHIC_KU32_FLAG_HAS_PIVOT | orxGRAPHIC_KU32_FLAG_RELATIVE_PIVOT);
   }
 
+  /* Notifies update */
+  orxGraphic_NotifyUpdate(_pstGraphic);
+
   /* Done! */
   return eResult;
 }
@@ -1093,6 +1199,9 @@ orxSTATUS orxFASTCALL orxGraphic_SetRelativePivot(orxGRAPHIC *_pstGraphic, orxU3
     /* Updates status */
     orxStructure_SetFlags(_pstGraphic, _u32AlignFlags | orxGRAPHIC_KU32_FLAG_HAS_PIVOT | orxGRAPHIC_KU32_FLAG_RELATIVE_PIVOT, orxGRAPHIC_KU32_MASK_ALIGN);
 
+    /* Notifies update */
+    orxGraphic_NotifyUpdate(_pstGraphic);
+
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -1164,6 +1273,9 @@ orxSTATUS orxFASTCALL orxGraphic_SetSize(orxGRAPHIC *_pstGraphic, const orxVECTO
   _pstGraphic->fWidth   = _pvSize->fX;
   _pstGraphic->fHeight  = _pvSize->fY;
 
+  /* Notifies update */
+  orxGraphic_NotifyUpdate(_pstGraphic);
+
   /* Done! */
   return eResult;
 }
@@ -1438,6 +1550,13 @@ orxSTATUS orxFASTCALL orxGraphic_UpdateSize(orxGRAPHIC *_pstGraphic)
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Notifies update */
+    orxGraphic_NotifyUpdate(_pstGraphic);
+  }
+
   /* Valid and has a relative pivot? */
   if((eResult != orxSTATUS_FAILURE)
   && (orxStructure_TestFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_RELATIVE_PIVOT)))
@@ -37,6 +37,7 @@
 #include "core/orxEvent.h"
 #include "core/orxLocale.h"
 #include "core/orxResource.h"
+#include "debug/orxProfiler.h"
 #include "math/orxVector.h"
 #include "object/orxStructure.h"
 #include "utils/orxHashTable.h"
@@ -55,6 +56,7 @@
 #define orxTEXT_KU32_FLAG_NONE                0x00000000  /**< No flags */
 
 #define orxTEXT_KU32_FLAG_INTERNAL            0x10000000  /**< Internal structure handlign flag */
+#define orxTEXT_KU32_FLAG_QUAD_DIRTY          0x20000000  /**< Quad list needs to be rebuilt */
 
 #define orxTEXT_KU32_MASK_ALL                 0xFFFFFFFF  /**< All mask */
 
@@ -83,6 +85,10 @@ struct __orxTEXT_t
   orxFLOAT          fWidth;                     /**< Width : 28 */
   orxFLOAT          fHeight;                    /**< Height : 32 */
   const orxSTRING   zReference;                 /**< Config reference : 36 */
+  orxCHARACTER_QUAD *astQuadList;               /**< Laid out character quads : 40 */
+  orxU32            u32QuadCounter;             /**< Quad counter : 44 */
+  orxU32            u32QuadCapacity;            /**< Quad list capacity : 48 */
+  orxU32            u32MapRevision;             /**< Revision of the font's map used for the quad list : 52 */
 };
 
 /** Static structure
@@ -418,6 +424,141 @@ static void orxFASTCALL orxText_UpdateSize(orxTEXT *_pstText)
     _pstText->fWidth = _pstText->fHeight = orxFLOAT_0;
   }
 
+  /* Invalidates quad list */
+  orxStructure_SetFlags(_pstText, orxTEXT_KU32_FLAG_QUAD_DIRTY, orxTEXT_KU32_FLAG_NONE);
+
+  /* Done! */
+  return;
+}
+
+/** Updates text quad list
+ * @param[in]   _pstText      Concerned text
+ * @param[in]   _pstMap       Font's character map
+ */
+static void orxFASTCALL orxText_UpdateQuadList(orxTEXT *_pstText, const orxCHARACTER_MAP *_pstMap)
+{
+  /* Checks */
+  orxSTRUCTURE_ASSERT(_pstText);
+  orxASSERT(_pstMap != orxNULL);
+
+  /* Clears quad counter */
+  _pstText->u32QuadCounter = 0;
+
+  /* Has string? */
+  if((_pstText->zString != orxNULL) && (_pstText->zString != orxSTRING_EMPTY))
+  {
+    orxU32 u32Length;
+
+    /* Gets its length (upper bound for the number of characters) */
+    u32Length = orxString_GetLength(_pstText->zString);
+
+    /* Needs more room? */
+    if(u32Length > _pstText->u32QuadCapacity)
+    {
+      orxCHARACTER_QUAD *astQuadList;
+
+      /* Reallocates quad list */
+      astQuadList = (orxCHARACTER_QUAD *)orxMemory_Reallocate(_pstText->astQuadList, u32Length * sizeof(orxCHARACTER_QUAD));
+
+      /* Success? */
+      if(astQuadList != orxNULL)
+      {
+        /* Stores it */
+        _pstText->astQuadList     = astQuadList;
+        _pstText->u32QuadCapacity = u32Length;
+      }
+    }
+
+    /* Has enough room? */
+    if(u32Length <= _pstText->u32QuadCapacity)
+    {
+      const orxCHAR  *pc;
+      orxU32          u32CharacterCodePoint;
+      orxFLOAT        fX, fY, fHeight;
+
+      /* Gets character height */
+      fHeight = _pstMap->fCharacterHeight;
+
+      /* For all characters */
+      for(u32CharacterCodePoint = orxString_GetFirstCharacterCodePoint(_pstText->zString, &pc), fX = fY = orxFLOAT_0;
+          u32CharacterCodePoint != orxCHAR_NULL;
+          u32CharacterCodePoint = orxString_GetFirstCharacterCodePoint(pc, &pc))
+      {
+        /* Depending on character */
+        switch(u32CharacterCodePoint)
+        {
+          case orxCHAR_CR:
+          {
+            /* Half EOL? */
+            if(*pc == orxCHAR_LF)
+            {
+              /* Updates pointer */
+              pc++;
+            }
+
+            /* Fall through */
+          }
+
+          case orxCHAR_LF:
+          {
+            /* Updates Y position */
+            fY += fHeight;
+
+            /* Resets X position */
+            fX = orxFLOAT_0;
+
+            break;
+          }
+
+          default:
+          {
+            const orxCHARACTER_GLYPH *pstGlyph;
+
+            /* Gets its glyph */
+            pstGlyph = orxCharacterMap_GetGlyph(_pstMap, u32CharacterCodePoint);
+
+            /* Valid? */
+            if(pstGlyph != orxNULL)
+            {
+              orxCHARACTER_QUAD *pstQuad;
+
+              /* Gets next quad */
+              pstQuad = &(_pstText->astQuadList[_pstText->u32QuadCounter++]);
+
+              /* Stores it */
+              pstQuad->fX     = fX;
+              pstQuad->fY     = fY;
+              pstQuad->fU     = pstGlyph->fX;
+              pstQuad->fV     = pstGlyph->fY;
+              pstQuad->fWidth = pstGlyph->fWidth;
+
+              /* Updates X position */
+              fX += pstGlyph->fWidth;
+            }
+            else
+            {
+              /* Updates X position, using default width */
+              fX += fHeight;
+            }
+
+            break;
+          }
+        }
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't allocate quad list for text <%s>.", orxText_GetName(_pstText));
+    }
+  }
+
+  /* Stores map revision */
+  _pstText->u32MapRevision = _pstMap->u32Revision;
+
+  /* Updates flags */
+  orxStructure_SetFlags(_pstText, orxTEXT_KU32_FLAG_NONE, orxTEXT_KU32_FLAG_QUAD_DIRTY);
+
   /* Done! */
   return;
 }
@@ -669,6 +810,13 @@ orxSTATUS orxFASTCALL orxText_Delete(orxTEXT *_pstText)
     /* Removes font */
     orxText_SetFont(_pstText, orxNULL);
 
+    /* Has quad list? */
+    if(_pstText->astQuadList != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(_pstText->astQuadList);
+    }
+
     /* Deletes structure */
     orxStructure_Delete(_pstText);
   }
@@ -772,6 +920,57 @@ orxFONT *orxFASTCALL orxText_GetFont(const orxTEXT *_pstText)
   return pstResult;
 }
 
+/** Gets text quad list: all its glyphs, laid out in text space, rebuilt only when its string, its font or the font's map change
+ * @param[in]   _pstText      Concerned text
+ * @param[out]  _pu32Counter  Number of quads in the list
+ * @return      Quad list / orxNULL
+ */
+const orxCHARACTER_QUAD *orxFASTCALL orxText_GetQuadList(orxTEXT *_pstText, orxU32 *_pu32Counter)
+{
+  const orxCHARACTER_QUAD *astResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(sstText.u32Flags & orxTEXT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstText);
+  orxASSERT(_pu32Counter != orxNULL);
+
+  /* Has font? */
+  if(_pstText->pstFont != orxNULL)
+  {
+    const orxCHARACTER_MAP *pstMap;
+
+    /* Gets its map */
+    pstMap = orxFont_GetMap(_pstText->pstFont);
+
+    /* Valid? */
+    if(pstMap != orxNULL)
+    {
+      /* Outdated? */
+      if((orxStructure_TestFlags(_pstText, orxTEXT_KU32_FLAG_QUAD_DIRTY))
+      || (_pstText->u32MapRevision != pstMap->u32Revision))
+      {
+        /* Profiles */
+        orxPROFILER_PUSH_MARKER("orxText_UpdateQuadList");
+
+        /* Updates it */
+        orxText_UpdateQuadList(_pstText, pstMap);
+
+        /* Profiles */
+        orxPROFILER_POP_MARKER();
+      }
+
+      /* Updates result */
+      astResult = _pstText->astQuadList;
+    }
+  }
+
+  /* Updates counter */
+  *_pu32Counter = (astResult != orxNULL) ? _pstText->u32QuadCounter : 0;
+
+  /* Done! */
+  return astResult;
+}
+
 /** Sets text string
  * @param[in]   _pstText      Concerned text
  * @param[in]   _zString      String to contain
@@ -41,6 +41,7 @@
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
 #include "memory/orxBank.h"
+#include "utils/orxHashTable.h"
 #include "utils/orxLinkList.h"
 #include "utils/orxString.h"
 
@@ -75,6 +76,12 @@
 
 #define orxINPUT_KU32_SET_BANK_SIZE                   8
 #define orxINPUT_KU32_ENTRY_BANK_SIZE                 32
+#define orxINPUT_KU32_ENTRY_TABLE_SIZE                32
+#define orxINPUT_KU32_SOURCE_BANK_SIZE                32
+#define orxINPUT_KU32_SOURCE_TABLE_SIZE               64
+#define orxINPUT_KU32_LINK_BANK_SIZE                  64
+#define orxINPUT_KU32_HANDLE_BANK_SIZE                32
+#define orxINPUT_KU32_HANDLE_TABLE_SIZE               64
 
 #define orxINPUT_KU32_SET_FLAG_NONE                   0x00000000  /**< No flags */
 
@@ -93,9 +100,11 @@
 #define orxINPUT_KU32_ENTRY_FLAG_EXTERNAL             0x02000000  /**< External flag */
 #define orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL       0x04000000  /**< Reset external flag */
 #define orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL        0x08000000  /**< Last external flag */
+#define orxINPUT_KU32_ENTRY_FLAG_DIRTY                0x00000100  /**< Dirty flag */
 
 #define orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING       0x0000000F  /**< Oldest binding mask */
 #define orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING  0x000000F0  /**< Last active binding mask */
+#define orxINPUT_KU32_ENTRY_MASK_UPDATE               (orxINPUT_KU32_ENTRY_FLAG_DIRTY | orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL) /**< Update mask */
 
 #define orxINPUT_KU32_ENTRY_MASK_ALL                  0xFFFFFFFF  /**< All mask */
 
@@ -113,14 +122,27 @@
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Input source structure (physical key/button/axis shared by all its bindings)
+ */
+typedef struct __orxINPUT_SOURCE_t
+{
+  orxLINKLIST_NODE  stNode;                                       /**< List node : 12 */
+  orxINPUT_TYPE     eType;                                        /**< Input type : 16 */
+  orxENUM           eID;                                          /**< Input ID : 20 */
+  orxFLOAT          fValue;                                       /**< Last polled value : 24 */
+  orxLINKLIST       stLinkList;                                   /**< Bound entry link list : 36 */
+
+} orxINPUT_SOURCE;
+
 /** Input binding structure
  */
 typedef struct __orxINPUT_BINDING_t
 {
-  orxINPUT_TYPE   eType;                                          /**< Input type : 4 */
-  orxENUM         eID;                                            /**< Input ID : 8 */
-  orxINPUT_MODE   eMode;                                          /**< Input Mode : 12 */
-  orxFLOAT        fValue;                                         /**< Value : 16 */
+  orxINPUT_TYPE     eType;                                        /**< Input type : 4 */
+  orxENUM           eID;                                          /**< Input ID : 8 */
+  orxINPUT_MODE     eMode;                                        /**< Input Mode : 12 */
+  orxFLOAT          fValue;                                       /**< Value : 16 */
+  orxINPUT_SOURCE  *pstSource;                                    /**< Source : 20 */
 
 } orxINPUT_BINDING;
 
@@ -140,6 +162,16 @@ typedef struct __orxINPUT_ENTRY_t
 
 } orxINPUT_ENTRY;
 
+/** Input source link structure (reverse index from a source to a bound entry)
+ */
+typedef struct __orxINPUT_LINK_t
+{
+  orxLINKLIST_NODE  stNode;                                       /**< List node : 12 */
+  orxINPUT_ENTRY   *pstEntry;                                     /**< Bound entry : 16 */
+  orxU32            u32BindingIndex;                              /**< Binding index : 20 */
+
+} orxINPUT_LINK;
+
 /** Input set structure
  */
 typedef struct __orxINPUT_SET_t
@@ -149,20 +181,38 @@ typedef struct __orxINPUT_SET_t
   const orxSTRING   zName;                                        /**< Set name : 20 */
   orxU32            u32Flags;                                     /** Flags : 24 */
   orxBANK          *pstEntryBank;                                 /**< Entry bank : 28 */
-  orxLINKLIST       stEntryList;                                  /**< Entry list : 42 */
+  orxHASHTABLE     *pstEntryTable;                                /**< Entry table : 32 */
+  orxLINKLIST       stEntryList;                                  /**< Entry list : 46 */
 
 } orxINPUT_SET;
 
+/** Input handle structure
+ */
+struct __orxINPUT_HANDLE_t
+{
+  orxINPUT_ENTRY   *pstEntry;                                     /**< Resolved entry : 4 */
+  orxU32            u32SetID;                                     /**< Set ID : 8 */
+  orxU32            u32EntryID;                                   /**< Entry ID : 12 */
+  orxU32            u32Revision;                                  /**< Revision at resolution : 16 */
+};
+
 /** Static structure
  */
 typedef struct __orxINPUT_STATIC_t
 {
   orxBANK      *pstSetBank;                                       /**< Set bank */
+  orxBANK      *pstSourceBank;                                    /**< Source bank */
+  orxBANK      *pstLinkBank;                                      /**< Source link bank */
+  orxBANK      *pstHandleBank;                                    /**< Handle bank */
+  orxHASHTABLE *pstSourceTable;                                   /**< Source table */
+  orxHASHTABLE *pstHandleTable;                                   /**< Handle table */
   orxINPUT_SET *pstCurrentSet;                                    /**< Current set */
   orxFLOAT      fDefaultThreshold;                                /**< Default threshold */
   orxFLOAT      fDefaultMultiplier;                               /**< Default multiplier */
   orxU32        u32Flags;                                         /**< Control flags */
+  orxU32        u32Revision;                                      /**< Handle revision */
   orxLINKLIST   stSetList;                                        /**< Set list */
+  orxLINKLIST   stSourceList;                                     /**< Source list */
   orxVECTOR     vMouseMove;                                       /**< Mouse move */
   orxCHAR       acResultBuffer[orxINPUT_KU32_RESULT_BUFFER_SIZE]; /**< Result buffer */
 
@@ -470,6 +520,279 @@ static orxINLINE orxFLOAT orxInput_GetBindingValue(orxINPUT_TYPE _eType, orxENUM
   return fResult;
 }
 
+/** Gets an entry from its ID
+ * @param[in] _pstSet           Concerned set
+ * @param[in] _u32EntryID       Entry ID
+ * @return orxINPUT_ENTRY / orxNULL
+ */
+static orxINLINE orxINPUT_ENTRY *orxInput_GetEntry(const orxINPUT_SET *_pstSet, orxU32 _u32EntryID)
+{
+  /* Checks */
+  orxASSERT(_pstSet != orxNULL);
+
+  /* Done! */
+  return (orxINPUT_ENTRY *)orxHashTable_Get(_pstSet->pstEntryTable, (orxU64)_u32EntryID);
+}
+
+/** Gets an entry value
+ * @param[in] _pstEntry         Concerned entry
+ * @return orxFLOAT
+ */
+static orxINLINE orxFLOAT orxInput_GetEntryValue(const orxINPUT_ENTRY *_pstEntry)
+{
+  orxFLOAT fResult = orxFLOAT_0;
+
+  /* Checks */
+  orxASSERT(_pstEntry != orxNULL);
+
+  /* External value? */
+  if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL))
+  {
+    /* Updates result */
+    fResult = _pstEntry->fExternalValue;
+  }
+  /* Is active? */
+  else if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE))
+  {
+    orxU32 i;
+
+    /* For all bindings */
+    for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+    {
+      /* Valid & active? */
+      if((_pstEntry->astBindingList[i].eType != orxINPUT_TYPE_NONE)
+      && (orxMath_Abs(_pstEntry->astBindingList[i].fValue) > _pstEntry->fThreshold))
+      {
+        /* Updates result */
+        fResult = _pstEntry->astBindingList[i].fValue;
+        break;
+      }
+    }
+  }
+
+  /* Updates result */
+  fResult = orxInput_ScaleValue(fResult, _pstEntry->fThreshold, _pstEntry->fMultiplier);
+
+  /* Done! */
+  return fResult;
+}
+
+/** Links an entry binding to its source
+ * @param[in] _pstEntry         Concerned entry
+ * @param[in] _u32BindingIndex  Index of the binding to link
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxInput_LinkBinding(orxINPUT_ENTRY *_pstEntry, orxU32 _u32BindingIndex)
+{
+  orxINPUT_BINDING *pstBinding;
+  orxINPUT_SOURCE  *pstSource;
+  orxU64            u64Key;
+  orxSTATUS         eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(_pstEntry != orxNULL);
+  orxASSERT(_u32BindingIndex < orxINPUT_KU32_BINDING_NUMBER);
+
+  /* Gets binding */
+  pstBinding = &(_pstEntry->astBindingList[_u32BindingIndex]);
+
+  /* Checks */
+  orxASSERT(pstBinding->eType != orxINPUT_TYPE_NONE);
+  orxASSERT(pstBinding->pstSource == orxNULL);
+
+  /* Gets source key */
+  u64Key = ((orxU64)pstBinding->eType << 32) | (orxU64)pstBinding->eID;
+
+  /* Gets source */
+  pstSource = (orxINPUT_SOURCE *)orxHashTable_Get(sstInput.pstSourceTable, u64Key);
+
+  /* Not found? */
+  if(pstSource == orxNULL)
+  {
+    /* Allocates it */
+    pstSource = (orxINPUT_SOURCE *)orxBank_Allocate(sstInput.pstSourceBank);
+
+    /* Valid? */
+    if(pstSource != orxNULL)
+    {
+      /* Inits it */
+      orxMemory_Zero(pstSource, sizeof(orxINPUT_SOURCE));
+      pstSource->eType  = pstBinding->eType;
+      pstSource->eID    = pstBinding->eID;
+      pstSource->fValue = orxFLOAT_0;
+
+      /* Adds it to list & table */
+      orxLinkList_AddEnd(&(sstInput.stSourceList), &(pstSource->stNode));
+      orxHashTable_Add(sstInput.pstSourceTable, u64Key, pstSource);
+    }
+  }
+
+  /* Valid? */
+  if(pstSource != orxNULL)
+  {
+    orxINPUT_LINK *pstLink;
+
+    /* Allocates link */
+    pstLink = (orxINPUT_LINK *)orxBank_Allocate(sstInput.pstLinkBank);
+
+    /* Valid? */
+    if(pstLink != orxNULL)
+    {
+      /* Inits it */
+      orxMemory_Zero(pstLink, sizeof(orxINPUT_LINK));
+      pstLink->pstEntry         = _pstEntry;
+      pstLink->u32BindingIndex  = _u32BindingIndex;
+
+      /* Adds it to source */
+      orxLinkList_AddEnd(&(pstSource->stLinkList), &(pstLink->stNode));
+
+      /* Stores source */
+      pstBinding->pstSource = pstSource;
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    /* Unused source? */
+    else if(orxLinkList_GetCounter(&(pstSource->stLinkList)) == 0)
+    {
+      /* Removes it */
+      orxHashTable_Remove(sstInput.pstSourceTable, u64Key);
+      orxLinkList_Remove(&(pstSource->stNode));
+      orxBank_Free(sstInput.pstSourceBank, pstSource);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Unlinks an entry binding from its source
+ * @param[in] _pstEntry         Concerned entry
+ * @param[in] _u32BindingIndex  Index of the binding to unlink
+ */
+static void orxFASTCALL orxInput_UnlinkBinding(orxINPUT_ENTRY *_pstEntry, orxU32 _u32BindingIndex)
+{
+  orxINPUT_SOURCE *pstSource;
+
+  /* Checks */
+  orxASSERT(_pstEntry != orxNULL);
+  orxASSERT(_u32BindingIndex < orxINPUT_KU32_BINDING_NUMBER);
+
+  /* Gets source */
+  pstSource = _pstEntry->astBindingList[_u32BindingIndex].pstSource;
+
+  /* Valid? */
+  if(pstSource != orxNULL)
+  {
+    orxINPUT_LINK *pstLink;
+
+    /* For all its links */
+    for(pstLink = (orxINPUT_LINK *)orxLinkList_GetFirst(&(pstSource->stLinkList));
+        pstLink != orxNULL;
+        pstLink = (orxINPUT_LINK *)orxLinkList_GetNext(&(pstLink->stNode)))
+    {
+      /* Found? */
+      if((pstLink->pstEntry == _pstEntry) && (pstLink->u32BindingIndex == _u32BindingIndex))
+      {
+        /* Removes it */
+        orxLinkList_Remove(&(pstLink->stNode));
+        orxBank_Free(sstInput.pstLinkBank, pstLink);
+
+        break;
+      }
+    }
+
+    /* Unused source? */
+    if(orxLinkList_GetCounter(&(pstSource->stLinkList)) == 0)
+    {
+      /* Removes it */
+      orxHashTable_Remove(sstInput.pstSourceTable, ((orxU64)pstSource->eType << 32) | (orxU64)pstSource->eID);
+      orxLinkList_Remove(&(pstSource->stNode));
+      orxBank_Free(sstInput.pstSourceBank, pstSource);
+    }
+
+    /* Clears binding's source */
+    _pstEntry->astBindingList[_u32BindingIndex].pstSource = orxNULL;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Polls all sources and marks entries bound to the ones that changed as dirty
+ */
+static orxINLINE void orxInput_UpdateSources()
+{
+  orxINPUT_SOURCE *pstSource;
+
+  /* For all sources */
+  for(pstSource = (orxINPUT_SOURCE *)orxLinkList_GetFirst(&(sstInput.stSourceList));
+      pstSource != orxNULL;
+      pstSource = (orxINPUT_SOURCE *)orxLinkList_GetNext(&(pstSource->stNode)))
+  {
+    orxFLOAT fValue;
+
+    /* Gets its value */
+    fValue = orxInput_GetBindingValue(pstSource->eType, pstSource->eID);
+
+    /* Has changed? */
+    if(fValue != pstSource->fValue)
+    {
+      orxINPUT_LINK *pstLink;
+
+      /* Stores it */
+      pstSource->fValue = fValue;
+
+      /* For all bound entries */
+      for(pstLink = (orxINPUT_LINK *)orxLinkList_GetFirst(&(pstSource->stLinkList));
+          pstLink != orxNULL;
+          pstLink = (orxINPUT_LINK *)orxLinkList_GetNext(&(pstLink->stNode)))
+      {
+        /* Marks it as dirty */
+        orxFLAG_SET(pstLink->pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_DIRTY, orxINPUT_KU32_ENTRY_FLAG_NONE);
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Resolves an input handle
+ * @param[in] _pstHandle        Concerned handle
+ * @return orxINPUT_ENTRY / orxNULL
+ */
+static orxINLINE orxINPUT_ENTRY *orxInput_ResolveHandle(orxINPUT_HANDLE *_pstHandle)
+{
+  /* Checks */
+  orxASSERT(_pstHandle != orxNULL);
+
+  /* Outdated? */
+  if(_pstHandle->u32Revision != sstInput.u32Revision)
+  {
+    orxINPUT_SET *pstSet;
+
+    /* For all the sets */
+    for(pstSet = (orxINPUT_SET *)orxLinkList_GetFirst(&(sstInput.stSetList));
+        pstSet != orxNULL;
+        pstSet = (orxINPUT_SET *)orxLinkList_GetNext(&(pstSet->stNode)))
+    {
+      /* Found? */
+      if(pstSet->u32ID == _pstHandle->u32SetID)
+      {
+        break;
+      }
+    }
+
+    /* Updates handle */
+    _pstHandle->pstEntry    = (pstSet != orxNULL) ? orxInput_GetEntry(pstSet, _pstHandle->u32EntryID) : orxNULL;
+    _pstHandle->u32Revision = sstInput.u32Revision;
+  }
+
+  /* Done! */
+  return _pstHandle->pstEntry;
+}
+
 static orxINLINE orxINPUT_SET *orxInput_LoadSet(const orxSTRING _zSetName)
 {
   orxINPUT_SET *pstResult = orxNULL;
@@ -570,278 +893,300 @@ static orxINLINE orxINPUT_SET *orxInput_LoadSet(const orxSTRING _zSetName)
   return pstResult;
 }
 
-static orxINLINE void orxInput_UpdateSet(orxINPUT_SET *_pstSet)
+/** Updates an entry
+ * @param[in] _pstSet           Concerned set
+ * @param[in] _pstEntry         Entry to update
+ */
+static orxINLINE void orxInput_UpdateEntry(const orxINPUT_SET *_pstSet, orxINPUT_ENTRY *_pstEntry)
 {
-  orxINPUT_ENTRY *pstEntry;
+  orxU32  i, u32ActiveIndex = 0;
+  orxBOOL bActive = orxFALSE, bStatusSet = orxFALSE, bHasBinding = orxFALSE;
 
+  /* Cleans dirty status */
+  orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_DIRTY);
 
-  /* For all entries */
-  for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(_pstSet->stEntryList));
-      pstEntry != orxNULL;
-      pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+  /* Had external value? */
+  if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL))
   {
-    orxU32  i, u32ActiveIndex = 0;
-    orxBOOL bActive = orxFALSE, bStatusSet = orxFALSE, bHasBinding = orxFALSE;
+    /* Updates status */
+    orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT);
+  }
+  /* Need to reset external value? */
+  else if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL))
+  {
+    /* Clears external value */
+    _pstEntry->fExternalValue = orxFLOAT_0;
 
-    /* Had external value? */
-    if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL))
-    {
-      /* Updates status */
-      orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT);
-    }
-    /* Need to reset external value? */
-    else if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL))
-    {
-      /* Clears external value */
-      pstEntry->fExternalValue = orxFLOAT_0;
+    /* Updates status */
+    orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT);
+  }
+  /* Has non permanent external value? */
+  else if(orxFLAG_GET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT) == orxINPUT_KU32_ENTRY_FLAG_EXTERNAL)
+  {
+    /* Marks it for reset */
+    orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL, orxINPUT_KU32_ENTRY_FLAG_NONE);
+  }
 
-      /* Updates status */
-      orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT);
-    }
-    /* Has non permanent external value? */
-    else if(orxFLAG_GET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT) == orxINPUT_KU32_ENTRY_FLAG_EXTERNAL)
+  /* For all bindings */
+  for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+  {
+    /* Valid? */
+    if(_pstEntry->astBindingList[i].eType != orxINPUT_TYPE_NONE)
     {
-      /* Marks it for reset */
-      orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL, orxINPUT_KU32_ENTRY_FLAG_NONE);
-    }
+      orxFLOAT fValue, fTestValue;
 
-    /* For all bindings */
-    for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
-    {
-      /* Valid? */
-      if(pstEntry->astBindingList[i].eType != orxINPUT_TYPE_NONE)
-      {
-        orxFLOAT fValue, fTestValue;
+      /* Updates binding status */
+      bHasBinding = orxTRUE;
 
-        /* Updates binding status */
-        bHasBinding = orxTRUE;
+      /* Checks */
+      orxASSERT(_pstEntry->astBindingList[i].pstSource != orxNULL);
 
-        /* Gets raw value */
-        fValue = orxInput_GetBindingValue(pstEntry->astBindingList[i].eType, pstEntry->astBindingList[i].eID);
+      /* Gets raw value (polled once per update for all its bindings) */
+      fValue = _pstEntry->astBindingList[i].pstSource->fValue;
 
-        /* Depending on mode */
-        switch(pstEntry->astBindingList[i].eMode)
+      /* Depending on mode */
+      switch(_pstEntry->astBindingList[i].eMode)
+      {
+        default:
+        case orxINPUT_MODE_FULL:
         {
-          default:
-          case orxINPUT_MODE_FULL:
-          {
-            /* Uses raw value */
-            pstEntry->astBindingList[i].fValue = fValue;
+          /* Uses raw value */
+          _pstEntry->astBindingList[i].fValue = fValue;
 
-            break;
-          }
+          break;
+        }
 
-          case orxINPUT_MODE_POSITIVE:
-          {
-            /* Stores it if positive */
-            pstEntry->astBindingList[i].fValue = (fValue > orxFLOAT_0) ? fValue : orxFLOAT_0;
+        case orxINPUT_MODE_POSITIVE:
+        {
+          /* Stores it if positive */
+          _pstEntry->astBindingList[i].fValue = (fValue > orxFLOAT_0) ? fValue : orxFLOAT_0;
 
-            break;
-          }
+          break;
+        }
 
-          case orxINPUT_MODE_NEGATIVE:
-          {
-            /* Stores it if negative */
-            pstEntry->astBindingList[i].fValue = (fValue < orxFLOAT_0) ? -fValue : orxFLOAT_0;
+        case orxINPUT_MODE_NEGATIVE:
+        {
+          /* Stores it if negative */
+          _pstEntry->astBindingList[i].fValue = (fValue < orxFLOAT_0) ? -fValue : orxFLOAT_0;
 
-            break;
-          }
+          break;
         }
+      }
 
-        /* Gets test value */
-        fTestValue = (orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL)) ? pstEntry->fExternalValue : pstEntry->astBindingList[i].fValue;
+      /* Gets test value */
+      fTestValue = (orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL)) ? _pstEntry->fExternalValue : _pstEntry->astBindingList[i].fValue;
 
-        /* Active? */
-        if(orxMath_Abs(fTestValue) > pstEntry->fThreshold)
+      /* Active? */
+      if(orxMath_Abs(fTestValue) > _pstEntry->fThreshold)
+      {
+        /* First one? */
+        if(bStatusSet == orxFALSE)
         {
-          /* First one? */
-          if(bStatusSet == orxFALSE)
-          {
-            /* Stores active index value */
-            u32ActiveIndex = i;
+          /* Stores active index value */
+          u32ActiveIndex = i;
 
-            /* Updates status */
-            bActive = orxTRUE;
+          /* Updates status */
+          bActive = orxTRUE;
 
-            /* Updates set status */
-            bStatusSet = orxTRUE;
-          }
+          /* Updates set status */
+          bStatusSet = orxTRUE;
         }
-        else
+      }
+      else
+      {
+        /* Is in combine mode? */
+        if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE))
         {
-          /* Is in combine mode? */
-          if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE))
-          {
-            /* Updates status */
-            bActive = orxFALSE;
+          /* Updates status */
+          bActive = orxFALSE;
 
-            /* Updates set status */
-            bStatusSet = orxTRUE;
-          }
+          /* Updates set status */
+          bStatusSet = orxTRUE;
         }
       }
     }
+  }
 
-    /* No binding? */
-    if(bHasBinding == orxFALSE)
+  /* No binding? */
+  if(bHasBinding == orxFALSE)
+  {
+    /* Has external value? */
+    if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL))
     {
-      /* Has external value? */
-      if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL))
-      {
-        /* Updates active status */
-        bActive = (pstEntry->fExternalValue != orxFLOAT_0);
-      }
+      /* Updates active status */
+      bActive = (_pstEntry->fExternalValue != orxFLOAT_0);
     }
+  }
 
-    /* Active? */
-    if(bActive != orxFALSE)
+  /* Active? */
+  if(bActive != orxFALSE)
+  {
+    /* Was not active and should send events? */
+    if(!orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE))
     {
-      /* Was not active and should send events? */
-      if(!orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE))
-      {
-        orxINPUT_EVENT_PAYLOAD stPayload;
+      orxINPUT_EVENT_PAYLOAD stPayload;
 
-        /* Inits event payload */
-        orxMemory_Zero(&stPayload, sizeof(orxINPUT_EVENT_PAYLOAD));
-        stPayload.zSetName    = _pstSet->zName;
-        stPayload.zInputName  = pstEntry->zName;
+      /* Inits event payload */
+      orxMemory_Zero(&stPayload, sizeof(orxINPUT_EVENT_PAYLOAD));
+      stPayload.zSetName    = _pstSet->zName;
+      stPayload.zInputName  = _pstEntry->zName;
 
-        /* Is in combine mode? */
-        if(orxFLAG_GET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL) == orxINPUT_KU32_ENTRY_FLAG_COMBINE)
+      /* Is in combine mode? */
+      if(orxFLAG_GET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL) == orxINPUT_KU32_ENTRY_FLAG_COMBINE)
+      {
+        orxU32 i;
+
+        /* For all bindings */
+        for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
         {
-          orxU32 i;
+          /* Updates payload */
+          stPayload.aeType[i]   = _pstEntry->astBindingList[i].eType;
+          stPayload.aeMode[i]   = _pstEntry->astBindingList[i].eMode;
+          stPayload.aeID[i]     = _pstEntry->astBindingList[i].eID;
+          stPayload.afValue[i]  = orxInput_ScaleValue(_pstEntry->astBindingList[i].fValue, _pstEntry->fThreshold, _pstEntry->fMultiplier);
+        }
 
-          /* For all bindings */
-          for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
-          {
-            /* Updates payload */
-            stPayload.aeType[i]   = pstEntry->astBindingList[i].eType;
-            stPayload.aeMode[i]   = pstEntry->astBindingList[i].eMode;
-            stPayload.aeID[i]     = pstEntry->astBindingList[i].eID;
-            stPayload.afValue[i]  = orxInput_ScaleValue(pstEntry->astBindingList[i].fValue, pstEntry->fThreshold, pstEntry->fMultiplier);
-          }
+        /* Updates status */
+        orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS | orxINPUT_KU32_ENTRY_FLAG_ACTIVE | orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING, orxINPUT_KU32_ENTRY_FLAG_NONE);
+      }
+      else
+      {
+        orxU32 i;
 
-          /* Updates status */
-          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS | orxINPUT_KU32_ENTRY_FLAG_ACTIVE | orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING, orxINPUT_KU32_ENTRY_FLAG_NONE);
+        /* External value? */
+        if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL))
+        {
+          /* Updates payload values */
+          stPayload.aeType[0]   = orxINPUT_TYPE_EXTERNAL;
+          stPayload.aeID[0]     = orxENUM_NONE;
+          stPayload.aeMode[0]   = orxINPUT_MODE_FULL;
+          stPayload.afValue[0]  = _pstEntry->fExternalValue;
         }
         else
         {
-          orxU32 i;
-
-          /* External value? */
-          if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL))
-          {
-            /* Updates payload values */
-            stPayload.aeType[0]   = orxINPUT_TYPE_EXTERNAL;
-            stPayload.aeID[0]     = orxENUM_NONE;
-            stPayload.aeMode[0]   = orxINPUT_MODE_FULL;
-            stPayload.afValue[0]  = pstEntry->fExternalValue;
-          }
-          else
-          {
-            /* Updates active binding values */
-            stPayload.aeType[0]   = pstEntry->astBindingList[u32ActiveIndex].eType;
-            stPayload.aeID[0]     = pstEntry->astBindingList[u32ActiveIndex].eID;
-            stPayload.aeMode[0]   = pstEntry->astBindingList[u32ActiveIndex].eMode;
-            stPayload.afValue[0]  = orxInput_ScaleValue(pstEntry->astBindingList[u32ActiveIndex].fValue, pstEntry->fThreshold, pstEntry->fMultiplier);
-          }
-
-          /* For all unused bindings */
-          for(i = 1; i < orxINPUT_KU32_BINDING_NUMBER; i++)
-          {
-            /* Cleans it */
-            stPayload.aeType[i] = orxINPUT_TYPE_NONE;
-          }
+          /* Updates active binding values */
+          stPayload.aeType[0]   = _pstEntry->astBindingList[u32ActiveIndex].eType;
+          stPayload.aeID[0]     = _pstEntry->astBindingList[u32ActiveIndex].eID;
+          stPayload.aeMode[0]   = _pstEntry->astBindingList[u32ActiveIndex].eMode;
+          stPayload.afValue[0]  = orxInput_ScaleValue(_pstEntry->astBindingList[u32ActiveIndex].fValue, _pstEntry->fThreshold, _pstEntry->fMultiplier);
+        }
 
-          /* Updates status */
-          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS | orxINPUT_KU32_ENTRY_FLAG_ACTIVE | (u32ActiveIndex << orxINPUT_KU32_ENTRY_SHIFT_LAST_ACTIVE_BINDING), orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING);
+        /* For all unused bindings */
+        for(i = 1; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+        {
+          /* Cleans it */
+          stPayload.aeType[i] = orxINPUT_TYPE_NONE;
         }
 
-        /* Sends event */
-        orxEVENT_SEND(orxEVENT_TYPE_INPUT, orxINPUT_EVENT_ON, orxNULL, orxNULL, &stPayload);
-      }
-      else
-      {
         /* Updates status */
-        orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE | (u32ActiveIndex << orxINPUT_KU32_ENTRY_SHIFT_LAST_ACTIVE_BINDING), orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING | orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS);
+        orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS | orxINPUT_KU32_ENTRY_FLAG_ACTIVE | (u32ActiveIndex << orxINPUT_KU32_ENTRY_SHIFT_LAST_ACTIVE_BINDING), orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING);
       }
+
+      /* Sends event */
+      orxEVENT_SEND(orxEVENT_TYPE_INPUT, orxINPUT_EVENT_ON, orxNULL, orxNULL, &stPayload);
     }
     else
     {
-      /* Was active and should send events? */
-      if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE))
-      {
-        orxINPUT_EVENT_PAYLOAD stPayload;
+      /* Updates status */
+      orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE | (u32ActiveIndex << orxINPUT_KU32_ENTRY_SHIFT_LAST_ACTIVE_BINDING), orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING | orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS);
+    }
+  }
+  else
+  {
+    /* Was active and should send events? */
+    if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE))
+    {
+      orxINPUT_EVENT_PAYLOAD stPayload;
 
-        /* Inits event payload */
-        orxMemory_Zero(&stPayload, sizeof(orxINPUT_EVENT_PAYLOAD));
-        stPayload.zSetName    = _pstSet->zName;
-        stPayload.zInputName  = pstEntry->zName;
+      /* Inits event payload */
+      orxMemory_Zero(&stPayload, sizeof(orxINPUT_EVENT_PAYLOAD));
+      stPayload.zSetName    = _pstSet->zName;
+      stPayload.zInputName  = _pstEntry->zName;
 
-        /* Is in combine mode? */
-        if(orxFLAG_GET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL) == orxINPUT_KU32_ENTRY_FLAG_COMBINE)
+      /* Is in combine mode? */
+      if(orxFLAG_GET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE | orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL) == orxINPUT_KU32_ENTRY_FLAG_COMBINE)
+      {
+        orxU32 i;
+
+        /* For all bindings */
+        for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
         {
-          orxU32 i;
+          /* Updates payload */
+          stPayload.aeType[i]   = _pstEntry->astBindingList[i].eType;
+          stPayload.aeMode[i]   = _pstEntry->astBindingList[i].eMode;
+          stPayload.aeID[i]     = _pstEntry->astBindingList[i].eID;
+          stPayload.afValue[i]  = orxInput_ScaleValue(_pstEntry->astBindingList[i].fValue, _pstEntry->fThreshold, _pstEntry->fMultiplier);;
+        }
+      }
+      else
+      {
+        orxU32 i;
 
-          /* For all bindings */
-          for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
-          {
-            /* Updates payload */
-            stPayload.aeType[i]   = pstEntry->astBindingList[i].eType;
-            stPayload.aeMode[i]   = pstEntry->astBindingList[i].eMode;
-            stPayload.aeID[i]     = pstEntry->astBindingList[i].eID;
-            stPayload.afValue[i]  = orxInput_ScaleValue(pstEntry->astBindingList[i].fValue, pstEntry->fThreshold, pstEntry->fMultiplier);;
-          }
+        /* External value? */
+        if(orxFLAG_TEST(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL))
+        {
+          /* Updates payload values */
+          stPayload.aeType[0]   = orxINPUT_TYPE_EXTERNAL;
+          stPayload.aeID[0]     = orxENUM_NONE;
+          stPayload.aeMode[0]   = orxINPUT_MODE_FULL;
+          stPayload.afValue[0]  = _pstEntry->fExternalValue;
         }
         else
         {
-          orxU32 i;
-
-          /* External value? */
-          if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_LAST_EXTERNAL))
-          {
-            /* Updates payload values */
-            stPayload.aeType[0]   = orxINPUT_TYPE_EXTERNAL;
-            stPayload.aeID[0]     = orxENUM_NONE;
-            stPayload.aeMode[0]   = orxINPUT_MODE_FULL;
-            stPayload.afValue[0]  = pstEntry->fExternalValue;
-          }
-          else
-          {
-            orxU32 u32LastActiveIndex;
+          orxU32 u32LastActiveIndex;
 
-            /* Gets last active index */
-            u32LastActiveIndex = (pstEntry->u32Status & orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING) >> orxINPUT_KU32_ENTRY_SHIFT_LAST_ACTIVE_BINDING;
+          /* Gets last active index */
+          u32LastActiveIndex = (_pstEntry->u32Status & orxINPUT_KU32_ENTRY_MASK_LAST_ACTIVE_BINDING) >> orxINPUT_KU32_ENTRY_SHIFT_LAST_ACTIVE_BINDING;
 
-            /* Checks */
-            orxASSERT(u32LastActiveIndex < orxINPUT_KU32_BINDING_NUMBER);
+          /* Checks */
+          orxASSERT(u32LastActiveIndex < orxINPUT_KU32_BINDING_NUMBER);
 
-            /* Updates active binding values */
-            stPayload.aeType[0]   = pstEntry->astBindingList[u32LastActiveIndex].eType;
-            stPayload.aeID[0]     = pstEntry->astBindingList[u32LastActiveIndex].eID;
-            stPayload.aeMode[0]   = pstEntry->astBindingList[u32LastActiveIndex].eMode;
-            stPayload.afValue[0]  = orxInput_ScaleValue(pstEntry->astBindingList[u32LastActiveIndex].fValue, pstEntry->fThreshold, pstEntry->fMultiplier);
-          }
+          /* Updates active binding values */
+          stPayload.aeType[0]   = _pstEntry->astBindingList[u32LastActiveIndex].eType;
+          stPayload.aeID[0]     = _pstEntry->astBindingList[u32LastActiveIndex].eID;
+          stPayload.aeMode[0]   = _pstEntry->astBindingList[u32LastActiveIndex].eMode;
+          stPayload.afValue[0]  = orxInput_ScaleValue(_pstEntry->astBindingList[u32LastActiveIndex].fValue, _pstEntry->fThreshold, _pstEntry->fMultiplier);
+        }
 
-          /* For all unused bindings */
-          for(i = 1; i < orxINPUT_KU32_BINDING_NUMBER; i++)
-          {
-            /* Cleans it */
-            stPayload.aeType[i] = orxINPUT_TYPE_NONE;
-          }
+        /* For all unused bindings */
+        for(i = 1; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+        {
+          /* Cleans it */
+          stPayload.aeType[i] = orxINPUT_TYPE_NONE;
         }
+      }
 
-        /* Updates status */
-        orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS, orxINPUT_KU32_ENTRY_FLAG_ACTIVE);
+      /* Updates status */
+      orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS, orxINPUT_KU32_ENTRY_FLAG_ACTIVE);
 
-        /* Sends event */
-        orxEVENT_SEND(orxEVENT_TYPE_INPUT, orxINPUT_EVENT_OFF, orxNULL, orxNULL, &stPayload);
-      }
-      else
-      {
-        /* Updates status */
-        orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS);
-      }
+      /* Sends event */
+      orxEVENT_SEND(orxEVENT_TYPE_INPUT, orxINPUT_EVENT_OFF, orxNULL, orxNULL, &stPayload);
+    }
+    else
+    {
+      /* Updates status */
+      orxFLAG_SET(_pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS);
+    }
+  }
+}
+
+/** Updates a set
+ * @param[in] _pstSet           Set to update
+ */
+static orxINLINE void orxInput_UpdateSet(orxINPUT_SET *_pstSet)
+{
+  orxINPUT_ENTRY *pstEntry;
+
+  /* For all entries */
+  for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(_pstSet->stEntryList));
+      pstEntry != orxNULL;
+      pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+  {
+    /* Needs update? (dirty bindings, new status or external value) */
+    if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_MASK_UPDATE))
+    {
+      /* Updates it */
+      orxInput_UpdateEntry(_pstSet, pstEntry);
     }
   }
 }
@@ -902,6 +1247,9 @@ static void orxFASTCALL orxInput_Update(const orxCLOCK_INFO *_pstClockInfo, void
   /* Updates mouse move */
   orxMouse_GetMoveDelta(&(sstInput.vMouseMove));
 
+  /* Updates sources */
+  orxInput_UpdateSources();
+
   /* Gets set from parameter */
   pstSet = (orxINPUT_SET *)_pContext;
 
@@ -965,15 +1313,22 @@ static orxINLINE orxINPUT_ENTRY *orxInput_CreateEntry(const orxSTRING _zEntryNam
       /* Inits it */
       pstResult->u32ID      = orxString_GetID(_zEntryName);
       pstResult->zName      = orxString_GetFromID(pstResult->u32ID);
-      pstResult->u32Status  = orxINPUT_KU32_ENTRY_FLAG_NONE;
+      pstResult->u32Status  = orxINPUT_KU32_ENTRY_FLAG_DIRTY;
       pstResult->fThreshold = orxINPUT_KF_DEFAULT_THRESHOLD;
       pstResult->fMultiplier= orxINPUT_KF_DEFAULT_MULTIPLIER;
       for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
       {
-        pstResult->astBindingList[i].eType  = orxINPUT_TYPE_NONE;
-        pstResult->astBindingList[i].eID    = orxENUM_NONE;
-        pstResult->astBindingList[i].eMode  = orxINPUT_MODE_NONE;
+        pstResult->astBindingList[i].eType      = orxINPUT_TYPE_NONE;
+        pstResult->astBindingList[i].eID        = orxENUM_NONE;
+        pstResult->astBindingList[i].eMode      = orxINPUT_MODE_NONE;
+        pstResult->astBindingList[i].pstSource  = orxNULL;
       }
+
+      /* Adds it to table */
+      orxHashTable_Add(sstInput.pstCurrentSet->pstEntryTable, (orxU64)pstResult->u32ID, pstResult);
+
+      /* Invalidates handles */
+      sstInput.u32Revision++;
     }
   }
 
@@ -987,13 +1342,28 @@ static orxINLINE orxINPUT_ENTRY *orxInput_CreateEntry(const orxSTRING _zEntryNam
  */
 static orxINLINE void orxInput_DeleteEntry(orxINPUT_SET *_pstSet, orxINPUT_ENTRY *_pstEntry)
 {
+  orxU32 i;
+
   /* Checks */
   orxASSERT(_pstSet != orxNULL);
   orxASSERT(_pstEntry != orxNULL);
 
+  /* For all bindings */
+  for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+  {
+    /* Unlinks it */
+    orxInput_UnlinkBinding(_pstEntry, i);
+  }
+
+  /* Removes it from table */
+  orxHashTable_Remove(_pstSet->pstEntryTable, (orxU64)_pstEntry->u32ID);
+
   /* Removes it from list */
   orxLinkList_Remove(&(_pstEntry->stNode));
 
+  /* Invalidates handles */
+  sstInput.u32Revision++;
+
   /* Deletes it */
   orxBank_Free(_pstSet->pstEntryBank, _pstEntry);
 
@@ -1014,11 +1384,12 @@ static orxINLINE orxINPUT_SET *orxInput_CreateSet(orxU32 _u32SetID)
   /* Valid? */
   if(pstResult != orxNULL)
   {
-    /* Creates its bank */
-    pstResult->pstEntryBank = orxBank_Create(orxINPUT_KU32_ENTRY_BANK_SIZE, sizeof(orxINPUT_ENTRY), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    /* Creates its bank & table */
+    pstResult->pstEntryBank   = orxBank_Create(orxINPUT_KU32_ENTRY_BANK_SIZE, sizeof(orxINPUT_ENTRY), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    pstResult->pstEntryTable  = orxHashTable_Create(orxINPUT_KU32_ENTRY_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
     /* Valid? */
-    if(pstResult->pstEntryBank != orxNULL)
+    if((pstResult->pstEntryBank != orxNULL) && (pstResult->pstEntryTable != orxNULL))
     {
       /* Duplicates its name */
       pstResult->zName = orxString_GetFromID(_u32SetID);
@@ -1038,14 +1409,18 @@ static orxINLINE orxINPUT_SET *orxInput_CreateSet(orxU32 _u32SetID)
 
         /* Clears its flags */
         pstResult->u32Flags = orxINPUT_KU32_SET_FLAG_NONE;
+
+        /* Invalidates handles */
+        sstInput.u32Revision++;
       }
       else
       {
         /* Logs message */
         orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Duplicating set name failed.");
 
-        /* Deletes its bank */
+        /* Deletes its bank & table */
         orxBank_Delete(pstResult->pstEntryBank);
+        orxHashTable_Delete(pstResult->pstEntryTable);
 
         /* Deletes it */
         orxBank_Free(sstInput.pstSetBank, pstResult);
@@ -1059,6 +1434,16 @@ static orxINLINE orxINPUT_SET *orxInput_CreateSet(orxU32 _u32SetID)
       /* Logs message */
       orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Failed to create input bank.");
 
+      /* Deletes its bank & table */
+      if(pstResult->pstEntryBank != orxNULL)
+      {
+        orxBank_Delete(pstResult->pstEntryBank);
+      }
+      if(pstResult->pstEntryTable != orxNULL)
+      {
+        orxHashTable_Delete(pstResult->pstEntryTable);
+      }
+
       /* Deletes the set */
       orxBank_Free(sstInput.pstSetBank, pstResult);
 
@@ -1098,6 +1483,10 @@ static orxINLINE void orxInput_DeleteSet(orxINPUT_SET *_pstSet)
     sstInput.pstCurrentSet = orxNULL;
   }
 
+  /* Deletes its bank & table */
+  orxBank_Delete(_pstSet->pstEntryBank);
+  orxHashTable_Delete(_pstSet->pstEntryTable);
+
   /* Removes set */
   orxBank_Free(sstInput.pstSetBank, _pstSet);
 
@@ -1168,11 +1557,21 @@ orxSTATUS orxFASTCALL orxInput_Init()
     /* Cleans control structure */
     orxMemory_Zero(&sstInput, sizeof(orxINPUT_STATIC));
 
-    /* Creates set banks */
-    sstInput.pstSetBank = orxBank_Create(orxINPUT_KU32_SET_BANK_SIZE, sizeof(orxINPUT_SET), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    /* Creates banks & tables */
+    sstInput.pstSetBank     = orxBank_Create(orxINPUT_KU32_SET_BANK_SIZE, sizeof(orxINPUT_SET), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstInput.pstSourceBank  = orxBank_Create(orxINPUT_KU32_SOURCE_BANK_SIZE, sizeof(orxINPUT_SOURCE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstInput.pstLinkBank    = orxBank_Create(orxINPUT_KU32_LINK_BANK_SIZE, sizeof(orxINPUT_LINK), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstInput.pstHandleBank  = orxBank_Create(orxINPUT_KU32_HANDLE_BANK_SIZE, sizeof(orxINPUT_HANDLE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstInput.pstSourceTable = orxHashTable_Create(orxINPUT_KU32_SOURCE_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstInput.pstHandleTable = orxHashTable_Create(orxINPUT_KU32_HANDLE_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
     /* Valid? */
-    if(sstInput.pstSetBank != orxNULL)
+    if((sstInput.pstSetBank != orxNULL)
+    && (sstInput.pstSourceBank != orxNULL)
+    && (sstInput.pstLinkBank != orxNULL)
+    && (sstInput.pstHandleBank != orxNULL)
+    && (sstInput.pstSourceTable != orxNULL)
+    && (sstInput.pstHandleTable != orxNULL))
     {
       orxCLOCK *pstClock;
 
@@ -1204,16 +1603,38 @@ orxSTATUS orxFASTCALL orxInput_Init()
         {
           /* Deletes clock */
           orxClock_Delete(pstClock);
-
-          /* Deletes set bank */
-          orxBank_Delete(sstInput.pstSetBank);
         }
       }
-      else
+    }
+
+    /* Failure? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Deletes banks & tables */
+      if(sstInput.pstSetBank != orxNULL)
       {
-        /* Deletes set bank */
         orxBank_Delete(sstInput.pstSetBank);
       }
+      if(sstInput.pstSourceBank != orxNULL)
+      {
+        orxBank_Delete(sstInput.pstSourceBank);
+      }
+      if(sstInput.pstLinkBank != orxNULL)
+      {
+        orxBank_Delete(sstInput.pstLinkBank);
+      }
+      if(sstInput.pstHandleBank != orxNULL)
+      {
+        orxBank_Delete(sstInput.pstHandleBank);
+      }
+      if(sstInput.pstSourceTable != orxNULL)
+      {
+        orxHashTable_Delete(sstInput.pstSourceTable);
+      }
+      if(sstInput.pstHandleTable != orxNULL)
+      {
+        orxHashTable_Delete(sstInput.pstHandleTable);
+      }
     }
   }
   else
@@ -1252,9 +1673,19 @@ void orxFASTCALL orxInput_Exit()
       orxInput_DeleteSet(pstSet);
     }
 
-    /* Clears sets bank */
+    /* Clears banks & tables */
     orxBank_Delete(sstInput.pstSetBank);
     sstInput.pstSetBank = orxNULL;
+    orxBank_Delete(sstInput.pstSourceBank);
+    sstInput.pstSourceBank = orxNULL;
+    orxBank_Delete(sstInput.pstLinkBank);
+    sstInput.pstLinkBank = orxNULL;
+    orxBank_Delete(sstInput.pstHandleBank);
+    sstInput.pstHandleBank = orxNULL;
+    orxHashTable_Delete(sstInput.pstSourceTable);
+    sstInput.pstSourceTable = orxNULL;
+    orxHashTable_Delete(sstInput.pstHandleTable);
+    sstInput.pstHandleTable = orxNULL;
 
     /* Gets core clock */
     pstClock = orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE);
@@ -1297,6 +1728,9 @@ orxSTATUS orxFASTCALL orxInput_Load(const orxSTRING _zFileName)
   {
     orxINPUT_SET *pstPreviousSet;
 
+    /* Invalidates handles */
+    sstInput.u32Revision++;
+
     /* Stores current set */
     pstPreviousSet = sstInput.pstCurrentSet;
 
@@ -1701,24 +2135,15 @@ orxBOOL orxFASTCALL orxInput_IsActive(const orxSTRING _zInputName)
   if((sstInput.pstCurrentSet != orxNULL) && (_zInputName != orxSTRING_EMPTY))
   {
     orxINPUT_ENTRY *pstEntry;
-    orxU32          u32EntryID;
 
-    /* Gets its ID */
-    u32EntryID = orxString_ToCRC(_zInputName);
+    /* Gets entry */
+    pstEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zInputName));
 
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    /* Found? */
+    if(pstEntry != orxNULL)
     {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
-      {
-        /* Updates result */
-        bResult = (orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE)) ? orxTRUE : orxFALSE;
-
-        break;
-      }
+      /* Updates result */
+      bResult = (orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE)) ? orxTRUE : orxFALSE;
     }
   }
 
@@ -1742,24 +2167,15 @@ orxBOOL orxFASTCALL orxInput_HasNewStatus(const orxSTRING _zInputName)
   if((sstInput.pstCurrentSet != orxNULL) && (_zInputName != orxSTRING_EMPTY))
   {
     orxINPUT_ENTRY *pstEntry;
-    orxU32          u32EntryID;
 
-    /* Gets its ID */
-    u32EntryID = orxString_ToCRC(_zInputName);
+    /* Gets entry */
+    pstEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zInputName));
 
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    /* Found? */
+    if(pstEntry != orxNULL)
     {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
-      {
-        /* Updates result */
-        bResult = (orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS)) ? orxTRUE : orxFALSE;
-
-        break;
-      }
+      /* Updates result */
+      bResult = (orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS)) ? orxTRUE : orxFALSE;
     }
   }
 
@@ -1783,50 +2199,154 @@ orxFLOAT orxFASTCALL orxInput_GetValue(const orxSTRING _zInputName)
   if((sstInput.pstCurrentSet != orxNULL) && (_zInputName != orxSTRING_EMPTY))
   {
     orxINPUT_ENTRY *pstEntry;
-    orxU32          u32EntryID;
 
-    /* Gets its ID */
+    /* Gets entry */
+    pstEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zInputName));
+
+    /* Found? */
+    if(pstEntry != orxNULL)
+    {
+      /* Updates result */
+      fResult = orxInput_GetEntryValue(pstEntry);
+    }
+  }
+
+  /* Done! */
+  return fResult;
+}
+
+/** Gets a handle for fast repeated queries of an input of the current set (stays valid across reloads, until the module exits)
+ * @param[in] _zInputName       Concerned input name (in the current working set)
+ * @return orxINPUT_HANDLE / orxNULL
+ */
+orxINPUT_HANDLE *orxFASTCALL orxInput_GetHandle(const orxSTRING _zInputName)
+{
+  orxINPUT_HANDLE *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zInputName != orxNULL);
+
+  /* Valid? */
+  if((sstInput.pstCurrentSet != orxNULL) && (_zInputName != orxSTRING_EMPTY))
+  {
+    orxU32  u32EntryID;
+    orxU64  u64Key;
+
+    /* Gets entry ID */
     u32EntryID = orxString_ToCRC(_zInputName);
 
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    /* Gets handle key */
+    u64Key = ((orxU64)sstInput.pstCurrentSet->u32ID << 32) | (orxU64)u32EntryID;
+
+    /* Gets existing handle */
+    pstResult = (orxINPUT_HANDLE *)orxHashTable_Get(sstInput.pstHandleTable, u64Key);
+
+    /* Not found? */
+    if(pstResult == orxNULL)
     {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
+      /* Allocates it */
+      pstResult = (orxINPUT_HANDLE *)orxBank_Allocate(sstInput.pstHandleBank);
+
+      /* Valid? */
+      if(pstResult != orxNULL)
       {
-        orxU32 i;
+        /* Inits it */
+        pstResult->u32SetID     = sstInput.pstCurrentSet->u32ID;
+        pstResult->u32EntryID   = u32EntryID;
+        pstResult->pstEntry     = orxInput_GetEntry(sstInput.pstCurrentSet, u32EntryID);
+        pstResult->u32Revision  = sstInput.u32Revision;
+
+        /* Adds it to table */
+        orxHashTable_Add(sstInput.pstHandleTable, u64Key, pstResult);
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "Input [%s.%s]: couldn't allocate handle.", sstInput.pstCurrentSet->zName, _zInputName);
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Is input active (using a handle)?
+ * @param[in] _pstHandle        Concerned input handle
+ * @return orxTRUE if active, orxFALSE otherwise
+ */
+orxBOOL orxFASTCALL orxInput_IsActiveFromHandle(orxINPUT_HANDLE *_pstHandle)
+{
+  orxINPUT_ENTRY *pstEntry;
+  orxBOOL         bResult = orxFALSE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_pstHandle != orxNULL);
+
+  /* Gets entry */
+  pstEntry = orxInput_ResolveHandle(_pstHandle);
+
+  /* Valid? */
+  if(pstEntry != orxNULL)
+  {
+    /* Updates result */
+    bResult = (orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE)) ? orxTRUE : orxFALSE;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Has a new active status since this frame (using a handle)?
+ * @param[in] _pstHandle        Concerned input handle
+ * @return orxTRUE if active status is new, orxFALSE otherwise
+ */
+orxBOOL orxFASTCALL orxInput_HasNewStatusFromHandle(orxINPUT_HANDLE *_pstHandle)
+{
+  orxINPUT_ENTRY *pstEntry;
+  orxBOOL         bResult = orxFALSE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_pstHandle != orxNULL);
+
+  /* Gets entry */
+  pstEntry = orxInput_ResolveHandle(_pstHandle);
+
+  /* Valid? */
+  if(pstEntry != orxNULL)
+  {
+    /* Updates result */
+    bResult = (orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NEW_STATUS)) ? orxTRUE : orxFALSE;
+  }
+
+  /* Done! */
+  return bResult;
+}
 
-        /* External value? */
-        if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL))
-        {
-          /* Updates result */
-          fResult = pstEntry->fExternalValue;
-        }
-        /* Is active? */
-        else if(orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_ACTIVE))
-        {
-          /* For all bindings */
-          for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
-          {
-            /* Valid & active? */
-            if((pstEntry->astBindingList[i].eType != orxINPUT_TYPE_NONE)
-            && (orxMath_Abs(pstEntry->astBindingList[i].fValue) > pstEntry->fThreshold))
-            {
-              /* Updates result */
-              fResult = pstEntry->astBindingList[i].fValue;
-              break;
-            }
-          }
-        }
+/** Gets input value (using a handle)
+ * @param[in] _pstHandle        Concerned input handle
+ * @return orxFLOAT
+ */
+orxFLOAT orxFASTCALL orxInput_GetValueFromHandle(orxINPUT_HANDLE *_pstHandle)
+{
+  orxINPUT_ENTRY *pstEntry;
+  orxFLOAT        fResult = orxFLOAT_0;
 
-        /* Updates result */
-        fResult = orxInput_ScaleValue(fResult, pstEntry->fThreshold, pstEntry->fMultiplier);
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstInput.u32Flags, orxINPUT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_pstHandle != orxNULL);
 
-        break;
-      }
-    }
+  /* Gets entry */
+  pstEntry = orxInput_ResolveHandle(_pstHandle);
+
+  /* Valid? */
+  if(pstEntry != orxNULL)
+  {
+    /* Updates result */
+    fResult = orxInput_GetEntryValue(pstEntry);
   }
 
   /* Done! */
@@ -1849,26 +2369,10 @@ orxSTATUS orxFASTCALL orxInput_SetValue(const orxSTRING _zInputName, orxFLOAT _f
   /* Valid? */
   if((sstInput.pstCurrentSet != orxNULL) && (_zInputName != orxSTRING_EMPTY))
   {
-    orxINPUT_ENTRY *pstEntry, *pstSelectedEntry = orxNULL;
-    orxU32          u32EntryID;
+    orxINPUT_ENTRY *pstSelectedEntry;
 
-    /* Gets entry ID */
-    u32EntryID = orxString_ToCRC(_zInputName);
-
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
-    {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
-      {
-        /* Updates selection */
-        pstSelectedEntry = pstEntry;
-
-        break;
-      }
-    }
+    /* Gets entry */
+    pstSelectedEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zInputName));
 
     /* Entry not found? */
     if(pstSelectedEntry == orxNULL)
@@ -1911,26 +2415,10 @@ orxSTATUS orxFASTCALL orxInput_SetPermanentValue(const orxSTRING _zInputName, or
   /* Valid? */
   if((sstInput.pstCurrentSet != orxNULL) && (_zInputName != orxSTRING_EMPTY))
   {
-    orxINPUT_ENTRY *pstEntry, *pstSelectedEntry = orxNULL;
-    orxU32          u32EntryID;
+    orxINPUT_ENTRY *pstSelectedEntry;
 
-    /* Gets entry ID */
-    u32EntryID = orxString_ToCRC(_zInputName);
-
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
-    {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
-      {
-        /* Updates selection */
-        pstSelectedEntry = pstEntry;
-
-        break;
-      }
-    }
+    /* Gets entry */
+    pstSelectedEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zInputName));
 
     /* Entry not found? */
     if(pstSelectedEntry == orxNULL)
@@ -1973,30 +2461,21 @@ orxSTATUS orxFASTCALL orxInput_ResetValue(const orxSTRING _zInputName)
   if((sstInput.pstCurrentSet != orxNULL) && (_zInputName != orxSTRING_EMPTY))
   {
     orxINPUT_ENTRY *pstEntry;
-    orxU32          u32EntryID;
 
-    /* Gets entry ID */
-    u32EntryID = orxString_ToCRC(_zInputName);
+    /* Gets entry */
+    pstEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zInputName));
 
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    /* Found? */
+    if(pstEntry != orxNULL)
     {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
-      {
-        /* Clears its value */
-        pstEntry->fExternalValue = orxFLOAT_0;
-
-        /* Updates its status */
-        orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT);
+      /* Clears its value */
+      pstEntry->fExternalValue = orxFLOAT_0;
 
-        /* Updates result */
-        eResult = orxSTATUS_SUCCESS;
+      /* Updates its status */
+      orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_RESET_EXTERNAL, orxINPUT_KU32_ENTRY_FLAG_EXTERNAL | orxINPUT_KU32_ENTRY_FLAG_PERMANENT);
 
-        break;
-      }
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
     }
   }
 
@@ -2020,24 +2499,15 @@ orxFLOAT orxFASTCALL orxInput_GetThreshold(const orxSTRING _zInputName)
   if((sstInput.pstCurrentSet != orxNULL) && (_zInputName != orxSTRING_EMPTY))
   {
     orxINPUT_ENTRY *pstEntry;
-    orxU32          u32EntryID;
 
-    /* Gets entry ID */
-    u32EntryID = orxString_ToCRC(_zInputName);
+    /* Gets entry */
+    pstEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zInputName));
 
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    /* Found? */
+    if(pstEntry != orxNULL)
     {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
-      {
-        /* Updates result */
-        fResult = pstEntry->fThreshold;
-
-        break;
-      }
+      /* Updates result */
+      fResult = pstEntry->fThreshold;
     }
   }
 
@@ -2063,27 +2533,21 @@ orxSTATUS orxFASTCALL orxInput_SetThreshold(const orxSTRING _zInputName, orxFLOA
   if((sstInput.pstCurrentSet != orxNULL) && (_zInputName != orxSTRING_EMPTY))
   {
     orxINPUT_ENTRY *pstEntry;
-    orxU32          u32EntryID;
 
-    /* Gets entry ID */
-    u32EntryID = orxString_ToCRC(_zInputName);
+    /* Gets entry */
+    pstEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zInputName));
 
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    /* Found? */
+    if(pstEntry != orxNULL)
     {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
-      {
-        /* Stores threshold */
-        pstEntry->fThreshold = _fThreshold;
+      /* Stores threshold */
+      pstEntry->fThreshold = _fThreshold;
 
-        /* Updates result */
-        eResult = orxSTATUS_SUCCESS;
+      /* Marks it as dirty */
+      orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_DIRTY, orxINPUT_KU32_ENTRY_FLAG_NONE);
 
-        break;
-      }
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
     }
   }
 
@@ -2107,24 +2571,15 @@ orxFLOAT orxFASTCALL orxInput_GetMultiplier(const orxSTRING _zInputName)
   if((sstInput.pstCurrentSet != orxNULL) && (_zInputName != orxSTRING_EMPTY))
   {
     orxINPUT_ENTRY *pstEntry;
-    orxU32          u32EntryID;
 
-    /* Gets entry ID */
-    u32EntryID = orxString_ToCRC(_zInputName);
+    /* Gets entry */
+    pstEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zInputName));
 
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    /* Found? */
+    if(pstEntry != orxNULL)
     {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
-      {
-        /* Updates result */
-        fResult = pstEntry->fMultiplier;
-
-        break;
-      }
+      /* Updates result */
+      fResult = pstEntry->fMultiplier;
     }
   }
 
@@ -2149,27 +2604,18 @@ orxSTATUS orxFASTCALL orxInput_SetMultiplier(const orxSTRING _zInputName, orxFLO
   if((sstInput.pstCurrentSet != orxNULL) && (_zInputName != orxSTRING_EMPTY))
   {
     orxINPUT_ENTRY *pstEntry;
-    orxU32          u32EntryID;
 
-    /* Gets entry ID */
-    u32EntryID = orxString_ToCRC(_zInputName);
+    /* Gets entry */
+    pstEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zInputName));
 
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    /* Found? */
+    if(pstEntry != orxNULL)
     {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
-      {
-        /* Stores multiplier */
-        pstEntry->fMultiplier = _fMultiplier;
+      /* Stores multiplier */
+      pstEntry->fMultiplier = _fMultiplier;
 
-        /* Updates result */
-        eResult = orxSTATUS_SUCCESS;
-
-        break;
-      }
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
     }
   }
 
@@ -2194,36 +2640,27 @@ orxSTATUS orxFASTCALL orxInput_SetCombineMode(const orxSTRING _zName, orxBOOL _b
   if((sstInput.pstCurrentSet != orxNULL) && (_zName != orxSTRING_EMPTY))
   {
     orxINPUT_ENTRY *pstEntry;
-    orxU32          u32EntryID;
 
-    /* Gets entry ID */
-    u32EntryID = orxString_ToCRC(_zName);
+    /* Gets entry */
+    pstEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zName));
 
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    /* Found? */
+    if(pstEntry != orxNULL)
     {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
+      /* Is in combine mode? */
+      if(_bCombine != orxFALSE)
       {
-        /* Is in combine mode? */
-        if(_bCombine != orxFALSE)
-        {
-          /* Updates its status */
-          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE, orxINPUT_KU32_ENTRY_FLAG_NONE);
-        }
-        else
-        {
-          /* Updates its status */
-          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_NONE, orxINPUT_KU32_ENTRY_FLAG_COMBINE);
-        }
-
-        /* Updates result */
-        eResult = orxSTATUS_SUCCESS;
-
-        break;
+        /* Updates its status */
+        orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE | orxINPUT_KU32_ENTRY_FLAG_DIRTY, orxINPUT_KU32_ENTRY_FLAG_NONE);
+      }
+      else
+      {
+        /* Updates its status */
+        orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_DIRTY, orxINPUT_KU32_ENTRY_FLAG_COMBINE);
       }
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
     }
   }
 
@@ -2247,24 +2684,15 @@ orxBOOL orxFASTCALL orxInput_IsInCombineMode(const orxSTRING _zName)
   if((sstInput.pstCurrentSet != orxNULL) && (_zName != orxSTRING_EMPTY))
   {
     orxINPUT_ENTRY *pstEntry;
-    orxU32          u32EntryID;
 
-    /* Gets entry ID */
-    u32EntryID = orxString_ToCRC(_zName);
+    /* Gets entry */
+    pstEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zName));
 
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    /* Found? */
+    if(pstEntry != orxNULL)
     {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
-      {
-        /* Updates result */
-        bResult = orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE) ? orxTRUE : orxFALSE;
-
-        break;
-      }
+      /* Updates result */
+      bResult = orxFLAG_TEST(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_COMBINE) ? orxTRUE : orxFALSE;
     }
   }
 
@@ -2366,20 +2794,40 @@ orxSTATUS orxFASTCALL orxInput_Bind(const orxSTRING _zName, orxINPUT_TYPE _eType
           orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "Input [%s.%s]: replacing <%s> with <%s>", sstInput.pstCurrentSet->zName, pstEntry->zName, orxInput_GetBindingName(pstEntry->astBindingList[u32OldestIndex].eType, pstEntry->astBindingList[u32OldestIndex].eID, pstEntry->astBindingList[u32OldestIndex].eMode), orxInput_GetBindingName(_eType, _eID, _eMode));
         }
 
+        /* Unlinks previous binding */
+        orxInput_UnlinkBinding(pstEntry, u32OldestIndex);
+
         /* Updates binding */
         pstEntry->astBindingList[u32OldestIndex].eType  = _eType;
         pstEntry->astBindingList[u32OldestIndex].eID    = _eID;
         pstEntry->astBindingList[u32OldestIndex].eMode  = _eMode;
         pstEntry->astBindingList[u32OldestIndex].fValue = orxFLOAT_0;
 
-        /* Gets new oldest index */
-        u32OldestIndex = (u32OldestIndex + 1) % orxINPUT_KU32_BINDING_NUMBER;
+        /* Links it to its source */
+        if(orxInput_LinkBinding(pstEntry, u32OldestIndex) != orxSTATUS_FAILURE)
+        {
+          /* Gets new oldest index */
+          u32OldestIndex = (u32OldestIndex + 1) % orxINPUT_KU32_BINDING_NUMBER;
 
-        /* Updates status */
-        orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_BOUND | u32OldestIndex, orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING);
+          /* Updates status */
+          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_BOUND | orxINPUT_KU32_ENTRY_FLAG_DIRTY | u32OldestIndex, orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING);
 
-        /* Updates result */
-        eResult = orxSTATUS_SUCCESS;
+          /* Updates result */
+          eResult = orxSTATUS_SUCCESS;
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "Input [%s.%s]: couldn't link <%s>.", sstInput.pstCurrentSet->zName, pstEntry->zName, orxInput_GetBindingName(_eType, _eID, _eMode));
+
+          /* Clears binding */
+          pstEntry->astBindingList[u32OldestIndex].eType  = orxINPUT_TYPE_NONE;
+          pstEntry->astBindingList[u32OldestIndex].eID    = orxENUM_NONE;
+          pstEntry->astBindingList[u32OldestIndex].eMode  = orxINPUT_MODE_NONE;
+
+          /* Marks it as dirty */
+          orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_DIRTY, orxINPUT_KU32_ENTRY_FLAG_NONE);
+        }
       }
     }
     else
@@ -2429,6 +2877,9 @@ orxSTATUS orxFASTCALL orxInput_Unbind(orxINPUT_TYPE _eType, orxENUM _eID, orxINP
           orxU32  j;
           orxBOOL bBound = orxFALSE;
 
+          /* Unlinks it */
+          orxInput_UnlinkBinding(pstEntry, i);
+
           /* Updates binding */
           pstEntry->astBindingList[i].eType = orxINPUT_TYPE_NONE;
 
@@ -2448,12 +2899,12 @@ orxSTATUS orxFASTCALL orxInput_Unbind(orxINPUT_TYPE _eType, orxENUM _eID, orxINP
           if(bBound != orxFALSE)
           {
             /* Updates status */
-            orxFLAG_SET(pstEntry->u32Status, i, orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING);
+            orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_DIRTY | i, orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING);
           }
           else
           {
             /* Updates status */
-            orxFLAG_SET(pstEntry->u32Status, i, orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING | orxINPUT_KU32_ENTRY_FLAG_BOUND);
+            orxFLAG_SET(pstEntry->u32Status, orxINPUT_KU32_ENTRY_FLAG_DIRTY | i, orxINPUT_KU32_ENTRY_MASK_OLDEST_BINDING | orxINPUT_KU32_ENTRY_FLAG_BOUND);
           }
 
           /* Updates result */
@@ -2592,27 +3043,18 @@ orxSTATUS orxFASTCALL orxInput_GetBinding(const orxSTRING _zName, orxU32 _u32Bin
   if((sstInput.pstCurrentSet != orxNULL) && (_zName != orxSTRING_EMPTY))
   {
     orxINPUT_ENTRY *pstEntry;
-    orxU32          u32EntryID;
 
-    /* Gets entry ID */
-    u32EntryID = orxString_ToCRC(_zName);
+    /* Gets entry */
+    pstEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zName));
 
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    /* Found? */
+    if(pstEntry != orxNULL)
     {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
-      {
-        /* Updates result */
-        *_peType  = pstEntry->astBindingList[_u32BindingIndex].eType;
-        *_peID    = pstEntry->astBindingList[_u32BindingIndex].eID;
-        *_peMode  = pstEntry->astBindingList[_u32BindingIndex].eMode;
-        eResult   = orxSTATUS_SUCCESS;
-
-        break;
-      }
+      /* Updates result */
+      *_peType  = pstEntry->astBindingList[_u32BindingIndex].eType;
+      *_peID    = pstEntry->astBindingList[_u32BindingIndex].eID;
+      *_peMode  = pstEntry->astBindingList[_u32BindingIndex].eMode;
+      eResult   = orxSTATUS_SUCCESS;
     }
   }
 
@@ -2650,35 +3092,26 @@ orxSTATUS orxFASTCALL orxInput_GetBindingList(const orxSTRING _zName, orxINPUT_T
   if((sstInput.pstCurrentSet != orxNULL) && (_zName != orxSTRING_EMPTY))
   {
     orxINPUT_ENTRY *pstEntry;
-    orxU32          u32EntryID;
 
-    /* Gets entry ID */
-    u32EntryID = orxString_ToCRC(_zName);
+    /* Gets entry */
+    pstEntry = orxInput_GetEntry(sstInput.pstCurrentSet, orxString_ToCRC(_zName));
 
-    /* For all entries */
-    for(pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetFirst(&(sstInput.pstCurrentSet->stEntryList));
-        pstEntry != orxNULL;
-        pstEntry = (orxINPUT_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    /* Found? */
+    if(pstEntry != orxNULL)
     {
-      /* Found? */
-      if(pstEntry->u32ID == u32EntryID)
-      {
-        orxU32 i;
-
-        /* For all bindings */
-        for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
-        {
-          /* Updates result */
-          _aeTypeList[i]  = pstEntry->astBindingList[i].eType;
-          _aeIDList[i]    = pstEntry->astBindingList[i].eID;
-          _aeModeList[i]  = pstEntry->astBindingList[i].eMode;
-        }
+      orxU32 i;
 
+      /* For all bindings */
+      for(i = 0; i < orxINPUT_KU32_BINDING_NUMBER; i++)
+      {
         /* Updates result */
-        eResult = orxSTATUS_SUCCESS;
-
-        break;
+        _aeTypeList[i]  = pstEntry->astBindingList[i].eType;
+        _aeIDList[i]    = pstEntry->astBindingList[i].eID;
+        _aeModeList[i]  = pstEntry->astBindingList[i].eMode;
       }
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
     }
   }
 
@@ -297,6 +297,9 @@ const orxSTRING orxiOS_GetDocumentsPath()
       /* Updates clock system */
       eClockStatus = orxClock_Update();
 
+      /* Sends posted events */
+      orxEvent_Flush();
+
       /* Sends frame stop event */
       orxEVENT_SEND(orxEVENT_TYPE_SYSTEM, orxSYSTEM_EVENT_GAME_LOOP_STOP, orxNULL, orxNULL, &stPayload);
 
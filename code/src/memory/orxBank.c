@@ -40,6 +40,8 @@
 #define orxBANK_KU32_STATIC_FLAG_NONE         0x00000000  /**< No flags have been set */
 #define orxBANK_KU32_STATIC_FLAG_READY        0x00000001  /**< The module has been initialized */
 
+#define orxBANK_KU32_SEGMENT_TABLE_SIZE       4           /**< Initial size of the segment tables */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -51,6 +53,7 @@ typedef struct __orxBANK_SEGMENT_t
 {
   void                       *pSegmentData;     /**< Pointer address on the head of the segment data cells */
   struct __orxBANK_SEGMENT_t *pstNext;          /**< Pointer on the next segment */
+  orxU32                      u32Index;         /**< Index of the segment in the bank */
   orxU32                      u32NbFree;        /**< Number of free elements in the segment */
   orxU32                      au32CellAllocationMap[0]; /**< List of bits that represents free and used elements in the segment */
 
@@ -63,6 +66,11 @@ struct __orxBANK_t
 {
   orxLINKLIST_NODE  stNode;                 /**< Linklist node */
   orxBANK_SEGMENT  *pstFirstSegment;        /**< First segment used in the bank */
+  orxBANK_SEGMENT **apstSegmentTable;       /**< Segments, indexed by their position in the bank */
+  orxBANK_SEGMENT **apstSortedSegmentTable; /**< Segments, sorted by data address */
+  orxU32            u32SegmentCounter;      /**< Number of segments */
+  orxU32            u32SegmentTableSize;    /**< Size of the segment tables */
+  orxU32            u32FreeSegmentIndex;    /**< Index of the first segment that might contain a free cell */
   orxU32            u32Counter;             /**< Number of allocated cells */
   orxU32            u32ElemSize;            /**< Size of a cell */
   orxU16            u16NbCellPerSegments;   /**< Number of cells per banks */
@@ -130,6 +138,105 @@ static orxINLINE orxBANK_SEGMENT *orxBank_CreateSegment(const orxBANK *_pstBank)
   return pstSegment;
 }
 
+/** Adds a segment to the bank's segment tables
+ * @param[in] _pstBank    Concerned bank
+ * @param[in] _pstSegment Segment to add, at the end of the bank
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxBank_AddSegment(orxBANK *_pstBank, orxBANK_SEGMENT *_pstSegment)
+{
+  orxU32    u32Min, u32Max;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstBank != orxNULL);
+  orxASSERT(_pstSegment != orxNULL);
+
+  /* Tables are full? */
+  if(_pstBank->u32SegmentCounter == _pstBank->u32SegmentTableSize)
+  {
+    orxBANK_SEGMENT **apstSegmentTable, **apstSortedSegmentTable;
+    orxU32            u32Size;
+
+    /* Gets new size */
+    u32Size = (_pstBank->u32SegmentTableSize != 0) ? _pstBank->u32SegmentTableSize << 1 : orxBANK_KU32_SEGMENT_TABLE_SIZE;
+
+    /* Allocates new tables */
+    apstSegmentTable        = (orxBANK_SEGMENT **)orxMemory_Allocate(u32Size * sizeof(orxBANK_SEGMENT *), _pstBank->eMemType);
+    apstSortedSegmentTable  = (orxBANK_SEGMENT **)orxMemory_Allocate(u32Size * sizeof(orxBANK_SEGMENT *), _pstBank->eMemType);
+
+    /* Success? */
+    if((apstSegmentTable != orxNULL) && (apstSortedSegmentTable != orxNULL))
+    {
+      /* Had previous tables? */
+      if(_pstBank->u32SegmentTableSize != 0)
+      {
+        /* Copies them */
+        orxMemory_Copy(apstSegmentTable, _pstBank->apstSegmentTable, _pstBank->u32SegmentCounter * sizeof(orxBANK_SEGMENT *));
+        orxMemory_Copy(apstSortedSegmentTable, _pstBank->apstSortedSegmentTable, _pstBank->u32SegmentCounter * sizeof(orxBANK_SEGMENT *));
+
+        /* Deletes them */
+        orxMemory_Free(_pstBank->apstSegmentTable);
+        orxMemory_Free(_pstBank->apstSortedSegmentTable);
+      }
+
+      /* Stores new tables */
+      _pstBank->apstSegmentTable        = apstSegmentTable;
+      _pstBank->apstSortedSegmentTable  = apstSortedSegmentTable;
+      _pstBank->u32SegmentTableSize     = u32Size;
+    }
+    else
+    {
+      /* Frees partial allocation */
+      if(apstSegmentTable != orxNULL)
+      {
+        orxMemory_Free(apstSegmentTable);
+      }
+      if(apstSortedSegmentTable != orxNULL)
+      {
+        orxMemory_Free(apstSortedSegmentTable);
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Finds its sorted position */
+    for(u32Min = 0, u32Max = _pstBank->u32SegmentCounter; u32Min < u32Max;)
+    {
+      orxU32 u32Middle;
+
+      /* Gets middle */
+      u32Middle = (u32Min + u32Max) >> 1;
+
+      /* Updates range */
+      if(_pstBank->apstSortedSegmentTable[u32Middle]->pSegmentData < _pstSegment->pSegmentData)
+      {
+        u32Min = u32Middle + 1;
+      }
+      else
+      {
+        u32Max = u32Middle;
+      }
+    }
+
+    /* Inserts it in sorted table */
+    orxMemory_Move(_pstBank->apstSortedSegmentTable + u32Min + 1, _pstBank->apstSortedSegmentTable + u32Min, (_pstBank->u32SegmentCounter - u32Min) * sizeof(orxBANK_SEGMENT *));
+    _pstBank->apstSortedSegmentTable[u32Min] = _pstSegment;
+
+    /* Adds it at the end of the indexed table */
+    _pstSegment->u32Index = _pstBank->u32SegmentCounter;
+    _pstBank->apstSegmentTable[_pstBank->u32SegmentCounter++] = _pstSegment;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Returns the segment where is stored _pCell
  * @param[in] _pstBank  Bank that stores segments
  * @param[in] _pCell    Cell stored by the segment to find
@@ -137,8 +244,8 @@ static orxINLINE orxBANK_SEGMENT *orxBank_CreateSegment(const orxBANK *_pstBank)
  */
 static orxINLINE orxBANK_SEGMENT *orxBank_GetSegment(const orxBANK *_pstBank, const void *_pCell)
 {
-  orxBANK_SEGMENT  *pstSegment, *pstResult = orxNULL;
-  orxU32            u32Size;
+  orxBANK_SEGMENT  *pstResult = orxNULL;
+  orxU32            u32Min, u32Max;
 
   /* Module initialized ? */
   orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
@@ -147,19 +254,38 @@ static orxINLINE orxBANK_SEGMENT *orxBank_GetSegment(const orxBANK *_pstBank, co
   orxASSERT(_pstBank != orxNULL);
   orxASSERT(_pCell != orxNULL);
 
-  /* For all segments */
-  for(pstSegment = _pstBank->pstFirstSegment, u32Size = _pstBank->u32ElemSize * (orxU32)_pstBank->u16NbCellPerSegments;
-      pstSegment != orxNULL;
-      pstSegment = pstSegment->pstNext)
+  /* Finds the last segment whose data starts at or before the cell */
+  for(u32Min = 0, u32Max = _pstBank->u32SegmentCounter; u32Min < u32Max;)
   {
+    orxU32 u32Middle;
+
+    /* Gets middle */
+    u32Middle = (u32Min + u32Max) >> 1;
+
+    /* Updates range */
+    if(_pstBank->apstSortedSegmentTable[u32Middle]->pSegmentData <= _pCell)
+    {
+      u32Min = u32Middle + 1;
+    }
+    else
+    {
+      u32Max = u32Middle;
+    }
+  }
+
+  /* Found? */
+  if(u32Min > 0)
+  {
+    orxBANK_SEGMENT *pstSegment;
+
+    /* Gets it */
+    pstSegment = _pstBank->apstSortedSegmentTable[u32Min - 1];
+
     /* Is cell in segment? */
-    if((_pCell >= pstSegment->pSegmentData)
-    && (((orxU32)((orxU8 *)_pCell - (orxU8 *)pstSegment->pSegmentData)) < u32Size))
+    if(((orxU32)((orxU8 *)_pCell - (orxU8 *)pstSegment->pSegmentData)) < _pstBank->u32ElemSize * (orxU32)_pstBank->u16NbCellPerSegments)
     {
       /* Updates result */
       pstResult = pstSegment;
-
-      break;
     }
   }
 
@@ -274,7 +400,8 @@ orxBANK *orxFASTCALL orxBank_Create(orxU16 _u16NbElem, orxU32 _u32Size, orxU32 _
     pstBank->pstFirstSegment          = orxBank_CreateSegment(pstBank);
 
     /* Success? */
-    if(pstBank->pstFirstSegment != orxNULL)
+    if((pstBank->pstFirstSegment != orxNULL)
+    && (orxBank_AddSegment(pstBank, pstBank->pstFirstSegment) != orxSTATUS_FAILURE))
     {
       /* Add it to the list */
       orxLinkList_AddEnd(&(sstBank.stBankList), &(pstBank->stNode));
@@ -282,6 +409,10 @@ orxBANK *orxFASTCALL orxBank_Create(orxU16 _u16NbElem, orxU32 _u32Size, orxU32 _
     else
     {
       /* Can't allocate segment, cancel bank allocation */
+      if(pstBank->pstFirstSegment != orxNULL)
+      {
+        orxMemory_Free(pstBank->pstFirstSegment);
+      }
       orxMemory_Free(pstBank);
       pstBank = orxNULL;
     }
@@ -311,6 +442,10 @@ void orxFASTCALL orxBank_Delete(orxBANK *_pstBank)
       pstSegment != orxNULL;
       pstSegmentToDelete = pstSegment, pstSegment = pstSegment->pstNext, orxMemory_Free(pstSegmentToDelete));
 
+  /* Deletes segment tables */
+  orxMemory_Free(_pstBank->apstSegmentTable);
+  orxMemory_Free(_pstBank->apstSortedSegmentTable);
+
   /* Completly Free Bank */
   orxMemory_Free(_pstBank);
 }
@@ -336,7 +471,7 @@ void *orxFASTCALL orxBank_Allocate(orxBANK *_pstBank)
 void *orxFASTCALL orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIndex, void **_ppPrevious)
 {
   orxU32            u32SegmentIndex;
-  orxBANK_SEGMENT  *pstCurrentSegment, *pstPreviousSegment;
+  orxBANK_SEGMENT  *pstCurrentSegment;
   void             *pResult = orxNULL;
 
   /* Profiles */
@@ -349,23 +484,41 @@ void *orxFASTCALL orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIn
   orxASSERT(_pstBank != orxNULL);
   orxASSERT(_pu32ItemIndex != orxNULL);
 
-  /* Finds the first segment with empty space */
-  for(u32SegmentIndex = 0, pstCurrentSegment = _pstBank->pstFirstSegment, pstPreviousSegment = orxNULL;
+  /* Finds the first segment with empty space, starting from the first one that might have some */
+  for(u32SegmentIndex = _pstBank->u32FreeSegmentIndex, pstCurrentSegment = _pstBank->apstSegmentTable[u32SegmentIndex];
       (pstCurrentSegment->pstNext != orxNULL) && (pstCurrentSegment->u32NbFree == 0);
-      u32SegmentIndex++, pstPreviousSegment = pstCurrentSegment, pstCurrentSegment = pstCurrentSegment->pstNext);
+      u32SegmentIndex++, pstCurrentSegment = pstCurrentSegment->pstNext);
+
+  /* Updates free segment index */
+  _pstBank->u32FreeSegmentIndex = u32SegmentIndex;
 
   /* Is there a free space in the current segment ? (If no, try to expand it if allowed) */
   if((pstCurrentSegment->u32NbFree == 0) && (!(_pstBank->u32Flags & orxBANK_KU32_FLAG_NOT_EXPANDABLE)))
   {
+    orxBANK_SEGMENT *pstNewSegment;
+
     /* No, Try to allocate a new segment */
-    pstCurrentSegment->pstNext = orxBank_CreateSegment(_pstBank);
+    pstNewSegment = orxBank_CreateSegment(_pstBank);
 
     /* Correct segment allocation ? */
-    if(pstCurrentSegment->pstNext != orxNULL)
+    if(pstNewSegment != orxNULL)
     {
-      /* Set the new allocated segment as the current selected one */
-      pstCurrentSegment = pstCurrentSegment->pstNext;
-      u32SegmentIndex++;
+      /* Can register it? */
+      if(orxBank_AddSegment(_pstBank, pstNewSegment) != orxSTATUS_FAILURE)
+      {
+        /* Links it */
+        pstCurrentSegment->pstNext = pstNewSegment;
+
+        /* Set the new allocated segment as the current selected one */
+        pstCurrentSegment = pstNewSegment;
+        u32SegmentIndex++;
+        _pstBank->u32FreeSegmentIndex = u32SegmentIndex;
+      }
+      else
+      {
+        /* Deletes it */
+        orxMemory_Free(pstNewSegment);
+      }
     }
   }
 
@@ -426,7 +579,7 @@ void *orxFASTCALL orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIn
         if((u32MapPartIndex == 0) && (u32BitIndex == 0))
         {
           /* Updates previous */
-          *_ppPrevious = (pstPreviousSegment != orxNULL) ? (void *)(((orxU8 *)pstPreviousSegment->pSegmentData) + _pstBank->u32ElemSize * (_pstBank->u16NbCellPerSegments - 1)) : orxNULL;
+          *_ppPrevious = (u32SegmentIndex != 0) ? (void *)(((orxU8 *)_pstBank->apstSegmentTable[u32SegmentIndex - 1]->pSegmentData) + _pstBank->u32ElemSize * (_pstBank->u16NbCellPerSegments - 1)) : orxNULL;
         }
         else
         {
@@ -503,6 +656,12 @@ void orxFASTCALL orxBank_Free(orxBANK *_pstBank, void *_pCell)
   /* Increase the number of free elements */
   pstSegment->u32NbFree++;
 
+  /* Updates free segment index */
+  if(pstSegment->u32Index < _pstBank->u32FreeSegmentIndex)
+  {
+    _pstBank->u32FreeSegmentIndex = pstSegment->u32Index;
+  }
+
   /* Updates bank counter */
   _pstBank->u32Counter--;
 
@@ -538,6 +697,9 @@ void orxFASTCALL orxBank_Clear(orxBANK *_pstBank)
 
   /* Clears bank counter */
   _pstBank->u32Counter = 0;
+
+  /* Resets free segment index */
+  _pstBank->u32FreeSegmentIndex = 0;
 }
 
 /** Compacts a bank by removing all its unused segments
@@ -545,12 +707,28 @@ void orxFASTCALL orxBank_Clear(orxBANK *_pstBank)
  */
 void orxFASTCALL orxBank_Compact(orxBANK *_pstBank)
 {
-  orxBANK_SEGMENT *pstSegment, *pstPreviousSegment;
+  orxBANK_SEGMENT  *pstSegment, *pstPreviousSegment;
+  orxU32            i, j;
 
   /* Checks */
   orxASSERT(sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBank != orxNULL);
 
+  /* Removes empty segments from sorted table, keeping its order */
+  for(i = 0, j = 0; i < _pstBank->u32SegmentCounter; i++)
+  {
+    /* Gets segment */
+    pstSegment = _pstBank->apstSortedSegmentTable[i];
+
+    /* Is first or not empty? */
+    if((pstSegment == _pstBank->pstFirstSegment)
+    || (pstSegment->u32NbFree != (orxU32)_pstBank->u16NbCellPerSegments))
+    {
+      /* Keeps it */
+      _pstBank->apstSortedSegmentTable[j++] = pstSegment;
+    }
+  }
+
   /* For all segments */
   for(pstPreviousSegment = _pstBank->pstFirstSegment, pstSegment = pstPreviousSegment->pstNext;
       pstSegment != orxNULL;
@@ -569,6 +747,20 @@ void orxFASTCALL orxBank_Compact(orxBANK *_pstBank)
       pstSegment = pstPreviousSegment;
     }
   }
+
+  /* For all segments */
+  for(pstSegment = _pstBank->pstFirstSegment, i = 0;
+      pstSegment != orxNULL;
+      pstSegment = pstSegment->pstNext, i++)
+  {
+    /* Updates its index */
+    pstSegment->u32Index = i;
+    _pstBank->apstSegmentTable[i] = pstSegment;
+  }
+
+  /* Updates counters */
+  _pstBank->u32SegmentCounter   = i;
+  _pstBank->u32FreeSegmentIndex = 0;
 }
 
 /** Compacts all banks by removing all their unused segments
@@ -670,26 +862,15 @@ void *orxFASTCALL orxBank_GetNext(const orxBANK *_pstBank, const void *_pCell)
 orxU32 orxFASTCALL orxBank_GetIndex(const orxBANK *_pstBank, const void *_pCell)
 {
   orxBANK_SEGMENT  *pstSegment;
-  orxU32            u32CellIndex, u32Size, u32SegmentCounter, u32Result = orxU32_UNDEFINED;
+  orxU32            u32CellIndex, u32Result = orxU32_UNDEFINED;
 
   /* Checks */
   orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBank != orxNULL);
   orxASSERT(_pCell != orxNULL);
 
-  /* For all segments */
-  for(pstSegment = _pstBank->pstFirstSegment, u32Size = _pstBank->u32ElemSize * (orxU32)_pstBank->u16NbCellPerSegments, u32SegmentCounter = 0;
-      pstSegment != orxNULL;
-      pstSegment = pstSegment->pstNext, u32SegmentCounter++)
-  {
-    /* Is cell in segment? */
-    if((_pCell >= pstSegment->pSegmentData)
-    && (((orxU32)((orxU8 *)_pCell - (orxU8 *)pstSegment->pSegmentData)) < u32Size))
-    {
-      /* Stops */
-      break;
-    }
-  }
+  /* Gets segment */
+  pstSegment = orxBank_GetSegment(_pstBank, _pCell);
 
   /* Checks */
   orxASSERT(pstSegment != orxNULL);
@@ -701,7 +882,7 @@ orxU32 orxFASTCALL orxBank_GetIndex(const orxBANK *_pstBank, const void *_pCell)
   if(pstSegment->au32CellAllocationMap[u32CellIndex >> 5] & (1 << (u32CellIndex & 31)))
   {
     /* Updates result */
-    u32Result = (u32SegmentCounter * (orxU32)_pstBank->u16NbCellPerSegments) + u32CellIndex;
+    u32Result = (pstSegment->u32Index * (orxU32)_pstBank->u16NbCellPerSegments) + u32CellIndex;
   }
 
   /* Done! */
@@ -724,15 +905,21 @@ void *orxFASTCALL orxBank_GetAtIndex(const orxBANK *_pstBank, orxU32 _u32Index)
   /* Non empty? */
   if(_pstBank->u32Counter > 0)
   {
-    orxBANK_SEGMENT  *pstSegment;
-    orxU32            u32Index;
+    orxU32 u32SegmentIndex;
 
-    /* Skips all segments till we hit the right one */
-    for(u32Index = _u32Index, pstSegment = _pstBank->pstFirstSegment; (u32Index >= (orxU32)_pstBank->u16NbCellPerSegments) && (pstSegment != orxNULL); u32Index -= (orxU32)_pstBank->u16NbCellPerSegments, pstSegment = pstSegment->pstNext);
+    /* Gets segment index */
+    u32SegmentIndex = _u32Index / (orxU32)_pstBank->u16NbCellPerSegments;
 
     /* Is segment valid? */
-    if(pstSegment != orxNULL)
+    if(u32SegmentIndex < _pstBank->u32SegmentCounter)
     {
+      orxBANK_SEGMENT  *pstSegment;
+      orxU32            u32Index;
+
+      /* Gets segment and local index */
+      pstSegment  = _pstBank->apstSegmentTable[u32SegmentIndex];
+      u32Index    = _u32Index - (u32SegmentIndex * (orxU32)_pstBank->u16NbCellPerSegments);
+
       /* Checks */
       orxASSERT((u32Index >> 5) < _pstBank->u16SizeSegmentBitField);
 
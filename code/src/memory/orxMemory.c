@@ -33,6 +33,15 @@
 #include "memory/orxMemory.h"
 #include "debug/orxDebug.h"
 
+#ifdef __orxMEMORY_TRACKING__
+
+  #include <stdio.h>
+
+  #undef orxMemory_Allocate
+  #undef orxMemory_Reallocate
+
+#endif /* __orxMEMORY_TRACKING__ */
+
 
 #define USE_DL_PREFIX
 #define USE_BUILTIN_FFS 1
@@ -57,6 +66,19 @@
 
 #define orxMEMORY_KZ_LITERAL_PREFIX             "MEM_"
 
+#ifdef __orxMEMORY_TRACKING__
+
+  #define orxMEMORY_KU32_SITE_NUMBER            4096        /**< Maximum number of tracked allocation sites */
+  #define orxMEMORY_KU32_SITE_TABLE_SIZE        (2 * orxMEMORY_KU32_SITE_NUMBER)
+  #define orxMEMORY_KU32_SITE_TABLE_MASK        (orxMEMORY_KU32_SITE_TABLE_SIZE - 1)
+
+  #define orxMEMORY_KU32_SNAPSHOT_MAGIC         0x53534D4F  /**< 'OMSS' */
+  #define orxMEMORY_KU32_SNAPSHOT_VERSION       1
+
+  #define orxMEMORY_KZ_UNKNOWN_SITE             "<unknown>"
+
+#endif /* __orxMEMORY_TRACKING__ */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -70,6 +92,35 @@ typedef struct __orxMEMORY_TRACKER_t
 
 } orxMEMORY_TRACKER;
 
+#if defined(__orxPROFILER__) || defined(__orxMEMORY_TRACKING__)
+
+typedef struct __orxMEMORY_HEADER_t
+{
+#ifdef __orxMEMORY_TRACKING__
+
+  orxU32            u32SiteIndex;
+
+#endif /* __orxMEMORY_TRACKING__ */
+
+  orxMEMORY_TYPE    eMemType;
+
+} orxMEMORY_HEADER;
+
+#endif /* __orxPROFILER__ || __orxMEMORY_TRACKING__ */
+
+#ifdef __orxMEMORY_TRACKING__
+
+typedef struct __orxMEMORY_SITE_t
+{
+  const orxCHAR    *zFile;
+  orxU32            u32Line;
+  orxMEMORY_TYPE    eMemType;
+  orxMEMORY_TRACKER stTracker;
+
+} orxMEMORY_SITE;
+
+#endif /* __orxMEMORY_TRACKING__ */
+
 typedef struct __orxMEMORY_STATIC_t
 {
 #ifdef __orxPROFILER__
@@ -78,6 +129,15 @@ typedef struct __orxMEMORY_STATIC_t
 
 #endif /* __orxPROFILER__ */
 
+#ifdef __orxMEMORY_TRACKING__
+
+  orxMEMORY_SITE    astSiteList[orxMEMORY_KU32_SITE_NUMBER];          /**< Allocation site list, index 0 being the unknown site */
+  orxU32            au32SiteTable[orxMEMORY_KU32_SITE_TABLE_SIZE];    /**< Allocation site table (open addressing), 0 for empty slots */
+  orxU32            u32SiteCounter;                                   /**< Allocation site counter */
+  MLOCK_T           stSiteLock;                                       /**< Allocation site lock */
+
+#endif /* __orxMEMORY_TRACKING__ */
+
   orxU32 u32Flags;   /**< Flags set by the memory module */
 
 } orxMEMORY_STATIC;
@@ -94,6 +154,301 @@ static orxMEMORY_STATIC sstMemory;
  * Private functions                                                       *
  ***************************************************************************/
 
+static orxINLINE void orxMemory_UpdateTracker(orxMEMORY_TRACKER *_pstTracker, orxU32 _u32Size, orxBOOL _bAllocate)
+{
+  /* Allocate? */
+  if(_bAllocate != orxFALSE)
+  {
+    /* Updates counters */
+    _pstTracker->u32Size += _u32Size;
+    _pstTracker->u32Counter++;
+    if(_pstTracker->u32Counter > _pstTracker->u32PeakCounter)
+    {
+      _pstTracker->u32PeakCounter = _pstTracker->u32Counter;
+    }
+    if(_pstTracker->u32Size > _pstTracker->u32PeakSize)
+    {
+      _pstTracker->u32PeakSize = _pstTracker->u32Size;
+    }
+  }
+  else
+  {
+    /* Updates counters */
+    _pstTracker->u32Size -= _u32Size;
+    _pstTracker->u32Counter--;
+  }
+
+  /* Updates operation counter */
+  _pstTracker->u32OperationCounter++;
+
+  /* Done! */
+  return;
+}
+
+#ifdef __orxMEMORY_TRACKING__
+
+static orxINLINE orxU32 orxMemory_GetSiteIndex(const orxCHAR *_zFile, orxU32 _u32Line, orxMEMORY_TYPE _eMemType)
+{
+  orxU32 u32Hash, u32Result = 0;
+
+  /* Computes site hash */
+  u32Hash = (orxU32)(size_t)_zFile ^ (_u32Line * 0x9E3779B1) ^ ((orxU32)_eMemType << 24);
+  u32Hash ^= u32Hash >> 15;
+
+  /* For all slots, starting from the site's one */
+  for(;; u32Hash++)
+  {
+    orxU32 *pu32Slot;
+
+    /* Gets slot */
+    pu32Slot = &sstMemory.au32SiteTable[u32Hash & orxMEMORY_KU32_SITE_TABLE_MASK];
+
+    /* Empty? */
+    if(*pu32Slot == 0)
+    {
+      /* Any site left? */
+      if(sstMemory.u32SiteCounter < orxMEMORY_KU32_SITE_NUMBER)
+      {
+        orxMEMORY_SITE *pstSite;
+
+        /* Inits new site */
+        pstSite           = &sstMemory.astSiteList[sstMemory.u32SiteCounter];
+        pstSite->zFile    = _zFile;
+        pstSite->u32Line  = _u32Line;
+        pstSite->eMemType = _eMemType;
+
+        /* Stores it */
+        *pu32Slot = u32Result = sstMemory.u32SiteCounter++;
+      }
+
+      break;
+    }
+    else
+    {
+      orxMEMORY_SITE *pstSite;
+
+      /* Gets site */
+      pstSite = &sstMemory.astSiteList[*pu32Slot];
+
+      /* Found? */
+      if((pstSite->u32Line == _u32Line)
+      && (pstSite->zFile == _zFile)
+      && (pstSite->eMemType == _eMemType))
+      {
+        /* Updates result */
+        u32Result = *pu32Slot;
+
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+static orxINLINE orxU32 orxMemory_TrackSite(orxU32 _u32SiteIndex, const orxCHAR *_zFile, orxU32 _u32Line, orxMEMORY_TYPE _eMemType, orxU32 _u32Size)
+{
+  orxU32 u32Result;
+
+  /* Locks sites */
+  ACQUIRE_LOCK(&sstMemory.stSiteLock);
+
+  /* Updates result */
+  u32Result = (_zFile != orxNULL) ? orxMemory_GetSiteIndex(_zFile, _u32Line, _eMemType) : _u32SiteIndex;
+
+  /* Updates its tracker */
+  orxMemory_UpdateTracker(&sstMemory.astSiteList[u32Result].stTracker, _u32Size, orxTRUE);
+
+  /* Unlocks sites */
+  RELEASE_LOCK(&sstMemory.stSiteLock);
+
+  /* Done! */
+  return u32Result;
+}
+
+static orxINLINE void orxMemory_UntrackSite(orxU32 _u32SiteIndex, orxU32 _u32Size)
+{
+  /* Checks */
+  orxASSERT(_u32SiteIndex < orxMEMORY_KU32_SITE_NUMBER);
+
+  /* Locks sites */
+  ACQUIRE_LOCK(&sstMemory.stSiteLock);
+
+  /* Updates its tracker */
+  orxMemory_UpdateTracker(&sstMemory.astSiteList[_u32SiteIndex].stTracker, _u32Size, orxFALSE);
+
+  /* Unlocks sites */
+  RELEASE_LOCK(&sstMemory.stSiteLock);
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxMEMORY_SITE *orxMemory_CopySites(orxU32 *_pu32SiteCounter)
+{
+  orxMEMORY_SITE *astResult;
+
+  /* Locks sites */
+  ACQUIRE_LOCK(&sstMemory.stSiteLock);
+
+  /* Allocates copy */
+  astResult = (orxMEMORY_SITE *)dlmalloc((size_t)(sstMemory.u32SiteCounter * sizeof(orxMEMORY_SITE)));
+
+  /* Success? */
+  if(astResult != NULL)
+  {
+    /* Copies all sites */
+    orxMemory_Copy(astResult, sstMemory.astSiteList, sstMemory.u32SiteCounter * sizeof(orxMEMORY_SITE));
+    *_pu32SiteCounter = sstMemory.u32SiteCounter;
+  }
+
+  /* Unlocks sites */
+  RELEASE_LOCK(&sstMemory.stSiteLock);
+
+  /* Done! */
+  return astResult;
+}
+
+#endif /* __orxMEMORY_TRACKING__ */
+
+static orxINLINE void *orxMemory_AllocateInternal(orxU32 _u32Size, orxMEMORY_TYPE _eMemType, const orxCHAR *_zFile, orxU32 _u32Line)
+{
+  void *pResult;
+
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_eMemType < orxMEMORY_TYPE_NUMBER);
+
+#if defined(__orxPROFILER__) || defined(__orxMEMORY_TRACKING__)
+
+  /* Allocates memory */
+  pResult = dlmalloc((size_t)(_u32Size + sizeof(orxMEMORY_HEADER)));
+
+  /* Success? */
+  if(pResult != NULL)
+  {
+    orxMEMORY_HEADER *pstHeader;
+    orxU32            u32ChunkSize;
+
+    /* Gets its header */
+    pstHeader = (orxMEMORY_HEADER *)pResult;
+
+    /* Gets memory chunk size */
+    u32ChunkSize = (orxU32)(dlmalloc_usable_size(pResult) - sizeof(orxMEMORY_HEADER));
+
+    /* Tags memory chunk */
+    pstHeader->eMemType = _eMemType;
+
+#ifdef __orxPROFILER__
+
+    /* Updates memory tracker */
+    orxMemory_Track(_eMemType, u32ChunkSize, orxTRUE);
+
+#endif /* __orxPROFILER__ */
+
+#ifdef __orxMEMORY_TRACKING__
+
+    /* Updates site tracker */
+    pstHeader->u32SiteIndex = orxMemory_TrackSite(0, _zFile, _u32Line, _eMemType, u32ChunkSize);
+
+#endif /* __orxMEMORY_TRACKING__ */
+
+    /* Updates result */
+    pResult = pstHeader + 1;
+  }
+
+#else /* __orxPROFILER__ || __orxMEMORY_TRACKING__ */
+
+  /* Allocates memory */
+  pResult = dlmalloc((size_t)_u32Size);
+
+#endif /* __orxPROFILER__ || __orxMEMORY_TRACKING__ */
+
+  /* Done! */
+  return pResult;
+}
+
+static orxINLINE void *orxMemory_ReallocateInternal(void *_pMem, orxU32 _u32Size, const orxCHAR *_zFile, orxU32 _u32Line)
+{
+  void *pResult;
+
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* Null? */
+  if(_pMem == orxNULL)
+  {
+    /* Allocates it */
+    pResult = orxMemory_AllocateInternal(_u32Size, orxMEMORY_TYPE_TEMP, _zFile, _u32Line);
+  }
+  else
+  {
+
+#if defined(__orxPROFILER__) || defined(__orxMEMORY_TRACKING__)
+
+    orxMEMORY_HEADER  stHeader;
+    orxU32            u32ChunkSize;
+
+    /* Updates pointer */
+    _pMem = (orxMEMORY_HEADER *)_pMem - 1;
+
+    /* Backups header */
+    orxMemory_Copy(&stHeader, _pMem, sizeof(orxMEMORY_HEADER));
+
+    /* Gets memory chunk size */
+    u32ChunkSize = (orxU32)(dlmalloc_usable_size(_pMem) - sizeof(orxMEMORY_HEADER));
+
+    /* Reallocates memory */
+    pResult = dlrealloc(_pMem, (size_t)(_u32Size + sizeof(orxMEMORY_HEADER)));
+
+    /* Success? */
+    if(pResult != NULL)
+    {
+      orxMEMORY_HEADER *pstHeader;
+      orxU32            u32NewChunkSize;
+
+      /* Gets its header */
+      pstHeader = (orxMEMORY_HEADER *)pResult;
+
+      /* Gets new memory chunk size */
+      u32NewChunkSize = (orxU32)(dlmalloc_usable_size(pResult) - sizeof(orxMEMORY_HEADER));
+
+      /* Tags memory chunk */
+      pstHeader->eMemType = stHeader.eMemType;
+
+#ifdef __orxPROFILER__
+
+      /* Updates memory tracker */
+      orxMemory_Track(stHeader.eMemType, u32ChunkSize, orxFALSE);
+      orxMemory_Track(stHeader.eMemType, u32NewChunkSize, orxTRUE);
+
+#endif /* __orxPROFILER__ */
+
+#ifdef __orxMEMORY_TRACKING__
+
+      /* Updates site trackers, keeping the original site if none was provided */
+      orxMemory_UntrackSite(stHeader.u32SiteIndex, u32ChunkSize);
+      pstHeader->u32SiteIndex = orxMemory_TrackSite(stHeader.u32SiteIndex, _zFile, _u32Line, stHeader.eMemType, u32NewChunkSize);
+
+#endif /* __orxMEMORY_TRACKING__ */
+
+      /* Updates result */
+      pResult = pstHeader + 1;
+    }
+
+#else /* __orxPROFILER__ || __orxMEMORY_TRACKING__ */
+
+    /* Reallocates memory */
+    pResult = dlrealloc(_pMem, (size_t)_u32Size);
+
+#endif /* __orxPROFILER__ || __orxMEMORY_TRACKING__ */
+  }
+
+  /* Done! */
+  return pResult;
+}
+
 #if defined(__orxWINDOWS__)
 
   #ifdef __orxMSVC__
@@ -218,6 +573,18 @@ orxSTATUS orxFASTCALL orxMemory_Init()
     /* Cleans static controller */
     orxMemory_Zero(&sstMemory, sizeof(orxMEMORY_STATIC));
 
+#ifdef __orxMEMORY_TRACKING__
+
+    /* Inits site lock */
+    INITIAL_LOCK(&sstMemory.stSiteLock);
+
+    /* Inits unknown site */
+    sstMemory.astSiteList[0].zFile    = orxMEMORY_KZ_UNKNOWN_SITE;
+    sstMemory.astSiteList[0].eMemType = orxMEMORY_TYPE_NONE;
+    sstMemory.u32SiteCounter          = 1;
+
+#endif /* __orxMEMORY_TRACKING__ */
+
     /* Module initialized */
     sstMemory.u32Flags = orxMEMORY_KU32_STATIC_FLAG_READY;
 
@@ -244,6 +611,13 @@ void orxFASTCALL orxMemory_Exit()
   /* Module initialized ? */
   if((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY)
   {
+#ifdef __orxMEMORY_TRACKING__
+
+    /* Deletes site lock */
+    DESTROY_LOCK(&sstMemory.stSiteLock);
+
+#endif /* __orxMEMORY_TRACKING__ */
+
     /* Module uninitialized */
     sstMemory.u32Flags = orxMEMORY_KU32_STATIC_FLAG_NONE;
   }
@@ -258,44 +632,8 @@ void orxFASTCALL orxMemory_Exit()
  */
 void *orxFASTCALL orxMemory_Allocate(orxU32 _u32Size, orxMEMORY_TYPE _eMemType)
 {
-  void *pResult;
-
-  /* Checks */
-  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
-  orxASSERT(_eMemType < orxMEMORY_TYPE_NUMBER);
-
-#ifdef __orxPROFILER__
-
-  /* Allocates memory */
-  pResult = dlmalloc((size_t)(_u32Size + sizeof(orxMEMORY_TYPE)));
-
-  /* Success? */
-  if(pResult != NULL)
-  {
-    size_t uMemoryChunkSize;
-
-    /* Tags memory chunk */
-    *(orxMEMORY_TYPE *)pResult = _eMemType;
-
-    /* Gets memory chunk size */
-    uMemoryChunkSize = dlmalloc_usable_size(pResult);
-
-    /* Updates memory tracker */
-    orxMemory_Track(_eMemType, (orxU32)(uMemoryChunkSize - sizeof(orxMEMORY_TYPE)), orxTRUE);
-
-    /* Updates result */
-    pResult = (orxU8 *)pResult + sizeof(orxMEMORY_TYPE);
-  }
-
-#else /* __orxPROFILER__ */
-
-  /* Allocates memory */
-  pResult = dlmalloc((size_t)_u32Size);
-
-#endif /* __orxPROFILER__ */
-
   /* Done! */
-  return pResult;
+  return orxMemory_AllocateInternal(_u32Size, _eMemType, orxNULL, 0);
 }
 
 /** Reallocates a previously allocated memory block, with the given new size and returns a pointer on it
@@ -307,61 +645,8 @@ void *orxFASTCALL orxMemory_Allocate(orxU32 _u32Size, orxMEMORY_TYPE _eMemType)
  */
 void *orxFASTCALL orxMemory_Reallocate(void *_pMem, orxU32 _u32Size)
 {
-  void *pResult;
-
-  /* Checks */
-  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
-
-  /* Null? */
-  if(_pMem == orxNULL)
-  {
-    /* Allocates it */
-    pResult = orxMemory_Allocate(_u32Size, orxMEMORY_TYPE_TEMP);
-  }
-  else
-  {
-
-#ifdef __orxPROFILER__
-
-    orxMEMORY_TYPE eMemType;
-    size_t         uMemoryChunkSize;
-
-    /* Updates pointer */
-    _pMem = (orxU8 *)_pMem - sizeof(orxMEMORY_TYPE);
-
-    /* Gets memory type from memory chunk tag */
-    eMemType = *(orxMEMORY_TYPE *)_pMem;
-
-    /* Gets memory chunk size */
-    uMemoryChunkSize = dlmalloc_usable_size(_pMem);
-
-    /* Reallocates memory */
-    pResult = dlrealloc(_pMem, (size_t)(_u32Size + sizeof(orxMEMORY_TYPE)));
-
-    /* Success? */
-    if(pResult != NULL)
-    {
-      /* Tags memory chunk */
-      *(orxMEMORY_TYPE *)pResult = eMemType;
-
-      /* Updates memory tracker */
-      orxMemory_Track(eMemType, (orxU32)(uMemoryChunkSize - sizeof(orxMEMORY_TYPE)), orxFALSE);
-      orxMemory_Track(eMemType, (orxU32)(dlmalloc_usable_size(pResult) - sizeof(orxMEMORY_TYPE)), orxTRUE);
-
-      /* Updates result */
-      pResult = (orxU8 *)pResult + sizeof(orxMEMORY_TYPE);
-    }
-
-#else /* __orxPROFILER__ */
-
-    /* Reallocates memory */
-    pResult = dlrealloc(_pMem, (size_t)_u32Size);
-
-#endif /* __orxPROFILER__ */
-  }
-
   /* Done! */
-  return pResult;
+  return orxMemory_ReallocateInternal(_pMem, _u32Size, orxNULL, 0);
 }
 
 /** Frees a portion of memory allocated with orxMemory_Allocateate
@@ -372,35 +657,76 @@ void orxFASTCALL orxMemory_Free(void *_pMem)
   /* Checks */
   orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
 
-#ifdef __orxPROFILER__
+#if defined(__orxPROFILER__) || defined(__orxMEMORY_TRACKING__)
 
   /* Valid? */
   if(_pMem != NULL)
   {
-    orxMEMORY_TYPE eMemType;
-    size_t         uMemoryChunkSize;
-
-    /* Updates pointer */
-    _pMem = (orxU8 *)_pMem - sizeof(orxMEMORY_TYPE);
+    orxMEMORY_HEADER *pstHeader;
+    orxU32            u32ChunkSize;
 
-    /* Gets memory type from memory chunk tag */
-    eMemType = *(orxMEMORY_TYPE *)_pMem;
+    /* Gets header */
+    pstHeader = (orxMEMORY_HEADER *)_pMem - 1;
 
     /* Gets memory chunk size */
-    uMemoryChunkSize = dlmalloc_usable_size(_pMem);
+    u32ChunkSize = (orxU32)(dlmalloc_usable_size(pstHeader) - sizeof(orxMEMORY_HEADER));
+
+#ifdef __orxPROFILER__
 
     /* Updates memory tracker */
-    orxMemory_Track(eMemType, (orxU32)(uMemoryChunkSize - sizeof(orxMEMORY_TYPE)), orxFALSE);
-  }
+    orxMemory_Track(pstHeader->eMemType, u32ChunkSize, orxFALSE);
 
 #endif /* __orxPROFILER__ */
 
+#ifdef __orxMEMORY_TRACKING__
+
+    /* Updates site tracker */
+    orxMemory_UntrackSite(pstHeader->u32SiteIndex, u32ChunkSize);
+
+#endif /* __orxMEMORY_TRACKING__ */
+
+    /* Updates pointer */
+    _pMem = pstHeader;
+  }
+
+#endif /* __orxPROFILER__ || __orxMEMORY_TRACKING__ */
+
   /* System call to free memory */
   dlfree(_pMem);
 
   return;
 }
 
+#ifdef __orxMEMORY_TRACKING__
+
+/** Allocates a portion of memory in the system and returns a pointer on it, recording the allocation site
+ * @param[in]  _u32Size  Size of the memory to allocate
+ * @param[in]  _eMemType Memory zone where data will be allocated
+ * @param[in]  _zFile    Name of the source file of the allocation site, has to remain valid (ie. __FILE__)
+ * @param[in]  _u32Line  Line of the allocation site
+ * @return  returns a pointer on the memory allocated, or orxNULL if an error has occurred
+ */
+void *orxFASTCALL orxMemory_AllocateAt(orxU32 _u32Size, orxMEMORY_TYPE _eMemType, const orxSTRING _zFile, orxU32 _u32Line)
+{
+  /* Done! */
+  return orxMemory_AllocateInternal(_u32Size, _eMemType, _zFile, _u32Line);
+}
+
+/** Reallocates a previously allocated memory block, with the given new size and returns a pointer on it, recording the allocation site
+ * @param[in]  _pMem      Memory block to reallocate
+ * @param[in]  _u32Size   Size of the memory to allocate
+ * @param[in]  _zFile     Name of the source file of the allocation site, has to remain valid (ie. __FILE__)
+ * @param[in]  _u32Line   Line of the allocation site
+ * @return  returns a pointer to the reallocated memory block or orxNULL if an error has occurred
+ */
+void *orxFASTCALL orxMemory_ReallocateAt(void *_pMem, orxU32 _u32Size, const orxSTRING _zFile, orxU32 _u32Line)
+{
+  /* Done! */
+  return orxMemory_ReallocateInternal(_pMem, _u32Size, _zFile, _u32Line);
+}
+
+#endif /* __orxMEMORY_TRACKING__ */
+
 /** Gets memory type literal name
  * @param[in] _eMemType               Concerned memory type
  * @return Memory type name
@@ -540,30 +866,119 @@ orxSTATUS orxFASTCALL orxMemory_Track(orxMEMORY_TYPE _eMemType, orxU32 _u32Size,
   /* Valid? */
   if(_eMemType < orxMEMORY_TYPE_NUMBER)
   {
-    /* Allocate? */
-    if(_bAllocate != orxFALSE)
+    /* Updates its tracker */
+    orxMemory_UpdateTracker(&sstMemory.astMemoryTrackerList[_eMemType], _u32Size, _bAllocate);
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+#endif /* __orxPROFILER__ */
+
+#ifdef __orxMEMORY_TRACKING__
+
+/** Gets the number of tracked allocation sites
+ * @return Number of allocation sites, including the unknown one (index 0), used for untracked or overflowing sites
+ */
+orxU32 orxFASTCALL orxMemory_GetSiteCounter()
+{
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstMemory.u32SiteCounter;
+}
+
+/** Gets memory usage for a given allocation site
+ * @param[in] _u32SiteIndex           Concerned allocation site index, < orxMemory_GetSiteCounter()
+ * @param[out] _pzFile                Source file of the allocation site
+ * @param[out] _pu32Line              Line of the allocation site
+ * @param[out] _peMemType             Memory type of the allocation site
+ * @param[out] _pu32Counter           Current memory allocation counter
+ * @param[out] _pu32PeakCounter       Peak memory allocation counter
+ * @param[out] _pu32Size              Current memory allocation size
+ * @param[out] _pu32PeakSize          Peak memory allocation size
+ * @param[out] _pu32OperationCounter  Total number of memory operations (malloc/free)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxMemory_GetSiteUsage(orxU32 _u32SiteIndex, const orxSTRING *_pzFile, orxU32 *_pu32Line, orxMEMORY_TYPE *_peMemType, orxU32 *_pu32Counter, orxU32 *_pu32PeakCounter, orxU32 *_pu32Size, orxU32 *_pu32PeakSize, orxU32 *_pu32OperationCounter)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* Valid? */
+  if(_u32SiteIndex < sstMemory.u32SiteCounter)
+  {
+    orxMEMORY_SITE stSite;
+
+    /* Gets a consistent copy of the site */
+    ACQUIRE_LOCK(&sstMemory.stSiteLock);
+    orxMemory_Copy(&stSite, &sstMemory.astSiteList[_u32SiteIndex], sizeof(orxMEMORY_SITE));
+    RELEASE_LOCK(&sstMemory.stSiteLock);
+
+    /* Asked for file? */
+    if(_pzFile != orxNULL)
     {
-      /* Updates counters */
-      sstMemory.astMemoryTrackerList[_eMemType].u32Size += _u32Size;
-      sstMemory.astMemoryTrackerList[_eMemType].u32Counter++;
-      if(sstMemory.astMemoryTrackerList[_eMemType].u32Counter > sstMemory.astMemoryTrackerList[_eMemType].u32PeakCounter)
-      {
-        sstMemory.astMemoryTrackerList[_eMemType].u32PeakCounter = sstMemory.astMemoryTrackerList[_eMemType].u32Counter;
-      }
-      if(sstMemory.astMemoryTrackerList[_eMemType].u32Size > sstMemory.astMemoryTrackerList[_eMemType].u32PeakSize)
-      {
-        sstMemory.astMemoryTrackerList[_eMemType].u32PeakSize = sstMemory.astMemoryTrackerList[_eMemType].u32Size;
-      }
+      /* Updates it */
+      *_pzFile = stSite.zFile;
     }
-    else
+
+    /* Asked for line? */
+    if(_pu32Line != orxNULL)
+    {
+      /* Updates it */
+      *_pu32Line = stSite.u32Line;
+    }
+
+    /* Asked for memory type? */
+    if(_peMemType != orxNULL)
+    {
+      /* Updates it */
+      *_peMemType = stSite.eMemType;
+    }
+
+    /* Asked for current counter? */
+    if(_pu32Counter != orxNULL)
+    {
+      /* Updates it */
+      *_pu32Counter = stSite.stTracker.u32Counter;
+    }
+
+    /* Asked for peak counter? */
+    if(_pu32PeakCounter != orxNULL)
+    {
+      /* Updates it */
+      *_pu32PeakCounter = stSite.stTracker.u32PeakCounter;
+    }
+
+    /* Asked for current size? */
+    if(_pu32Size != orxNULL)
     {
-      /* Updates counters */
-      sstMemory.astMemoryTrackerList[_eMemType].u32Size -= _u32Size;
-      sstMemory.astMemoryTrackerList[_eMemType].u32Counter--;
+      /* Updates it */
+      *_pu32Size = stSite.stTracker.u32Size;
+    }
+
+    /* Asked for peak size? */
+    if(_pu32PeakSize != orxNULL)
+    {
+      /* Updates it */
+      *_pu32PeakSize = stSite.stTracker.u32PeakSize;
     }
 
-    /* Updates operation counter */
-    sstMemory.astMemoryTrackerList[_eMemType].u32OperationCounter++;
+    /* Asked for total operation counter? */
+    if(_pu32OperationCounter != orxNULL)
+    {
+      /* Updates it */
+      *_pu32OperationCounter = stSite.stTracker.u32OperationCounter;
+    }
   }
   else
   {
@@ -575,4 +990,147 @@ orxSTATUS orxFASTCALL orxMemory_Track(orxMEMORY_TYPE _eMemType, orxU32 _u32Size,
   return eResult;
 }
 
-#endif /* __orxPROFILER__ */
+/** Logs the allocation sites currently holding the most memory
+ * @param[in] _u32Number              Number of sites to log, 0 for all of them
+ */
+void orxFASTCALL orxMemory_LogSites(orxU32 _u32Number)
+{
+  orxMEMORY_SITE *astSiteList;
+  orxU32          u32SiteCounter = 0;
+
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* Gets a copy of all sites (logging might allocate memory) */
+  astSiteList = orxMemory_CopySites(&u32SiteCounter);
+
+  /* Success? */
+  if(astSiteList != NULL)
+  {
+    orxU32 i;
+
+    /* Updates number of sites to log */
+    if((_u32Number == 0) || (_u32Number > u32SiteCounter))
+    {
+      _u32Number = u32SiteCounter;
+    }
+
+    /* Logs header */
+    orxLOG("%u allocation sites tracked, top %u by current size:", u32SiteCounter, _u32Number);
+
+    /* For all sites to log */
+    for(i = 0; i < _u32Number; i++)
+    {
+      orxMEMORY_SITE  stSite;
+      orxU32          j, u32Best;
+
+      /* Selects the biggest remaining site (current size, then peak size) */
+      for(j = i + 1, u32Best = i; j < u32SiteCounter; j++)
+      {
+        if((astSiteList[j].stTracker.u32Size > astSiteList[u32Best].stTracker.u32Size)
+        || ((astSiteList[j].stTracker.u32Size == astSiteList[u32Best].stTracker.u32Size)
+         && (astSiteList[j].stTracker.u32PeakSize > astSiteList[u32Best].stTracker.u32PeakSize)))
+        {
+          u32Best = j;
+        }
+      }
+
+      /* Moves it in place */
+      stSite                = astSiteList[u32Best];
+      astSiteList[u32Best]  = astSiteList[i];
+      astSiteList[i]        = stSite;
+
+      /* Logs it */
+      orxLOG("%s:%u [%s] %u bytes in %u blocks (peak: %u bytes in %u blocks), %u operations", stSite.zFile, stSite.u32Line, (stSite.eMemType < orxMEMORY_TYPE_NUMBER) ? orxMemory_GetTypeName(stSite.eMemType) : orxSTRING_EMPTY, stSite.stTracker.u32Size, stSite.stTracker.u32Counter, stSite.stTracker.u32PeakSize, stSite.stTracker.u32PeakCounter, stSite.stTracker.u32OperationCounter);
+    }
+
+    /* Frees copy */
+    dlfree(astSiteList);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Saves a binary snapshot of all the allocation sites
+ * @param[in] _zFileName              Name of the file to save
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxMemory_SaveSiteSnapshot(const orxSTRING _zFileName)
+{
+  FILE     *pstFile;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Opens file */
+  pstFile = fopen(_zFileName, "wb");
+
+  /* Success? */
+  if(pstFile != NULL)
+  {
+    orxMEMORY_SITE *astSiteList;
+    orxU32          u32SiteCounter = 0;
+
+    /* Gets a copy of all sites */
+    astSiteList = orxMemory_CopySites(&u32SiteCounter);
+
+    /* Success? */
+    if(astSiteList != NULL)
+    {
+      orxU32 au32Header[3], i;
+
+      /* Writes header */
+      au32Header[0] = orxMEMORY_KU32_SNAPSHOT_MAGIC;
+      au32Header[1] = orxMEMORY_KU32_SNAPSHOT_VERSION;
+      au32Header[2] = u32SiteCounter;
+      eResult = (fwrite(au32Header, sizeof(au32Header), 1, pstFile) == 1) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+      /* For all sites */
+      for(i = 0; (i < u32SiteCounter) && (eResult != orxSTATUS_FAILURE); i++)
+      {
+        orxU32 au32Entry[8];
+
+        /* Writes it */
+        au32Entry[0] = astSiteList[i].u32Line;
+        au32Entry[1] = (orxU32)astSiteList[i].eMemType;
+        au32Entry[2] = astSiteList[i].stTracker.u32Counter;
+        au32Entry[3] = astSiteList[i].stTracker.u32PeakCounter;
+        au32Entry[4] = astSiteList[i].stTracker.u32Size;
+        au32Entry[5] = astSiteList[i].stTracker.u32PeakSize;
+        au32Entry[6] = astSiteList[i].stTracker.u32OperationCounter;
+        au32Entry[7] = (orxU32)strlen(astSiteList[i].zFile);
+        if((fwrite(au32Entry, sizeof(au32Entry), 1, pstFile) != 1)
+        || ((au32Entry[7] != 0) && (fwrite(astSiteList[i].zFile, au32Entry[7], 1, pstFile) != 1)))
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+      }
+
+      /* Frees copy */
+      dlfree(astSiteList);
+    }
+
+    /* Closes file */
+    if(fclose(pstFile) != 0)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Failure? */
+  if(eResult == orxSTATUS_FAILURE)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_MEMORY, "Couldn't save allocation site snapshot to <%s>.", _zFileName);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+#endif /* __orxMEMORY_TRACKING__ */
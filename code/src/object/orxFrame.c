@@ -57,6 +57,7 @@
 #define orxFRAME_KU32_FLAG_NONE             0x00000000  /**< No flags */
 
 #define orxFRAME_KU32_FLAG_DATA_2D          0x10000000  /**< 2D ID flag */
+#define orxFRAME_KU32_FLAG_DIRTY            0x20000000  /**< Dirty global data flag */
 
 #define orxFRAME_KU32_MASK_ALL              0xFFFFFFFF  /**< All mask */
 
@@ -64,6 +65,7 @@
 /** Misc defines
  */
 #define orxFRAME_KU32_BANK_SIZE             2048        /**< Bank size */
+#define orxFRAME_KU32_UPDATE_CALLBACK_NUMBER  4         /**< Number of update callbacks */
 
 
 /***************************************************************************
@@ -101,6 +103,7 @@ typedef struct __orxFRAME_STATIC_t
   orxU32    u32Flags;                       /**< Control flags : 4 */
   orxFRAME *pstRoot;                        /**< Frame root : 8 */
   orxBANK  *pst2DDataBank;                  /**< 2D Data bank : 12 */
+  orxFRAME_UPDATE_FUNCTION apfnUpdateList[orxFRAME_KU32_UPDATE_CALLBACK_NUMBER]; /**< Update callbacks : 28 */
 
 } orxFRAME_STATIC;
 
@@ -537,6 +540,27 @@ static orxINLINE orxVECTOR *orxFrame_FromGlobalToLocalScale(const orxFRAME *_pst
   return pvResult;
 }
 
+/** Notifies a change of frame global data
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static orxINLINE void orxFrame_NotifyUpdate(const orxFRAME *_pstFrame)
+{
+  orxU32 i;
+
+  /* For all callbacks */
+  for(i = 0; i < orxFRAME_KU32_UPDATE_CALLBACK_NUMBER; i++)
+  {
+    /* Valid? */
+    if(sstFrame.apfnUpdateList[i] != orxNULL)
+    {
+      /* Calls it */
+      sstFrame.apfnUpdateList[i](_pstFrame);
+    }
+  }
+
+  return;
+}
+
 /** Updates frame global data using parent's global and frame local ones
  * @param[out]  _pstFrame       Frame to update
  * @param[in]   _pstParent Parent frame to use for update
@@ -577,23 +601,77 @@ static orxINLINE void orxFrame_UpdateData(orxFRAME *_pstFrame, const orxFRAME *_
   return;
 }
 
-/** Processes a frame
+/** Invalidates a frame's global data, along with the one of all its children
  * @param[in]   _pstFrame       Concerned frame
  */
-static void orxFASTCALL orxFrame_Process(orxFRAME *_pstFrame, const orxFRAME *_pstParent)
+static void orxFASTCALL orxFrame_Invalidate(orxFRAME *_pstFrame)
 {
-  orxFRAME *pstChild;
+  /* Not already dirty? (its children are then already dirty too) */
+  if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DIRTY) == orxFALSE)
+  {
+    orxFRAME *pstChild;
+
+    /* Updates flags */
+    orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_DIRTY, orxFRAME_KU32_FLAG_NONE);
 
-  /* Updates frame's data */
-  orxFrame_UpdateData(_pstFrame, _pstParent);
+    /* Notifies update */
+    orxFrame_NotifyUpdate(_pstFrame);
+
+    /* For all children */
+    for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
+        pstChild != orxNULL;
+        pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
+    {
+      /* Invalidates it */
+      orxFrame_Invalidate(pstChild);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Invalidates the global data of all the children of a frame
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static orxINLINE void orxFrame_InvalidateChildren(orxFRAME *_pstFrame)
+{
+  orxFRAME *pstChild;
 
   /* For all children */
   for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
       pstChild != orxNULL;
       pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
   {
-    /* Updates it */
-    orxFrame_Process(pstChild, _pstFrame);
+    /* Invalidates it */
+    orxFrame_Invalidate(pstChild);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Resolves a frame's global data, recomputing it along with the one of its dirty ancestors (top-down)
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static void orxFASTCALL orxFrame_Resolve(orxFRAME *_pstFrame)
+{
+  /* Dirty? */
+  if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DIRTY) != orxFALSE)
+  {
+    orxFRAME *pstParent;
+
+    /* Gets parent */
+    pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
+
+    /* Resolves it first */
+    orxFrame_Resolve(pstParent);
+
+    /* Updates frame's data */
+    orxFrame_UpdateData(_pstFrame, pstParent);
+
+    /* Updates flags */
+    orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_NONE, orxFRAME_KU32_FLAG_DIRTY);
   }
 
   /* Done! */
@@ -818,6 +896,83 @@ orxSTATUS orxFASTCALL orxFrame_Delete(orxFRAME *_pstFrame)
   return eResult;
 }
 
+/** Adds a frame update callback: it will be called every time a frame's global data gets invalidated, including when propagated from a parent
+ * @param[in]   _pfnCallback    Callback to add
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxFrame_AddUpdateCallback(const orxFRAME_UPDATE_FUNCTION _pfnCallback)
+{
+  orxU32    i, u32Free = orxFRAME_KU32_UPDATE_CALLBACK_NUMBER;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* For all callback slots */
+  for(i = 0; i < orxFRAME_KU32_UPDATE_CALLBACK_NUMBER; i++)
+  {
+    /* Already registered? */
+    if(sstFrame.apfnUpdateList[i] == _pfnCallback)
+    {
+      /* Stops */
+      u32Free = orxFRAME_KU32_UPDATE_CALLBACK_NUMBER;
+      break;
+    }
+    /* First free slot? */
+    else if((sstFrame.apfnUpdateList[i] == orxNULL) && (u32Free == orxFRAME_KU32_UPDATE_CALLBACK_NUMBER))
+    {
+      /* Stores it */
+      u32Free = i;
+    }
+  }
+
+  /* Found a free slot? */
+  if(u32Free < orxFRAME_KU32_UPDATE_CALLBACK_NUMBER)
+  {
+    /* Stores callback */
+    sstFrame.apfnUpdateList[u32Free] = _pfnCallback;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Removes a frame update callback
+ * @param[in]   _pfnCallback    Callback to remove
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxFrame_RemoveUpdateCallback(const orxFRAME_UPDATE_FUNCTION _pfnCallback)
+{
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+
+  /* For all callback slots */
+  for(i = 0; i < orxFRAME_KU32_UPDATE_CALLBACK_NUMBER; i++)
+  {
+    /* Found? */
+    if(sstFrame.apfnUpdateList[i] == _pfnCallback)
+    {
+      /* Removes it */
+      sstFrame.apfnUpdateList[i] = orxNULL;
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Sets frame parent
  * @param[in]   _pstFrame       Concerned frame
  * @param[in]   _pstParent      Parent frame to set
@@ -837,14 +992,8 @@ void orxFASTCALL orxFrame_SetParent(orxFRAME *_pstFrame, orxFRAME *_pstParent)
       /* Root is parent */
       orxStructure_SetParent(_pstFrame, sstFrame.pstRoot);
 
-      /* Profiles */
-      orxPROFILER_PUSH_MARKER("orxFrame_Process");
-
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, sstFrame.pstRoot);
-
-      /* Profiles */
-      orxPROFILER_POP_MARKER();
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
   else
@@ -855,14 +1004,8 @@ void orxFASTCALL orxFrame_SetParent(orxFRAME *_pstFrame, orxFRAME *_pstParent)
       /* Sets parent */
       orxStructure_SetParent(_pstFrame, _pstParent);
 
-      /* Profiles */
-      orxPROFILER_PUSH_MARKER("orxFrame_Process");
-
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, _pstParent);
-
-      /* Profiles */
-      orxPROFILER_POP_MARKER();
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
 
@@ -971,14 +1114,8 @@ void orxFASTCALL orxFrame_SetPosition(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpac
     /* Updates coord values */
     if(_orxFrame_SetPosition(_pstFrame, _pvPos, orxFRAME_SPACE_LOCAL) != orxFALSE)
     {
-      /* Profiles */
-      orxPROFILER_PUSH_MARKER("orxFrame_Process");
-
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, orxFRAME(orxStructure_GetParent(_pstFrame)));
-
-      /* Profiles */
-      orxPROFILER_POP_MARKER();
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
   else
@@ -986,12 +1123,15 @@ void orxFASTCALL orxFrame_SetPosition(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpac
     /* 2D data? */
     if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D) != orxFALSE)
     {
-      orxFRAME *pstParent, *pstChild;
+      orxFRAME *pstParent;
       orxVECTOR vPos;
 
       /* Gets parent frame */
       pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
 
+      /* Resolves frame (and its parent) */
+      orxFrame_Resolve(_pstFrame);
+
       /* Stores global position */
       _orxFrame_SetPosition(_pstFrame, _pvPos, orxFRAME_SPACE_GLOBAL);
 
@@ -999,20 +1139,11 @@ void orxFASTCALL orxFrame_SetPosition(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpac
       orxVector_Copy(&vPos, _pvPos);
       _orxFrame_SetPosition(_pstFrame, orxFrame_FromGlobalToLocalPosition(pstParent, &vPos), orxFRAME_SPACE_LOCAL);
 
-      /* Profiles */
-      orxPROFILER_PUSH_MARKER("orxFrame_Process");
+      /* Notifies update */
+      orxFrame_NotifyUpdate(_pstFrame);
 
-      /* For all children */
-      for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
-          pstChild != orxNULL;
-          pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
-      {
-        /* Processes it */
-        orxFrame_Process(pstChild, _pstFrame);
-      }
-
-      /* Profiles */
-      orxPROFILER_POP_MARKER();
+      /* Invalidates children */
+      orxFrame_InvalidateChildren(_pstFrame);
     }
     else
     {
@@ -1041,14 +1172,8 @@ void orxFASTCALL orxFrame_SetRotation(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpac
     /* Updates rotation value */
     if(_orxFrame_SetRotation(_pstFrame, _fRotation, orxFRAME_SPACE_LOCAL) != orxFALSE)
     {
-      /* Profiles */
-      orxPROFILER_PUSH_MARKER("orxFrame_Process");
-
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, orxFRAME(orxStructure_GetParent(_pstFrame)));
-
-      /* Profiles */
-      orxPROFILER_POP_MARKER();
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
   else
@@ -1056,31 +1181,25 @@ void orxFASTCALL orxFrame_SetRotation(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpac
     /* 2D data? */
     if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D) != orxFALSE)
     {
-      orxFRAME *pstParent, *pstChild;
+      orxFRAME *pstParent;
 
       /* Gets parent frame */
       pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
 
+      /* Resolves frame (and its parent) */
+      orxFrame_Resolve(_pstFrame);
+
       /* Stores global rotation */
       _orxFrame_SetRotation(_pstFrame, _fRotation, orxFRAME_SPACE_GLOBAL);
 
       /* Computes & stores local rotation */
       _orxFrame_SetRotation(_pstFrame, orxFrame_FromGlobalToLocalRotation(pstParent, _fRotation), orxFRAME_SPACE_LOCAL);
 
-      /* Profiles */
-      orxPROFILER_PUSH_MARKER("orxFrame_Process");
-
-      /* For all children */
-      for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
-          pstChild != orxNULL;
-          pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
-      {
-        /* Processes it */
-        orxFrame_Process(pstChild, _pstFrame);
-      }
+      /* Notifies update */
+      orxFrame_NotifyUpdate(_pstFrame);
 
-      /* Profiles */
-      orxPROFILER_POP_MARKER();
+      /* Invalidates children */
+      orxFrame_InvalidateChildren(_pstFrame);
     }
     else
     {
@@ -1110,14 +1229,8 @@ void orxFASTCALL orxFrame_SetScale(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpace,
     /* Updates scale value */
     if(_orxFrame_SetScale(_pstFrame, _pvScale, orxFRAME_SPACE_LOCAL) != orxFALSE)
     {
-      /* Profiles */
-      orxPROFILER_PUSH_MARKER("orxFrame_Process");
-
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, orxFRAME(orxStructure_GetParent(_pstFrame)));
-
-      /* Profiles */
-      orxPROFILER_POP_MARKER();
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
   else
@@ -1125,12 +1238,15 @@ void orxFASTCALL orxFrame_SetScale(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpace,
     /* 2D data? */
     if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D) != orxFALSE)
     {
-      orxFRAME *pstParent, *pstChild;
+      orxFRAME *pstParent;
       orxVECTOR vScale;
 
       /* Gets parent frame */
       pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
 
+      /* Resolves frame (and its parent) */
+      orxFrame_Resolve(_pstFrame);
+
       /* Stores global scale */
       _orxFrame_SetScale(_pstFrame, _pvScale, orxFRAME_SPACE_GLOBAL);
 
@@ -1138,20 +1254,11 @@ void orxFASTCALL orxFrame_SetScale(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpace,
       orxVector_Copy(&vScale, _pvScale);
       _orxFrame_SetScale(_pstFrame, orxFrame_FromGlobalToLocalScale(pstParent, &vScale), orxFRAME_SPACE_LOCAL);
 
-      /* Profiles */
-      orxPROFILER_PUSH_MARKER("orxFrame_Process");
+      /* Notifies update */
+      orxFrame_NotifyUpdate(_pstFrame);
 
-      /* For all children */
-      for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
-          pstChild != orxNULL;
-          pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
-      {
-        /* Processes it */
-        orxFrame_Process(pstChild, _pstFrame);
-      }
-
-      /* Profiles */
-      orxPROFILER_POP_MARKER();
+      /* Invalidates children */
+      orxFrame_InvalidateChildren(_pstFrame);
     }
     else
     {
@@ -1182,6 +1289,13 @@ orxVECTOR *orxFASTCALL orxFrame_GetPosition(orxFRAME *_pstFrame, orxFRAME_SPACE
   /* Is a 2D Frame? */
   if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D) != orxFALSE)
   {
+    /* Global? */
+    if(_eSpace == orxFRAME_SPACE_GLOBAL)
+    {
+      /* Resolves frame */
+      orxFrame_Resolve(_pstFrame);
+    }
+
     /* Updates result */
     orxVector_Copy(_pvPos, _orxFrame_GetPosition(_pstFrame, _eSpace));
     pvResult = _pvPos;
@@ -1214,6 +1328,13 @@ orxFLOAT orxFASTCALL orxFrame_GetRotation(orxFRAME *_pstFrame, orxFRAME_SPACE _e
   /* Is Frame 2D? */
   if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D) != orxFALSE)
   {
+    /* Global? */
+    if(_eSpace == orxFRAME_SPACE_GLOBAL)
+    {
+      /* Resolves frame */
+      orxFrame_Resolve(_pstFrame);
+    }
+
     /* Updates result */
     fRotation = _orxFrame_GetRotation(_pstFrame, _eSpace);
   }
@@ -1246,6 +1367,13 @@ orxVECTOR *orxFASTCALL orxFrame_GetScale(orxFRAME *_pstFrame, orxFRAME_SPACE _eS
   /* Is Frame 2D? */
   if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D) != orxFALSE)
   {
+    /* Global? */
+    if(_eSpace == orxFRAME_SPACE_GLOBAL)
+    {
+      /* Resolves frame */
+      orxFrame_Resolve(_pstFrame);
+    }
+
     /* Updates result */
     pvResult = _orxFrame_GetScale(_pstFrame, _eSpace, _pvScale);
   }
@@ -1278,6 +1406,9 @@ orxVECTOR *orxFASTCALL orxFrame_TransformPosition(orxFRAME *_pstFrame, orxFRAME_
   orxASSERT(_eSpace < orxFRAME_SPACE_NUMBER);
   orxASSERT(_pvPos != orxNULL);
 
+  /* Resolves frame */
+  orxFrame_Resolve(_pstFrame);
+
   /* Updates result */
   pvResult = (_eSpace == orxFRAME_SPACE_LOCAL) ? orxFrame_FromLocalToGlobalPosition(_pstFrame, _pvPos) : orxFrame_FromGlobalToLocalPosition(_pstFrame, _pvPos);
 
@@ -1300,6 +1431,9 @@ orxFLOAT orxFASTCALL orxFrame_TransformRotation(orxFRAME *_pstFrame, orxFRAME_SP
   orxSTRUCTURE_ASSERT(_pstFrame);
   orxASSERT(_eSpace < orxFRAME_SPACE_NUMBER);
 
+  /* Resolves frame */
+  orxFrame_Resolve(_pstFrame);
+
   /* Updates result */
   fResult = (_eSpace == orxFRAME_SPACE_LOCAL) ? orxFrame_FromLocalToGlobalRotation(_pstFrame, _fRotation) : orxFrame_FromGlobalToLocalRotation(_pstFrame, _fRotation);
 
@@ -1323,6 +1457,9 @@ orxVECTOR *orxFASTCALL orxFrame_TransformScale(orxFRAME *_pstFrame, orxFRAME_SPA
   orxASSERT(_eSpace < orxFRAME_SPACE_NUMBER);
   orxASSERT(_pvScale != orxNULL);
 
+  /* Resolves frame */
+  orxFrame_Resolve(_pstFrame);
+
   /* Updates result */
   pvResult = (_eSpace == orxFRAME_SPACE_LOCAL) ? orxFrame_FromLocalToGlobalScale(_pstFrame, _pvScale) : orxFrame_FromGlobalToLocalScale(_pstFrame, _pvScale);
 
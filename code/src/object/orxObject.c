@@ -96,6 +96,15 @@
 #define orxOBJECT_KU32_GROUP_BANK_SIZE          64
 #define orxOBJECT_KU32_GROUP_TABLE_SIZE         64
 
+#define orxOBJECT_KU32_CELL_BANK_SIZE           256
+#define orxOBJECT_KU32_CELL_TABLE_SIZE          64
+#define orxOBJECT_KU32_CELL_LEVEL_NUMBER        12          /**< Number of cell levels, each one having cells twice as big as the previous one */
+#define orxOBJECT_KF_CELL_SIZE                  orx2F(32.0f) /**< Size of the cells of the first level */
+#define orxOBJECT_KF_CELL_EPSILON               orx2F(0.0001f) /**< Relative margin added to bounding boxes before indexing them */
+#define orxOBJECT_KF_CELL_MAX_COORD             orx2F(1.0e9f) /**< Objects beyond this coordinate aren't spatially indexed */
+
+#define orxOBJECT_KU32_CANDIDATE_LIST_SIZE      256
+
 #define orxOBJECT_KZ_CONFIG_GRAPHIC_NAME        "Graphic"
 #define orxOBJECT_KZ_CONFIG_ANIMPOINTER_NAME    "AnimationSet"
 #define orxOBJECT_KZ_CONFIG_BODY                "Body"
@@ -182,6 +191,37 @@ typedef struct __orxOBJECT_STORAGE_t
 
 } orxOBJECT_STORAGE;
 
+/** Object cell structure: objects whose bounding box starts in the same area of a group's spatial index
+ */
+typedef struct __orxOBJECT_CELL_t
+{
+  orxLINKLIST                 stObjectList;     /**< Object list : 12 */
+  struct __orxOBJECT_GROUP_t *pstGroup;         /**< Group : 16 */
+  orxU64                      u64Key;           /**< Key (packed cell coordinates) : 24 */
+  orxU32                      u32Level;         /**< Level, orxU32_UNDEFINED for objects that can't be indexed : 28 */
+
+} orxOBJECT_CELL;
+
+/** Object group structure
+ */
+typedef struct __orxOBJECT_GROUP_t
+{
+  orxLINKLIST     stObjectList;                 /**< Object list : 12 */
+  orxOBJECT_CELL  stUnindexedCell;              /**< Objects that can't be spatially indexed : 40 */
+  orxHASHTABLE   *apstCellTable[orxOBJECT_KU32_CELL_LEVEL_NUMBER]; /**< Cell tables, per level : 88 */
+  orxU32          au32LevelCounter[orxOBJECT_KU32_CELL_LEVEL_NUMBER]; /**< Object counters, per level : 136 */
+
+} orxOBJECT_GROUP;
+
+/** Object candidate structure (spatial queries)
+ */
+typedef struct __orxOBJECT_CANDIDATE_t
+{
+  orxU64      u64Order;                         /**< Iteration order : 8 */
+  orxOBJECT  *pstObject;                        /**< Object : 12 */
+
+} orxOBJECT_CANDIDATE;
+
 /** Object structure
  */
 struct __orxOBJECT_t
@@ -200,6 +240,9 @@ struct __orxOBJECT_t
   orxVECTOR         vSize;                      /**< Object size : 144 */
   orxVECTOR         vPivot;                     /**< Object pivot : 156 */
   orxLINKLIST_NODE  stGroupNode;                /**< Group node: 176 */
+  orxLINKLIST_NODE  stCellNode;                 /**< Cell node: 188 */
+  orxLINKLIST_NODE  stDirtyNode;                /**< Dirty node: 200 */
+  orxU64            u64GroupOrder;              /**< Order in group: 208 */
 };
 
 /** Static structure
@@ -213,6 +256,12 @@ typedef struct __orxOBJECT_STATIC_t
   orxHASHTABLE *pstGroupTable;                  /**< Group table */
   orxLINKLIST  *pstCachedGroupList;             /**< Cached group list */
   orxU32        u32CachedGroupID;               /**< Cached group ID */
+  orxU64        u64GroupOrder;                  /**< Next order in group */
+  orxBANK      *pstCellBank;                    /**< Cell bank */
+  orxLINKLIST   stDirtyList;                    /**< Objects whose cell needs to be updated */
+  orxOBJECT_CANDIDATE *astCandidateList;        /**< Candidate list */
+  orxU32        u32CandidateSize;               /**< Candidate list size */
+  orxU32        u32CandidateCounter;            /**< Candidate counter */
   orxU32        u32Flags;                       /**< Control flags */
 
 } orxOBJECT_STATIC;
@@ -231,6 +280,641 @@ static orxOBJECT_STATIC sstObject;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Marks the cell of an object as needing an update
+ */
+static orxINLINE void orxObject_InvalidateCell(orxOBJECT *_pstObject)
+{
+  /* Not already dirty? */
+  if(orxLinkList_GetList(&(_pstObject->stDirtyNode)) == orxNULL)
+  {
+    /* Adds it to dirty list */
+    orxLinkList_AddEnd(&(sstObject.stDirtyList), &(_pstObject->stDirtyNode));
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Removes an object from its cell
+ */
+static void orxFASTCALL orxObject_RemoveFromCell(orxOBJECT *_pstObject)
+{
+  orxLINKLIST *pstCellList;
+
+  /* Gets cell list */
+  pstCellList = orxLinkList_GetList(&(_pstObject->stCellNode));
+
+  /* Valid? */
+  if(pstCellList != orxNULL)
+  {
+    orxOBJECT_CELL *pstCell;
+
+    /* Gets cell */
+    pstCell = orxSTRUCT_GET_FROM_FIELD(orxOBJECT_CELL, stObjectList, pstCellList);
+
+    /* Removes object from it */
+    orxLinkList_Remove(&(_pstObject->stCellNode));
+
+    /* Indexed cell? */
+    if(pstCell->u32Level != orxU32_UNDEFINED)
+    {
+      /* Updates level counter */
+      pstCell->pstGroup->au32LevelCounter[pstCell->u32Level]--;
+
+      /* Empty? */
+      if(orxLinkList_GetCounter(&(pstCell->stObjectList)) == 0)
+      {
+        /* Removes it from its table */
+        orxHashTable_Remove(pstCell->pstGroup->apstCellTable[pstCell->u32Level], pstCell->u64Key);
+
+        /* Deletes it */
+        orxBank_Free(sstObject.pstCellBank, pstCell);
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets the cell key of a cell coordinate pair
+ */
+static orxINLINE orxU64 orxObject_GetCellKey(orxS32 _s32X, orxS32 _s32Y)
+{
+  /* Done! */
+  return ((orxU64)(orxU32)_s32X << 32) | (orxU64)(orxU32)_s32Y;
+}
+
+/** Gets the cell coordinate of a value for a given cell size
+ */
+static orxINLINE orxS32 orxObject_GetCellCoord(orxFLOAT _fValue, orxFLOAT _fCellSize)
+{
+  /* Done! */
+  return orxF2S(orxMath_Floor(_fValue / _fCellSize));
+}
+
+/** Gets the slightly enlarged 2D axis-aligned extents of a box
+ * @return orxTRUE if the extents can be spatially indexed, orxFALSE otherwise
+ */
+static orxINLINE orxBOOL orxObject_GetCellExtents(const orxOBOX *_pstBox, orxFLOAT *_pfMinX, orxFLOAT *_pfMinY, orxFLOAT *_pfMaxX, orxFLOAT *_pfMaxY)
+{
+  orxFLOAT fOriginX, fOriginY, fMargin;
+
+  /* Gets box origin */
+  fOriginX = _pstBox->vPosition.fX - _pstBox->vPivot.fX;
+  fOriginY = _pstBox->vPosition.fY - _pstBox->vPivot.fY;
+
+  /* Gets extents */
+  *_pfMinX = fOriginX + orxMIN(orxFLOAT_0, _pstBox->vX.fX) + orxMIN(orxFLOAT_0, _pstBox->vY.fX);
+  *_pfMinY = fOriginY + orxMIN(orxFLOAT_0, _pstBox->vX.fY) + orxMIN(orxFLOAT_0, _pstBox->vY.fY);
+  *_pfMaxX = fOriginX + orxMAX(orxFLOAT_0, _pstBox->vX.fX) + orxMAX(orxFLOAT_0, _pstBox->vY.fX);
+  *_pfMaxY = fOriginY + orxMAX(orxFLOAT_0, _pstBox->vX.fY) + orxMAX(orxFLOAT_0, _pstBox->vY.fY);
+
+  /* Enlarges them to absorb rounding errors */
+  fMargin   = orxOBJECT_KF_CELL_EPSILON * (orxMath_Abs(fOriginX) + orxMath_Abs(fOriginY) + (*_pfMaxX - *_pfMinX) + (*_pfMaxY - *_pfMinY) + orxFLOAT_1);
+  *_pfMinX -= fMargin;
+  *_pfMinY -= fMargin;
+  *_pfMaxX += fMargin;
+  *_pfMaxY += fMargin;
+
+  /* Done! */
+  return ((*_pfMinX > -orxOBJECT_KF_CELL_MAX_COORD)
+       && (*_pfMinY > -orxOBJECT_KF_CELL_MAX_COORD)
+       && (*_pfMaxX < orxOBJECT_KF_CELL_MAX_COORD)
+       && (*_pfMaxY < orxOBJECT_KF_CELL_MAX_COORD)) ? orxTRUE : orxFALSE;
+}
+
+/** Updates the cell of an object
+ */
+static void orxFASTCALL orxObject_UpdateCell(orxOBJECT *_pstObject)
+{
+  orxLINKLIST *pstGroupList;
+
+  /* Gets group list */
+  pstGroupList = orxLinkList_GetList(&(_pstObject->stGroupNode));
+
+  /* Valid? */
+  if(pstGroupList != orxNULL)
+  {
+    orxOBJECT_GROUP  *pstGroup;
+    orxOBJECT_CELL   *pstCell = orxNULL;
+    orxLINKLIST      *pstCellList;
+    orxFRAME         *pstFrame;
+    orxGRAPHIC       *pstGraphic;
+
+    /* Gets group, frame & graphic */
+    pstGroup    = orxSTRUCT_GET_FROM_FIELD(orxOBJECT_GROUP, stObjectList, pstGroupList);
+    pstFrame    = orxOBJECT_GET_STRUCTURE(_pstObject, FRAME);
+    pstGraphic  = orxOBJECT_GET_STRUCTURE(_pstObject, GRAPHIC);
+
+    /* Are frame & graphic tracked? (only owned ones notify us of their changes) */
+    if((pstFrame != orxNULL)
+    && (orxStructure_GetOwner(pstFrame) == orxSTRUCTURE(_pstObject))
+    && ((pstGraphic == orxNULL)
+     || (orxStructure_GetOwner(pstGraphic) == orxSTRUCTURE(_pstObject))))
+    {
+      orxOBOX   stBox;
+      orxFLOAT  fMinX, fMinY, fMaxX, fMaxY;
+
+      /* Gets its bounding box */
+      orxObject_GetBoundingBox(_pstObject, &stBox);
+
+      /* Can be indexed? */
+      if(orxObject_GetCellExtents(&stBox, &fMinX, &fMinY, &fMaxX, &fMaxY) != orxFALSE)
+      {
+        orxFLOAT  fExtent, fCellSize;
+        orxU32    u32Level;
+
+        /* Gets extent */
+        fExtent = orxMAX(fMaxX - fMinX, fMaxY - fMinY);
+
+        /* Finds smallest level whose cells are at least as big as the box */
+        for(u32Level = 0, fCellSize = orxOBJECT_KF_CELL_SIZE;
+            (u32Level < orxOBJECT_KU32_CELL_LEVEL_NUMBER) && (fExtent > fCellSize);
+            u32Level++, fCellSize *= orx2F(2.0f));
+
+        /* Found? */
+        if(u32Level < orxOBJECT_KU32_CELL_LEVEL_NUMBER)
+        {
+          orxHASHTABLE *pstTable;
+          orxU64        u64Key;
+
+          /* Gets key */
+          u64Key = orxObject_GetCellKey(orxObject_GetCellCoord(fMinX, fCellSize), orxObject_GetCellCoord(fMinY, fCellSize));
+
+          /* Gets cell table */
+          pstTable = pstGroup->apstCellTable[u32Level];
+
+          /* Not created yet? */
+          if(pstTable == orxNULL)
+          {
+            /* Creates it */
+            pstTable = orxHashTable_Create(orxOBJECT_KU32_CELL_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+            /* Stores it */
+            pstGroup->apstCellTable[u32Level] = pstTable;
+          }
+
+          /* Valid? */
+          if(pstTable != orxNULL)
+          {
+            orxOBJECT_CELL **ppstBucket;
+
+            /* Gets cell bucket */
+            ppstBucket = (orxOBJECT_CELL **)orxHashTable_Retrieve(pstTable, u64Key);
+
+            /* Valid? */
+            if(ppstBucket != orxNULL)
+            {
+              /* Not found? */
+              if(*ppstBucket == orxNULL)
+              {
+                /* Allocates it */
+                pstCell = (orxOBJECT_CELL *)orxBank_Allocate(sstObject.pstCellBank);
+
+                /* Success? */
+                if(pstCell != orxNULL)
+                {
+                  /* Inits it */
+                  orxMemory_Zero(pstCell, sizeof(orxOBJECT_CELL));
+                  pstCell->pstGroup = pstGroup;
+                  pstCell->u64Key   = u64Key;
+                  pstCell->u32Level = u32Level;
+
+                  /* Stores it */
+                  *ppstBucket = pstCell;
+                }
+                else
+                {
+                  /* Removes empty bucket */
+                  orxHashTable_Remove(pstTable, u64Key);
+                }
+              }
+              else
+              {
+                /* Gets it */
+                pstCell = *ppstBucket;
+              }
+            }
+          }
+        }
+      }
+    }
+
+    /* No cell found? */
+    if(pstCell == orxNULL)
+    {
+      /* Uses unindexed one */
+      pstCell = &(pstGroup->stUnindexedCell);
+    }
+
+    /* Gets current cell list */
+    pstCellList = orxLinkList_GetList(&(_pstObject->stCellNode));
+
+    /* Cell changed? */
+    if(pstCellList != &(pstCell->stObjectList))
+    {
+      /* Removes object from its current cell */
+      orxObject_RemoveFromCell(_pstObject);
+
+      /* Adds it to its new one */
+      orxLinkList_AddEnd(&(pstCell->stObjectList), &(_pstObject->stCellNode));
+
+      /* Indexed cell? */
+      if(pstCell->u32Level != orxU32_UNDEFINED)
+      {
+        /* Updates level counter */
+        pstGroup->au32LevelCounter[pstCell->u32Level]++;
+      }
+    }
+  }
+  else
+  {
+    /* Removes object from its current cell */
+    orxObject_RemoveFromCell(_pstObject);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Updates the cells of all dirty objects
+ */
+static orxINLINE void orxObject_UpdateCells()
+{
+  orxLINKLIST_NODE *pstNode;
+
+  /* For all dirty objects */
+  while((pstNode = orxLinkList_GetFirst(&(sstObject.stDirtyList))) != orxNULL)
+  {
+    /* Updates its cell */
+    orxObject_UpdateCell(orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stDirtyNode, pstNode));
+
+    /* Removes it from dirty list (after the update so as to ignore the notifications it triggered) */
+    orxLinkList_Remove(pstNode);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Frame update callback
+ */
+static void orxFASTCALL orxObject_NotifyFrame(const orxFRAME *_pstFrame)
+{
+  orxOBJECT *pstObject;
+
+  /* Gets owner object */
+  pstObject = orxOBJECT(orxStructure_GetOwner(_pstFrame));
+
+  /* Valid and linked to that frame? */
+  if((pstObject != orxNULL) && (orxOBJECT_GET_STRUCTURE(pstObject, FRAME) == _pstFrame))
+  {
+    /* Invalidates its cell */
+    orxObject_InvalidateCell(pstObject);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Graphic update callback
+ */
+static void orxFASTCALL orxObject_NotifyGraphic(const orxGRAPHIC *_pstGraphic)
+{
+  orxOBJECT *pstObject;
+
+  /* Gets owner object */
+  pstObject = orxOBJECT(orxStructure_GetOwner(_pstGraphic));
+
+  /* Valid and linked to that graphic? */
+  if((pstObject != orxNULL) && (orxOBJECT_GET_STRUCTURE(pstObject, GRAPHIC) == _pstGraphic))
+  {
+    /* Invalidates its cell */
+    orxObject_InvalidateCell(pstObject);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Adds a candidate to the current spatial query
+ */
+static orxINLINE orxSTATUS orxObject_AddCandidate(orxOBJECT *_pstObject, orxU64 _u64Order)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Is list full? */
+  if(sstObject.u32CandidateCounter == sstObject.u32CandidateSize)
+  {
+    orxOBJECT_CANDIDATE  *astCandidateList;
+    orxU32                u32Size;
+
+    /* Gets new size */
+    u32Size = (sstObject.u32CandidateSize != 0) ? sstObject.u32CandidateSize << 1 : orxOBJECT_KU32_CANDIDATE_LIST_SIZE;
+
+    /* Allocates new list */
+    astCandidateList = (orxOBJECT_CANDIDATE *)orxMemory_Allocate(u32Size * sizeof(orxOBJECT_CANDIDATE), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(astCandidateList != orxNULL)
+    {
+      /* Had a previous list? */
+      if(sstObject.astCandidateList != orxNULL)
+      {
+        /* Copies its content */
+        orxMemory_Copy(astCandidateList, sstObject.astCandidateList, sstObject.u32CandidateCounter * sizeof(orxOBJECT_CANDIDATE));
+
+        /* Deletes it */
+        orxMemory_Free(sstObject.astCandidateList);
+      }
+
+      /* Stores new list */
+      sstObject.astCandidateList  = astCandidateList;
+      sstObject.u32CandidateSize  = u32Size;
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Stores candidate */
+    sstObject.astCandidateList[sstObject.u32CandidateCounter].u64Order  = _u64Order;
+    sstObject.astCandidateList[sstObject.u32CandidateCounter].pstObject = _pstObject;
+
+    /* Updates counter */
+    sstObject.u32CandidateCounter++;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Adds all the objects of a cell as candidates
+ */
+static orxSTATUS orxFASTCALL orxObject_AddCellCandidates(const orxOBJECT_CELL *_pstCell, orxBOOL _bAllGroups)
+{
+  orxLINKLIST_NODE *pstNode;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* For all its objects */
+  for(pstNode = orxLinkList_GetFirst(&(_pstCell->stObjectList));
+      (pstNode != orxNULL) && (eResult != orxSTATUS_FAILURE);
+      pstNode = orxLinkList_GetNext(pstNode))
+  {
+    orxOBJECT *pstObject;
+
+    /* Gets object */
+    pstObject = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stCellNode, pstNode);
+
+    /* Adds it, ordered by group position or by creation slot when querying all groups (see orxObject_GetNext()) */
+    eResult = orxObject_AddCandidate(pstObject, (_bAllGroups != orxFALSE) ? ((pstObject->stStructure.u64GUID & orxSTRUCTURE_GUID_MASK_ITEM_ID) >> orxSTRUCTURE_GUID_SHIFT_ITEM_ID) : pstObject->u64GroupOrder);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Adds all the objects of a group that might intersect an area as candidates
+ */
+static orxSTATUS orxFASTCALL orxObject_AddGroupCandidates(const orxOBJECT_GROUP *_pstGroup, orxFLOAT _fMinX, orxFLOAT _fMinY, orxFLOAT _fMaxX, orxFLOAT _fMaxY, orxBOOL _bAllGroups)
+{
+  orxFLOAT  fCellSize;
+  orxU32    u32Level;
+  orxSTATUS eResult;
+
+  /* Adds unindexed objects */
+  eResult = orxObject_AddCellCandidates(&(_pstGroup->stUnindexedCell), _bAllGroups);
+
+  /* For all levels */
+  for(u32Level = 0, fCellSize = orxOBJECT_KF_CELL_SIZE;
+      (u32Level < orxOBJECT_KU32_CELL_LEVEL_NUMBER) && (eResult != orxSTATUS_FAILURE);
+      u32Level++, fCellSize *= orx2F(2.0f))
+  {
+    /* Not empty? */
+    if(_pstGroup->au32LevelCounter[u32Level] != 0)
+    {
+      orxHASHTABLE *pstTable;
+      orxS32        s32MinX, s32MinY, s32MaxX, s32MaxY;
+
+      /* Gets table */
+      pstTable = _pstGroup->apstCellTable[u32Level];
+
+      /* Gets cell range: objects are stored by their min corner and aren't bigger than a cell */
+      s32MinX = orxObject_GetCellCoord(_fMinX, fCellSize) - 1;
+      s32MinY = orxObject_GetCellCoord(_fMinY, fCellSize) - 1;
+      s32MaxX = orxObject_GetCellCoord(_fMaxX, fCellSize);
+      s32MaxY = orxObject_GetCellCoord(_fMaxY, fCellSize);
+
+      /* Fewer cells in table than in range? */
+      if(orxS2F(s32MaxX - s32MinX + 1) * orxS2F(s32MaxY - s32MinY + 1) > orxU2F(orxHashTable_GetCounter(pstTable)))
+      {
+        orxHANDLE       hIterator;
+        orxU64          u64Key;
+        orxOBJECT_CELL *pstCell;
+
+        /* For all cells */
+        for(hIterator = orxHashTable_GetNext(pstTable, orxHANDLE_UNDEFINED, &u64Key, (void **)&pstCell);
+            (hIterator != orxHANDLE_UNDEFINED) && (eResult != orxSTATUS_FAILURE);
+            hIterator = orxHashTable_GetNext(pstTable, hIterator, &u64Key, (void **)&pstCell))
+        {
+          orxS32 s32X, s32Y;
+
+          /* Gets its coordinates */
+          s32X = (orxS32)(orxU32)(u64Key >> 32);
+          s32Y = (orxS32)(orxU32)u64Key;
+
+          /* In range? */
+          if((s32X >= s32MinX) && (s32X <= s32MaxX) && (s32Y >= s32MinY) && (s32Y <= s32MaxY))
+          {
+            /* Adds its objects */
+            eResult = orxObject_AddCellCandidates(pstCell, _bAllGroups);
+          }
+        }
+      }
+      else
+      {
+        orxS32 s32X, s32Y;
+
+        /* For all cells in range */
+        for(s32X = s32MinX; (s32X <= s32MaxX) && (eResult != orxSTATUS_FAILURE); s32X++)
+        {
+          for(s32Y = s32MinY; (s32Y <= s32MaxY) && (eResult != orxSTATUS_FAILURE); s32Y++)
+          {
+            const orxOBJECT_CELL *pstCell;
+
+            /* Gets cell */
+            pstCell = (const orxOBJECT_CELL *)orxHashTable_Get(pstTable, orxObject_GetCellKey(s32X, s32Y));
+
+            /* Found? */
+            if(pstCell != orxNULL)
+            {
+              /* Adds its objects */
+              eResult = orxObject_AddCellCandidates(pstCell, _bAllGroups);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Sifts down a candidate in the candidate heap
+ */
+static orxINLINE void orxObject_SiftCandidate(orxU32 _u32Index, orxU32 _u32Number)
+{
+  orxOBJECT_CANDIDATE  stCandidate;
+  orxOBJECT_CANDIDATE *astList;
+  orxU32               u32Child;
+
+  /* Gets list */
+  astList = sstObject.astCandidateList;
+
+  /* Backups candidate */
+  stCandidate = astList[_u32Index];
+
+  /* While it has children */
+  while((u32Child = (_u32Index << 1) + 1) < _u32Number)
+  {
+    /* Gets biggest child */
+    if((u32Child + 1 < _u32Number) && (astList[u32Child + 1].u64Order > astList[u32Child].u64Order))
+    {
+      u32Child++;
+    }
+
+    /* Bigger than candidate? */
+    if(astList[u32Child].u64Order > stCandidate.u64Order)
+    {
+      /* Moves it up */
+      astList[_u32Index] = astList[u32Child];
+      _u32Index = u32Child;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  /* Stores candidate */
+  astList[_u32Index] = stCandidate;
+
+  /* Done! */
+  return;
+}
+
+/** Finds all the objects that might intersect an area, sorted in iteration order (see orxObject_GetNext())
+ * If the area can't be used with the spatial index, all the objects will be iterated instead.
+ */
+static void orxFASTCALL orxObject_FindCandidates(const orxOBOX *_pstBox, orxU32 _u32GroupID)
+{
+  orxFLOAT  fMinX, fMinY, fMaxX, fMaxY;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxObject_FindCandidates");
+
+  /* Updates all dirty cells */
+  orxObject_UpdateCells();
+
+  /* Clears candidates */
+  sstObject.u32CandidateCounter = 0;
+
+  /* Can area be used with the spatial index? */
+  if(orxObject_GetCellExtents(_pstBox, &fMinX, &fMinY, &fMaxX, &fMaxY) != orxFALSE)
+  {
+    /* Has group? */
+    if(_u32GroupID != orxU32_UNDEFINED)
+    {
+      const orxOBJECT_GROUP *pstGroup;
+
+      /* Gets it */
+      pstGroup = (const orxOBJECT_GROUP *)orxHashTable_Get(sstObject.pstGroupTable, _u32GroupID);
+
+      /* Adds its candidates */
+      eResult = (pstGroup != orxNULL) ? orxObject_AddGroupCandidates(pstGroup, fMinX, fMinY, fMaxX, fMaxY, orxFALSE) : orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      orxHANDLE         hIterator;
+      orxOBJECT_GROUP  *pstGroup;
+
+      /* For all groups */
+      for(eResult = orxSTATUS_SUCCESS, hIterator = orxHashTable_GetNext(sstObject.pstGroupTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstGroup);
+          (hIterator != orxHANDLE_UNDEFINED) && (eResult != orxSTATUS_FAILURE);
+          hIterator = orxHashTable_GetNext(sstObject.pstGroupTable, hIterator, orxNULL, (void **)&pstGroup))
+      {
+        /* Adds its candidates */
+        eResult = orxObject_AddGroupCandidates(pstGroup, fMinX, fMinY, fMaxX, fMaxY, orxTRUE);
+      }
+    }
+  }
+
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    orxU32 i;
+
+    /* Sorts candidates (heap sort) */
+    for(i = sstObject.u32CandidateCounter >> 1; i != 0; i--)
+    {
+      orxObject_SiftCandidate(i - 1, sstObject.u32CandidateCounter);
+    }
+    for(i = sstObject.u32CandidateCounter; i > 1; i--)
+    {
+      orxOBJECT_CANDIDATE stCandidate;
+
+      /* Moves biggest to the end */
+      stCandidate                       = sstObject.astCandidateList[0];
+      sstObject.astCandidateList[0]     = sstObject.astCandidateList[i - 1];
+      sstObject.astCandidateList[i - 1] = stCandidate;
+
+      /* Restores heap */
+      orxObject_SiftCandidate(0, i - 1);
+    }
+  }
+  else
+  {
+    /* Iterates all objects instead */
+    sstObject.u32CandidateCounter = orxU32_UNDEFINED;
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+/** Gets next candidate found with orxObject_FindCandidates()
+ */
+static orxINLINE orxOBJECT *orxObject_GetNextCandidate(const orxOBJECT *_pstObject, orxU32 _u32GroupID, orxU32 *_pu32Index)
+{
+  orxOBJECT *pstResult;
+
+  /* Iterating all objects? */
+  if(sstObject.u32CandidateCounter == orxU32_UNDEFINED)
+  {
+    /* Gets next object */
+    pstResult = orxObject_GetNext(_pstObject, _u32GroupID);
+  }
+  else
+  {
+    /* Gets next candidate */
+    pstResult = (*_pu32Index < sstObject.u32CandidateCounter) ? sstObject.astCandidateList[(*_pu32Index)++].pstObject : orxNULL;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
 /** Update body scale
  */
 void orxFASTCALL orxObject_UpdateBodyScale(orxOBJECT *_pstObject)
@@ -3128,10 +3812,13 @@ orxSTATUS orxFASTCALL orxObject_Init()
         if(eResult != orxSTATUS_FAILURE)
         {
           /* Creates group bank */
-          sstObject.pstGroupBank = orxBank_Create(orxOBJECT_KU32_GROUP_BANK_SIZE, sizeof(orxLINKLIST), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+          sstObject.pstGroupBank = orxBank_Create(orxOBJECT_KU32_GROUP_BANK_SIZE, sizeof(orxOBJECT_GROUP), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+          /* Creates cell bank */
+          sstObject.pstCellBank = orxBank_Create(orxOBJECT_KU32_CELL_BANK_SIZE, sizeof(orxOBJECT_CELL), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
           /* Success? */
-          if(sstObject.pstGroupBank != orxNULL)
+          if((sstObject.pstGroupBank != orxNULL) && (sstObject.pstCellBank != orxNULL))
           {
             /* Creates group table */
             sstObject.pstGroupTable = orxHashTable_Create(orxOBJECT_KU32_GROUP_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
@@ -3142,6 +3829,13 @@ orxSTATUS orxFASTCALL orxObject_Init()
               /* Registers commands */
               orxObject_RegisterCommands();
 
+              /* Registers frame & graphic update callbacks (spatial index) */
+              orxFrame_AddUpdateCallback(orxObject_NotifyFrame);
+              if(orxModule_IsInitialized(orxMODULE_ID_GRAPHIC) != orxFALSE)
+              {
+                orxGraphic_AddUpdateCallback(orxObject_NotifyGraphic);
+              }
+
               /* Stores default group ID */
               sstObject.u32DefaultGroupID = orxString_GetID(orxOBJECT_KZ_DEFAULT_GROUP);
               sstObject.u32CurrentGroupID = sstObject.u32DefaultGroupID;
@@ -3154,6 +3848,9 @@ orxSTATUS orxFASTCALL orxObject_Init()
               /* Updates result */
               eResult = orxSTATUS_FAILURE;
 
+              /* Deletes cell bank */
+              orxBank_Delete(sstObject.pstCellBank);
+
               /* Deletes group bank */
               orxBank_Delete(sstObject.pstGroupBank);
 
@@ -3169,6 +3866,16 @@ orxSTATUS orxFASTCALL orxObject_Init()
             /* Updates result */
             eResult = orxSTATUS_FAILURE;
 
+            /* Deletes banks */
+            if(sstObject.pstCellBank != orxNULL)
+            {
+              orxBank_Delete(sstObject.pstCellBank);
+            }
+            if(sstObject.pstGroupBank != orxNULL)
+            {
+              orxBank_Delete(sstObject.pstGroupBank);
+            }
+
             /* Unregisters from clock */
             orxClock_Unregister(sstObject.pstClock, orxObject_UpdateAll);
 
@@ -3206,6 +3913,8 @@ orxSTATUS orxFASTCALL orxObject_Init()
  */
 void orxFASTCALL orxObject_Exit()
 {
+  orxOBJECT_GROUP *pstGroup;
+
   /* Initialized? */
   if(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY)
   {
@@ -3231,12 +3940,49 @@ void orxFASTCALL orxObject_Exit()
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_OBJECT);
 
+    /* Unregisters frame & graphic update callbacks */
+    orxFrame_RemoveUpdateCallback(orxObject_NotifyFrame);
+    if(orxModule_IsInitialized(orxMODULE_ID_GRAPHIC) != orxFALSE)
+    {
+      orxGraphic_RemoveUpdateCallback(orxObject_NotifyGraphic);
+    }
+
+    /* For all groups */
+    for(pstGroup = (orxOBJECT_GROUP *)orxBank_GetNext(sstObject.pstGroupBank, orxNULL);
+        pstGroup != orxNULL;
+        pstGroup = (orxOBJECT_GROUP *)orxBank_GetNext(sstObject.pstGroupBank, pstGroup))
+    {
+      orxU32 i;
+
+      /* For all levels */
+      for(i = 0; i < orxOBJECT_KU32_CELL_LEVEL_NUMBER; i++)
+      {
+        /* Has cell table? */
+        if(pstGroup->apstCellTable[i] != orxNULL)
+        {
+          /* Deletes it */
+          orxHashTable_Delete(pstGroup->apstCellTable[i]);
+        }
+      }
+    }
+
     /* Deletes group table */
     orxHashTable_Delete(sstObject.pstGroupTable);
 
     /* Deletes group bank */
     orxBank_Delete(sstObject.pstGroupBank);
 
+    /* Deletes cell bank */
+    orxBank_Delete(sstObject.pstCellBank);
+
+    /* Has candidate list? */
+    if(sstObject.astCandidateList != orxNULL)
+    {
+      /* Deletes it */
+      orxMemory_Free(sstObject.astCandidateList);
+      sstObject.astCandidateList = orxNULL;
+    }
+
     /* Updates flags */
     sstObject.u32Flags &= ~orxOBJECT_KU32_STATIC_FLAG_READY;
   }
@@ -3334,6 +4080,13 @@ orxSTATUS orxFASTCALL orxObject_Delete(orxOBJECT *_pstObject)
         orxLinkList_Remove(&(_pstObject->stGroupNode));
       }
 
+      /* Removes object from the spatial index */
+      if(orxLinkList_GetList(&(_pstObject->stDirtyNode)) != orxNULL)
+      {
+        orxLinkList_Remove(&(_pstObject->stDirtyNode));
+      }
+      orxObject_RemoveFromCell(_pstObject);
+
       /* Deletes structure */
       orxStructure_Delete(_pstObject);
     }
@@ -4205,6 +4958,13 @@ orxSTATUS orxFASTCALL orxObject_LinkStructure(orxOBJECT *_pstObject, orxSTRUCTUR
 
     /* Updates flags */
     orxStructure_SetFlags(_pstObject, 1 << eStructureID, orxOBJECT_KU32_FLAG_NONE);
+
+    /* Frame or graphic? */
+    if((eStructureID == orxSTRUCTURE_ID_FRAME) || (eStructureID == orxSTRUCTURE_ID_GRAPHIC))
+    {
+      /* Invalidates cell */
+      orxObject_InvalidateCell(_pstObject);
+    }
   }
   else
   {
@@ -4326,6 +5086,13 @@ void orxFASTCALL orxObject_UnlinkStructure(orxOBJECT *_pstObject, orxSTRUCTURE_I
 
     /* Updates flags */
     orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, 1 << _eStructureID);
+
+    /* Frame or graphic? */
+    if((_eStructureID == orxSTRUCTURE_ID_FRAME) || (_eStructureID == orxSTRUCTURE_ID_GRAPHIC))
+    {
+      /* Invalidates cell */
+      orxObject_InvalidateCell(_pstObject);
+    }
   }
 
   return;
@@ -4829,6 +5596,9 @@ orxSTATUS orxFASTCALL orxObject_SetPivot(orxOBJECT *_pstObject, const orxVECTOR
     /* Stores it */
     orxVector_Copy(&(_pstObject->vPivot), _pvPivot);
 
+    /* Invalidates cell */
+    orxObject_InvalidateCell(_pstObject);
+
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -4909,6 +5679,9 @@ orxSTATUS orxFASTCALL orxObject_SetSize(orxOBJECT *_pstObject, const orxVECTOR *
     /* Stores it */
     orxVector_Copy(&(_pstObject->vSize), _pvSize);
 
+    /* Invalidates cell */
+    orxObject_InvalidateCell(_pstObject);
+
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -7473,17 +8246,20 @@ orxBANK *orxFASTCALL orxObject_CreateNeighborList(const orxOBOX *_pstCheckBox, o
   orxASSERT(_pstCheckBox != orxNULL);
 
   /* Creates bank */
-  pstResult = orxBank_Create(orxOBJECT_KU32_NEIGHBOR_LIST_SIZE, sizeof(orxOBJECT *), orxBANK_KU32_FLAG_NOT_EXPANDABLE, orxMEMORY_TYPE_TEMP);
+  pstResult = orxBank_Create(orxOBJECT_KU32_NEIGHBOR_LIST_SIZE, sizeof(orxOBJECT *), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
 
   /* Valid? */
   if(pstResult != orxNULL)
   {
-    orxU32 u32Counter;
+    orxU32 u32Index = 0;
+
+    /* Finds candidates */
+    orxObject_FindCandidates(_pstCheckBox, _u32GroupID);
 
-    /* For all objects */
-    for(u32Counter = 0, pstObject = orxObject_GetNext(orxNULL, _u32GroupID);
-        (u32Counter < orxOBJECT_KU32_NEIGHBOR_LIST_SIZE) && (pstObject != orxNULL);
-        pstObject = orxObject_GetNext(pstObject, _u32GroupID))
+    /* For all candidates */
+    for(pstObject = orxObject_GetNextCandidate(orxNULL, _u32GroupID, &u32Index);
+        pstObject != orxNULL;
+        pstObject = orxObject_GetNextCandidate(pstObject, _u32GroupID, &u32Index))
     {
       /* Gets its bounding box */
       if(orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
@@ -7501,9 +8277,6 @@ orxBANK *orxFASTCALL orxObject_CreateNeighborList(const orxOBOX *_pstCheckBox, o
           {
             /* Adds object */
             *ppstObject = pstObject;
-
-            /* Updates counter */
-            u32Counter++;
           }
           else
           {
@@ -8179,9 +8952,9 @@ extern orxDLLAPI orxU32 orxFASTCALL orxObject_GetGroupID(const orxOBJECT *_pstOb
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObject, orxU32 _u32GroupID)
 {
-  orxLINKLIST **ppstBucket;
-  orxLINKLIST  *pstGroupList;
-  orxSTATUS     eResult = orxSTATUS_SUCCESS;
+  orxOBJECT_GROUP **ppstBucket;
+  orxOBJECT_GROUP  *pstGroup;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
@@ -8194,8 +8967,11 @@ extern orxDLLAPI orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObjec
     orxLinkList_Remove(&(_pstObject->stGroupNode));
   }
 
-  /* Gets group list bucker*/
-  ppstBucket = (orxLINKLIST **)orxHashTable_Retrieve(sstObject.pstGroupTable, _u32GroupID);
+  /* Removes object from its current cell */
+  orxObject_RemoveFromCell(_pstObject);
+
+  /* Gets group bucket */
+  ppstBucket = (orxOBJECT_GROUP **)orxHashTable_Retrieve(sstObject.pstGroupTable, _u32GroupID);
 
   /* Checks */
   orxASSERT(ppstBucket != orxNULL);
@@ -8204,19 +8980,30 @@ extern orxDLLAPI orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObjec
   if(*ppstBucket == orxNULL)
   {
     /* Allocates it */
-    pstGroupList = (orxLINKLIST *)orxBank_Allocate(sstObject.pstGroupBank);
+    pstGroup = (orxOBJECT_GROUP *)orxBank_Allocate(sstObject.pstGroupBank);
+
+    /* Inits it */
+    orxMemory_Zero(pstGroup, sizeof(orxOBJECT_GROUP));
+    pstGroup->stUnindexedCell.pstGroup  = pstGroup;
+    pstGroup->stUnindexedCell.u32Level  = orxU32_UNDEFINED;
 
     /* Stores it */
-    *ppstBucket = pstGroupList;
+    *ppstBucket = pstGroup;
   }
   else
   {
     /* Gets it */
-    pstGroupList = *ppstBucket;
+    pstGroup = *ppstBucket;
   }
 
   /* Adds object to end of list */
-  orxLinkList_AddEnd(pstGroupList, &(_pstObject->stGroupNode));
+  orxLinkList_AddEnd(&(pstGroup->stObjectList), &(_pstObject->stGroupNode));
+
+  /* Stores its order in group */
+  _pstObject->u64GroupOrder = sstObject.u64GroupOrder++;
+
+  /* Invalidates its cell */
+  orxObject_InvalidateCell(_pstObject);
 
   /* Stores group ID */
   _pstObject->u32GroupID = _u32GroupID;
@@ -8243,7 +9030,7 @@ extern orxDLLAPI orxOBJECT *orxFASTCALL orxObject_GetNext(const orxOBJECT *_pstO
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT((_pstObject == orxNULL) || (orxStructure_GetID((orxSTRUCTURE *)_pstObject) < orxSTRUCTURE_ID_NUMBER));
-  orxASSERT((_pstObject == orxNULL) || (_u32GroupID == orxU32_UNDEFINED) || (orxLinkList_GetList(&(_pstObject->stGroupNode)) == orxHashTable_Get(sstObject.pstGroupTable, _u32GroupID)));
+  orxASSERT((_pstObject == orxNULL) || (_u32GroupID == orxU32_UNDEFINED) || (orxLinkList_GetList(&(_pstObject->stGroupNode)) == &(((orxOBJECT_GROUP *)orxHashTable_Get(sstObject.pstGroupTable, _u32GroupID))->stObjectList)));
 
   /* Has group? */
   if(_u32GroupID != orxU32_UNDEFINED)
@@ -8258,8 +9045,13 @@ extern orxDLLAPI orxOBJECT *orxFASTCALL orxObject_GetNext(const orxOBJECT *_pstO
     }
     else
     {
+      orxOBJECT_GROUP *pstGroup;
+
+      /* Gets group */
+      pstGroup = (orxOBJECT_GROUP *)orxHashTable_Get(sstObject.pstGroupTable, _u32GroupID);
+
       /* Gets group list */
-      pstGroupList = (orxLINKLIST *)orxHashTable_Get(sstObject.pstGroupTable, _u32GroupID);
+      pstGroupList = (pstGroup != orxNULL) ? &(pstGroup->stObjectList) : orxNULL;
     }
 
     /* Valid? */
@@ -8311,17 +9103,23 @@ extern orxDLLAPI orxOBJECT *orxFASTCALL orxObject_GetNext(const orxOBJECT *_pstO
  */
 orxOBJECT *orxFASTCALL orxObject_Pick(const orxVECTOR *_pvPosition, orxU32 _u32GroupID)
 {
+  orxOBOX     stPickBox;
   orxFLOAT    fSelectedZ;
+  orxU32      u32Index = 0;
   orxOBJECT  *pstResult = orxNULL, *pstObject;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT(_pvPosition != orxNULL);
 
-  /* For all objects */
-  for(pstObject = orxObject_GetNext(orxNULL, _u32GroupID), fSelectedZ = _pvPosition->fZ;
+  /* Finds candidates */
+  orxOBox_2DSet(&stPickBox, _pvPosition, &orxVECTOR_0, &orxVECTOR_0, orxFLOAT_0);
+  orxObject_FindCandidates(&stPickBox, _u32GroupID);
+
+  /* For all candidates */
+  for(pstObject = orxObject_GetNextCandidate(orxNULL, _u32GroupID, &u32Index), fSelectedZ = _pvPosition->fZ;
       pstObject != orxNULL;
-      pstObject = orxObject_GetNext(pstObject, _u32GroupID))
+      pstObject = orxObject_GetNextCandidate(pstObject, _u32GroupID, &u32Index))
   {
     /* Is enabled? */
     if(orxObject_IsEnabled(pstObject) != orxFALSE)
@@ -8370,16 +9168,20 @@ orxOBJECT *orxFASTCALL orxObject_Pick(const orxVECTOR *_pvPosition, orxU32 _u32G
 orxOBJECT *orxFASTCALL orxObject_BoxPick(const orxOBOX *_pstBox, orxU32 _u32GroupID)
 {
   orxFLOAT    fSelectedZ;
+  orxU32      u32Index = 0;
   orxOBJECT  *pstResult = orxNULL, *pstObject;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBox != orxNULL);
 
-  /* For all objects */
-  for(pstObject = orxObject_GetNext(orxNULL, _u32GroupID), fSelectedZ = _pstBox->vPosition.fZ;
+  /* Finds candidates */
+  orxObject_FindCandidates(_pstBox, _u32GroupID);
+
+  /* For all candidates */
+  for(pstObject = orxObject_GetNextCandidate(orxNULL, _u32GroupID, &u32Index), fSelectedZ = _pstBox->vPosition.fZ;
       pstObject != orxNULL;
-      pstObject = orxObject_GetNext(pstObject, _u32GroupID))
+      pstObject = orxObject_GetNextCandidate(pstObject, _u32GroupID, &u32Index))
   {
     /* Is enabled? */
     if(orxObject_IsEnabled(pstObject) != orxFALSE)
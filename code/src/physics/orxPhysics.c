@@ -241,6 +241,10 @@ orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_GetPartCheckMask, orxU16, const orxPHY
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_IsPartSolid, orxBOOL, const orxPHYSICS_BODY_PART *);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_SetPartSolid, orxSTATUS, orxPHYSICS_BODY_PART *, orxBOOL);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_Raycast, orxHANDLE, const orxVECTOR *, const orxVECTOR *, orxU16, orxU16, orxBOOL, orxVECTOR *, orxVECTOR *);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_RaycastList, orxU32, const orxPHYSICS_RAY *, orxU32, orxU16, orxU16, orxBOOL, orxPHYSICS_RAY_HIT *);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_QueryBox, orxU32, const orxAABOX *, orxU16, orxU16, orxHANDLE *, orxU32);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_QuerySphere, orxU32, const orxVECTOR *, orxFLOAT, orxU16, orxU16, orxHANDLE *, orxU32);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_QueryMesh, orxU32, const orxVECTOR *, orxU32, orxU16, orxU16, orxHANDLE *, orxU32);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_EnableSimulation, void, orxBOOL);
 
 
@@ -292,6 +296,10 @@ orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, SET_JOINT_MAX_MOTOR_TORQUE, orxPhysic
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, GET_JOINT_REACTION_FORCE, orxPhysics_GetJointReactionForce)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, GET_JOINT_REACTION_TORQUE, orxPhysics_GetJointReactionTorque)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, RAYCAST, orxPhysics_Raycast)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, RAYCAST_LIST, orxPhysics_RaycastList)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, QUERY_BOX, orxPhysics_QueryBox)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, QUERY_SPHERE, orxPhysics_QuerySphere)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, QUERY_MESH, orxPhysics_QueryMesh)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, ENABLE_SIMULATION, orxPhysics_EnableSimulation)
 
 orxPLUGIN_END_CORE_FUNCTION_ARRAY(PHYSICS)
@@ -519,6 +527,26 @@ orxHANDLE orxFASTCALL orxPhysics_Raycast(const orxVECTOR *_pvStart, const orxVEC
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_Raycast)(_pvStart, _pvEnd, _u16SelfFlags, _u16CheckMask, _bEarlyExit, _pvContact, _pvNormal);
 }
 
+orxU32 orxFASTCALL orxPhysics_RaycastList(const orxPHYSICS_RAY *_astRayList, orxU32 _u32Number, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxBOOL _bEarlyExit, orxPHYSICS_RAY_HIT *_astHitList)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_RaycastList)(_astRayList, _u32Number, _u16SelfFlags, _u16CheckMask, _bEarlyExit, _astHitList);
+}
+
+orxU32 orxFASTCALL orxPhysics_QueryBox(const orxAABOX *_pstBox, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxHANDLE *_ahUserDataList, orxU32 _u32Number)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_QueryBox)(_pstBox, _u16SelfFlags, _u16CheckMask, _ahUserDataList, _u32Number);
+}
+
+orxU32 orxFASTCALL orxPhysics_QuerySphere(const orxVECTOR *_pvCenter, orxFLOAT _fRadius, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxHANDLE *_ahUserDataList, orxU32 _u32Number)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_QuerySphere)(_pvCenter, _fRadius, _u16SelfFlags, _u16CheckMask, _ahUserDataList, _u32Number);
+}
+
+orxU32 orxFASTCALL orxPhysics_QueryMesh(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxHANDLE *_ahUserDataList, orxU32 _u32Number)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_QueryMesh)(_avVertexList, _u32VertexNumber, _u16SelfFlags, _u16CheckMask, _ahUserDataList, _u32Number);
+}
+
 void orxFASTCALL orxPhysics_EnableSimulation(orxBOOL _bEnable)
 {
   orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_EnableSimulation)(_bEnable);
@@ -85,6 +85,7 @@
 #define orxSHADER_KZ_CONFIG_CODE_LIST         "CodeList"
 #define orxSHADER_KZ_CONFIG_PARAM_LIST        "ParamList"
 #define orxSHADER_KZ_CONFIG_USE_CUSTOM_PARAM  "UseCustomParam"
+#define orxSHADER_KZ_CONFIG_OWNER_PARAM_LIST  "OwnerParamList"
 #define orxSHADER_KZ_CONFIG_KEEP_IN_CACHE     "KeepInCache"
 
 #define orxSHADER_KZ_TIME                     "time"
@@ -160,18 +161,6 @@ static orxSTATUS orxFASTCALL orxShader_ProcessConfigData(orxSHADER *_pstShader)
   /* Pushes its section */
   orxConfig_PushSection(_pstShader->zReference);
 
-  /* Use custom param? */
-  if(orxConfig_GetBool(orxSHADER_KZ_CONFIG_USE_CUSTOM_PARAM) != orxFALSE)
-  {
-    /* Updates status */
-    orxStructure_SetFlags(_pstShader, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM, orxSHADER_KU32_FLAG_NONE);
-  }
-  else
-  {
-    /* Updates status */
-    orxStructure_SetFlags(_pstShader, orxSHADER_KU32_FLAG_NONE, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM);
-  }
-
   /* For all current parameter values */
   for(pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetFirst(&(_pstShader->stParamValueList));
       pstParamValue != orxNULL;
@@ -285,16 +274,6 @@ static orxSTATUS orxFASTCALL orxShader_ProcessConfigData(orxSHADER *_pstShader)
                   /* Marks as time */
                   bIsTime = orxTRUE;
 
-                  /* Is not using custom param? */
-                  if(!orxStructure_TestFlags(_pstShader, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM))
-                  {
-                    /* Forces it */
-                    orxStructure_SetFlags(_pstShader, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM, orxSHADER_KU32_FLAG_NONE);
-
-                    /* Logs message */
-                    orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Shader [%s/%x]: Using time parameter for <%s> -> forcing config property \"%s\" to true.", _pstShader->zReference, _pstShader, zParamName, orxSHADER_KZ_CONFIG_USE_CUSTOM_PARAM);
-                  }
-
                   /* Logs message */
                   orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Shader [%s/%x]: Can't use array for time parameter. <%s> will be declared as a regular variable.", _pstShader->zReference, _pstShader, zParamName);
 
@@ -321,16 +300,6 @@ static orxSTATUS orxFASTCALL orxShader_ProcessConfigData(orxSHADER *_pstShader)
               {
                 /* Marks as time */
                 bIsTime = orxTRUE;
-
-                /* Is not using custom param? */
-                if(!orxStructure_TestFlags(_pstShader, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM))
-                {
-                  /* Forces it */
-                  orxStructure_SetFlags(_pstShader, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM, orxSHADER_KU32_FLAG_NONE);
-
-                  /* Logs message */
-                  orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Shader [%s/%x]: Using time parameter for <%s> -> forcing config property \"%s\" to true.", _pstShader->zReference, _pstShader, zParamName, orxSHADER_KZ_CONFIG_USE_CUSTOM_PARAM);
-                }
               }
 
               /* Creates texture */
@@ -359,6 +328,34 @@ static orxSTATUS orxFASTCALL orxShader_ProcessConfigData(orxSHADER *_pstShader)
     }
   }
 
+  /* Use custom param? */
+  if(orxConfig_GetBool(orxSHADER_KZ_CONFIG_USE_CUSTOM_PARAM) != orxFALSE)
+  {
+    /* Has owner param list? */
+    if(orxConfig_HasValue(orxSHADER_KZ_CONFIG_OWNER_PARAM_LIST) != orxFALSE)
+    {
+      /* For all owner parameters */
+      for(i = 0, s32Number = orxConfig_GetListCounter(orxSHADER_KZ_CONFIG_OWNER_PARAM_LIST); i < s32Number; i++)
+      {
+        /* Updates it */
+        orxShader_SetParamUpdate(_pstShader, orxConfig_GetListString(orxSHADER_KZ_CONFIG_OWNER_PARAM_LIST, i), orxSHADER_PARAM_UPDATE_OWNER);
+      }
+    }
+    else
+    {
+      orxSHADER_PARAM *pstParam;
+
+      /* For all parameters */
+      for(pstParam = (orxSHADER_PARAM *)orxLinkList_GetFirst(&(_pstShader->stParamList));
+          pstParam != orxNULL;
+          pstParam = (orxSHADER_PARAM *)orxLinkList_GetNext(&(pstParam->stNode)))
+      {
+        /* Updates it */
+        pstParam->eUpdate = orxSHADER_PARAM_UPDATE_OWNER;
+      }
+    }
+  }
+
   /* Has code list? */
   if(orxConfig_HasValue(orxSHADER_KZ_CONFIG_CODE_LIST) != orxFALSE)
   {
@@ -939,13 +936,13 @@ orxSTATUS orxFASTCALL orxShader_Start(const orxSHADER *_pstShader, const orxSTRU
         }
       }
 
-      /* No custom param? */
-      if(!orxStructure_TestFlags(_pstShader, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM))
+      /* For all parameter values */
+      for(pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetFirst(&(_pstShader->stParamValueList));
+          pstParamValue != orxNULL;
+          pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetNext(&(pstParamValue->stNode)))
       {
-        /* For all parameter values */
-        for(pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetFirst(&(_pstShader->stParamValueList));
-            pstParamValue != orxNULL;
-            pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetNext(&(pstParamValue->stNode)))
+        /* Not re-evaluated per owner? */
+        if(pstParamValue->pstParam->eUpdate != orxSHADER_PARAM_UPDATE_OWNER)
         {
           /* Depending on parameter type */
           switch(pstParamValue->pstParam->eType)
@@ -1008,13 +1005,7 @@ orxSTATUS orxFASTCALL orxShader_Start(const orxSHADER *_pstShader, const orxSTRU
             }
           }
         }
-      }
-      else
-      {
-        /* For all parameter values */
-        for(pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetFirst(&(_pstShader->stParamValueList));
-            pstParamValue != orxNULL;
-            pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetNext(&(pstParamValue->stNode)))
+        else
         {
           orxSHADER_EVENT_PAYLOAD stPayload;
 
@@ -1174,6 +1165,7 @@ orxSTATUS orxFASTCALL orxShader_AddFloatParam(orxSHADER *_pstShader, const orxST
       pstParam->eType         = orxSHADER_PARAM_TYPE_FLOAT;
       pstParam->zName         = orxString_Store(_zName);
       pstParam->u32ArraySize  = _u32ArraySize;
+      pstParam->eUpdate       = orxSHADER_PARAM_UPDATE_CONSTANT;
 
       /* Adds it to list */
       orxLinkList_AddEnd(&(_pstShader->stParamList), &(pstParam->stNode));
@@ -1251,6 +1243,7 @@ orxSTATUS orxFASTCALL orxShader_AddTextureParam(orxSHADER *_pstShader, const orx
       pstParam->eType         = orxSHADER_PARAM_TYPE_TEXTURE;
       pstParam->zName         = orxString_Store(_zName);
       pstParam->u32ArraySize  = _u32ArraySize;
+      pstParam->eUpdate       = orxSHADER_PARAM_UPDATE_CONSTANT;
 
       /* Adds it to list */
       orxLinkList_AddEnd(&(_pstShader->stParamList), &(pstParam->stNode));
@@ -1329,6 +1322,7 @@ orxSTATUS orxFASTCALL orxShader_AddVectorParam(orxSHADER *_pstShader, const orxS
       pstParam->eType         = orxSHADER_PARAM_TYPE_VECTOR;
       pstParam->zName         = orxString_Store(_zName);
       pstParam->u32ArraySize  = _u32ArraySize;
+      pstParam->eUpdate       = orxSHADER_PARAM_UPDATE_CONSTANT;
 
       /* Adds it to list */
       orxLinkList_AddEnd(&(_pstShader->stParamList), &(pstParam->stNode));
@@ -1404,6 +1398,7 @@ orxSTATUS orxFASTCALL orxShader_AddTimeParam(orxSHADER *_pstShader, const orxSTR
       pstParam->eType         = orxSHADER_PARAM_TYPE_TIME;
       pstParam->zName         = orxString_Store(_zName);
       pstParam->u32ArraySize  = 0;
+      pstParam->eUpdate       = orxSHADER_PARAM_UPDATE_TIME;
 
       /* Adds it to list */
       orxLinkList_AddEnd(&(_pstShader->stParamList), &(pstParam->stNode));
@@ -1659,6 +1654,94 @@ orxSTATUS orxFASTCALL orxShader_SetVectorParam(orxSHADER *_pstShader, const orxS
   return eResult;
 }
 
+/** Sets how a parameter gets evaluated when the shader is started (parameters need to be added beforehand and this needs to be set before compiling the shader code)
+ * @param[in] _pstShader              Concerned Shader
+ * @param[in] _zName                  Parameter's literal name
+ * @param[in] _eUpdate                Update mode: orxSHADER_PARAM_UPDATE_TIME is only valid for time parameters, orxSHADER_PARAM_UPDATE_CONSTANT for all the others
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxShader_SetParamUpdate(orxSHADER *_pstShader, const orxSTRING _zName, orxSHADER_PARAM_UPDATE _eUpdate)
+{
+  orxSHADER_PARAM  *pstParam;
+  orxSTATUS         eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstShader.u32Flags & orxSHADER_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstShader);
+  orxASSERT(_eUpdate < orxSHADER_PARAM_UPDATE_NUMBER);
+
+  /* For all defined parameters? */
+  for(pstParam = (orxSHADER_PARAM *)orxLinkList_GetFirst(&(_pstShader->stParamList));
+      pstParam != orxNULL;
+      pstParam = (orxSHADER_PARAM *)orxLinkList_GetNext(&(pstParam->stNode)))
+  {
+    /* Found? */
+    if(!orxString_Compare(_zName, pstParam->zName))
+    {
+      /* Valid mode for its type? */
+      if((_eUpdate == orxSHADER_PARAM_UPDATE_OWNER)
+      || ((_eUpdate == orxSHADER_PARAM_UPDATE_TIME) == (pstParam->eType == orxSHADER_PARAM_TYPE_TIME)))
+      {
+        /* Updates it */
+        pstParam->eUpdate = _eUpdate;
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Shader [%s/%x]: Can't set update mode for parameter <%s>: incompatible with its type.", _pstShader->zReference, _pstShader, _zName);
+      }
+
+      break;
+    }
+  }
+
+  /* Not found? */
+  if(pstParam == orxNULL)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Shader [%s/%x]: Can't set update mode for parameter <%s>: parameter not found.", _pstShader->zReference, _pstShader, _zName);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets how a parameter gets evaluated when the shader is started
+ * @param[in] _pstShader              Concerned Shader
+ * @param[in] _zName                  Parameter's literal name
+ * @return orxSHADER_PARAM_UPDATE / orxSHADER_PARAM_UPDATE_NONE if the parameter can't be found
+ */
+orxSHADER_PARAM_UPDATE orxFASTCALL orxShader_GetParamUpdate(const orxSHADER *_pstShader, const orxSTRING _zName)
+{
+  orxSHADER_PARAM        *pstParam;
+  orxSHADER_PARAM_UPDATE  eResult = orxSHADER_PARAM_UPDATE_NONE;
+
+  /* Checks */
+  orxASSERT(sstShader.u32Flags & orxSHADER_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstShader);
+
+  /* For all defined parameters? */
+  for(pstParam = (orxSHADER_PARAM *)orxLinkList_GetFirst(&(_pstShader->stParamList));
+      pstParam != orxNULL;
+      pstParam = (orxSHADER_PARAM *)orxLinkList_GetNext(&(pstParam->stNode)))
+  {
+    /* Found? */
+    if(!orxString_Compare(_zName, pstParam->zName))
+    {
+      /* Updates result */
+      eResult = pstParam->eUpdate;
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Sets shader code & compiles it (parameters need to be set before compiling the shader code)
  * @param[in] _pstShader              Concerned Shader
  * @param[in] _azCodeList             List of shader codes to compile (parameters need to be set beforehand), will be processed in order
@@ -1689,6 +1772,26 @@ orxSTATUS orxFASTCALL orxShader_CompileCode(orxSHADER *_pstShader, const orxSTRI
   /* Valid? */
   if((_azCodeList != orxNULL) && (_u32Size > 0))
   {
+    orxSHADER_PARAM *pstParam;
+
+    /* Clears custom param status */
+    orxStructure_SetFlags(_pstShader, orxSHADER_KU32_FLAG_NONE, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM);
+
+    /* For all parameters */
+    for(pstParam = (orxSHADER_PARAM *)orxLinkList_GetFirst(&(_pstShader->stParamList));
+        pstParam != orxNULL;
+        pstParam = (orxSHADER_PARAM *)orxLinkList_GetNext(&(pstParam->stNode)))
+    {
+      /* Not constant? */
+      if(pstParam->eUpdate != orxSHADER_PARAM_UPDATE_CONSTANT)
+      {
+        /* Values can change with each use */
+        orxStructure_SetFlags(_pstShader, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM, orxSHADER_KU32_FLAG_NONE);
+
+        break;
+      }
+    }
+
     /* Creates compiled shader */
     _pstShader->hData = orxDisplay_CreateShader(_azCodeList, _u32Size, &(_pstShader->stParamList), orxStructure_TestFlags(_pstShader, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM) ? orxTRUE : orxFALSE);
 
@@ -34,8 +34,26 @@
 #include "memory/orxBank.h"
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
+#include "math/orxMath.h"
 #include "utils/orxString.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+
+  #include <emmintrin.h>
+
+  #define __orxHASHTABLE_SSE2__
+
+#endif /* __SSE2__ || _M_X64 || _M_IX86_FP >= 2 */
+
+
+/** Module flags
+ */
+#define orxHASHTABLE_KU32_GROUP_SIZE            16          /**< Number of control bytes probed at once */
+
+#define orxHASHTABLE_KU8_CONTROL_EMPTY          0x80        /**< Empty cell */
+#define orxHASHTABLE_KU8_CONTROL_DELETED        0xFE        /**< Deleted cell (tombstone) */
+#define orxHASHTABLE_KU8_CONTROL_MASK_USED      0x80        /**< Mask shared by empty & deleted cells, cleared for used ones */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -46,27 +64,32 @@ typedef struct __orxHASHTABLE_CELL_t
 {
   orxU64                        u64Key;                       /**< Key element of a hash table : 8 */
   void                         *pData;                        /**< Address of data : 12 / 16 */
-  struct __orxHASHTABLE_CELL_t *pstNext;                      /**< Next cell with the same index : 16 / 20 */
 
 } orxHASHTABLE_CELL;
 
-/** Hash Table */
-#ifdef __orxMSVC__
-  #pragma warning(disable : 4200)
-#endif /* __orxMSVC__ */
+/** Chained hash table cell definition.*/
+typedef struct __orxHASHTABLE_CHAINED_CELL_t
+{
+  orxU64                                u64Key;               /**< Key element of a hash table : 8 */
+  void                                 *pData;                /**< Address of data : 12 / 16 */
+  struct __orxHASHTABLE_CHAINED_CELL_t *pstNext;              /**< Next cell with the same index : 16 / 24 */
 
+} orxHASHTABLE_CHAINED_CELL;
+
+/** Hash Table */
 struct __orxHASHTABLE_t
 {
-  orxBANK            *pstBank;                                /**< Bank where are stored cells : 4 */
-  orxU32              u32Counter;                             /**< Hashtable item counter : 8 */
-  orxU32              u32Size;                                /**< Hashtable size : 12 */
-  orxHASHTABLE_CELL  *apstCell[0];                            /**< Hash table */
+  orxHASHTABLE_CELL          *astCell;                        /**< Cells : 4 / 8 */
+  orxU8                      *au8Control;                     /**< Control bytes, one per cell, followed by a copy of the first group : 8 / 16 */
+  orxHASHTABLE_CHAINED_CELL **apstBucket;                     /**< Buckets (chained hash tables only) : 12 / 24 */
+  orxBANK                    *pstBank;                        /**< Bank where are stored chained cells (chained hash tables only) : 16 / 32 */
+  orxU32                      u32Counter;                     /**< Hashtable item counter : 20 / 36 */
+  orxU32                      u32DeletedCounter;              /**< Hashtable deleted cell counter : 24 / 40 */
+  orxU32                      u32Size;                        /**< Hashtable size : 28 / 44 */
+  orxU32                      u32Flags;                       /**< Hashtable flags : 32 / 48 */
+  orxMEMORY_TYPE              eMemType;                       /**< Memory type : 36 / 52 */
 };
 
-#ifdef __orxMSVC__
-  #pragma warning(default : 4200)
-#endif /* __orxMSVC__ */
-
 
 /***************************************************************************
  * Module global variable                                                  *
@@ -76,18 +99,572 @@ struct __orxHASHTABLE_t
  * Private functions                                                       *
  ***************************************************************************/
 
-/** Find a row in a hash table.
+/** Mixes a key into a hash value (all bits of the key affect all bits of the result).
+ * @param[in] _u64Key Key to hash.
+ * @return Hash of the key.
+ */
+static orxINLINE orxU64 orxHashTable_Hash(orxU64 _u64Key)
+{
+  orxU64 u64Result;
+
+  /* Mixes all bits */
+  u64Result   = _u64Key;
+  u64Result  ^= u64Result >> 33;
+  u64Result  *= 0xFF51AFD7ED558CCDULL;
+  u64Result  ^= u64Result >> 33;
+  u64Result  *= 0xC4CEB9FE1A85EC53ULL;
+  u64Result  ^= u64Result >> 33;
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Gets the control byte stored for a used cell.
+ * @param[in] _u64Hash Hash of the key.
+ * @return Control byte.
+ */
+static orxINLINE orxU8 orxHashTable_GetControl(orxU64 _u64Hash)
+{
+  /* Uses the 7 highest bits */
+  return (orxU8)(_u64Hash >> 57);
+}
+
+/** Gets the max number of non-empty cells for a given size.
+ * @param[in] _u32Size Hash table size.
+ * @return Max number of used + deleted cells.
+ */
+static orxINLINE orxU32 orxHashTable_GetMaxLoad(orxU32 _u32Size)
+{
+  /* 7/8th */
+  return _u32Size - (_u32Size >> 3);
+}
+
+/** Matches a group of control bytes against a value.
+ * @param[in] _au8Control Group of control bytes.
+ * @param[in] _u8Value    Value to match.
+ * @return Bit mask of matching control bytes.
+ */
+static orxINLINE orxU32 orxHashTable_MatchGroup(const orxU8 *_au8Control, orxU8 _u8Value)
+{
+  orxU32 u32Result;
+
+#ifdef __orxHASHTABLE_SSE2__
+
+  /* Compares all bytes at once */
+  u32Result = (orxU32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)_au8Control), _mm_set1_epi8((char)_u8Value)));
+
+#else /* __orxHASHTABLE_SSE2__ */
+
+  orxU32 i;
+
+  /* For all bytes */
+  for(i = 0, u32Result = 0; i < orxHASHTABLE_KU32_GROUP_SIZE; i++)
+  {
+    /* Matches? */
+    if(_au8Control[i] == _u8Value)
+    {
+      /* Updates result */
+      u32Result |= 1 << i;
+    }
+  }
+
+#endif /* __orxHASHTABLE_SSE2__ */
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Matches a group of control bytes against empty or deleted cells.
+ * @param[in] _au8Control Group of control bytes.
+ * @return Bit mask of empty or deleted control bytes.
+ */
+static orxINLINE orxU32 orxHashTable_MatchGroupFree(const orxU8 *_au8Control)
+{
+  orxU32 u32Result;
+
+#ifdef __orxHASHTABLE_SSE2__
+
+  /* Gets all high bits at once */
+  u32Result = (orxU32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)_au8Control));
+
+#else /* __orxHASHTABLE_SSE2__ */
+
+  orxU32 i;
+
+  /* For all bytes */
+  for(i = 0, u32Result = 0; i < orxHASHTABLE_KU32_GROUP_SIZE; i++)
+  {
+    /* Empty or deleted? */
+    if(_au8Control[i] & orxHASHTABLE_KU8_CONTROL_MASK_USED)
+    {
+      /* Updates result */
+      u32Result |= 1 << i;
+    }
+  }
+
+#endif /* __orxHASHTABLE_SSE2__ */
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Sets a control byte, keeping the copy of the first group up-to-date.
+ * @param[in] _pstHashTable Concerned hash table.
+ * @param[in] _u32Index     Index of the cell.
+ * @param[in] _u8Value      Control value.
+ */
+static orxINLINE void orxHashTable_SetControl(orxHASHTABLE *_pstHashTable, orxU32 _u32Index, orxU8 _u8Value)
+{
+  /* Stores value */
+  _pstHashTable->au8Control[_u32Index] = _u8Value;
+
+  /* Part of the first group? */
+  if(_u32Index < orxHASHTABLE_KU32_GROUP_SIZE)
+  {
+    /* Updates its copy */
+    _pstHashTable->au8Control[_pstHashTable->u32Size + _u32Index] = _u8Value;
+  }
+}
+
+/** Find the cell index of a key in a hash table.
  * @param[in] _pstHashTable The hash table where search.
- * @param[in] _u64Key Key to find.
- * @return index associated to the given key.
+ * @param[in] _u64Key       Key to find.
+ * @param[in] _u64Hash      Hash of the key.
+ * @return index of the cell holding the given key, orxU32_UNDEFINED if not found.
  */
-static orxINLINE orxU32 orxHashTable_FindIndex(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
+static orxINLINE orxU32 orxHashTable_FindIndex(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key, orxU64 _u64Hash)
 {
+  orxU32  u32Mask, u32Index, u32ProbeCounter;
+  orxU8   u8Control;
+  orxU32  u32Result = orxU32_UNDEFINED;
+
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Computes the hash index */
-  return((orxU32)_u64Key & (_pstHashTable->u32Size - 1));
+  /* Gets control value */
+  u8Control = orxHashTable_GetControl(_u64Hash);
+
+  /* For all probed groups */
+  for(u32Mask = _pstHashTable->u32Size - 1, u32Index = (orxU32)_u64Hash & u32Mask, u32ProbeCounter = _pstHashTable->u32Size / orxHASHTABLE_KU32_GROUP_SIZE;
+      u32ProbeCounter != 0;
+      u32Index = (u32Index + orxHASHTABLE_KU32_GROUP_SIZE) & u32Mask, u32ProbeCounter--)
+  {
+    orxU32 u32Match;
+
+    /* For all matching control bytes */
+    for(u32Match = orxHashTable_MatchGroup(_pstHashTable->au8Control + u32Index, u8Control);
+        u32Match != 0;
+        u32Match &= u32Match - 1)
+    {
+      orxU32 u32CellIndex;
+
+      /* Gets cell index */
+      u32CellIndex = (u32Index + orxMath_GetTrailingZeroCount(u32Match)) & u32Mask;
+
+      /* Found? */
+      if(_pstHashTable->astCell[u32CellIndex].u64Key == _u64Key)
+      {
+        /* Updates result */
+        u32Result = u32CellIndex;
+
+        break;
+      }
+    }
+
+    /* Found or reached an empty cell? */
+    if((u32Result != orxU32_UNDEFINED)
+    || (orxHashTable_MatchGroup(_pstHashTable->au8Control + u32Index, orxHASHTABLE_KU8_CONTROL_EMPTY) != 0))
+    {
+      /* Stops */
+      break;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Finds a free cell for a new key.
+ * @param[in] _pstHashTable The hash table where search.
+ * @param[in] _u64Hash      Hash of the key.
+ * @return index of the first empty or deleted cell on the key's probe sequence.
+ */
+static orxINLINE orxU32 orxHashTable_FindFreeIndex(const orxHASHTABLE *_pstHashTable, orxU64 _u64Hash)
+{
+  orxU32 u32Mask, u32Index, u32Match;
+
+  /* Checks */
+  orxASSERT(_pstHashTable != orxNULL);
+  orxASSERT(_pstHashTable->u32Counter < _pstHashTable->u32Size);
+
+  /* Finds first group with a free cell */
+  for(u32Mask = _pstHashTable->u32Size - 1, u32Index = (orxU32)_u64Hash & u32Mask;
+      (u32Match = orxHashTable_MatchGroupFree(_pstHashTable->au8Control + u32Index)) == 0;
+      u32Index = (u32Index + orxHASHTABLE_KU32_GROUP_SIZE) & u32Mask)
+  ;
+
+  /* Done! */
+  return (u32Index + orxMath_GetTrailingZeroCount(u32Match)) & u32Mask;
+}
+
+/** Resizes a hash table, removing all its deleted cells.
+ * @param[in] _pstHashTable The hash table to resize.
+ * @param[in] _u32Size      New size (power of two).
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxHashTable_Resize(orxHASHTABLE *_pstHashTable, orxU32 _u32Size)
+{
+  orxHASHTABLE_CELL  *astCell;
+  orxSTATUS           eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(_pstHashTable != orxNULL);
+  orxASSERT(orxMath_IsPowerOfTwo(_u32Size) != orxFALSE);
+  orxASSERT(_u32Size >= orxHASHTABLE_KU32_GROUP_SIZE);
+  orxASSERT(orxHashTable_GetMaxLoad(_u32Size) >= _pstHashTable->u32Counter);
+
+  /* Allocates cells & control bytes */
+  astCell = (orxHASHTABLE_CELL *)orxMemory_Allocate(_u32Size * (sizeof(orxHASHTABLE_CELL) + sizeof(orxU8)) + orxHASHTABLE_KU32_GROUP_SIZE, _pstHashTable->eMemType);
+
+  /* Success? */
+  if(astCell != orxNULL)
+  {
+    orxHASHTABLE_CELL  *astOldCell;
+    orxU8              *au8OldControl;
+    orxU32              u32OldSize, i;
+
+    /* Backups old storage */
+    astOldCell    = _pstHashTable->astCell;
+    au8OldControl = _pstHashTable->au8Control;
+    u32OldSize    = _pstHashTable->u32Size;
+
+    /* Stores new storage */
+    _pstHashTable->astCell            = astCell;
+    _pstHashTable->au8Control         = (orxU8 *)(astCell + _u32Size);
+    _pstHashTable->u32Size            = _u32Size;
+    _pstHashTable->u32DeletedCounter  = 0;
+
+    /* Clears control bytes */
+    orxMemory_Set(_pstHashTable->au8Control, orxHASHTABLE_KU8_CONTROL_EMPTY, _u32Size + orxHASHTABLE_KU32_GROUP_SIZE);
+
+    /* Had previous storage? */
+    if(astOldCell != orxNULL)
+    {
+      /* For all old cells */
+      for(i = 0; i < u32OldSize; i++)
+      {
+        /* Used? */
+        if(!(au8OldControl[i] & orxHASHTABLE_KU8_CONTROL_MASK_USED))
+        {
+          orxU64 u64Hash;
+          orxU32 u32Index;
+
+          /* Gets its new index */
+          u64Hash   = orxHashTable_Hash(astOldCell[i].u64Key);
+          u32Index  = orxHashTable_FindFreeIndex(_pstHashTable, u64Hash);
+
+          /* Stores it */
+          orxHashTable_SetControl(_pstHashTable, u32Index, orxHashTable_GetControl(u64Hash));
+          _pstHashTable->astCell[u32Index] = astOldCell[i];
+        }
+      }
+
+      /* Frees old storage */
+      orxMemory_Free(astOldCell);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Inserts a new key in a hash table, growing or cleaning it if needed.
+ * @param[in] _pstHashTable The hash table where to insert.
+ * @param[in] _u64Key       Key to insert, must not be already present.
+ * @param[in] _u64Hash      Hash of the key.
+ * @param[in] _pData        Data to assign.
+ * @return index of the new cell, orxU32_UNDEFINED if the table is full.
+ */
+static orxU32 orxFASTCALL orxHashTable_Insert(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, orxU64 _u64Hash, void *_pData)
+{
+  orxU32 u32Result = orxU32_UNDEFINED;
+
+  /* Checks */
+  orxASSERT(_pstHashTable != orxNULL);
+
+  /* Reached max load? */
+  if(_pstHashTable->u32Counter + _pstHashTable->u32DeletedCounter >= orxHashTable_GetMaxLoad(_pstHashTable->u32Size))
+  {
+    /* Enough deleted cells or can't grow? */
+    if((_pstHashTable->u32DeletedCounter >= (_pstHashTable->u32Counter >> 1))
+    || (orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE)))
+    {
+      /* Has deleted cells? */
+      if(_pstHashTable->u32DeletedCounter != 0)
+      {
+        /* Cleans it */
+        orxHashTable_Resize(_pstHashTable, _pstHashTable->u32Size);
+      }
+    }
+    else
+    {
+      /* Grows it */
+      orxHashTable_Resize(_pstHashTable, _pstHashTable->u32Size << 1);
+    }
+  }
+
+  /* Not full? */
+  if(_pstHashTable->u32Counter + _pstHashTable->u32DeletedCounter < orxHashTable_GetMaxLoad(_pstHashTable->u32Size))
+  {
+    /* Gets free cell */
+    u32Result = orxHashTable_FindFreeIndex(_pstHashTable, _u64Hash);
+
+    /* Was deleted? */
+    if(_pstHashTable->au8Control[u32Result] == orxHASHTABLE_KU8_CONTROL_DELETED)
+    {
+      /* Updates deleted counter */
+      _pstHashTable->u32DeletedCounter--;
+    }
+
+    /* Inits cell */
+    orxHashTable_SetControl(_pstHashTable, u32Result, orxHashTable_GetControl(_u64Hash));
+    _pstHashTable->astCell[u32Result].u64Key  = _u64Key;
+    _pstHashTable->astCell[u32Result].pData   = _pData;
+
+    /* Updates counter */
+    _pstHashTable->u32Counter++;
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Finds the cell of a key in a chained hash table.
+ * @param[in] _pstHashTable The hash table where search.
+ * @param[in] _u64Key       Key to find.
+ * @return Cell holding the given key, orxNULL if not found.
+ */
+static orxINLINE orxHASHTABLE_CHAINED_CELL *orxHashTable_FindChainedCell(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
+{
+  orxHASHTABLE_CHAINED_CELL *pstResult;
+
+  /* Checks */
+  orxASSERT(_pstHashTable != orxNULL);
+  orxASSERT(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED));
+
+  /* Finds the corresponding cell */
+  for(pstResult = _pstHashTable->apstBucket[(orxU32)_u64Key & (_pstHashTable->u32Size - 1)];
+      (pstResult != orxNULL) && (pstResult->u64Key != _u64Key);
+      pstResult = pstResult->pstNext)
+  ;
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Inserts a new key in a chained hash table.
+ * @param[in] _pstHashTable The hash table where to insert.
+ * @param[in] _u64Key       Key to insert, must not be already present.
+ * @param[in] _pData        Data to assign.
+ * @return New cell, orxNULL if the bank is full.
+ */
+static orxHASHTABLE_CHAINED_CELL *orxFASTCALL orxHashTable_InsertChainedCell(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, void *_pData)
+{
+  orxHASHTABLE_CHAINED_CELL *pstResult;
+
+  /* Checks */
+  orxASSERT(_pstHashTable != orxNULL);
+  orxASSERT(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED));
+
+  /* Creates a new cell */
+  pstResult = (orxHASHTABLE_CHAINED_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    orxU32 u32Index;
+
+    /* Gets its bucket */
+    u32Index = (orxU32)_u64Key & (_pstHashTable->u32Size - 1);
+
+    /* Inits cell */
+    pstResult->u64Key   = _u64Key;
+    pstResult->pData    = _pData;
+    pstResult->pstNext  = _pstHashTable->apstBucket[u32Index];
+
+    /* Inserts it */
+    _pstHashTable->apstBucket[u32Index] = pstResult;
+
+    /* Updates counter */
+    _pstHashTable->u32Counter++;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Removes a key from a chained hash table.
+ * @param[in] _pstHashTable The hash table where remove.
+ * @param[in] _u64Key       Key to remove.
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxHashTable_RemoveChainedCell(orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
+{
+  orxHASHTABLE_CHAINED_CELL **ppstCell;
+  orxSTATUS                   eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(_pstHashTable != orxNULL);
+  orxASSERT(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED));
+
+  /* Finds the link to the corresponding cell */
+  for(ppstCell = &(_pstHashTable->apstBucket[(orxU32)_u64Key & (_pstHashTable->u32Size - 1)]);
+      (*ppstCell != orxNULL) && ((*ppstCell)->u64Key != _u64Key);
+      ppstCell = &((*ppstCell)->pstNext))
+  ;
+
+  /* Found? */
+  if(*ppstCell != orxNULL)
+  {
+    orxHASHTABLE_CHAINED_CELL *pstCell;
+
+    /* Unlinks it */
+    pstCell   = *ppstCell;
+    *ppstCell = pstCell->pstNext;
+
+    /* Frees it */
+    orxBank_Free(_pstHashTable->pstBank, pstCell);
+
+    /* Updates counter */
+    _pstHashTable->u32Counter--;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets the next cell of a chained hash table.
+ * @param[in] _pstHashTable The hash table to iterate.
+ * @param[in] _hIterator    Previous cell or orxHANDLE_UNDEFINED/orxNULL for a new search.
+ * @return Next cell, orxNULL if none.
+ */
+static orxHASHTABLE_CHAINED_CELL *orxFASTCALL orxHashTable_GetNextChainedCell(const orxHASHTABLE *_pstHashTable, orxHANDLE _hIterator)
+{
+  orxHASHTABLE_CHAINED_CELL  *pstResult;
+  orxU32                      u32Index;
+
+  /* Checks */
+  orxASSERT(_pstHashTable != orxNULL);
+  orxASSERT(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED));
+
+  /* Has iterator? */
+  if((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED))
+  {
+    /* Gets current cell */
+    pstResult = (orxHASHTABLE_CHAINED_CELL *)_hIterator;
+
+    /* Gets start index */
+    u32Index  = ((orxU32)pstResult->u64Key & (_pstHashTable->u32Size - 1)) + 1;
+
+    /* Gets next cell in line */
+    pstResult = pstResult->pstNext;
+  }
+  else
+  {
+    /* Starts a new search */
+    u32Index  = 0;
+    pstResult = orxNULL;
+  }
+
+  /* Finds next head cell if needed */
+  for(; (pstResult == orxNULL) && (u32Index < _pstHashTable->u32Size); pstResult = _pstHashTable->apstBucket[u32Index++])
+  ;
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Optimizes a chained hash table by storing its cells in bucket order.
+ * @param[in] _pstHashTable The hash table to optimize.
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxHashTable_OptimizeChained(orxHASHTABLE *_pstHashTable)
+{
+  orxHASHTABLE_CHAINED_CELL  *astWorkBuffer;
+  orxSTATUS                   eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstHashTable != orxNULL);
+  orxASSERT(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED));
+
+  /* Allocates work buffer */
+  astWorkBuffer = (orxHASHTABLE_CHAINED_CELL *)orxMemory_Allocate(_pstHashTable->u32Counter * sizeof(orxHASHTABLE_CHAINED_CELL), orxMEMORY_TYPE_TEMP);
+
+  /* Valid? */
+  if(astWorkBuffer != orxNULL)
+  {
+    orxHASHTABLE_CHAINED_CELL  *pstCell;
+    orxU32                      i;
+
+    /* Copies all cells, in bucket order */
+    for(pstCell = orxHashTable_GetNextChainedCell(_pstHashTable, orxHANDLE_UNDEFINED), i = 0;
+        pstCell != orxNULL;
+        pstCell = orxHashTable_GetNextChainedCell(_pstHashTable, (orxHANDLE)pstCell), i++)
+    {
+      orxMemory_Copy(&astWorkBuffer[i], pstCell, sizeof(orxHASHTABLE_CHAINED_CELL));
+    }
+
+    /* Checks */
+    orxASSERT(i == _pstHashTable->u32Counter);
+
+    /* Clears bank */
+    orxBank_Clear(_pstHashTable->pstBank);
+
+    /* For all ordered cells */
+    for(i = 0, pstCell = orxNULL; i < _pstHashTable->u32Counter; i++)
+    {
+      orxHASHTABLE_CHAINED_CELL *pstPreviousCell;
+
+      /* Allocates new cell */
+      pstPreviousCell = pstCell;
+      pstCell         = (orxHASHTABLE_CHAINED_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
+
+      /* Checks */
+      orxASSERT(pstCell != orxNULL);
+
+      /* Stores its data */
+      orxMemory_Copy(pstCell, &astWorkBuffer[i], sizeof(orxHASHTABLE_CHAINED_CELL));
+
+      /* Chained? */
+      if((pstPreviousCell != orxNULL) && (pstPreviousCell->pstNext != orxNULL))
+      {
+        /* Updates chaining */
+        pstPreviousCell->pstNext = pstCell;
+      }
+      else
+      {
+        /* Updates head pointer */
+        _pstHashTable->apstBucket[(orxU32)pstCell->u64Key & (_pstHashTable->u32Size - 1)] = pstCell;
+      }
+    }
+
+    /* Frees work buffer */
+    orxMemory_Free(astWorkBuffer);
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
 }
 
 /***************************************************************************
@@ -106,7 +683,6 @@ orxHASHTABLE *orxFASTCALL orxHashTable_Create(orxU32 _u32NbKey, orxU32 _u32Flags
 {
   orxHASHTABLE *pstHashTable;
   orxU32        u32Size;
-  orxU32        u32Flags;
 
   /* Checks */
   orxASSERT(_eMemType < orxMEMORY_TYPE_NUMBER);
@@ -115,35 +691,65 @@ orxHASHTABLE *orxFASTCALL orxHashTable_Create(orxU32 _u32NbKey, orxU32 _u32Flags
   /* Gets Power of Two size */
   u32Size = orxMath_GetNextPowerOfTwo(_u32NbKey);
 
+  /* Not chained? */
+  if(!orxFLAG_TEST(_u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED))
+  {
+    /* Makes sure all keys can be stored without growing */
+    if(orxHashTable_GetMaxLoad(u32Size) < _u32NbKey)
+    {
+      u32Size <<= 1;
+    }
+    u32Size = orxMAX(u32Size, orxHASHTABLE_KU32_GROUP_SIZE);
+  }
+
   /* Allocate memory for a hash table */
-  pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)), _eMemType);
+  pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE), _eMemType);
 
   /* Enough memory ? */
   if(pstHashTable != orxNULL)
   {
-    /* Set flags */
-    if(_u32Flags == orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE)
-    {
-      u32Flags = orxBANK_KU32_FLAG_NOT_EXPANDABLE;
-    }
-    else
-    {
-      u32Flags = orxBANK_KU32_FLAG_NONE;
-    }
-
     /* Clean values */
-    orxMemory_Zero(pstHashTable, sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)));
+    orxMemory_Zero(pstHashTable, sizeof(orxHASHTABLE));
 
-    /* Allocate bank for cells */
-    pstHashTable->pstBank = orxBank_Create((orxU16)u32Size, sizeof(orxHASHTABLE_CELL), u32Flags, _eMemType);
+    /* Stores flags & memory type */
+    pstHashTable->u32Flags  = _u32Flags;
+    pstHashTable->eMemType  = _eMemType;
 
-    /* Correct bank allocation ? */
-    if(pstHashTable->pstBank != orxNULL)
+    /* Chained? */
+    if(orxFLAG_TEST(_u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED))
     {
-      /* Stores its size */
-      pstHashTable->u32Size = u32Size;
+      /* Allocates buckets & bank for cells */
+      pstHashTable->apstBucket  = (orxHASHTABLE_CHAINED_CELL **)orxMemory_Allocate(u32Size * sizeof(orxHASHTABLE_CHAINED_CELL *), _eMemType);
+      pstHashTable->pstBank     = orxBank_Create((orxU16)orxMIN(u32Size, 0xFFFF), sizeof(orxHASHTABLE_CHAINED_CELL), orxFLAG_TEST(_u32Flags, orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE) ? orxBANK_KU32_FLAG_NOT_EXPANDABLE : orxBANK_KU32_FLAG_NONE, _eMemType);
+
+      /* Success? */
+      if((pstHashTable->apstBucket != orxNULL) && (pstHashTable->pstBank != orxNULL))
+      {
+        /* Clears buckets */
+        orxMemory_Zero(pstHashTable->apstBucket, u32Size * sizeof(orxHASHTABLE_CHAINED_CELL *));
+
+        /* Stores its size */
+        pstHashTable->u32Size = u32Size;
+      }
+      else
+      {
+        /* Frees buckets & bank */
+        if(pstHashTable->apstBucket != orxNULL)
+        {
+          orxMemory_Free(pstHashTable->apstBucket);
+        }
+        if(pstHashTable->pstBank != orxNULL)
+        {
+          orxBank_Delete(pstHashTable->pstBank);
+        }
+
+        /* Allocation problem, returns orxNULL */
+        orxMemory_Free(pstHashTable);
+        pstHashTable = orxNULL;
+      }
     }
-    else
+    /* Can't allocate cells? */
+    else if(orxHashTable_Resize(pstHashTable, u32Size) == orxSTATUS_FAILURE)
     {
       /* Allocation problem, returns orxNULL */
       orxMemory_Free(pstHashTable);
@@ -163,11 +769,18 @@ orxSTATUS orxFASTCALL orxHashTable_Delete(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Clear hash table (unallocate cells) */
-  orxHashTable_Clear(_pstHashTable);
-
-  /* Free bank */
-  orxBank_Delete(_pstHashTable->pstBank);
+  /* Chained? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED))
+  {
+    /* Frees bank & buckets */
+    orxBank_Delete(_pstHashTable->pstBank);
+    orxMemory_Free(_pstHashTable->apstBucket);
+  }
+  else
+  {
+    /* Free cells */
+    orxMemory_Free(_pstHashTable->astCell);
+  }
 
   /* Unallocate memory */
   orxMemory_Free(_pstHashTable);
@@ -185,14 +798,22 @@ orxSTATUS orxFASTCALL orxHashTable_Clear(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Clear the memory bank */
-  orxBank_Clear(_pstHashTable->pstBank);
-
-  /* Clear the hash */
-  orxMemory_Zero(_pstHashTable->apstCell, _pstHashTable->u32Size * sizeof(orxHASHTABLE_CELL *));
+  /* Chained? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED))
+  {
+    /* Clears the bank & buckets */
+    orxBank_Clear(_pstHashTable->pstBank);
+    orxMemory_Zero(_pstHashTable->apstBucket, _pstHashTable->u32Size * sizeof(orxHASHTABLE_CHAINED_CELL *));
+  }
+  else
+  {
+    /* Clear the control bytes */
+    orxMemory_Set(_pstHashTable->au8Control, orxHASHTABLE_KU8_CONTROL_EMPTY, _pstHashTable->u32Size + orxHASHTABLE_KU32_GROUP_SIZE);
+  }
 
-  /* Clears counter */
-  _pstHashTable->u32Counter = 0;
+  /* Clears counters */
+  _pstHashTable->u32Counter         = 0;
+  _pstHashTable->u32DeletedCounter  = 0;
 
   /* Done! */
   return orxSTATUS_SUCCESS;
@@ -225,8 +846,8 @@ orxU32 orxFASTCALL orxHashTable_GetCounter(const orxHASHTABLE *_pstHashTable)
  */
 void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell = orxNULL;
+  orxU32  u32Index;
+  void   *pResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Get");
@@ -234,20 +855,31 @@ void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u6
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Chained? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED))
+  {
+    orxHASHTABLE_CHAINED_CELL *pstCell;
 
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+    /* Finds the corresponding cell */
+    pstCell = orxHashTable_FindChainedCell(_pstHashTable, _u64Key);
+
+    /* Updates result */
+    pResult = (pstCell != orxNULL) ? pstCell->pData : orxNULL;
+  }
+  else
+  {
+    /* Finds the corresponding cell */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key, orxHashTable_Hash(_u64Key));
+
+    /* Updates result */
+    pResult = (u32Index != orxU32_UNDEFINED) ? _pstHashTable->astCell[u32Index].pData : orxNULL;
+  }
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
   /* Done! */
-  return (pstCell != orxNULL) ? pstCell->pData : orxNULL;
+  return pResult;
 }
 
 /** Retrieves the bucket of an item in a hash table, if the item wasn't present, a new bucket will be created.
@@ -257,9 +889,9 @@ void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u6
  */
 void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell;
-  void              **ppResult;
+  orxU64  u64Hash;
+  orxU32  u32Index;
+  void  **ppResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Retrieve");
@@ -267,48 +899,39 @@ void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u6
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
-
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
-
-  /* Not found ? */
-  if(pstCell == orxNULL)
+  /* Chained? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED))
   {
-    /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
-
-    /* Success? */
-    if(pstCell != orxNULL)
-    {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = orxNULL;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
-
-      /* Updates counter */
-      _pstHashTable->u32Counter++;
+    orxHASHTABLE_CHAINED_CELL *pstCell;
 
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
+    /* Finds the corresponding cell */
+    pstCell = orxHashTable_FindChainedCell(_pstHashTable, _u64Key);
 
-      /* Updates result */
-      ppResult = &(pstCell->pData);
-    }
-    else
+    /* Not found? */
+    if(pstCell == orxNULL)
     {
-      /* Updates result */
-      ppResult = orxNULL;
+      /* Creates a new cell */
+      pstCell = orxHashTable_InsertChainedCell(_pstHashTable, _u64Key, orxNULL);
     }
+
+    /* Updates result */
+    ppResult = (pstCell != orxNULL) ? &(pstCell->pData) : orxNULL;
   }
   else
   {
+    /* Finds the corresponding cell */
+    u64Hash   = orxHashTable_Hash(_u64Key);
+    u32Index  = orxHashTable_FindIndex(_pstHashTable, _u64Key, u64Hash);
+
+    /* Not found ? */
+    if(u32Index == orxU32_UNDEFINED)
+    {
+      /* Creates a new cell */
+      u32Index = orxHashTable_Insert(_pstHashTable, _u64Key, u64Hash, orxNULL);
+    }
+
     /* Updates result */
-    ppResult = &(pstCell->pData);
+    ppResult = (u32Index != orxU32_UNDEFINED) ? &(_pstHashTable->astCell[u32Index].pData) : orxNULL;
   }
 
   /* Profiles */
@@ -326,8 +949,8 @@ void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u6
  */
 orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, void *_pData)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell;
+  orxU64 u64Hash;
+  orxU32 u32Index;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Set");
@@ -335,39 +958,42 @@ orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64K
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Chained? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED))
+  {
+    orxHASHTABLE_CHAINED_CELL *pstCell;
 
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+    /* Finds the corresponding cell */
+    pstCell = orxHashTable_FindChainedCell(_pstHashTable, _u64Key);
 
-  /* Found ? */
-  if(pstCell != orxNULL)
-  {
-    /* Stores data */
-    pstCell->pData = _pData;
+    /* Found? */
+    if(pstCell != orxNULL)
+    {
+      /* Stores data */
+      pstCell->pData = _pData;
+    }
+    else
+    {
+      /* Creates a new cell */
+      orxHashTable_InsertChainedCell(_pstHashTable, _u64Key, _pData);
+    }
   }
   else
   {
-    /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
+    /* Finds the corresponding cell */
+    u64Hash   = orxHashTable_Hash(_u64Key);
+    u32Index  = orxHashTable_FindIndex(_pstHashTable, _u64Key, u64Hash);
 
-    /* Success? */
-    if(pstCell != orxNULL)
+    /* Found ? */
+    if(u32Index != orxU32_UNDEFINED)
     {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = _pData;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
-
-      /* Updates counter */
-      _pstHashTable->u32Counter++;
-
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
+      /* Stores data */
+      _pstHashTable->astCell[u32Index].pData = _pData;
+    }
+    else
+    {
+      /* Creates a new cell */
+      orxHashTable_Insert(_pstHashTable, _u64Key, u64Hash, _pData);
     }
   }
 
@@ -387,9 +1013,8 @@ orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64K
  */
 orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, void *_pData)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell;
-  orxSTATUS           eStatus = orxSTATUS_FAILURE;
+  orxU64    u64Hash;
+  orxSTATUS eStatus = orxSTATUS_FAILURE;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Add");
@@ -398,37 +1023,34 @@ orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64K
   orxASSERT(_pstHashTable != orxNULL);
   orxASSERT(_pData != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
-
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
-
-  /* Not found? */
-  if(pstCell == orxNULL)
+  /* Chained? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED))
   {
-    /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
-
-    /* Success? */
-    if(pstCell != orxNULL)
+    /* Not found? */
+    if(orxHashTable_FindChainedCell(_pstHashTable, _u64Key) == orxNULL)
     {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = _pData;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
-
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
-
-      /* Updates counter */
-      _pstHashTable->u32Counter++;
+      /* Creates a new cell */
+      if(orxHashTable_InsertChainedCell(_pstHashTable, _u64Key, _pData) != orxNULL)
+      {
+        /* Updates result */
+        eStatus = orxSTATUS_SUCCESS;
+      }
+    }
+  }
+  else
+  {
+    /* Gets hash */
+    u64Hash = orxHashTable_Hash(_u64Key);
 
-      /* Updates result */
-      eStatus = orxSTATUS_SUCCESS;
+    /* Not found? */
+    if(orxHashTable_FindIndex(_pstHashTable, _u64Key, u64Hash) == orxU32_UNDEFINED)
+    {
+      /* Creates a new cell */
+      if(orxHashTable_Insert(_pstHashTable, _u64Key, u64Hash, _pData) != orxU32_UNDEFINED)
+      {
+        /* Updates result */
+        eStatus = orxSTATUS_SUCCESS;
+      }
     }
   }
 
@@ -446,9 +1068,8 @@ orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64K
  */
 orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
 {
-  orxU32 u32Index;                        /* Hash table index */
-  orxHASHTABLE_CELL *pstCell;             /* Cell used to traverse */
-  orxSTATUS eStatus = orxSTATUS_FAILURE;  /* Status to return */
+  orxU32    u32Index;
+  orxSTATUS eStatus = orxSTATUS_FAILURE;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Remove");
@@ -456,57 +1077,32 @@ orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Get the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
-
-  pstCell = _pstHashTable->apstCell[u32Index];
-
-  /* Is the first key is the key to remove ? */
-  if(pstCell != orxNULL)
+  /* Chained? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED))
   {
-    if(pstCell->u64Key == _u64Key)
-    {
-      /* The first cell has to be removed */
-      _pstHashTable->apstCell[u32Index] = pstCell->pstNext;
-      orxBank_Free(_pstHashTable->pstBank, pstCell);
+    /* Removes its cell */
+    eStatus = orxHashTable_RemoveChainedCell(_pstHashTable, _u64Key);
+  }
+  else
+  {
+    /* Finds the corresponding cell */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key, orxHashTable_Hash(_u64Key));
 
-      /* Operation succeed */
-      eStatus = orxSTATUS_SUCCESS;
-    }
-    else
+    /* Found? */
+    if(u32Index != orxU32_UNDEFINED)
     {
-      /* Traverse to find the key */
-      while(pstCell->pstNext != orxNULL && pstCell->pstNext->u64Key != _u64Key)
-      {
-        /* Try with next cell */
-        pstCell = pstCell->pstNext;
-      }
-
-      /* Cell found ? (key should be on the next cell) */
-      if(pstCell->pstNext != orxNULL)
-      {
-        orxHASHTABLE_CELL *pstRemoveCell;
+      /* Marks it as deleted (cells are never moved upon removal, which keeps iterators valid) */
+      orxHashTable_SetControl(_pstHashTable, u32Index, orxHASHTABLE_KU8_CONTROL_DELETED);
 
-        /* We found it, remove this cell */
-        pstRemoveCell = pstCell->pstNext;
-        pstCell->pstNext = pstRemoveCell->pstNext;
+      /* Updates counters */
+      _pstHashTable->u32Counter--;
+      _pstHashTable->u32DeletedCounter++;
 
-        /* Free cell from bank */
-        orxBank_Free(_pstHashTable->pstBank, pstRemoveCell);
-
-        /* Operation succeed */
-        eStatus = orxSTATUS_SUCCESS;
-      }
+      /* Operation succeed */
+      eStatus = orxSTATUS_SUCCESS;
     }
   }
 
-  /* Successful? */
-  if(eStatus != orxSTATUS_FAILURE)
-  {
-    /* Updates counter */
-    _pstHashTable->u32Counter--;
-  }
-
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
@@ -527,60 +1123,71 @@ orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u
  */
 orxHANDLE orxFASTCALL orxHashTable_GetNext(const orxHASHTABLE *_pstHashTable, orxHANDLE _hIterator, orxU64 *_pu64Key, void **_ppData)
 {
-  orxHASHTABLE_CELL  *pstCell;
-  orxU32              u32Index;
-  orxHANDLE           hResult;
+  orxU64    u64Key = 0;
+  void     *pData = orxNULL;
+  orxHANDLE hResult = orxHANDLE_UNDEFINED;
 
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Has iterator? */
-  if((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED))
+  /* Chained? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED))
   {
-    /* Gets current cell */
-    pstCell = (orxHASHTABLE_CELL *)_hIterator;
+    orxHASHTABLE_CHAINED_CELL *pstCell;
 
-    /* Gets start index */
-    u32Index = orxHashTable_FindIndex(_pstHashTable, pstCell->u64Key) + 1;
+    /* Gets next cell (iterators store the current cell) */
+    pstCell = orxHashTable_GetNextChainedCell(_pstHashTable, _hIterator);
+
+    /* Found? */
+    if(pstCell != orxNULL)
+    {
+      /* Gets its content */
+      u64Key  = pstCell->u64Key;
+      pData   = pstCell->pData;
 
-    /* Updates temporary result */
-    pstCell = pstCell->pstNext;
+      /* Updates result */
+      hResult = (orxHANDLE)pstCell;
+    }
   }
   else
   {
-    /* Starts a new search */
-    u32Index  = 0;
-    pstCell   = orxNULL;
-  }
+    orxU32 u32Index;
 
-  /* Finds next head cell if needed */
-  for(; (pstCell == orxNULL) && (u32Index < _pstHashTable->u32Size); pstCell = _pstHashTable->apstCell[u32Index++])
-  ;
+    /* Gets start index (iterators store the index of the current cell + 1) */
+    u32Index = ((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED)) ? (orxU32)(size_t)_hIterator : 0;
+
+    /* Finds next used cell */
+    for(; (u32Index < _pstHashTable->u32Size) && (_pstHashTable->au8Control[u32Index] & orxHASHTABLE_KU8_CONTROL_MASK_USED); u32Index++)
+    ;
+
+    /* Found? */
+    if(u32Index < _pstHashTable->u32Size)
+    {
+      /* Gets its content */
+      u64Key  = _pstHashTable->astCell[u32Index].u64Key;
+      pData   = _pstHashTable->astCell[u32Index].pData;
+
+      /* Updates result */
+      hResult = (orxHANDLE)(size_t)(u32Index + 1);
+    }
+  }
 
   /* Found? */
-  if(pstCell != orxNULL)
+  if(hResult != orxHANDLE_UNDEFINED)
   {
     /* Asked for key? */
     if(_pu64Key != orxNULL)
     {
       /* Updates it */
-      *_pu64Key = pstCell->u64Key;
+      *_pu64Key = u64Key;
     }
 
     /* Asked for data? */
     if(_ppData != orxNULL)
     {
       /* Updates it */
-      *_ppData = pstCell->pData;
+      *_ppData = pData;
     }
-
-    /* Updates result */
-    hResult = (orxHANDLE)pstCell;
-  }
-  else
-  {
-    /* Updates result */
-    hResult = orxHANDLE_UNDEFINED;
   }
 
   /* Done! */
@@ -598,80 +1205,22 @@ orxSTATUS orxFASTCALL orxHashTable_Optimize(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Has elements? */
-  if(_pstHashTable->u32Counter > 0)
+  /* Chained? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_CHAINED))
   {
-    orxHASHTABLE_CELL *astWorkBuffer;
-
-    /* Allocates work buffer */
-    astWorkBuffer = (orxHASHTABLE_CELL *)orxMemory_Allocate(_pstHashTable->u32Counter * sizeof(orxHASHTABLE_CELL), orxMEMORY_TYPE_TEMP);
-
-    /* Valid? */
-    if(astWorkBuffer != orxNULL)
-    {
-      orxU64              u64KeyIndex;
-      orxU32              u32BufferIndex, i;
-      orxHASHTABLE_CELL  *pstCell;
-
-      /* For all cells */
-      for(i = 0, u64KeyIndex = 0, u32BufferIndex = 0, pstCell = orxNULL; i < _pstHashTable->u32Counter; i++, u32BufferIndex++)
-      {
-        /* Linked cell? */
-        if((pstCell != orxNULL) && (pstCell->pstNext != orxNULL))
-        {
-          /* Gets next in line */
-          pstCell = pstCell->pstNext;
-        }
-        else
-        {
-          /* Finds next head cell */
-          do{pstCell = _pstHashTable->apstCell[u64KeyIndex++];} while(pstCell == orxNULL);
-        }
-
-        /* Stores it */
-        orxMemory_Copy(&astWorkBuffer[u32BufferIndex], pstCell, sizeof(orxHASHTABLE_CELL));
-      }
-
-      /* Clears bank */
-      orxBank_Clear(_pstHashTable->pstBank);
-
-      /* For all ordered cells */
-      for(i = 0, pstCell = orxNULL; i < _pstHashTable->u32Counter; i++)
-      {
-        orxHASHTABLE_CELL *pstPreviousCell;
-
-        /* Allocates new cell */
-        pstPreviousCell = pstCell;
-        pstCell         = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
-
-        /* Checks */
-        orxASSERT(pstCell != orxNULL);
-
-        /* Stores its data */
-        orxMemory_Copy(pstCell, &astWorkBuffer[i], sizeof(orxHASHTABLE_CELL));
-
-        /* Chained? */
-        if((pstPreviousCell != orxNULL) && (pstPreviousCell->pstNext != orxNULL))
-        {
-          /* Updates chaining */
-          pstPreviousCell->pstNext = pstCell;
-        }
-        else
-        {
-          /* Updates head pointer */
-          _pstHashTable->apstCell[orxHashTable_FindIndex(_pstHashTable, pstCell->u64Key)] = pstCell;
-        }
-      }
-
-      /* Clears work buffer */
-      orxMemory_Free(astWorkBuffer);
-    }
-    else
+    /* Has elements? */
+    if(_pstHashTable->u32Counter > 0)
     {
-      /* Updates result */
-      eResult = orxSTATUS_FAILURE;
+      /* Stores its cells in bucket order */
+      eResult = orxHashTable_OptimizeChained(_pstHashTable);
     }
   }
+  /* Has deleted cells? */
+  else if(_pstHashTable->u32DeletedCounter > 0)
+  {
+    /* Rebuilds it to shorten probe sequences */
+    eResult = orxHashTable_Resize(_pstHashTable, _pstHashTable->u32Size);
+  }
 
   /* Done! */
   return eResult;
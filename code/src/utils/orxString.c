@@ -37,6 +37,33 @@
 #include "memory/orxMemory.h"
 #include "utils/orxHashTable.h"
 
+#if defined(__orxX86_64__) || defined(__orxX86__)
+
+  #if defined(__orxMSVC__)
+
+    #include <intrin.h>
+    #include <nmmintrin.h>
+
+    #define orxSTRING_CRC_HARDWARE_X86
+    #define orxSTRING_CRC_TARGET
+
+  #elif defined(__orxGCC__) || defined(__orxLLVM__)
+
+    #include <nmmintrin.h>
+
+    #define orxSTRING_CRC_HARDWARE_X86
+    #define orxSTRING_CRC_TARGET        __attribute__((target("sse4.2")))
+
+  #endif /* __orxMSVC__ */
+
+#elif defined(__orxARM64__) && defined(__ARM_FEATURE_CRC32)
+
+  #include <arm_acle.h>
+
+  #define orxSTRING_CRC_HARDWARE_ARM
+
+#endif /* __orxX86_64__ || __orxX86__ */
+
 
 /** Module flags
  */
@@ -58,7 +85,7 @@
 /***************************************************************************
  * CRC Tables (slice-by-8)                                                 *
  ***************************************************************************/
-orxU32 saau32CRCTable[8][256];
+static orxU32 saau32CRCTable[8][256];
 
 
 /***************************************************************************
@@ -83,11 +110,224 @@ typedef struct __orxSTRING_STATIC_t
  */
 static orxSTRING_STATIC sstString;
 
+static orxU32 orxFASTCALL orxString_ContinueCRCSoftware(const orxU8 *_pu8Data, orxU32 _u32CRC, orxU32 _u32Size);
+
+/** CRC function, selected at setup
+ */
+static orxU32 (orxFASTCALL *spfnContinueCRC)(const orxU8 *_pu8Data, orxU32 _u32CRC, orxU32 _u32Size) = orxString_ContinueCRCSoftware;
+
 
 /***************************************************************************
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Continues a CRC with a buffer, software version (slice-by-8)
+ * @param[in] _pu8Data        Data used to continue the given CRC
+ * @param[in] _u32CRC         Base CRC (already inverted)
+ * @param[in] _u32Size        Size of the data
+ * @return The resulting CRC (inverted)
+ */
+static orxU32 orxFASTCALL orxString_ContinueCRCSoftware(const orxU8 *_pu8Data, orxU32 _u32CRC, orxU32 _u32Size)
+{
+  orxU32 u32CRC;
+
+#ifdef __orxLITTLE_ENDIAN__
+
+#define orxCRC_GET_FIRST(VALUE) VALUE
+#define orxCRC_INDEX_0          0
+#define orxCRC_INDEX_1          1
+#define orxCRC_INDEX_2          2
+#define orxCRC_INDEX_3          3
+#define orxCRC_INDEX_4          4
+#define orxCRC_INDEX_5          5
+#define orxCRC_INDEX_6          6
+#define orxCRC_INDEX_7          7
+
+#else /* __orxLITTLE_ENDIAN__ */
+
+#define orxCRC_GET_FIRST(VALUE) ((VALUE >> 24) | ((VALUE >> 8) & 0x0000FF00) | ((VALUE << 8) & 0x00FF0000) | (VALUE << 24))
+#define orxCRC_INDEX_0          3
+#define orxCRC_INDEX_1          2
+#define orxCRC_INDEX_2          1
+#define orxCRC_INDEX_3          0
+#define orxCRC_INDEX_4          7
+#define orxCRC_INDEX_5          6
+#define orxCRC_INDEX_6          5
+#define orxCRC_INDEX_7          4
+
+#endif /* __orxLITTLE_ENDIAN__ */
+
+  /* For all slices */
+  for(u32CRC = _u32CRC; _u32Size >= 8; _u32Size -= 8, _pu8Data += 8)
+  {
+    orxU32 u32First, u32Second;
+
+    /* Gets the slice's data */
+    orxMemory_Copy(&u32First, _pu8Data, sizeof(orxU32));
+    orxMemory_Copy(&u32Second, _pu8Data + 4, sizeof(orxU32));
+    u32First ^= orxCRC_GET_FIRST(u32CRC);
+
+    /* Updates the CRC */
+    u32CRC  = saau32CRCTable[orxCRC_INDEX_7][u32First & 0xFF]
+            ^ saau32CRCTable[orxCRC_INDEX_6][(u32First >> 8) & 0xFF]
+            ^ saau32CRCTable[orxCRC_INDEX_5][(u32First >> 16) & 0xFF]
+            ^ saau32CRCTable[orxCRC_INDEX_4][u32First >> 24]
+            ^ saau32CRCTable[orxCRC_INDEX_3][u32Second & 0xFF]
+            ^ saau32CRCTable[orxCRC_INDEX_2][(u32Second >> 8) & 0xFF]
+            ^ saau32CRCTable[orxCRC_INDEX_1][(u32Second >> 16) & 0xFF]
+            ^ saau32CRCTable[orxCRC_INDEX_0][u32Second >> 24];
+  }
+
+  /* For all remaining characters */
+  for(; _u32Size != 0; _u32Size--, _pu8Data++)
+  {
+    /* Updates the CRC */
+    u32CRC = saau32CRCTable[0][((orxU8)(u32CRC & 0xFF)) ^ *_pu8Data] ^ (u32CRC >> 8);
+  }
+
+#undef orxCRC_GET_FIRST
+#undef orxCRC_INDEX_0
+#undef orxCRC_INDEX_1
+#undef orxCRC_INDEX_2
+#undef orxCRC_INDEX_3
+#undef orxCRC_INDEX_4
+#undef orxCRC_INDEX_5
+#undef orxCRC_INDEX_6
+#undef orxCRC_INDEX_7
+
+  /* Done! */
+  return u32CRC;
+}
+
+#if defined(orxSTRING_CRC_HARDWARE_X86)
+
+/** Continues a CRC with a buffer, SSE4.2 version
+ * @param[in] _pu8Data        Data used to continue the given CRC
+ * @param[in] _u32CRC         Base CRC (already inverted)
+ * @param[in] _u32Size        Size of the data
+ * @return The resulting CRC (inverted)
+ */
+static orxSTRING_CRC_TARGET orxU32 orxFASTCALL orxString_ContinueCRCHardware(const orxU8 *_pu8Data, orxU32 _u32CRC, orxU32 _u32Size)
+{
+  orxU32 u32CRC = _u32CRC;
+
+#ifdef __orxX86_64__
+
+  orxU64 u64CRC;
+
+  /* For all 8-byte slices */
+  for(u64CRC = u32CRC; _u32Size >= 8; _u32Size -= 8, _pu8Data += 8)
+  {
+    orxU64 u64Data;
+
+    /* Updates the CRC */
+    orxMemory_Copy(&u64Data, _pu8Data, sizeof(orxU64));
+    u64CRC = _mm_crc32_u64(u64CRC, u64Data);
+  }
+
+  /* Gets 32-bit CRC */
+  u32CRC = (orxU32)u64CRC;
+
+#endif /* __orxX86_64__ */
+
+  /* For all 4-byte slices */
+  for(; _u32Size >= 4; _u32Size -= 4, _pu8Data += 4)
+  {
+    orxU32 u32Data;
+
+    /* Updates the CRC */
+    orxMemory_Copy(&u32Data, _pu8Data, sizeof(orxU32));
+    u32CRC = _mm_crc32_u32(u32CRC, u32Data);
+  }
+
+  /* For all remaining characters */
+  for(; _u32Size != 0; _u32Size--, _pu8Data++)
+  {
+    /* Updates the CRC */
+    u32CRC = _mm_crc32_u8(u32CRC, *_pu8Data);
+  }
+
+  /* Done! */
+  return u32CRC;
+}
+
+#elif defined(orxSTRING_CRC_HARDWARE_ARM)
+
+/** Continues a CRC with a buffer, ARMv8 version
+ * @param[in] _pu8Data        Data used to continue the given CRC
+ * @param[in] _u32CRC         Base CRC (already inverted)
+ * @param[in] _u32Size        Size of the data
+ * @return The resulting CRC (inverted)
+ */
+static orxU32 orxFASTCALL orxString_ContinueCRCHardware(const orxU8 *_pu8Data, orxU32 _u32CRC, orxU32 _u32Size)
+{
+  orxU32 u32CRC;
+
+  /* For all 8-byte slices */
+  for(u32CRC = _u32CRC; _u32Size >= 8; _u32Size -= 8, _pu8Data += 8)
+  {
+    orxU64 u64Data;
+
+    /* Updates the CRC */
+    orxMemory_Copy(&u64Data, _pu8Data, sizeof(orxU64));
+    u32CRC = __crc32cd(u32CRC, u64Data);
+  }
+
+  /* For all remaining characters */
+  for(; _u32Size != 0; _u32Size--, _pu8Data++)
+  {
+    /* Updates the CRC */
+    u32CRC = __crc32cb(u32CRC, *_pu8Data);
+  }
+
+  /* Done! */
+  return u32CRC;
+}
+
+#endif /* orxSTRING_CRC_HARDWARE_X86 */
+
+/** Checks if the CPU supports CRC32C instructions
+ * @return orxTRUE / orxFALSE
+ */
+static orxINLINE orxBOOL orxString_HasHardwareCRC()
+{
+  orxBOOL bResult;
+
+#if defined(orxSTRING_CRC_HARDWARE_X86)
+
+  #if defined(__orxMSVC__)
+
+  int aiInfo[4];
+
+  /* Gets CPU features */
+  __cpuid(aiInfo, 1);
+
+  /* Updates result (SSE4.2) */
+  bResult = (aiInfo[2] & (1 << 20)) ? orxTRUE : orxFALSE;
+
+  #else /* __orxMSVC__ */
+
+  /* Updates result */
+  bResult = __builtin_cpu_supports("sse4.2") ? orxTRUE : orxFALSE;
+
+  #endif /* __orxMSVC__ */
+
+#elif defined(orxSTRING_CRC_HARDWARE_ARM)
+
+  /* Updates result (targeted at compile time) */
+  bResult = orxTRUE;
+
+#else /* orxSTRING_CRC_HARDWARE_X86 */
+
+  /* Updates result */
+  bResult = orxFALSE;
+
+#endif /* orxSTRING_CRC_HARDWARE_X86 */
+
+  /* Done! */
+  return bResult;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -134,6 +374,13 @@ void orxFASTCALL orxString_Setup()
     }
   }
 
+#if defined(orxSTRING_CRC_HARDWARE_X86) || defined(orxSTRING_CRC_HARDWARE_ARM)
+
+  /* Selects CRC function */
+  spfnContinueCRC = (orxString_HasHardwareCRC() != orxFALSE) ? orxString_ContinueCRCHardware : orxString_ContinueCRCSoftware;
+
+#endif /* orxSTRING_CRC_HARDWARE_X86 || orxSTRING_CRC_HARDWARE_ARM */
+
   /* Adds module dependencies */
   orxModule_AddDependency(orxMODULE_ID_STRING, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_STRING, orxMODULE_ID_BANK);
@@ -223,6 +470,22 @@ void orxFASTCALL orxString_Exit()
   return;
 }
 
+/** Continues a CRC with a string one (CRC-32C, hardware accelerated when supported by the CPU)
+ * @param[in] _zString        String used to continue the given CRC
+ * @param[in] _u32CRC         Base CRC.
+ * @param[in] _u32CharNumber  Number of character to process, should be <= orxString_GetLength(_zString)
+ * @return The resulting CRC.
+ */
+orxU32 orxFASTCALL orxString_NContinueCRC(const orxSTRING _zString, orxU32 _u32CRC, orxU32 _u32CharNumber)
+{
+  /* Checks */
+  orxASSERT(_zString != orxNULL);
+  orxASSERT(_u32CharNumber <= orxString_GetLength(_zString));
+
+  /* Done! */
+  return ~spfnContinueCRC((const orxU8 *)_zString, ~_u32CRC, _u32CharNumber);
+}
+
 /** Gets a string's ID (and stores the string internally to prevent duplication)
  * @param[in]   _zString        Concerned string
  * @return      String's ID
@@ -254,17 +517,15 @@ orxU32 orxFASTCALL orxString_GetID(const orxSTRING _zString)
     /* Adds it */
     *pzBucket = orxString_Duplicate(_zString);
   }
-#ifdef __orxDEBUG__
   else
   {
     /* Different strings? */
     if(orxString_Compare(_zString, *pzBucket) != 0)
     {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", *pzBucket, _zString);
+      /* Logs message (in all builds, as IDs are only 32-bit wide) */
+      orxLOG("Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", *pzBucket, _zString);
     }
   }
-#endif /* __orxDEBUG__ */
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -341,14 +602,12 @@ const orxSTRING orxFASTCALL orxString_Store(const orxSTRING _zString)
     /* Gets it */
     zResult = *pzBucket;
 
-#ifdef __orxDEBUG__
     /* Different strings? */
     if(orxString_Compare(_zString, zResult) != 0)
     {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", zResult, _zString);
+      /* Logs message (in all builds, as IDs are only 32-bit wide) */
+      orxLOG("Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", zResult, _zString);
     }
-#endif /* __orxDEBUG__ */
   }
 
   /* Profiles */
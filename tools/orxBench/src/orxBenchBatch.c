@@ -0,0 +1,300 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2017 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxBenchBatch.c
+ * @date 17/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * Display batching bench: draws a large number of small alpha-blended quads every frame, with VSync disabled,
+ * and measures the time spent submitting them as well as the total frame time (including the buffer swap).
+ * An optional blend mode switch every few quads forces the display plugin to flush its batch more often.
+ */
+
+
+#include "orx.h"
+
+
+/** Defines
+ */
+#define orxBENCH_KU32_DEFAULT_QUAD_NUMBER         100000
+#define orxBENCH_KU32_DEFAULT_FRAME_NUMBER        300
+#define orxBENCH_KU32_WARMUP_FRAME_NUMBER         30
+#define orxBENCH_KU32_BITMAP_SIZE                 16
+
+#define orxBENCH_KZ_LOG_TAG_LENGTH                "10"
+
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", ##__VA_ARGS__)
+
+#else // __orxGCC__ || __orxLLVM__
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", __VA_ARGS__)
+
+#endif //__orxGCC__ || __orxLLVM__
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Static structure
+ */
+typedef struct __orxBENCH_STATIC_t
+{
+  orxBITMAP  *pstBitmap;
+  orxDOUBLE   dSubmitTime;
+  orxDOUBLE   dFrameTime;
+  orxDOUBLE   dLastFrameTime;
+  orxU32      u32QuadNumber;
+  orxU32      u32FrameNumber;
+  orxU32      u32SwitchNumber;
+  orxU32      u32FrameCount;
+
+} orxBENCH_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** static data
+ */
+static orxBENCH_STATIC sstBench;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static orxSTATUS ProcessCount(orxU32 _u32ParamCount, const orxSTRING _azParams[], orxU32 *_pu32Count, const orxSTRING _zName, orxBOOL _bAllowZero)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Has a valid count?
+  if((_u32ParamCount > 1) && (orxString_ToU32(_azParams[1], _pu32Count, orxNULL) != orxSTATUS_FAILURE) && ((*_pu32Count > 0) || (_bAllowZero != orxFALSE)))
+  {
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Logs message
+    orxBENCH_LOG(PARAM, "Invalid %s count.", _zName);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessQuadParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Done!
+  return ProcessCount(_u32ParamCount, _azParams, &(sstBench.u32QuadNumber), "quad", orxFALSE);
+}
+
+static orxSTATUS orxFASTCALL ProcessFrameParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Done!
+  return ProcessCount(_u32ParamCount, _azParams, &(sstBench.u32FrameNumber), "frame", orxFALSE);
+}
+
+static orxSTATUS orxFASTCALL ProcessSwitchParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Done!
+  return ProcessCount(_u32ParamCount, _azParams, &(sstBench.u32SwitchNumber), "switch", orxTRUE);
+}
+
+static orxSTATUS orxFASTCALL EventHandler(const orxEVENT *_pstEvent)
+{
+  // Render stop? (the screen is the current destination)
+  if(_pstEvent->eID == orxRENDER_EVENT_STOP)
+  {
+    orxDISPLAY_TRANSFORM  stTransform;
+    orxDOUBLE             dStart;
+    orxFLOAT              fWidth, fHeight;
+    orxU32                i, u32Columns, u32Rows;
+
+    // Gets frame time
+    dStart = orxSystem_GetTime();
+
+    // Done warming up?
+    if(sstBench.u32FrameCount > orxBENCH_KU32_WARMUP_FRAME_NUMBER)
+    {
+      // Updates stats
+      sstBench.dFrameTime += dStart - sstBench.dLastFrameTime;
+    }
+    sstBench.dLastFrameTime = dStart;
+
+    // Gets quad grid
+    orxDisplay_GetScreenSize(&fWidth, &fHeight);
+    u32Columns  = orxMAX(orxF2U(fWidth) / orxBENCH_KU32_BITMAP_SIZE, 1);
+    u32Rows     = orxMAX(orxF2U(fHeight) / orxBENCH_KU32_BITMAP_SIZE, 1);
+
+    // Inits transform
+    orxMemory_Zero(&stTransform, sizeof(orxDISPLAY_TRANSFORM));
+    stTransform.fRepeatX  = orxFLOAT_1;
+    stTransform.fRepeatY  = orxFLOAT_1;
+    stTransform.fScaleX   = orxFLOAT_1;
+    stTransform.fScaleY   = orxFLOAT_1;
+
+    // For all quads
+    for(i = 0; i < sstBench.u32QuadNumber; i++)
+    {
+      orxDISPLAY_BLEND_MODE eBlendMode;
+
+      // Gets its position
+      stTransform.fDstX = orxU2F((i % u32Columns) * orxBENCH_KU32_BITMAP_SIZE);
+      stTransform.fDstY = orxU2F(((i / u32Columns) % u32Rows) * orxBENCH_KU32_BITMAP_SIZE);
+
+      // Gets its blend mode
+      eBlendMode = ((sstBench.u32SwitchNumber != 0) && (((i / sstBench.u32SwitchNumber) & 1) != 0)) ? orxDISPLAY_BLEND_MODE_ADD : orxDISPLAY_BLEND_MODE_ALPHA;
+
+      // Draws it
+      orxDisplay_TransformBitmap(sstBench.pstBitmap, &stTransform, orxDISPLAY_SMOOTHING_OFF, eBlendMode);
+    }
+
+    // Done warming up?
+    if(sstBench.u32FrameCount >= orxBENCH_KU32_WARMUP_FRAME_NUMBER)
+    {
+      // Updates stats
+      sstBench.dSubmitTime += orxSystem_GetTime() - dStart;
+    }
+
+    // Updates frame count
+    sstBench.u32FrameCount++;
+  }
+
+  // Done!
+  return orxSTATUS_SUCCESS;
+}
+
+static orxSTATUS orxFASTCALL Init()
+{
+#define orxBENCH_DECLARE_PARAM(SN, LN, SD, LD, FN) {orxPARAM_KU32_FLAG_STOP_ON_ERROR, SN, LN, SD, LD, &FN},
+
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxPARAM  astParamList[] =
+  {
+    orxBENCH_DECLARE_PARAM("n", "number", "Quad number", "Number of quads drawn per frame, defaults to 100000", ProcessQuadParams)
+    orxBENCH_DECLARE_PARAM("f", "frames", "Frame number", "Number of measured frames, defaults to 300", ProcessFrameParams)
+    orxBENCH_DECLARE_PARAM("s", "switch", "Blend switch", "Switches blend mode every <number> quads, forcing batch flushes, defaults to 0 (never)", ProcessSwitchParams)
+  };
+
+  // Clears static controller
+  orxMemory_Zero(&sstBench, sizeof(orxBENCH_STATIC));
+  sstBench.u32QuadNumber  = orxBENCH_KU32_DEFAULT_QUAD_NUMBER;
+  sstBench.u32FrameNumber = orxBENCH_KU32_DEFAULT_FRAME_NUMBER;
+
+  // For all params
+  for(i = 0; (i < sizeof(astParamList) / sizeof(astParamList[0])) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    // Registers param
+    eResult = orxParam_Register(&astParamList[i]);
+  }
+
+  // Success?
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    // Creates bitmap
+    sstBench.pstBitmap = orxDisplay_CreateBitmap(orxBENCH_KU32_BITMAP_SIZE, orxBENCH_KU32_BITMAP_SIZE);
+
+    // Success?
+    if(sstBench.pstBitmap != orxNULL)
+    {
+      orxU8 au8Data[orxBENCH_KU32_BITMAP_SIZE * orxBENCH_KU32_BITMAP_SIZE * 4];
+
+      // Fills it with translucent white
+      for(i = 0; i < sizeof(au8Data); i += 4)
+      {
+        au8Data[i]      = 0xFF;
+        au8Data[i + 1]  = 0xFF;
+        au8Data[i + 2]  = 0xFF;
+        au8Data[i + 3]  = 0x20;
+      }
+      orxDisplay_SetBitmapData(sstBench.pstBitmap, au8Data, sizeof(au8Data));
+
+      // Doesn't wait for the screen refresh
+      orxDisplay_EnableVSync(orxFALSE);
+
+      // Adds event handler
+      eResult = orxEvent_AddHandler(orxEVENT_TYPE_RENDER, EventHandler);
+
+      // Logs message
+      orxBENCH_LOG(SETUP, "Drawing %u quads per frame, switching blend mode every %u quads.", sstBench.u32QuadNumber, sstBench.u32SwitchNumber);
+    }
+    else
+    {
+      // Logs message
+      orxBENCH_LOG(SETUP, "Couldn't create bitmap, aborting.");
+
+      // Updates result
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL Run()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Done? (the frame time of the last measured frame is only known on the next one)
+  if(sstBench.u32FrameCount > sstBench.u32FrameNumber + orxBENCH_KU32_WARMUP_FRAME_NUMBER)
+  {
+    // Logs results
+    orxBENCH_LOG(RESULT, "%u quads: %.3fms submit, %.3fms frame on average over %u frames", sstBench.u32QuadNumber, 1000.0 * sstBench.dSubmitTime / (orxDOUBLE)sstBench.u32FrameNumber, 1000.0 * sstBench.dFrameTime / (orxDOUBLE)sstBench.u32FrameNumber, sstBench.u32FrameNumber);
+
+    // Updates result
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Exit()
+{
+  // Removes event handler
+  orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, EventHandler);
+
+  // Deletes bitmap
+  if(sstBench.pstBitmap != orxNULL)
+  {
+    orxDisplay_DeleteBitmap(sstBench.pstBitmap);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  // Executes bench
+  orx_Execute(argc, argv, Init, Run, Exit);
+
+  // Done!
+  return EXIT_SUCCESS;
+}
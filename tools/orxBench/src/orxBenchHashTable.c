@@ -0,0 +1,381 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2017 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxBenchHashTable.c
+ * @date 17/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * Hashtable bench: fills open addressing and chained (orxHASHTABLE_KU32_FLAG_CHAINED) hashtables with string CRC keys,
+ * then measures insertions, successful & failed lookups, iteration and removals, checking that both return the same results.
+ */
+
+
+#include "orx.h"
+
+#include <stdlib.h>
+
+
+/** Defines
+ */
+#define orxBENCH_KU32_DEFAULT_KEY_NUMBER          200000
+#define orxBENCH_KU32_DEFAULT_SIZE                256
+#define orxBENCH_KU32_DEFAULT_RUN_NUMBER          5
+
+#define orxBENCH_KZ_LOG_TAG_LENGTH                "10"
+
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", ##__VA_ARGS__)
+
+#else // __orxGCC__ || __orxLLVM__
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", __VA_ARGS__)
+
+#endif //__orxGCC__ || __orxLLVM__
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Operations
+ */
+typedef enum __orxBENCH_OPERATION_t
+{
+  orxBENCH_OPERATION_SET = 0,
+  orxBENCH_OPERATION_GET,
+  orxBENCH_OPERATION_MISS,
+  orxBENCH_OPERATION_ITERATE,
+  orxBENCH_OPERATION_REMOVE,
+
+  orxBENCH_OPERATION_NUMBER,
+
+  orxBENCH_OPERATION_NONE = orxENUM_NONE
+
+} orxBENCH_OPERATION;
+
+/** Static structure
+ */
+typedef struct __orxBENCH_STATIC_t
+{
+  orxU64     *au64KeyList;
+  orxU32      u32KeyNumber;
+  orxU32      u32Size;
+  orxU32      u32RunNumber;
+
+} orxBENCH_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** static data
+ */
+static orxBENCH_STATIC sstBench;
+
+static const orxSTRING sazOperationName[orxBENCH_OPERATION_NUMBER] =
+{
+  "set", "get", "miss", "iterate", "remove"
+};
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static orxSTATUS ProcessCount(orxU32 _u32ParamCount, const orxSTRING _azParams[], orxU32 *_pu32Count, const orxSTRING _zName)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Has a valid count?
+  if((_u32ParamCount > 1) && (orxString_ToU32(_azParams[1], _pu32Count, orxNULL) != orxSTATUS_FAILURE) && (*_pu32Count > 0))
+  {
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Logs message
+    orxBENCH_LOG(PARAM, "Invalid %s.", _zName);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessKeyParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Done!
+  return ProcessCount(_u32ParamCount, _azParams, &(sstBench.u32KeyNumber), "key count");
+}
+
+static orxSTATUS orxFASTCALL ProcessSizeParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Done!
+  return ProcessCount(_u32ParamCount, _azParams, &(sstBench.u32Size), "size");
+}
+
+static orxSTATUS orxFASTCALL ProcessRunParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Done!
+  return ProcessCount(_u32ParamCount, _azParams, &(sstBench.u32RunNumber), "run count");
+}
+
+static orxU32 RunOnce(orxU32 _u32Flags, orxDOUBLE *_adTime)
+{
+  orxHASHTABLE *pstTable;
+  orxU32        u32Errors = 0;
+
+  // Creates table
+  pstTable = orxHashTable_Create(sstBench.u32Size, _u32Flags, orxMEMORY_TYPE_MAIN);
+
+  // Success?
+  if(pstTable != orxNULL)
+  {
+    orxDOUBLE dTime;
+    orxHANDLE hIterator;
+    orxU64    u64Sum = 0, u64Expected = 0;
+    orxU32    i, u32Half;
+
+    // Only first half of the keys are inserted, the second half being used for failed lookups
+    u32Half = sstBench.u32KeyNumber / 2;
+
+    // Inserts keys
+    dTime = orxSystem_GetTime();
+    for(i = 0; i < u32Half; i++)
+    {
+      orxHashTable_Set(pstTable, sstBench.au64KeyList[i], (void *)(size_t)(i + 1));
+    }
+    _adTime[orxBENCH_OPERATION_SET] += orxSystem_GetTime() - dTime;
+
+    // Checks count
+    u32Errors += (orxHashTable_GetCounter(pstTable) != u32Half) ? 1 : 0;
+
+    // Finds them
+    dTime = orxSystem_GetTime();
+    for(i = 0; i < u32Half; i++)
+    {
+      u64Sum += (orxU64)(size_t)orxHashTable_Get(pstTable, sstBench.au64KeyList[i]);
+    }
+    _adTime[orxBENCH_OPERATION_GET] += orxSystem_GetTime() - dTime;
+
+    // Checks results
+    u64Expected = ((orxU64)u32Half * (orxU64)(u32Half + 1)) / 2;
+    u32Errors  += (u64Sum != u64Expected) ? 1 : 0;
+
+    // Looks for missing keys
+    dTime = orxSystem_GetTime();
+    for(i = u32Half, u64Sum = 0; i < sstBench.u32KeyNumber; i++)
+    {
+      u64Sum += (orxU64)(size_t)orxHashTable_Get(pstTable, sstBench.au64KeyList[i]);
+    }
+    _adTime[orxBENCH_OPERATION_MISS] += orxSystem_GetTime() - dTime;
+
+    // Checks results
+    u32Errors += (u64Sum != 0) ? 1 : 0;
+
+    // Iterates over all keys
+    dTime = orxSystem_GetTime();
+    for(hIterator = orxHashTable_GetNext(pstTable, orxHANDLE_UNDEFINED, orxNULL, orxNULL), u64Sum = 0;
+        hIterator != orxHANDLE_UNDEFINED;
+        hIterator = orxHashTable_GetNext(pstTable, hIterator, orxNULL, orxNULL))
+    {
+      void *pData;
+
+      orxHashTable_GetNext(pstTable, hIterator, orxNULL, &pData);
+      u64Sum++;
+    }
+    _adTime[orxBENCH_OPERATION_ITERATE] += orxSystem_GetTime() - dTime;
+
+    // Checks results
+    u32Errors += (u64Sum != (orxU64)u32Half) ? 1 : 0;
+
+    // Removes all keys
+    dTime = orxSystem_GetTime();
+    for(i = 0; i < u32Half; i++)
+    {
+      u32Errors += (orxHashTable_Remove(pstTable, sstBench.au64KeyList[i]) == orxSTATUS_FAILURE) ? 1 : 0;
+    }
+    _adTime[orxBENCH_OPERATION_REMOVE] += orxSystem_GetTime() - dTime;
+
+    // Checks count
+    u32Errors += (orxHashTable_GetCounter(pstTable) != 0) ? 1 : 0;
+
+    // Deletes table
+    orxHashTable_Delete(pstTable);
+  }
+  else
+  {
+    // Logs message
+    orxBENCH_LOG(RUN, "Couldn't create hashtable.");
+
+    // Updates errors
+    u32Errors++;
+  }
+
+  // Done!
+  return u32Errors;
+}
+
+static void orxFASTCALL Setup()
+{
+  // Adds module dependencies
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_PARAM);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_BANK);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_SYSTEM);
+}
+
+static orxSTATUS orxFASTCALL Init()
+{
+#define orxBENCH_DECLARE_PARAM(SN, LN, SD, LD, FN) {orxPARAM_KU32_FLAG_STOP_ON_ERROR, SN, LN, SD, LD, &FN},
+
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxPARAM  astParamList[] =
+  {
+    orxBENCH_DECLARE_PARAM("n", "number", "Key number", "Number of keys, half of them being inserted and the other half used for failed lookups, defaults to 200000", ProcessKeyParams)
+    orxBENCH_DECLARE_PARAM("s", "size", "Creation size", "Key number given at creation, ie. bucket number of chained hashtables, defaults to 256", ProcessSizeParams)
+    orxBENCH_DECLARE_PARAM("r", "runs", "Run number", "Number of runs per hashtable type, defaults to 5", ProcessRunParams)
+  };
+
+  // Clears static controller
+  orxMemory_Zero(&sstBench, sizeof(orxBENCH_STATIC));
+  sstBench.u32KeyNumber = orxBENCH_KU32_DEFAULT_KEY_NUMBER;
+  sstBench.u32Size      = orxBENCH_KU32_DEFAULT_SIZE;
+  sstBench.u32RunNumber = orxBENCH_KU32_DEFAULT_RUN_NUMBER;
+
+  // For all params
+  for(i = 0; (i < sizeof(astParamList) / sizeof(astParamList[0])) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    // Registers param
+    eResult = orxParam_Register(&astParamList[i]);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Exit()
+{
+}
+
+static void Run()
+{
+  orxU32 i;
+
+  // Needs at least one inserted key
+  sstBench.u32KeyNumber = orxMAX(sstBench.u32KeyNumber, 2);
+
+  // Allocates keys
+  sstBench.au64KeyList = (orxU64 *)orxMemory_Allocate(sstBench.u32KeyNumber * sizeof(orxU64), orxMEMORY_TYPE_MAIN);
+
+  // Success?
+  if(sstBench.au64KeyList != orxNULL)
+  {
+    orxU32 u32Type;
+
+    // For all keys
+    for(i = 0; i < sstBench.u32KeyNumber; i++)
+    {
+      orxCHAR acBuffer[32];
+
+      // Uses the CRC of a generated name, like string IDs used as keys throughout the engine
+      orxString_NPrint(acBuffer, sizeof(acBuffer) - 1, "BenchKey%u", i);
+      sstBench.au64KeyList[i] = (orxU64)orxString_ToCRC(acBuffer);
+    }
+
+    // For both hashtable types
+    for(u32Type = 0; u32Type < 2; u32Type++)
+    {
+      orxDOUBLE adTime[orxBENCH_OPERATION_NUMBER];
+      orxU32    u32Flags, u32Errors, u32Operation;
+
+      // Gets flags
+      u32Flags = (u32Type == 0) ? orxHASHTABLE_KU32_FLAG_NONE : orxHASHTABLE_KU32_FLAG_CHAINED;
+
+      // For all runs
+      orxMemory_Zero(adTime, sizeof(adTime));
+      for(i = 0, u32Errors = 0; i < sstBench.u32RunNumber; i++)
+      {
+        u32Errors += RunOnce(u32Flags, adTime);
+      }
+
+      // For all operations
+      for(u32Operation = 0; u32Operation < orxBENCH_OPERATION_NUMBER; u32Operation++)
+      {
+        // Logs result
+        orxBENCH_LOG(RESULT, "%-8s %u keys, size %u, %-8s %8.1fns per key", (u32Type == 0) ? "open" : "chained", sstBench.u32KeyNumber / 2, sstBench.u32Size, sazOperationName[u32Operation], 1.0e9 * adTime[u32Operation] / ((orxDOUBLE)sstBench.u32RunNumber * (orxDOUBLE)(sstBench.u32KeyNumber / 2)));
+      }
+
+      // Errors?
+      if(u32Errors != 0)
+      {
+        // Logs message
+        orxBENCH_LOG(RESULT, "%-8s %u unexpected results", (u32Type == 0) ? "open" : "chained", u32Errors);
+      }
+    }
+
+    // Frees keys
+    orxMemory_Free(sstBench.au64KeyList);
+  }
+  else
+  {
+    // Logs message
+    orxBENCH_LOG(RUN, "Couldn't allocate %u keys.", sstBench.u32KeyNumber);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  // Inits the Debug System
+  orxDEBUG_INIT();
+
+  // Sets debug flags
+  orxDEBUG_SET_FLAGS(orxDEBUG_KU32_STATIC_FLAG_TIMESTAMP, orxDEBUG_KU32_STATIC_FLAG_FULL_TIMESTAMP | orxDEBUG_KU32_STATIC_FLAG_TYPE | orxDEBUG_KU32_STATIC_FLAG_TAGGED);
+
+  // Registers main module
+  orxModule_Register(orxMODULE_ID_MAIN, "MAIN", Setup, Init, Exit);
+
+  // Sends the command line arguments to orxParam module
+  if(orxParam_SetArgs(argc, argv) != orxSTATUS_FAILURE)
+  {
+    // Inits the engine
+    if(orxModule_Init(orxMODULE_ID_MAIN) != orxSTATUS_FAILURE)
+    {
+      // Runs
+      Run();
+
+      // Exits from engine
+      orxModule_Exit(orxMODULE_ID_MAIN);
+    }
+  }
+
+  // Exits from the Debug system
+  orxDEBUG_EXIT();
+
+  // Done!
+  return EXIT_SUCCESS;
+}
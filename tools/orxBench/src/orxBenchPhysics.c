@@ -0,0 +1,320 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2017 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxBenchPhysics.c
+ * @date 17/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * Physics update bench: creates a grid of static and sleeping dynamic bodies, lets them settle,
+ * then measures the time spent in the physics plugin update per frame.
+ * Run it against an orx library built before the LiquidFun synced body state to get the previous figures.
+ */
+
+
+#include "orx.h"
+
+
+/** Defines
+ */
+#define orxBENCH_KZ_CONFIG_STATIC                 "BenchStatic"
+#define orxBENCH_KZ_CONFIG_DYNAMIC                "BenchDynamic"
+#define orxBENCH_KZ_CONFIG_PART                   "BenchPart"
+
+#define orxBENCH_KU32_DEFAULT_BODY_NUMBER         10000
+#define orxBENCH_KU32_DEFAULT_FRAME_NUMBER        600
+
+#define orxBENCH_KF_BODY_SIZE                     orx2F(8.0f)
+#define orxBENCH_KF_BODY_SPACING                  orx2F(16.0f)
+#define orxBENCH_KF_SETTLE_TIME                   orx2F(2.0f)
+
+#define orxBENCH_KZ_LOG_TAG_LENGTH                "10"
+
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", ##__VA_ARGS__)
+
+#else // __orxGCC__ || __orxLLVM__
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", __VA_ARGS__)
+
+#endif //__orxGCC__ || __orxLLVM__
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Static structure
+ */
+typedef struct __orxBENCH_STATIC_t
+{
+  orxDOUBLE dStartTime;
+  orxDOUBLE dSettleTime;
+  orxDOUBLE dUpdateTime;
+  orxDOUBLE dMaxUpdateTime;
+  orxU32    u32BodyNumber;
+  orxU32    u32FrameNumber;
+  orxU32    u32FrameCount;
+
+} orxBENCH_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** static data
+ */
+static orxBENCH_STATIC sstBench;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static void orxFASTCALL StartTimer(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  // Stores start time
+  sstBench.dStartTime = orxSystem_GetTime();
+}
+
+static void orxFASTCALL StopTimer(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  orxDOUBLE dTime;
+
+  // Gets update time
+  dTime = orxSystem_GetTime() - sstBench.dStartTime;
+
+  // Done settling?
+  if(sstBench.dStartTime >= sstBench.dSettleTime)
+  {
+    // Updates stats
+    sstBench.dUpdateTime   += dTime;
+    sstBench.dMaxUpdateTime = orxMAX(sstBench.dMaxUpdateTime, dTime);
+    sstBench.u32FrameCount++;
+  }
+}
+
+static orxSTATUS orxFASTCALL ProcessBodyParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Has a valid count?
+  if((_u32ParamCount > 1) && (orxString_ToU32(_azParams[1], &(sstBench.u32BodyNumber), orxNULL) != orxSTATUS_FAILURE) && (sstBench.u32BodyNumber > 0))
+  {
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Logs message
+    orxBENCH_LOG(PARAM, "Invalid body count.");
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessFrameParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Has a valid count?
+  if((_u32ParamCount > 1) && (orxString_ToU32(_azParams[1], &(sstBench.u32FrameNumber), orxNULL) != orxSTATUS_FAILURE) && (sstBench.u32FrameNumber > 0))
+  {
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Logs message
+    orxBENCH_LOG(PARAM, "Invalid frame count.");
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void SetupConfig()
+{
+  orxVECTOR       vTopLeft, vBottomRight;
+  const orxSTRING zPart = orxBENCH_KZ_CONFIG_PART;
+
+  // Setups body part
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_PART);
+  orxConfig_SetString("Type", "box");
+  orxConfig_SetBool("Solid", orxTRUE);
+  orxConfig_SetFloat("Density", orxFLOAT_1);
+  orxConfig_SetVector("TopLeft", orxVector_Set(&vTopLeft, orxFLOAT_0, orxFLOAT_0, orxFLOAT_0));
+  orxConfig_SetVector("BottomRight", orxVector_Set(&vBottomRight, orxBENCH_KF_BODY_SIZE, orxBENCH_KF_BODY_SIZE, orxFLOAT_0));
+  orxConfig_PopSection();
+
+  // Setups static body & object
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_STATIC "Body");
+  orxConfig_SetListString("PartList", &zPart, 1);
+  orxConfig_PopSection();
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_STATIC);
+  orxConfig_SetString("Body", orxBENCH_KZ_CONFIG_STATIC "Body");
+  orxConfig_PopSection();
+
+  // Setups dynamic body & object: without gravity nor contacts, they fall asleep as soon as Box2D allows it
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_DYNAMIC "Body");
+  orxConfig_SetListString("PartList", &zPart, 1);
+  orxConfig_SetBool("Dynamic", orxTRUE);
+  orxConfig_SetBool("AllowSleep", orxTRUE);
+  orxConfig_SetVector("CustomGravity", &orxVECTOR_0);
+  orxConfig_PopSection();
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_DYNAMIC);
+  orxConfig_SetString("Body", orxBENCH_KZ_CONFIG_DYNAMIC "Body");
+  orxConfig_PopSection();
+}
+
+static orxSTATUS orxFASTCALL Init()
+{
+#define orxBENCH_DECLARE_PARAM(SN, LN, SD, LD, FN) {orxPARAM_KU32_FLAG_STOP_ON_ERROR, SN, LN, SD, LD, &FN},
+
+  orxCLOCK *pstClock;
+  orxU32    i, u32Width;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxPARAM  astParamList[] =
+  {
+    orxBENCH_DECLARE_PARAM("n", "number", "Body number", "Number of bodies, half static & half sleeping dynamic, defaults to 10000", ProcessBodyParams)
+    orxBENCH_DECLARE_PARAM("f", "frames", "Frame number", "Number of measured frames, defaults to 600", ProcessFrameParams)
+  };
+
+  // Clears static controller
+  orxMemory_Zero(&sstBench, sizeof(orxBENCH_STATIC));
+  sstBench.u32BodyNumber  = orxBENCH_KU32_DEFAULT_BODY_NUMBER;
+  sstBench.u32FrameNumber = orxBENCH_KU32_DEFAULT_FRAME_NUMBER;
+
+  // For all params
+  for(i = 0; (i < sizeof(astParamList) / sizeof(astParamList[0])) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    // Registers param
+    eResult = orxParam_Register(&astParamList[i]);
+  }
+
+  // Success?
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    // Setups config
+    SetupConfig();
+
+    // Creates bodies on a grid, alternating static & dynamic ones
+    u32Width = (orxU32)orxMath_Ceil(orxMath_Sqrt(orxU2F(sstBench.u32BodyNumber)));
+    for(i = 0; i < sstBench.u32BodyNumber; i++)
+    {
+      orxOBJECT *pstObject;
+      orxVECTOR  vPos;
+
+      // Creates it
+      pstObject = orxObject_CreateFromConfig(((i & 1) == 0) ? orxBENCH_KZ_CONFIG_STATIC : orxBENCH_KZ_CONFIG_DYNAMIC);
+
+      // Valid?
+      if(pstObject != orxNULL)
+      {
+        // Moves it
+        orxObject_SetPosition(pstObject, orxVector_Set(&vPos, orxBENCH_KF_BODY_SPACING * orxU2F(i % u32Width), orxBENCH_KF_BODY_SPACING * orxU2F(i / u32Width), orxFLOAT_0));
+      }
+      else
+      {
+        // Logs message
+        orxBENCH_LOG(SETUP, "Couldn't create body #%u, aborting.", i);
+
+        // Updates result
+        eResult = orxSTATUS_FAILURE;
+        break;
+      }
+    }
+  }
+
+  // Success?
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    // Gets core clock
+    pstClock = orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE);
+
+    // Surrounds the physics update (orxCLOCK_PRIORITY_LOWER, registered before us) with our timers
+    if((orxClock_Register(pstClock, StartTimer, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_LOW) == orxSTATUS_FAILURE)
+    || (orxClock_Register(pstClock, StopTimer, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_LOWER) == orxSTATUS_FAILURE))
+    {
+      // Logs message
+      orxBENCH_LOG(SETUP, "Couldn't register timers, aborting.");
+
+      // Updates result
+      eResult = orxSTATUS_FAILURE;
+    }
+    else
+    {
+      // Lets dynamic bodies fall asleep before measuring
+      sstBench.dSettleTime = orxSystem_GetTime() + (orxDOUBLE)orxBENCH_KF_SETTLE_TIME;
+
+      // Logs message
+      orxBENCH_LOG(SETUP, "Created %u bodies, settling for %gs.", sstBench.u32BodyNumber, orxBENCH_KF_SETTLE_TIME);
+    }
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL Run()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Done?
+  if(sstBench.u32FrameCount >= sstBench.u32FrameNumber)
+  {
+    // Logs results
+    orxBENCH_LOG(RESULT, "%u bodies, physics update: %.3fms average, %.3fms max over %u frames", sstBench.u32BodyNumber, 1000.0 * sstBench.dUpdateTime / (orxDOUBLE)sstBench.u32FrameCount, 1000.0 * sstBench.dMaxUpdateTime, sstBench.u32FrameCount);
+
+    // Updates result
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Exit()
+{
+  orxCLOCK *pstClock;
+
+  // Gets core clock
+  pstClock = orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE);
+
+  // Unregisters timers
+  orxClock_Unregister(pstClock, StartTimer);
+  orxClock_Unregister(pstClock, StopTimer);
+}
+
+int main(int argc, char **argv)
+{
+  // Executes bench
+  orx_Execute(argc, argv, Init, Run, Exit);
+
+  // Done!
+  return EXIT_SUCCESS;
+}
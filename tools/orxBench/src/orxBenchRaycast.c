@@ -0,0 +1,343 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2017 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxBenchRaycast.c
+ * @date 17/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * Raycast bench: creates randomly placed static bodies, then casts the same random rays every frame,
+ * one at a time with orxPhysics_Raycast() and as a batch with orxPhysics_RaycastList(),
+ * and compares their timings and results.
+ */
+
+
+#include "orx.h"
+
+
+/** Defines
+ */
+#define orxBENCH_KZ_CONFIG_OBJECT                 "BenchBox"
+#define orxBENCH_KZ_CONFIG_PART                   "BenchPart"
+
+#define orxBENCH_KU32_DEFAULT_BODY_NUMBER         5000
+#define orxBENCH_KU32_DEFAULT_RAY_NUMBER          10000
+#define orxBENCH_KU32_DEFAULT_FRAME_NUMBER        60
+#define orxBENCH_KU32_WARMUP_FRAME_NUMBER         2
+#define orxBENCH_KU32_RANDOM_SEED                 0x2A
+
+#define orxBENCH_KF_BODY_SIZE                     orx2F(8.0f)
+#define orxBENCH_KF_FIELD_SIZE                    orx2F(2048.0f)
+
+#define orxBENCH_KZ_LOG_TAG_LENGTH                "10"
+
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", ##__VA_ARGS__)
+
+#else // __orxGCC__ || __orxLLVM__
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", __VA_ARGS__)
+
+#endif //__orxGCC__ || __orxLLVM__
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Static structure
+ */
+typedef struct __orxBENCH_STATIC_t
+{
+  orxPHYSICS_RAY     *astRayList;
+  orxPHYSICS_RAY_HIT *astHitList;
+  orxDOUBLE           dSingleTime;
+  orxDOUBLE           dListTime;
+  orxU32              u32BodyNumber;
+  orxU32              u32RayNumber;
+  orxU32              u32FrameNumber;
+  orxU32              u32FrameCount;
+  orxU32              u32HitCount;
+  orxU32              u32MismatchCount;
+
+} orxBENCH_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** static data
+ */
+static orxBENCH_STATIC sstBench;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static orxSTATUS ProcessCount(orxU32 _u32ParamCount, const orxSTRING _azParams[], orxU32 *_pu32Count, const orxSTRING _zName)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Has a valid count?
+  if((_u32ParamCount > 1) && (orxString_ToU32(_azParams[1], _pu32Count, orxNULL) != orxSTATUS_FAILURE) && (*_pu32Count > 0))
+  {
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Logs message
+    orxBENCH_LOG(PARAM, "Invalid %s count.", _zName);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessBodyParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Done!
+  return ProcessCount(_u32ParamCount, _azParams, &(sstBench.u32BodyNumber), "body");
+}
+
+static orxSTATUS orxFASTCALL ProcessRayParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Done!
+  return ProcessCount(_u32ParamCount, _azParams, &(sstBench.u32RayNumber), "ray");
+}
+
+static orxSTATUS orxFASTCALL ProcessFrameParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Done!
+  return ProcessCount(_u32ParamCount, _azParams, &(sstBench.u32FrameNumber), "frame");
+}
+
+static void SetupConfig()
+{
+  orxVECTOR       vTopLeft, vBottomRight;
+  const orxSTRING zPart = orxBENCH_KZ_CONFIG_PART;
+
+  // Setups body part
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_PART);
+  orxConfig_SetString("Type", "box");
+  orxConfig_SetBool("Solid", orxTRUE);
+  orxConfig_SetVector("TopLeft", orxVector_Set(&vTopLeft, orxFLOAT_0, orxFLOAT_0, orxFLOAT_0));
+  orxConfig_SetVector("BottomRight", orxVector_Set(&vBottomRight, orxBENCH_KF_BODY_SIZE, orxBENCH_KF_BODY_SIZE, orxFLOAT_0));
+  orxConfig_PopSection();
+
+  // Setups static body & object
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_OBJECT "Body");
+  orxConfig_SetListString("PartList", &zPart, 1);
+  orxConfig_PopSection();
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_OBJECT);
+  orxConfig_SetString("Body", orxBENCH_KZ_CONFIG_OBJECT "Body");
+  orxConfig_PopSection();
+}
+
+static orxSTATUS orxFASTCALL Init()
+{
+#define orxBENCH_DECLARE_PARAM(SN, LN, SD, LD, FN) {orxPARAM_KU32_FLAG_STOP_ON_ERROR, SN, LN, SD, LD, &FN},
+
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxPARAM  astParamList[] =
+  {
+    orxBENCH_DECLARE_PARAM("n", "number", "Body number", "Number of static bodies, defaults to 5000", ProcessBodyParams)
+    orxBENCH_DECLARE_PARAM("r", "rays", "Ray number", "Number of rays cast per frame, defaults to 10000", ProcessRayParams)
+    orxBENCH_DECLARE_PARAM("f", "frames", "Frame number", "Number of measured frames, defaults to 60", ProcessFrameParams)
+  };
+
+  // Clears static controller
+  orxMemory_Zero(&sstBench, sizeof(orxBENCH_STATIC));
+  sstBench.u32BodyNumber  = orxBENCH_KU32_DEFAULT_BODY_NUMBER;
+  sstBench.u32RayNumber   = orxBENCH_KU32_DEFAULT_RAY_NUMBER;
+  sstBench.u32FrameNumber = orxBENCH_KU32_DEFAULT_FRAME_NUMBER;
+
+  // For all params
+  for(i = 0; (i < sizeof(astParamList) / sizeof(astParamList[0])) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    // Registers param
+    eResult = orxParam_Register(&astParamList[i]);
+  }
+
+  // Success?
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    // Allocates rays & hits
+    sstBench.astRayList = (orxPHYSICS_RAY *)orxMemory_Allocate(sstBench.u32RayNumber * sizeof(orxPHYSICS_RAY), orxMEMORY_TYPE_MAIN);
+    sstBench.astHitList = (orxPHYSICS_RAY_HIT *)orxMemory_Allocate(sstBench.u32RayNumber * sizeof(orxPHYSICS_RAY_HIT), orxMEMORY_TYPE_MAIN);
+
+    // Success?
+    if((sstBench.astRayList != orxNULL) && (sstBench.astHitList != orxNULL))
+    {
+      // Setups config
+      SetupConfig();
+
+      // Uses a fixed seed so as to get comparable runs
+      orxMath_InitRandom(orxBENCH_KU32_RANDOM_SEED);
+
+      // Creates bodies
+      for(i = 0; i < sstBench.u32BodyNumber; i++)
+      {
+        orxOBJECT *pstObject;
+        orxVECTOR  vPos;
+
+        // Creates it
+        pstObject = orxObject_CreateFromConfig(orxBENCH_KZ_CONFIG_OBJECT);
+
+        // Valid?
+        if(pstObject != orxNULL)
+        {
+          // Moves it
+          orxObject_SetPosition(pstObject, orxVector_Set(&vPos, orxMath_GetRandomFloat(orxFLOAT_0, orxBENCH_KF_FIELD_SIZE), orxMath_GetRandomFloat(orxFLOAT_0, orxBENCH_KF_FIELD_SIZE), orxFLOAT_0));
+        }
+        else
+        {
+          // Logs message
+          orxBENCH_LOG(SETUP, "Couldn't create body #%u, aborting.", i);
+
+          // Updates result
+          eResult = orxSTATUS_FAILURE;
+          break;
+        }
+      }
+
+      // For all rays
+      for(i = 0; i < sstBench.u32RayNumber; i++)
+      {
+        // Picks its extremities
+        orxVector_Set(&(sstBench.astRayList[i].vStart), orxMath_GetRandomFloat(orxFLOAT_0, orxBENCH_KF_FIELD_SIZE), orxMath_GetRandomFloat(orxFLOAT_0, orxBENCH_KF_FIELD_SIZE), orxFLOAT_0);
+        orxVector_Set(&(sstBench.astRayList[i].vEnd), orxMath_GetRandomFloat(orxFLOAT_0, orxBENCH_KF_FIELD_SIZE), orxMath_GetRandomFloat(orxFLOAT_0, orxBENCH_KF_FIELD_SIZE), orxFLOAT_0);
+      }
+
+      // Logs message
+      orxBENCH_LOG(SETUP, "Created %u bodies, casting %u rays per frame.", sstBench.u32BodyNumber, sstBench.u32RayNumber);
+    }
+    else
+    {
+      // Logs message
+      orxBENCH_LOG(SETUP, "Couldn't allocate %u rays, aborting.", sstBench.u32RayNumber);
+
+      // Updates result
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL Run()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Done warming up? (bodies get activated during the first physics update)
+  if(sstBench.u32FrameCount >= orxBENCH_KU32_WARMUP_FRAME_NUMBER)
+  {
+    orxDOUBLE dStart, dSingle;
+    orxU32    i, u32Hits;
+
+    // Casts all rays, one at a time
+    dStart = orxSystem_GetTime();
+    for(i = 0; i < sstBench.u32RayNumber; i++)
+    {
+      orxHANDLE hUserData;
+
+      // Casts it
+      hUserData = orxPhysics_Raycast(&(sstBench.astRayList[i].vStart), &(sstBench.astRayList[i].vEnd), 0xFFFF, 0xFFFF, orxFALSE, orxNULL, orxNULL);
+
+      // Stores its result
+      sstBench.astHitList[i].hUserData = hUserData;
+    }
+    dSingle = orxSystem_GetTime();
+    sstBench.dSingleTime += dSingle - dStart;
+
+    // Checks the batched results against them
+    for(i = 0; i < sstBench.u32RayNumber; i++)
+    {
+      orxPHYSICS_RAY_HIT stHit;
+
+      // Casts it
+      orxPhysics_RaycastList(&(sstBench.astRayList[i]), 1, 0xFFFF, 0xFFFF, orxFALSE, &stHit);
+
+      // Different?
+      if(stHit.hUserData != sstBench.astHitList[i].hUserData)
+      {
+        // Updates mismatch count
+        sstBench.u32MismatchCount++;
+      }
+    }
+
+    // Casts all rays, as a batch
+    dStart = orxSystem_GetTime();
+    u32Hits = orxPhysics_RaycastList(sstBench.astRayList, sstBench.u32RayNumber, 0xFFFF, 0xFFFF, orxFALSE, sstBench.astHitList);
+    sstBench.dListTime += orxSystem_GetTime() - dStart;
+    sstBench.u32HitCount += u32Hits;
+  }
+
+  // Updates frame count
+  sstBench.u32FrameCount++;
+
+  // Done?
+  if(sstBench.u32FrameCount >= sstBench.u32FrameNumber + orxBENCH_KU32_WARMUP_FRAME_NUMBER)
+  {
+    // Logs results
+    orxBENCH_LOG(RESULT, "%u bodies, %u rays: orxPhysics_Raycast() %.3fms, orxPhysics_RaycastList() %.3fms per frame, %u hits per frame", sstBench.u32BodyNumber, sstBench.u32RayNumber, 1000.0 * sstBench.dSingleTime / (orxDOUBLE)sstBench.u32FrameNumber, 1000.0 * sstBench.dListTime / (orxDOUBLE)sstBench.u32FrameNumber, sstBench.u32HitCount / sstBench.u32FrameNumber);
+    if(sstBench.u32MismatchCount != 0)
+    {
+      orxBENCH_LOG(RESULT, "%u rays didn't hit the same body with both functions", sstBench.u32MismatchCount);
+    }
+
+    // Updates result
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Exit()
+{
+  // Frees rays & hits
+  if(sstBench.astRayList != orxNULL)
+  {
+    orxMemory_Free(sstBench.astRayList);
+  }
+  if(sstBench.astHitList != orxNULL)
+  {
+    orxMemory_Free(sstBench.astHitList);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  // Executes bench
+  orx_Execute(argc, argv, Init, Run, Exit);
+
+  // Done!
+  return EXIT_SUCCESS;
+}
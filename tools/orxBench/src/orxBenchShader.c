@@ -0,0 +1,406 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2017 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxBenchShader.c
+ * @date 17/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * Shader parameter bench: renders a grid of objects sharing a shader with a vector and a float parameter,
+ * with VSync disabled, and measures the render and frame times.
+ * The vector parameter is either constant or set per owner, from a given number of distinct values.
+ */
+
+
+#include "orx.h"
+
+
+/** Defines
+ */
+#define orxBENCH_KZ_CONFIG_OBJECT                 "BenchObject"
+#define orxBENCH_KZ_CONFIG_GRAPHIC                "BenchGraphic"
+#define orxBENCH_KZ_CONFIG_SHADER                 "BenchShader"
+#define orxBENCH_KZ_CONFIG_VIEWPORT               "BenchViewport"
+#define orxBENCH_KZ_CONFIG_CAMERA                 "BenchCamera"
+#define orxBENCH_KZ_TEXTURE                       "BenchTexture"
+#define orxBENCH_KZ_PARAM_TINT                    "tint"
+
+#define orxBENCH_KU32_DEFAULT_OBJECT_NUMBER       5000
+#define orxBENCH_KU32_DEFAULT_FRAME_NUMBER        300
+#define orxBENCH_KU32_WARMUP_FRAME_NUMBER         30
+#define orxBENCH_KU32_BITMAP_SIZE                 16
+
+#define orxBENCH_KF_FRUSTUM_WIDTH                 orx2F(800.0f)
+#define orxBENCH_KF_FRUSTUM_HEIGHT                orx2F(600.0f)
+
+#define orxBENCH_KZ_LOG_TAG_LENGTH                "10"
+
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", ##__VA_ARGS__)
+
+#else // __orxGCC__ || __orxLLVM__
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", __VA_ARGS__)
+
+#endif //__orxGCC__ || __orxLLVM__
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Static structure
+ */
+typedef struct __orxBENCH_STATIC_t
+{
+  orxTEXTURE *pstTexture;
+  orxDOUBLE   dRenderStartTime;
+  orxDOUBLE   dRenderTime;
+  orxDOUBLE   dFrameTime;
+  orxDOUBLE   dLastFrameTime;
+  orxU32      u32ObjectNumber;
+  orxU32      u32FrameNumber;
+  orxU32      u32GroupNumber;
+  orxU32      u32FrameCount;
+
+} orxBENCH_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** static data
+ */
+static orxBENCH_STATIC sstBench;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static orxSTATUS ProcessCount(orxU32 _u32ParamCount, const orxSTRING _azParams[], orxU32 *_pu32Count, const orxSTRING _zName, orxBOOL _bAllowZero)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Has a valid count?
+  if((_u32ParamCount > 1) && (orxString_ToU32(_azParams[1], _pu32Count, orxNULL) != orxSTATUS_FAILURE) && ((*_pu32Count > 0) || (_bAllowZero != orxFALSE)))
+  {
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Logs message
+    orxBENCH_LOG(PARAM, "Invalid %s count.", _zName);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessObjectParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Done!
+  return ProcessCount(_u32ParamCount, _azParams, &(sstBench.u32ObjectNumber), "object", orxFALSE);
+}
+
+static orxSTATUS orxFASTCALL ProcessFrameParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Done!
+  return ProcessCount(_u32ParamCount, _azParams, &(sstBench.u32FrameNumber), "frame", orxFALSE);
+}
+
+static orxSTATUS orxFASTCALL ProcessGroupParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Done!
+  return ProcessCount(_u32ParamCount, _azParams, &(sstBench.u32GroupNumber), "group", orxTRUE);
+}
+
+static orxSTATUS orxFASTCALL EventHandler(const orxEVENT *_pstEvent)
+{
+  // Shader?
+  if(_pstEvent->eType == orxEVENT_TYPE_SHADER)
+  {
+    orxSHADER_EVENT_PAYLOAD *pstPayload;
+
+    // Gets payload
+    pstPayload = (orxSHADER_EVENT_PAYLOAD *)_pstEvent->pstPayload;
+
+    // Tint?
+    if(!orxString_Compare(pstPayload->zParamName, orxBENCH_KZ_PARAM_TINT))
+    {
+      orxOBJECT *pstObject;
+
+      // Gets owner object
+      pstObject = orxOBJECT(_pstEvent->hSender);
+
+      // Valid?
+      if(pstObject != orxNULL)
+      {
+        orxVECTOR vPos;
+        orxU32    u32Group;
+
+        // Gets its group from its column
+        orxObject_GetPosition(pstObject, &vPos);
+        u32Group = (orxF2U(vPos.fX) / orxBENCH_KU32_BITMAP_SIZE) % sstBench.u32GroupNumber;
+
+        // Sets its tint
+        orxVector_Set(&(pstPayload->vValue), orxU2F(u32Group + 1) / orxU2F(sstBench.u32GroupNumber), orxFLOAT_1, orxFLOAT_1);
+      }
+    }
+  }
+  else
+  {
+    // Render start?
+    if(_pstEvent->eID == orxRENDER_EVENT_START)
+    {
+      // Stores its time
+      sstBench.dRenderStartTime = orxSystem_GetTime();
+    }
+    // Render stop?
+    else if(_pstEvent->eID == orxRENDER_EVENT_STOP)
+    {
+      orxDOUBLE dTime;
+
+      // Gets current time
+      dTime = orxSystem_GetTime();
+
+      // Done warming up?
+      if(sstBench.u32FrameCount >= orxBENCH_KU32_WARMUP_FRAME_NUMBER)
+      {
+        // Updates stats
+        sstBench.dRenderTime += dTime - sstBench.dRenderStartTime;
+      }
+      if(sstBench.u32FrameCount > orxBENCH_KU32_WARMUP_FRAME_NUMBER)
+      {
+        // Updates stats
+        sstBench.dFrameTime += dTime - sstBench.dLastFrameTime;
+      }
+      sstBench.dLastFrameTime = dTime;
+
+      // Updates frame count
+      sstBench.u32FrameCount++;
+    }
+  }
+
+  // Done!
+  return orxSTATUS_SUCCESS;
+}
+
+static void SetupConfig()
+{
+  orxVECTOR       vValue;
+  const orxSTRING azParamList[] = {"texture", orxBENCH_KZ_PARAM_TINT, "scale"};
+  const orxSTRING zOwnerParam = orxBENCH_KZ_PARAM_TINT;
+  const orxSTRING zShader = orxBENCH_KZ_CONFIG_SHADER;
+
+  // Setups viewport & camera
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_VIEWPORT);
+  orxConfig_SetString("Camera", orxBENCH_KZ_CONFIG_CAMERA);
+  orxConfig_PopSection();
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_CAMERA);
+  orxConfig_SetFloat("FrustumWidth", orxBENCH_KF_FRUSTUM_WIDTH);
+  orxConfig_SetFloat("FrustumHeight", orxBENCH_KF_FRUSTUM_HEIGHT);
+  orxConfig_SetFloat("FrustumFar", orx2F(2.0f));
+  orxConfig_SetVector("Position", orxVector_Set(&vValue, orx2F(0.5f) * orxBENCH_KF_FRUSTUM_WIDTH, orx2F(0.5f) * orxBENCH_KF_FRUSTUM_HEIGHT, -orxFLOAT_1));
+  orxConfig_PopSection();
+
+  // Setups shader: the texture param uses the owner's texture
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_SHADER);
+  orxConfig_SetString("Code", "void main() { gl_FragColor = vec4(tint * scale, 1.0) * texture2D(texture, gl_TexCoord[0].xy) * gl_Color; }");
+  orxConfig_SetListString("ParamList", azParamList, sizeof(azParamList) / sizeof(azParamList[0]));
+  orxConfig_SetVector(orxBENCH_KZ_PARAM_TINT, orxVector_Set(&vValue, orxFLOAT_1, orxFLOAT_1, orxFLOAT_1));
+  orxConfig_SetFloat("scale", orxFLOAT_1);
+  if(sstBench.u32GroupNumber != 0)
+  {
+    orxConfig_SetBool("UseCustomParam", orxTRUE);
+    orxConfig_SetListString("OwnerParamList", &zOwnerParam, 1);
+  }
+  orxConfig_PopSection();
+
+  // Setups graphic & object
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_GRAPHIC);
+  orxConfig_SetString("Texture", orxBENCH_KZ_TEXTURE);
+  orxConfig_PopSection();
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_OBJECT);
+  orxConfig_SetString("Graphic", orxBENCH_KZ_CONFIG_GRAPHIC);
+  orxConfig_SetListString("ShaderList", &zShader, 1);
+  orxConfig_PopSection();
+}
+
+static orxSTATUS orxFASTCALL Init()
+{
+#define orxBENCH_DECLARE_PARAM(SN, LN, SD, LD, FN) {orxPARAM_KU32_FLAG_STOP_ON_ERROR, SN, LN, SD, LD, &FN},
+
+  orxBITMAP  *pstBitmap;
+  orxU32      i;
+  orxSTATUS   eResult = orxSTATUS_SUCCESS;
+  orxPARAM    astParamList[] =
+  {
+    orxBENCH_DECLARE_PARAM("n", "number", "Object number", "Number of rendered objects, defaults to 5000", ProcessObjectParams)
+    orxBENCH_DECLARE_PARAM("f", "frames", "Frame number", "Number of measured frames, defaults to 300", ProcessFrameParams)
+    orxBENCH_DECLARE_PARAM("g", "groups", "Group number", "Number of distinct per-owner values of the vector param, defaults to 0 (constant param)", ProcessGroupParams)
+  };
+
+  // Clears static controller
+  orxMemory_Zero(&sstBench, sizeof(orxBENCH_STATIC));
+  sstBench.u32ObjectNumber  = orxBENCH_KU32_DEFAULT_OBJECT_NUMBER;
+  sstBench.u32FrameNumber   = orxBENCH_KU32_DEFAULT_FRAME_NUMBER;
+
+  // For all params
+  for(i = 0; (i < sizeof(astParamList) / sizeof(astParamList[0])) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    // Registers param
+    eResult = orxParam_Register(&astParamList[i]);
+  }
+
+  // Success?
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    // Creates bitmap & texture
+    pstBitmap           = orxDisplay_CreateBitmap(orxBENCH_KU32_BITMAP_SIZE, orxBENCH_KU32_BITMAP_SIZE);
+    sstBench.pstTexture = orxTexture_Create();
+
+    // Success?
+    if((pstBitmap != orxNULL) && (sstBench.pstTexture != orxNULL))
+    {
+      orxU8 au8Data[orxBENCH_KU32_BITMAP_SIZE * orxBENCH_KU32_BITMAP_SIZE * 4];
+
+      // Fills it with white
+      orxMemory_Set(au8Data, 0xFF, sizeof(au8Data));
+      orxDisplay_SetBitmapData(pstBitmap, au8Data, sizeof(au8Data));
+
+      // Links it under a name graphics can refer to
+      orxTexture_LinkBitmap(sstBench.pstTexture, pstBitmap, orxBENCH_KZ_TEXTURE, orxTRUE);
+
+      // Setups config
+      SetupConfig();
+
+      // Doesn't wait for the screen refresh
+      orxDisplay_EnableVSync(orxFALSE);
+
+      // Creates viewport
+      orxViewport_CreateFromConfig(orxBENCH_KZ_CONFIG_VIEWPORT);
+
+      // Creates objects on a grid
+      for(i = 0; i < sstBench.u32ObjectNumber; i++)
+      {
+        orxOBJECT  *pstObject;
+        orxU32      u32Columns;
+
+        // Creates it
+        pstObject = orxObject_CreateFromConfig(orxBENCH_KZ_CONFIG_OBJECT);
+
+        // Valid?
+        if(pstObject != orxNULL)
+        {
+          orxVECTOR vPos;
+
+          // Moves it
+          u32Columns = orxF2U(orxBENCH_KF_FRUSTUM_WIDTH) / orxBENCH_KU32_BITMAP_SIZE;
+          orxObject_SetPosition(pstObject, orxVector_Set(&vPos, orxU2F((i % u32Columns) * orxBENCH_KU32_BITMAP_SIZE), orxU2F(((i / u32Columns) * orxBENCH_KU32_BITMAP_SIZE) % orxF2U(orxBENCH_KF_FRUSTUM_HEIGHT)), orxFLOAT_0));
+        }
+        else
+        {
+          // Logs message
+          orxBENCH_LOG(SETUP, "Couldn't create object #%u, aborting.", i);
+
+          // Updates result
+          eResult = orxSTATUS_FAILURE;
+          break;
+        }
+      }
+
+      // Success?
+      if(eResult != orxSTATUS_FAILURE)
+      {
+        // Adds event handlers
+        orxEvent_AddHandler(orxEVENT_TYPE_RENDER, EventHandler);
+        if(sstBench.u32GroupNumber != 0)
+        {
+          orxEvent_AddHandler(orxEVENT_TYPE_SHADER, EventHandler);
+        }
+
+        // Logs message
+        orxBENCH_LOG(SETUP, "Rendering %u objects, with %u distinct owner values.", sstBench.u32ObjectNumber, sstBench.u32GroupNumber);
+      }
+    }
+    else
+    {
+      // Logs message
+      orxBENCH_LOG(SETUP, "Couldn't create texture, aborting.");
+
+      // Deletes bitmap
+      if(pstBitmap != orxNULL)
+      {
+        orxDisplay_DeleteBitmap(pstBitmap);
+      }
+
+      // Updates result
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL Run()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Done? (the frame time of the last measured frame is only known on the next one)
+  if(sstBench.u32FrameCount > sstBench.u32FrameNumber + orxBENCH_KU32_WARMUP_FRAME_NUMBER)
+  {
+    // Logs results
+    orxBENCH_LOG(RESULT, "%u objects, %u groups: %.3fms render, %.3fms frame on average over %u frames", sstBench.u32ObjectNumber, sstBench.u32GroupNumber, 1000.0 * sstBench.dRenderTime / (orxDOUBLE)sstBench.u32FrameNumber, 1000.0 * sstBench.dFrameTime / (orxDOUBLE)sstBench.u32FrameNumber, sstBench.u32FrameNumber);
+
+    // Updates result
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Exit()
+{
+  // Removes event handlers
+  orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, EventHandler);
+  if(sstBench.u32GroupNumber != 0)
+  {
+    orxEvent_RemoveHandler(orxEVENT_TYPE_SHADER, EventHandler);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  // Executes bench
+  orx_Execute(argc, argv, Init, Run, Exit);
+
+  // Done!
+  return EXIT_SUCCESS;
+}
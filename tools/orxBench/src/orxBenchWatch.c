@@ -0,0 +1,417 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2017 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxBenchWatch.c
+ * @date 17/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * Resource watch bench: creates files in a temporary directory, caches them in a watched resource group,
+ * then measures the idle CPU cost of the watcher per frame and the latency between a file modification
+ * and its orxRESOURCE_EVENT_UPDATE (including the 0.2s debounce).
+ * Run it against an orx library built before the inotify watcher to get the polling figures.
+ */
+
+
+#include "orx.h"
+
+#include <stdlib.h>
+#include <time.h>
+#include <sys/types.h>
+#ifdef __orxWINDOWS__
+  #include <sys/utime.h>
+  #define utimbuf   _utimbuf
+  #define utime     _utime
+#else /* __orxWINDOWS__ */
+  #include <utime.h>
+#endif /* __orxWINDOWS__ */
+
+
+/** Defines
+ */
+#define orxBENCH_KZ_GROUP                         "BenchWatch"
+#define orxBENCH_KZ_DIRECTORY                     "orxbenchwatch.tmp"
+
+#define orxBENCH_KU32_DEFAULT_FILE_NUMBER         200
+#define orxBENCH_KU32_DEFAULT_RUN_NUMBER          5
+#define orxBENCH_KU32_IDLE_FRAME_NUMBER           300
+
+#define orxBENCH_KF_FRAME_TIME                    orx2F(1.0f / 60.0f)
+#define orxBENCH_KF_TIMEOUT                       orx2F(60.0f)
+
+#define orxBENCH_KZ_LOG_TAG_LENGTH                "10"
+
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", ##__VA_ARGS__)
+
+#else // __orxGCC__ || __orxLLVM__
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", __VA_ARGS__)
+
+#endif //__orxGCC__ || __orxLLVM__
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Static structure
+ */
+typedef struct __orxBENCH_STATIC_t
+{
+  orxDOUBLE dUpdateTime;
+  orxU32    u32FileNumber;
+  orxU32    u32RunNumber;
+  orxU32    u32TargetID;
+
+} orxBENCH_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** static data
+ */
+static orxBENCH_STATIC sstBench;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static const orxSTRING GetFileName(orxU32 _u32Index)
+{
+  static orxCHAR sacBuffer[64];
+
+  // Prints its name
+  orxString_NPrint(sacBuffer, sizeof(sacBuffer) - 1, "file%05u.txt", _u32Index);
+
+  // Done!
+  return sacBuffer;
+}
+
+static orxSTATUS WriteFile(orxU32 _u32Index, orxU32 _u32Version)
+{
+  orxCHAR   acPath[256];
+  orxFILE  *pstFile;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Gets its path
+  orxString_NPrint(acPath, sizeof(acPath) - 1, "%s/%s", orxBENCH_KZ_DIRECTORY, GetFileName(_u32Index));
+
+  // Opens it
+  pstFile = orxFile_Open(acPath, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  // Success?
+  if(pstFile != orxNULL)
+  {
+    struct utimbuf stTime;
+
+    // Writes content
+    orxFile_Print(pstFile, "version %u\n", _u32Version);
+    orxFile_Close(pstFile);
+
+    // Pushes its modification time forward, as file times only have a one second resolution
+    stTime.actime   = time(NULL);
+    stTime.modtime  = stTime.actime + (time_t)_u32Version;
+    if(utime(acPath, &stTime) == 0)
+    {
+      // Updates result
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void RemoveFiles()
+{
+  orxCHAR acPath[256];
+  orxU32  i;
+
+  // For all files
+  for(i = 0; i < sstBench.u32FileNumber; i++)
+  {
+    // Removes it
+    orxString_NPrint(acPath, sizeof(acPath) - 1, "%s/%s", orxBENCH_KZ_DIRECTORY, GetFileName(i));
+    orxFile_Remove(acPath);
+  }
+
+  // Removes directory
+  orxFile_Remove(orxBENCH_KZ_DIRECTORY);
+}
+
+static orxSTATUS orxFASTCALL EventHandler(const orxEVENT *_pstEvent)
+{
+  const orxRESOURCE_EVENT_PAYLOAD *pstPayload;
+
+  // Gets payload
+  pstPayload = (const orxRESOURCE_EVENT_PAYLOAD *)_pstEvent->pstPayload;
+
+  // Target update?
+  if((_pstEvent->eID == orxRESOURCE_EVENT_UPDATE) && (pstPayload->u32NameID == sstBench.u32TargetID))
+  {
+    // Stores its time
+    sstBench.dUpdateTime = orxSystem_GetTime();
+  }
+
+  // Done!
+  return orxSTATUS_SUCCESS;
+}
+
+static void RunFrame()
+{
+  orxDOUBLE dStart;
+  orxFLOAT  fDelay;
+
+  // Updates clocks (ie. the resource watcher)
+  dStart = orxSystem_GetTime();
+  orxClock_Update();
+
+  // Waits for the end of the frame
+  fDelay = orxBENCH_KF_FRAME_TIME - (orxFLOAT)(orxSystem_GetTime() - dStart);
+  if(fDelay > orxFLOAT_0)
+  {
+    orxSystem_Delay(fDelay);
+  }
+}
+
+static orxSTATUS orxFASTCALL ProcessCountParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Has a valid count?
+  if((_u32ParamCount > 1) && (orxString_ToU32(_azParams[1], &(sstBench.u32FileNumber), orxNULL) != orxSTATUS_FAILURE) && (sstBench.u32FileNumber > 0))
+  {
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Logs message
+    orxBENCH_LOG(PARAM, "Invalid file count.");
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessRunParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Has a valid count?
+  if((_u32ParamCount > 1) && (orxString_ToU32(_azParams[1], &(sstBench.u32RunNumber), orxNULL) != orxSTATUS_FAILURE) && (sstBench.u32RunNumber > 0))
+  {
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Logs message
+    orxBENCH_LOG(PARAM, "Invalid run count.");
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Setup()
+{
+  // Adds module dependencies
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_PARAM);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_FILE);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_CONFIG);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_CLOCK);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_RESOURCE);
+}
+
+static orxSTATUS orxFASTCALL Init()
+{
+#define orxBENCH_DECLARE_PARAM(SN, LN, SD, LD, FN) {orxPARAM_KU32_FLAG_STOP_ON_ERROR, SN, LN, SD, LD, &FN},
+
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxPARAM  astParamList[] =
+  {
+    orxBENCH_DECLARE_PARAM("n", "number", "File number", "Number of watched files, defaults to 200", ProcessCountParams)
+    orxBENCH_DECLARE_PARAM("r", "runs", "Run number", "Number of file modifications to measure, defaults to 5", ProcessRunParams)
+  };
+
+  // Clears static controller
+  orxMemory_Zero(&sstBench, sizeof(orxBENCH_STATIC));
+  sstBench.u32FileNumber  = orxBENCH_KU32_DEFAULT_FILE_NUMBER;
+  sstBench.u32RunNumber   = orxBENCH_KU32_DEFAULT_RUN_NUMBER;
+
+  // For all params
+  for(i = 0; (i < sizeof(astParamList) / sizeof(astParamList[0])) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    // Registers param
+    eResult = orxParam_Register(&astParamList[i]);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Exit()
+{
+}
+
+static void Run()
+{
+  const orxSTRING azWatchList[] = {orxBENCH_KZ_GROUP};
+  const orxSTRING azStorageList[] = {orxBENCH_KZ_DIRECTORY};
+  orxDOUBLE       dLatency = 0.0, dMaxLatency = 0.0;
+  clock_t         stCPU;
+  orxU32          i, u32Missed = 0;
+
+  // Creates files
+  orxFile_MakeDirectory(orxBENCH_KZ_DIRECTORY);
+  for(i = 0; i < sstBench.u32FileNumber; i++)
+  {
+    if(WriteFile(i, 0) == orxSTATUS_FAILURE)
+    {
+      // Logs message
+      orxBENCH_LOG(SETUP, "Couldn't write file #%u in [%s], aborting.", i, orxBENCH_KZ_DIRECTORY);
+      RemoveFiles();
+      return;
+    }
+  }
+
+  // Setups watched resource group
+  orxConfig_PushSection("Resource");
+  orxConfig_SetListString("WatchList", azWatchList, 1);
+  orxConfig_SetListString(orxBENCH_KZ_GROUP, azStorageList, 1);
+  orxConfig_PopSection();
+
+  // Caches all files (the second pass registers the watcher, once storages are loaded)
+  for(i = 0; i < sstBench.u32FileNumber; i++)
+  {
+    orxResource_Locate(orxBENCH_KZ_GROUP, GetFileName(i));
+  }
+  orxResource_Locate(orxBENCH_KZ_GROUP, GetFileName(0));
+
+  // Adds event handler
+  orxEvent_AddHandler(orxEVENT_TYPE_RESOURCE, EventHandler);
+
+  // Lets the watcher settle
+  for(i = 0; i < 60; i++)
+  {
+    RunFrame();
+  }
+
+  // Measures idle frames
+  stCPU = clock();
+  for(i = 0; i < orxBENCH_KU32_IDLE_FRAME_NUMBER; i++)
+  {
+    RunFrame();
+  }
+  stCPU = clock() - stCPU;
+
+  // For all runs
+  for(i = 0; i < sstBench.u32RunNumber; i++)
+  {
+    orxDOUBLE dStart;
+
+    // Picks a file
+    sstBench.u32TargetID  = orxString_ToCRC(GetFileName((i * 7919) % sstBench.u32FileNumber));
+    sstBench.dUpdateTime  = 0.0;
+
+    // Modifies it
+    WriteFile((i * 7919) % sstBench.u32FileNumber, i + 1);
+    dStart = orxSystem_GetTime();
+
+    // Waits for its update
+    while((sstBench.dUpdateTime == 0.0) && (orxSystem_GetTime() - dStart < orxBENCH_KF_TIMEOUT))
+    {
+      RunFrame();
+    }
+
+    // Updated?
+    if(sstBench.dUpdateTime != 0.0)
+    {
+      // Updates stats
+      dLatency   += sstBench.dUpdateTime - dStart;
+      dMaxLatency = orxMAX(dMaxLatency, sstBench.dUpdateTime - dStart);
+    }
+    else
+    {
+      // Updates stats
+      u32Missed++;
+    }
+  }
+
+  // Logs results
+  orxBENCH_LOG(RESULT, "%u files, idle CPU: %.3fms per frame", sstBench.u32FileNumber, 1000.0 * (orxDOUBLE)stCPU / ((orxDOUBLE)CLOCKS_PER_SEC * (orxDOUBLE)orxBENCH_KU32_IDLE_FRAME_NUMBER));
+  if(u32Missed < sstBench.u32RunNumber)
+  {
+    orxBENCH_LOG(RESULT, "%u files, update latency: %.3fs average, %.3fs max over %u runs", sstBench.u32FileNumber, dLatency / (orxDOUBLE)(sstBench.u32RunNumber - u32Missed), dMaxLatency, sstBench.u32RunNumber - u32Missed);
+  }
+  if(u32Missed != 0)
+  {
+    orxBENCH_LOG(RESULT, "%u/%u modifications weren't notified within %gs", u32Missed, sstBench.u32RunNumber, orxBENCH_KF_TIMEOUT);
+  }
+
+  // Removes event handler
+  orxEvent_RemoveHandler(orxEVENT_TYPE_RESOURCE, EventHandler);
+
+  // Cleans up
+  RemoveFiles();
+}
+
+int main(int argc, char **argv)
+{
+  // Inits the Debug System
+  orxDEBUG_INIT();
+
+  // Sets debug flags
+  orxDEBUG_SET_FLAGS(orxDEBUG_KU32_STATIC_FLAG_TIMESTAMP, orxDEBUG_KU32_STATIC_FLAG_FULL_TIMESTAMP | orxDEBUG_KU32_STATIC_FLAG_TYPE | orxDEBUG_KU32_STATIC_FLAG_TAGGED);
+
+  // Registers main module
+  orxModule_Register(orxMODULE_ID_MAIN, "MAIN", Setup, Init, Exit);
+
+  // Sends the command line arguments to orxParam module
+  if(orxParam_SetArgs(argc, argv) != orxSTATUS_FAILURE)
+  {
+    // Inits the engine
+    if(orxModule_Init(orxMODULE_ID_MAIN) != orxSTATUS_FAILURE)
+    {
+      // Runs
+      Run();
+
+      // Exits from engine
+      orxModule_Exit(orxMODULE_ID_MAIN);
+    }
+  }
+
+  // Exits from the Debug system
+  orxDEBUG_EXIT();
+
+  // Done!
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,776 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2017 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxPack.c
+ * @date 16/10/2026
+ * @author iarwain@orx-project.org
+ *
+ */
+
+
+#include "orx.h"
+
+#include <stdlib.h>
+
+
+/** Module flags
+ */
+#define orxPACK_KU32_STATIC_FLAG_NONE             0x00000000  /**< No flags */
+
+#define orxPACK_KU32_STATIC_FLAG_INPUT_LOADED     0x00000001  /**< Input loaded flag */
+#define orxPACK_KU32_STATIC_FLAG_USE_COMPRESSION  0x00000002  /**< Use compression flag */
+
+#define orxPACK_KU32_STATIC_MASK_ALL              0xFFFFFFFF  /**< All mask */
+
+
+/** Defines
+ */
+#define orxPACK_KZ_DEFAULT_OUTPUT                 "orxpack.pack"
+
+#define orxPACK_KZ_LOG_TAG_LENGTH                 "10"
+
+#define orxPACK_KU32_ENTRY_BANK_SIZE              256
+
+#define orxPACK_KU32_HASH_BITS                    14
+#define orxPACK_KU32_MIN_MATCH                    4
+#define orxPACK_KU32_MAX_OFFSET                   0xFFFF
+#define orxPACK_KU32_LAST_LITERALS                5           /**< LZ4 block rule: the last 5 bytes are always literals */
+#define orxPACK_KU32_MATCH_LIMIT                  12          /**< LZ4 block rule: the last match starts at least 12 bytes before the end */
+
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+
+  #define orxPACK_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxPACK_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", ##__VA_ARGS__)
+
+#else // __orxGCC__ || __orxLLVM__
+
+  #define orxPACK_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxPACK_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", __VA_ARGS__)
+
+#endif //__orxGCC__ || __orxLLVM__
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Entry structure
+ */
+typedef struct __orxPACK_ENTRY_t
+{
+  orxSTRING   zName;
+  orxSTRING   zFileName;
+  orxU32      u32NameCRC;
+  orxU32      u32Index;
+
+} orxPACK_ENTRY;
+
+/** Static structure
+ */
+typedef struct __orxPACK_STATIC_t
+{
+  orxPACK_ENTRY  *astEntryList;
+  orxSTRING       zOutputFile;
+  orxU32          u32EntryCount;
+  orxU32          u32EntrySize;
+  orxU32          u32Flags;
+
+} orxPACK_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** static data
+ */
+static orxPACK_STATIC sstPack;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static int SortEntries(const void *_pEntry1, const void *_pEntry2)
+{
+  const orxPACK_ENTRY *pstEntry1, *pstEntry2;
+  int                  iResult;
+
+  // Gets entries
+  pstEntry1 = (const orxPACK_ENTRY *)_pEntry1;
+  pstEntry2 = (const orxPACK_ENTRY *)_pEntry2;
+
+  // Sorts by CRC first (runtime lookup order), then by name and input order, so that duplicates are next to each other
+  iResult = (pstEntry1->u32NameCRC < pstEntry2->u32NameCRC) ? -1 : (pstEntry1->u32NameCRC > pstEntry2->u32NameCRC) ? 1 : orxString_Compare(pstEntry1->zName, pstEntry2->zName);
+  if(iResult == 0)
+  {
+    iResult = (pstEntry1->u32Index < pstEntry2->u32Index) ? -1 : 1;
+  }
+
+  // Done!
+  return iResult;
+}
+
+static orxSTATUS orxFASTCALL AddEntry(const orxSTRING _zName, const orxSTRING _zFileName)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Entry names can't contain location separators
+  if(orxString_SearchChar(_zName, orxRESOURCE_KC_LOCATION_SEPARATOR) == orxNULL)
+  {
+    orxPACK_ENTRY *pstEntry;
+    orxCHAR       *pc;
+
+    // Needs to grow list?
+    if(sstPack.u32EntryCount == sstPack.u32EntrySize)
+    {
+      // Grows it
+      sstPack.u32EntrySize += orxPACK_KU32_ENTRY_BANK_SIZE;
+      sstPack.astEntryList  = (orxPACK_ENTRY *)orxMemory_Reallocate(sstPack.astEntryList, sstPack.u32EntrySize * sizeof(orxPACK_ENTRY));
+
+      // Checks
+      orxASSERT(sstPack.astEntryList);
+    }
+
+    // Inits entry
+    pstEntry            = &sstPack.astEntryList[sstPack.u32EntryCount];
+    pstEntry->zName     = orxString_Duplicate(_zName);
+    pstEntry->zFileName = orxString_Duplicate(_zFileName);
+    pstEntry->u32Index  = sstPack.u32EntryCount++;
+
+    // Uses linux separators, as resource names do
+    for(pc = pstEntry->zName; *pc != orxCHAR_NULL; pc++)
+    {
+      if(*pc == orxCHAR_DIRECTORY_SEPARATOR_WINDOWS)
+      {
+        *pc = orxCHAR_DIRECTORY_SEPARATOR_LINUX;
+      }
+    }
+
+    // Gets its CRC
+    pstEntry->u32NameCRC = orxString_ToCRC(pstEntry->zName);
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Logs message
+    orxPACK_LOG(INPUT, "Skipping [%s]: names can't contain '%c'", _zName, orxRESOURCE_KC_LOCATION_SEPARATOR);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL AddDirectory(const orxSTRING _zRoot, const orxSTRING _zPath)
+{
+  orxFILE_INFO  stInfo;
+  orxCHAR       acBuffer[1280];
+
+  // Starts search
+  orxString_NPrint(acBuffer, sizeof(acBuffer) - 1, "%s%s%c*", _zRoot, _zPath, orxCHAR_DIRECTORY_SEPARATOR_LINUX);
+  if(orxFile_FindFirst(acBuffer, &stInfo) != orxSTATUS_FAILURE)
+  {
+    do
+    {
+      // Not hidden or special?
+      if(stInfo.zName[0] != '.')
+      {
+        orxCHAR acPath[1280];
+
+        // Gets path, relative to root
+        orxString_NPrint(acPath, sizeof(acPath) - 1, "%s%c%s", _zPath, orxCHAR_DIRECTORY_SEPARATOR_LINUX, stInfo.zName);
+
+        // Directory?
+        if(orxFLAG_TEST(stInfo.u32Flags, orxFILE_KU32_FLAG_INFO_DIRECTORY))
+        {
+          // Recurses
+          AddDirectory(_zRoot, acPath);
+        }
+        else
+        {
+          // Adds it, skipping the leading separator for its name
+          AddEntry(acPath + 1, stInfo.zFullName);
+        }
+      }
+    } while(orxFile_FindNext(&stInfo) != orxSTATUS_FAILURE);
+
+    // Ends search
+    orxFile_FindClose(&stInfo);
+  }
+}
+
+static orxU32 orxFASTCALL Compress(const orxU8 *_pu8Source, orxU32 _u32Size, orxU8 *_pu8Destination, orxU32 _u32Capacity)
+{
+  static orxU32   su32HashTable[1 << orxPACK_KU32_HASH_BITS];
+  const orxU8    *pu8Anchor, *pu8Input, *pu8End;
+  orxU8          *pu8Output, *pu8OutputEnd;
+
+  // Clears hash table
+  orxMemory_Zero(su32HashTable, sizeof(su32HashTable));
+
+  // Inits
+  pu8Anchor     = pu8Input = _pu8Source;
+  pu8End        = _pu8Source + _u32Size;
+  pu8Output     = _pu8Destination;
+  pu8OutputEnd  = _pu8Destination + _u32Capacity;
+
+  // Can have matches?
+  if(_u32Size > orxPACK_KU32_MATCH_LIMIT)
+  {
+    const orxU8 *pu8MatchLimit, *pu8MatchEnd;
+
+    // Gets limits
+    pu8MatchLimit = pu8End - orxPACK_KU32_MATCH_LIMIT;
+    pu8MatchEnd   = pu8End - orxPACK_KU32_LAST_LITERALS;
+
+    // Greedy parsing
+    while(pu8Input < pu8MatchLimit)
+    {
+      orxU32 u32Sequence, u32Hash, u32Reference;
+
+      // Gets sequence & its hash
+      orxMemory_Copy(&u32Sequence, pu8Input, sizeof(orxU32));
+      u32Hash = (u32Sequence * 2654435761U) >> (32 - orxPACK_KU32_HASH_BITS);
+
+      // Gets previous position (stored + 1, 0 being empty) & updates it
+      u32Reference            = su32HashTable[u32Hash];
+      su32HashTable[u32Hash]  = (orxU32)(pu8Input - _pu8Source) + 1;
+
+      // Match?
+      if((u32Reference != 0)
+      && ((orxU32)(pu8Input - _pu8Source) + 1 - u32Reference <= orxPACK_KU32_MAX_OFFSET)
+      && (orxMemory_Compare(_pu8Source + u32Reference - 1, pu8Input, orxPACK_KU32_MIN_MATCH) == 0))
+      {
+        const orxU8  *pu8Match;
+        orxU32        u32LiteralLength, u32MatchLength, u32Offset;
+
+        // Gets match
+        pu8Match  = _pu8Source + u32Reference - 1;
+        u32Offset = (orxU32)(pu8Input - pu8Match);
+
+        // Extends it
+        for(u32MatchLength = orxPACK_KU32_MIN_MATCH; (pu8Input + u32MatchLength < pu8MatchEnd) && (pu8Match[u32MatchLength] == pu8Input[u32MatchLength]); u32MatchLength++);
+
+        // Gets literal length
+        u32LiteralLength = (orxU32)(pu8Input - pu8Anchor);
+
+        // Not enough space?
+        if((orxU32)(pu8OutputEnd - pu8Output) < 1 + u32LiteralLength + (u32LiteralLength / 255) + 1 + 2 + ((u32MatchLength - orxPACK_KU32_MIN_MATCH) / 255) + 1)
+        {
+          // Gives up
+          return 0;
+        }
+
+        // Writes token
+        *pu8Output++ = (orxU8)((orxMIN(u32LiteralLength, 15) << 4) | orxMIN(u32MatchLength - orxPACK_KU32_MIN_MATCH, 15));
+
+        // Writes literal length
+        if(u32LiteralLength >= 15)
+        {
+          orxU32 u32Length;
+
+          for(u32Length = u32LiteralLength - 15; u32Length >= 255; u32Length -= 255)
+          {
+            *pu8Output++ = 255;
+          }
+          *pu8Output++ = (orxU8)u32Length;
+        }
+
+        // Writes literals
+        orxMemory_Copy(pu8Output, pu8Anchor, u32LiteralLength);
+        pu8Output += u32LiteralLength;
+
+        // Writes offset
+        *pu8Output++ = (orxU8)(u32Offset & 0xFF);
+        *pu8Output++ = (orxU8)(u32Offset >> 8);
+
+        // Writes match length
+        if(u32MatchLength - orxPACK_KU32_MIN_MATCH >= 15)
+        {
+          orxU32 u32Length;
+
+          for(u32Length = u32MatchLength - orxPACK_KU32_MIN_MATCH - 15; u32Length >= 255; u32Length -= 255)
+          {
+            *pu8Output++ = 255;
+          }
+          *pu8Output++ = (orxU8)u32Length;
+        }
+
+        // Skips match
+        pu8Input += u32MatchLength;
+        pu8Anchor = pu8Input;
+      }
+      else
+      {
+        // Next byte
+        pu8Input++;
+      }
+    }
+  }
+
+  // Writes last literals
+  {
+    orxU32 u32LiteralLength;
+
+    // Gets literal length
+    u32LiteralLength = (orxU32)(pu8End - pu8Anchor);
+
+    // Not enough space?
+    if((orxU32)(pu8OutputEnd - pu8Output) < 1 + u32LiteralLength + (u32LiteralLength / 255) + 1)
+    {
+      // Gives up
+      return 0;
+    }
+
+    // Writes token
+    *pu8Output++ = (orxU8)(orxMIN(u32LiteralLength, 15) << 4);
+
+    // Writes literal length
+    if(u32LiteralLength >= 15)
+    {
+      orxU32 u32Length;
+
+      for(u32Length = u32LiteralLength - 15; u32Length >= 255; u32Length -= 255)
+      {
+        *pu8Output++ = 255;
+      }
+      *pu8Output++ = (orxU8)u32Length;
+    }
+
+    // Writes literals
+    orxMemory_Copy(pu8Output, pu8Anchor, u32LiteralLength);
+    pu8Output += u32LiteralLength;
+  }
+
+  // Done!
+  return (orxU32)(pu8Output - _pu8Destination);
+}
+
+static orxSTATUS orxFASTCALL ProcessInputParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Has a valid input parameter?
+  if(_u32ParamCount > 1)
+  {
+    orxU32 i;
+
+    // For all inputs
+    for(i = 1; i < _u32ParamCount; i++)
+    {
+      orxFILE_INFO stInfo;
+
+      // Gets its info
+      if(orxFile_GetInfo(_azParams[i], &stInfo) != orxSTATUS_FAILURE)
+      {
+        orxU32 u32Count;
+
+        // Stores current count
+        u32Count = sstPack.u32EntryCount;
+
+        // Directory?
+        if(orxFLAG_TEST(stInfo.u32Flags, orxFILE_KU32_FLAG_INFO_DIRECTORY))
+        {
+          // Adds its content, named relatively to it
+          AddDirectory(_azParams[i], orxSTRING_EMPTY);
+        }
+        else
+        {
+          // Adds it, using its path as name
+          AddEntry(_azParams[i], _azParams[i]);
+        }
+
+        // Logs message
+        orxPACK_LOG(LOAD, "%3u: %-24.24s SUCCESS (%u file(s))", i, _azParams[i], sstPack.u32EntryCount - u32Count);
+      }
+      else
+      {
+        // Logs message
+        orxPACK_LOG(LOAD, "%3u: %-24.24s FAILURE, aborting.", i, _azParams[i]);
+        break;
+      }
+    }
+
+    // Success?
+    if((i == _u32ParamCount) && (sstPack.u32EntryCount > 0))
+    {
+      // Updates status
+      orxFLAG_SET(sstPack.u32Flags, orxPACK_KU32_STATIC_FLAG_INPUT_LOADED, orxPACK_KU32_STATIC_FLAG_NONE);
+
+      // Updates result
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+  else
+  {
+    // Logs message
+    orxPACK_LOG(INPUT, "No valid file list found, aborting");
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessOutputParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Has a valid output parameter?
+  if(_u32ParamCount > 1)
+  {
+    // Stores it
+    sstPack.zOutputFile = orxString_Duplicate(_azParams[1]);
+  }
+  else
+  {
+    // Logs message
+    orxPACK_LOG(OUTPUT, "No valid output found, using default");
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessCompressParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Updates status
+  orxFLAG_SET(sstPack.u32Flags, orxPACK_KU32_STATIC_FLAG_USE_COMPRESSION, orxPACK_KU32_STATIC_FLAG_NONE);
+
+  // Done!
+  return orxSTATUS_SUCCESS;
+}
+
+static void orxFASTCALL Setup()
+{
+  // Adds module dependencies
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_PARAM);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_FILE);
+}
+
+static orxSTATUS orxFASTCALL Init()
+{
+#define orxPACK_DECLARE_PARAM(SN, LN, SD, LD, FN) {orxPARAM_KU32_FLAG_STOP_ON_ERROR, SN, LN, SD, LD, &FN},
+
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxPARAM  astParamList[] =
+  {
+    orxPACK_DECLARE_PARAM("f", "filelist", "Input file list", "List of files and directories to pack; files are named after their path, directory content is named relatively to the directory", ProcessInputParams)
+    orxPACK_DECLARE_PARAM("o", "output", "Output file", "Archive file to create, to be used as a resource storage", ProcessOutputParams)
+    orxPACK_DECLARE_PARAM("z", "compress", "Compress mode", "If this switch is provided, entries will be LZ4-compressed whenever it saves space, otherwise they'll be stored as-is, by default", ProcessCompressParams)
+  };
+
+  // Clears static controller
+  orxMemory_Zero(&sstPack, sizeof(orxPACK_STATIC));
+
+  // For all params
+  for(i = 0; (i < sizeof(astParamList) / sizeof(astParamList[0])) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    // Registers param
+    eResult = orxParam_Register(&astParamList[i]);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Exit()
+{
+  orxU32 i;
+
+  // For all entries
+  for(i = 0; i < sstPack.u32EntryCount; i++)
+  {
+    // Frees its strings
+    orxString_Delete(sstPack.astEntryList[i].zName);
+    orxString_Delete(sstPack.astEntryList[i].zFileName);
+  }
+
+  // Has entry list?
+  if(sstPack.astEntryList)
+  {
+    // Frees it
+    orxMemory_Free(sstPack.astEntryList);
+  }
+
+  // Has output file?
+  if(sstPack.zOutputFile)
+  {
+    // Frees its string
+    orxString_Delete(sstPack.zOutputFile);
+  }
+}
+
+static orxSTATUS orxFASTCALL Save(const orxSTRING _zOutputFile)
+{
+  orxRESOURCE_PACK_HEADER stHeader;
+  orxRESOURCE_PACK_ENTRY *astEntryList;
+  orxFILE                *pstFile;
+  orxU32                  i, u32Count, u32StoredSize = 0, u32TotalSize = 0;
+  orxS64                  s64Offset;
+  orxSTATUS               eResult = orxSTATUS_FAILURE;
+
+  // Sorts entries
+  qsort(sstPack.astEntryList, sstPack.u32EntryCount, sizeof(orxPACK_ENTRY), &SortEntries);
+
+  // Removes duplicates, keeping the first provided one
+  for(i = 1, u32Count = 1; i < sstPack.u32EntryCount; i++)
+  {
+    // Duplicate?
+    if((sstPack.astEntryList[i].u32NameCRC == sstPack.astEntryList[u32Count - 1].u32NameCRC)
+    && (orxString_Compare(sstPack.astEntryList[i].zName, sstPack.astEntryList[u32Count - 1].zName) == 0))
+    {
+      // Logs message
+      orxPACK_LOG(INPUT, "Skipping [%s]: already provided by [%s]", sstPack.astEntryList[i].zFileName, sstPack.astEntryList[u32Count - 1].zFileName);
+
+      // Deletes it
+      orxString_Delete(sstPack.astEntryList[i].zName);
+      orxString_Delete(sstPack.astEntryList[i].zFileName);
+    }
+    else
+    {
+      // Keeps it
+      sstPack.astEntryList[u32Count++] = sstPack.astEntryList[i];
+    }
+  }
+  sstPack.u32EntryCount = u32Count;
+
+  // Inits header
+  orxMemory_Zero(&stHeader, sizeof(orxRESOURCE_PACK_HEADER));
+  stHeader.u32Magic       = orxRESOURCE_KU32_PACK_MAGIC;
+  stHeader.u32Version     = orxRESOURCE_KU32_PACK_VERSION;
+  stHeader.u32EntryCount  = sstPack.u32EntryCount;
+
+  // Allocates entry list
+  astEntryList = (orxRESOURCE_PACK_ENTRY *)orxMemory_Allocate(sstPack.u32EntryCount * sizeof(orxRESOURCE_PACK_ENTRY), orxMEMORY_TYPE_TEMP);
+  orxASSERT(astEntryList);
+  orxMemory_Zero(astEntryList, sstPack.u32EntryCount * sizeof(orxRESOURCE_PACK_ENTRY));
+
+  // For all entries
+  for(i = 0; i < sstPack.u32EntryCount; i++)
+  {
+    // Stores name
+    astEntryList[i].u32NameCRC    = sstPack.astEntryList[i].u32NameCRC;
+    astEntryList[i].u32NameOffset = stHeader.u32NameSize;
+    stHeader.u32NameSize         += orxString_GetLength(sstPack.astEntryList[i].zName) + 1;
+  }
+
+  // Opens output
+  pstFile = orxFile_Open(_zOutputFile, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  // Success?
+  if(pstFile)
+  {
+    // Writes header, entry list (updated once all data has been written) & names
+    orxFile_Write(&stHeader, sizeof(orxRESOURCE_PACK_HEADER), 1, pstFile);
+    orxFile_Write(astEntryList, sizeof(orxRESOURCE_PACK_ENTRY), sstPack.u32EntryCount, pstFile);
+    for(i = 0; i < sstPack.u32EntryCount; i++)
+    {
+      orxFile_Write(sstPack.astEntryList[i].zName, sizeof(orxCHAR), orxString_GetLength(sstPack.astEntryList[i].zName) + 1, pstFile);
+    }
+    s64Offset = sizeof(orxRESOURCE_PACK_HEADER) + sstPack.u32EntryCount * sizeof(orxRESOURCE_PACK_ENTRY) + stHeader.u32NameSize;
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+
+    // For all entries
+    for(i = 0; (eResult != orxSTATUS_FAILURE) && (i < sstPack.u32EntryCount); i++)
+    {
+      orxFILE *pstInput;
+
+      // Updates result
+      eResult = orxSTATUS_FAILURE;
+
+      // Opens input
+      pstInput = orxFile_Open(sstPack.astEntryList[i].zFileName, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+      // Success?
+      if(pstInput)
+      {
+        orxU8  *pu8Buffer;
+        orxS64  s64Size;
+
+        // Gets its size
+        s64Size = orxFile_GetSize(pstInput);
+
+        // Allocates buffer, with room for compressed data
+        pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)(2 * s64Size + 1), orxMEMORY_TYPE_TEMP);
+        orxASSERT(pu8Buffer);
+
+        // Reads it
+        if((s64Size < 0xFFFFFFFF) && (orxFile_Read(pu8Buffer, sizeof(orxU8), s64Size, pstInput) == s64Size))
+        {
+          const orxU8  *pu8Data = pu8Buffer;
+          orxU32        u32Size;
+          orxU8         au8Padding[orxRESOURCE_KU32_PACK_DATA_ALIGNMENT] = {0};
+
+          // Inits entry
+          astEntryList[i].u32Size = (orxU32)s64Size;
+          u32Size                 = (orxU32)s64Size;
+
+          // Should compress?
+          if(orxFLAG_TEST(sstPack.u32Flags, orxPACK_KU32_STATIC_FLAG_USE_COMPRESSION))
+          {
+            orxU32 u32CompressedSize;
+
+            // Compresses it, only keeping it if it saves at least 1/16th
+            u32CompressedSize = Compress(pu8Buffer, (orxU32)s64Size, pu8Buffer + s64Size, (orxU32)s64Size - ((orxU32)s64Size >> 4));
+
+            // Success?
+            if(u32CompressedSize != 0)
+            {
+              // Uses compressed data
+              pu8Data                   = pu8Buffer + s64Size;
+              u32Size                   = u32CompressedSize;
+              astEntryList[i].u32Flags  = orxRESOURCE_KU32_PACK_ENTRY_FLAG_COMPRESSED;
+            }
+          }
+
+          // Aligns data
+          orxFile_Write(au8Padding, sizeof(orxU8), orxALIGN(s64Offset, orxRESOURCE_KU32_PACK_DATA_ALIGNMENT) - s64Offset, pstFile);
+          s64Offset = orxALIGN(s64Offset, orxRESOURCE_KU32_PACK_DATA_ALIGNMENT);
+
+          // Writes it
+          if(orxFile_Write(pu8Data, sizeof(orxU8), u32Size, pstFile) == u32Size)
+          {
+            // Updates entry
+            astEntryList[i].u64Offset     = (orxU64)s64Offset;
+            astEntryList[i].u32StoredSize = u32Size;
+            s64Offset                    += u32Size;
+
+            // Updates stats
+            u32TotalSize  += astEntryList[i].u32Size;
+            u32StoredSize += u32Size;
+
+            // Updates result
+            eResult = orxSTATUS_SUCCESS;
+          }
+        }
+
+        // Frees buffer
+        orxMemory_Free(pu8Buffer);
+
+        // Closes input
+        orxFile_Close(pstInput);
+      }
+
+      // Failure?
+      if(eResult == orxSTATUS_FAILURE)
+      {
+        // Logs message
+        orxPACK_LOG(SAVE, "Couldn't pack [%s], aborting.", sstPack.astEntryList[i].zFileName);
+      }
+    }
+
+    // Success?
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      // Rewrites header & final entry list
+      orxFile_Seek(pstFile, 0, orxSEEK_OFFSET_WHENCE_START);
+      orxFile_Write(&stHeader, sizeof(orxRESOURCE_PACK_HEADER), 1, pstFile);
+      orxFile_Write(astEntryList, sizeof(orxRESOURCE_PACK_ENTRY), sstPack.u32EntryCount, pstFile);
+
+      // Logs message
+      orxPACK_LOG(SAVE, "%u entries, %u bytes stored for %u bytes of data", sstPack.u32EntryCount, u32StoredSize, u32TotalSize);
+    }
+
+    // Closes output
+    orxFile_Close(pstFile);
+
+    // Failure?
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      // Removes partial output
+      orxFile_Remove(_zOutputFile);
+    }
+  }
+
+  // Frees entry list
+  orxMemory_Free(astEntryList);
+
+  // Done!
+  return eResult;
+}
+
+static void Run()
+{
+  // Has loaded input?
+  if(orxFLAG_TEST(sstPack.u32Flags, orxPACK_KU32_STATIC_FLAG_INPUT_LOADED))
+  {
+    const orxSTRING zOutputFile;
+
+    // Selects correct output file
+    zOutputFile = (sstPack.zOutputFile) ? sstPack.zOutputFile : orxPACK_KZ_DEFAULT_OUTPUT;
+
+    // Saves archive
+    if(Save(zOutputFile) != orxSTATUS_FAILURE)
+    {
+      // Logs message
+      orxPACK_LOG(SAVE, "==== %-24.24s SUCCESS%s", zOutputFile, orxFLAG_TEST(sstPack.u32Flags, orxPACK_KU32_STATIC_FLAG_USE_COMPRESSION) ? " (COMPRESSED)" : orxSTRING_EMPTY);
+    }
+    else
+    {
+      // Logs message
+      orxPACK_LOG(SAVE, "==== %-24.24s FAILURE, aborting.", zOutputFile);
+    }
+  }
+  else
+  {
+    // Logs message
+    orxPACK_LOG(PROCESS, "No loaded files, can't process.");
+  }
+}
+
+int main(int argc, char **argv)
+{
+  // Inits the Debug System
+  orxDEBUG_INIT();
+
+  // Sets debug flags
+  orxDEBUG_SET_FLAGS(orxDEBUG_KU32_STATIC_FLAG_TIMESTAMP, orxDEBUG_KU32_STATIC_FLAG_FULL_TIMESTAMP | orxDEBUG_KU32_STATIC_FLAG_TYPE | orxDEBUG_KU32_STATIC_FLAG_TAGGED);
+
+  // Registers main module
+  orxModule_Register(orxMODULE_ID_MAIN, "MAIN", Setup, Init, Exit);
+
+  // Sends the command line arguments to orxParam module
+  if(orxParam_SetArgs(argc, argv) != orxSTATUS_FAILURE)
+  {
+    // Inits the engine
+    if(orxModule_Init(orxMODULE_ID_MAIN) != orxSTATUS_FAILURE)
+    {
+      // Runs
+      Run();
+
+      // Exits from engine
+      orxModule_Exit(orxMODULE_ID_MAIN);
+    }
+  }
+
+  // Exits from the Debug system
+  orxDEBUG_EXIT();
+
+  // Done!
+  return EXIT_SUCCESS;
+}